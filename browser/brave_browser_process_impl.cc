@@ -419,10 +419,12 @@ p3a::P3AService* BraveBrowserProcessImpl::p3a_service() {
   if (p3a_service_) {
     return p3a_service_.get();
   }
+  base::FilePath user_data_dir;
+  base::PathService::Get(chrome::DIR_USER_DATA, &user_data_dir);
   p3a_service_ = base::MakeRefCounted<p3a::P3AService>(
       *local_state(), brave::GetChannelName(),
       local_state()->GetString(kWeekOfInstallation),
-      p3a::P3AConfig::LoadFromCommandLine());
+      p3a::P3AConfig::LoadFromCommandLine(), user_data_dir);
   p3a_service()->InitCallbacks();
   return p3a_service_.get();
 #else
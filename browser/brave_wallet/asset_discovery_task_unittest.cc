@@ -8,6 +8,7 @@
 #include "base/base64.h"
 #include "base/json/json_reader.h"
 #include "base/memory/raw_ptr.h"
+#include "base/strings/string_util.h"
 #include "base/test/bind.h"
 #include "base/test/scoped_feature_list.h"
 #include "base/time/time.h"
@@ -30,6 +31,7 @@
 #include "chrome/test/base/scoped_testing_local_state.h"
 #include "chrome/test/base/testing_browser_process.h"
 #include "chrome/test/base/testing_profile.h"
+#include "components/prefs/pref_change_registrar.h"
 #include "components/prefs/pref_service.h"
 #include "components/prefs/scoped_user_pref_update.h"
 #include "components/sync_preferences/testing_pref_service_syncable.h"
@@ -322,8 +324,10 @@ class AssetDiscoveryTaskUnitTest : public testing::Test {
     asset_discovery_task_->DiscoverERC20sFromRegistry(
         chain_ids, account_addresses,
         base::BindLambdaForTesting(
-            [&](const std::vector<mojom::BlockchainTokenPtr>
-                    discovered_assets) {
+            [&](std::vector<mojom::BlockchainTokenPtr> tokens) {
+              // Assets are only added to prefs once discovery is complete.
+              auto discovered_assets = BraveWalletService::AddUserAssets(
+                  std::move(tokens), GetPrefs());
               for (size_t i = 0; i < discovered_assets.size(); i++) {
                 EXPECT_EQ(discovered_assets[i]->contract_address,
                           expected_token_contract_addresses[i]);
@@ -340,8 +344,9 @@ class AssetDiscoveryTaskUnitTest : public testing::Test {
     asset_discovery_task_->DiscoverSPLTokensFromRegistry(
         account_addresses,
         base::BindLambdaForTesting(
-            [&](const std::vector<mojom::BlockchainTokenPtr>
-                    discovered_assets) {
+            [&](std::vector<mojom::BlockchainTokenPtr> tokens) {
+              auto discovered_assets = BraveWalletService::AddUserAssets(
+                  std::move(tokens), GetPrefs());
               for (size_t i = 0; i < discovered_assets.size(); i++) {
                 EXPECT_EQ(discovered_assets[i]->contract_address,
                           expected_token_contract_addresses[i]);
@@ -376,7 +381,9 @@ class AssetDiscoveryTaskUnitTest : public testing::Test {
     asset_discovery_task_->DiscoverNFTs(
         chain_ids, addresses,
         base::BindLambdaForTesting(
-            [&](std::vector<mojom::BlockchainTokenPtr> discovered_assets) {
+            [&](std::vector<mojom::BlockchainTokenPtr> tokens) {
+              auto discovered_assets = BraveWalletService::AddUserAssets(
+                  std::move(tokens), GetPrefs());
               for (size_t i = 0; i < discovered_assets.size(); i++) {
                 EXPECT_EQ(discovered_assets[i]->contract_address,
                           expected_token_contract_addresses[i]);
@@ -1791,4 +1798,61 @@ TEST_F(AssetDiscoveryTaskUnitTest, DiscoverAssets) {
   TestDiscoverAssets({}, {});
 }
 
+TEST_F(AssetDiscoveryTaskUnitTest, DiscoverAssetsWithManyAccounts) {
+  wallet_service_->SetNftDiscoveryEnabled(true);
+
+  // More accounts than requests allowed in flight, the first one listed twice.
+  std::vector<std::string> eth_addresses;
+  for (char c = '0'; c <= '9'; c++) {
+    eth_addresses.push_back("0x" + std::string(39, 'a') + c);
+  }
+  eth_addresses.push_back("0x" +
+                          base::ToUpperASCII(eth_addresses[0].substr(2)));
+
+  // Every account owns the same NFT.
+  size_t request_count = 0;
+  url_loader_factory_.SetInterceptor(base::BindLambdaForTesting(
+      [&](const network::ResourceRequest& request) {
+        request_count++;
+        url_loader_factory_.ClearResponses();
+        url_loader_factory_.AddResponse(request.url.spec(), R"({
+          "next": null,
+          "nfts": [
+            {
+              "chain": "ethereum",
+              "contract_address": "0x4E1f41613c9084FdB9E34E11fAE9412427480e56",
+              "token_id": "8635",
+              "contract": {
+                "type": "ERC721",
+                "symbol": "TERRAFORMS"
+              },
+              "collection": {
+                "spam_score": 0
+              }
+            }
+          ]
+        })");
+      }));
+
+  size_t pref_change_count = 0;
+  PrefChangeRegistrar registrar;
+  registrar.Init(GetPrefs());
+  registrar.Add(kBraveWalletUserAssets,
+                base::BindLambdaForTesting([&]() { pref_change_count++; }));
+
+  base::RunLoop run_loop;
+  asset_discovery_task_->DiscoverAssets(
+      {}, {{mojom::CoinType::ETH, {mojom::kMainnetChainId}}},
+      {{mojom::CoinType::ETH, eth_addresses}},
+      base::BindLambdaForTesting([&]() {
+        wallet_service_observer_->WaitForOnDiscoverAssetsCompleted(
+            {"0x4E1f41613c9084FdB9E34E11fAE9412427480e56"});
+        run_loop.Quit();
+      }));
+  run_loop.Run();
+
+  EXPECT_EQ(request_count, 10u);
+  EXPECT_EQ(pref_change_count, 1u);
+}
+
 }  // namespace brave_wallet
@@ -81,7 +81,7 @@ KeyedService* BitcoinWalletServiceFactory::BuildServiceInstanceFor(
       default_storage_partition->GetURLLoaderFactoryForBrowserProcess();
   return new BitcoinWalletService(
       KeyringServiceFactory::GetServiceForContext(context),
-      shared_url_loader_factory);
+      shared_url_loader_factory, context->GetPath());
 }
 
 content::BrowserContext* BitcoinWalletServiceFactory::GetBrowserContextToUse(
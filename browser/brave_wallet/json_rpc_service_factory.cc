@@ -70,9 +70,11 @@ KeyedService* JsonRpcServiceFactory::BuildServiceInstanceFor(
   auto* default_storage_partition = context->GetDefaultStoragePartition();
   auto shared_url_loader_factory =
       default_storage_partition->GetURLLoaderFactoryForBrowserProcess();
-  return new JsonRpcService(shared_url_loader_factory,
-                            user_prefs::UserPrefs::Get(context),
-                            g_browser_process->local_state());
+  auto* json_rpc_service = new JsonRpcService(
+      shared_url_loader_factory, user_prefs::UserPrefs::Get(context),
+      g_browser_process->local_state());
+  json_rpc_service->EnableNftMetadataCache(context->GetPath());
+  return json_rpc_service;
 }
 
 content::BrowserContext* JsonRpcServiceFactory::GetBrowserContextToUse(
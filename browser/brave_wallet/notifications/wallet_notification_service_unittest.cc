@@ -40,8 +40,10 @@ class WalletNotificationServiceUnitTest : public testing::Test {
         std::make_unique<JsonRpcService>(shared_url_loader_factory_, prefs());
     keyring_service_ = std::make_unique<KeyringService>(json_rpc_service_.get(),
                                                         prefs(), local_state());
-    tx_service_ = std::make_unique<TxService>(json_rpc_service_.get(), nullptr,
-                                              keyring_service_.get(), prefs());
+    tx_service_ =
+        std::make_unique<TxService>(json_rpc_service_.get(), nullptr,
+                                    keyring_service_.get(), prefs(),
+                                    /*wallet_base_directory=*/base::FilePath());
     notification_service_ =
         std::make_unique<WalletNotificationService>(profile());
     tester_ = std::make_unique<NotificationDisplayServiceTester>(profile());
@@ -57,7 +57,8 @@ class NTPP3AHelperImplTest : public testing::Test {
     config.p2a_json_upload_url = GURL(kTestP2AJsonHost);
     config.p3a_creative_upload_url = GURL(kTestP3ACreativeHost);
     p3a_service_ = scoped_refptr(new p3a::P3AService(
-        local_state_, "release", "2049-01-01", std::move(config)));
+        local_state_, "release", "2049-01-01", std::move(config),
+        base::FilePath()));
 
     ntp_p3a_helper_ = std::make_unique<NTPP3AHelperImpl>(
         &local_state_, p3a_service_.get(), &ads_service_mock_);
@@ -68,6 +68,9 @@ void BraveUptimeTracker::RecordUsage() {
   const base::TimeDelta interval = new_total - current_total_usage_;
   if (interval > base::TimeDelta()) {
     state_.AddDelta(interval.InSeconds());
+    // The tracker is never destroyed, so a delayed write could be lost on
+    // shutdown. Usage is only recorded once a minute, write it right away.
+    state_.Flush();
     current_total_usage_ = new_total;
 
     RecordP3A();
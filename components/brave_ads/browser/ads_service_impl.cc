@@ -12,6 +12,7 @@
 #include "base/containers/circular_deque.h"
 #include "base/containers/flat_map.h"
 #include "base/feature_list.h"
+#include "base/files/file.h"
 #include "base/files/file_util.h"
 #include "base/files/important_file_writer.h"
 #include "base/functional/bind.h"
@@ -19,8 +20,10 @@
 #include "base/logging.h"
 #include "base/notreached.h"
 #include "base/ranges/algorithm.h"
+#include "base/strings/strcat.h"
 #include "base/strings/string_util.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/task/bind_post_task.h"
 #include "base/task/sequenced_task_runner.h"
 #include "base/task/thread_pool.h"
 #include "base/time/time.h"
@@ -42,7 +45,6 @@
 #include "brave/components/brave_ads/common/pref_names.h"
 #include "brave/components/brave_ads/core/ad_constants.h"
 #include "brave/components/brave_ads/core/ads_util.h"
-#include "brave/components/brave_ads/core/database.h"
 #include "brave/components/brave_ads/core/flags_util.h"
 #include "brave/components/brave_ads/core/new_tab_page_ad_info.h"
 #include "brave/components/brave_ads/core/new_tab_page_ad_value_util.h"
@@ -58,6 +60,7 @@
 #include "build/build_config.h"
 #include "chrome/browser/browser_process.h"
 #include "chrome/browser/notifications/notification_display_service.h"
+#include "mojo/public/cpp/bindings/callback_helpers.h"
 #include "services/network/public/mojom/url_response_head.mojom.h"
 #if !BUILDFLAG(IS_ANDROID)
 #include "chrome/browser/fullscreen.h"
@@ -101,6 +104,11 @@ constexpr int kHttpUpgradeRequiredStatusResponseCode = 426;
 
 constexpr char kNotificationAdUrlPrefix[] = "https://www.brave.com/ads/?";
 
+constexpr char kDatabaseFilename[] = "database.sqlite";
+// SQLite names the rollback journal by appending "-journal" to the database
+// path, see https://www.sqlite.org/tempfiles.html.
+constexpr char kDatabaseJournalFilenameSuffix[] = "-journal";
+
 int GetDataResourceId(const std::string& name) {
   if (name == data::resource::kCatalogJsonSchemaFilename) {
     return IDR_ADS_CATALOG_SCHEMA;
@@ -184,22 +192,35 @@ net::NetworkTrafficAnnotationTag GetNetworkTrafficAnnotationTag() {
     )");
 }
 
-mojom::DBCommandResponseInfoPtr RunDBTransactionOnFileTaskRunner(
-    mojom::DBTransactionInfoPtr transaction,
-    Database* database) {
-  CHECK(transaction);
+base::File OpenDatabaseFileOnFileTaskRunner(const base::FilePath& path) {
+  // |FLAG_WIN_SHARE_DELETE| allows the ads service directory to be deleted on
+  // reset while the bat-ads service process still holds the handle.
+  return base::File(path, base::File::FLAG_OPEN_ALWAYS |
+                              base::File::FLAG_READ | base::File::FLAG_WRITE |
+                              base::File::FLAG_WIN_SHARE_DELETE);
+}
 
-  mojom::DBCommandResponseInfoPtr command_response =
-      mojom::DBCommandResponseInfo::New();
+bat_ads::mojom::DatabaseFilesPtr OpenDatabaseFilesOnFileTaskRunner(
+    const base::FilePath& base_path) {
+  const base::FilePath path = base_path.AppendASCII(kDatabaseFilename);
+  base::File database_file = OpenDatabaseFileOnFileTaskRunner(path);
+  if (!database_file.IsValid()) {
+    VLOG(1) << "Failed to open " << path << ": "
+            << base::File::ErrorToString(database_file.error_details());
+    return nullptr;
+  }
 
-  if (!database) {
-    command_response->status =
-        mojom::DBCommandResponseInfo::StatusType::RESPONSE_ERROR;
-  } else {
-    database->RunTransaction(std::move(transaction), command_response.get());
+  const base::FilePath journal_path = base_path.AppendASCII(
+      base::StrCat({kDatabaseFilename, kDatabaseJournalFilenameSuffix}));
+  base::File journal_file = OpenDatabaseFileOnFileTaskRunner(journal_path);
+  if (!journal_file.IsValid()) {
+    VLOG(1) << "Failed to open " << journal_path << ": "
+            << base::File::ErrorToString(journal_file.error_details());
+    return nullptr;
   }
 
-  return command_response;
+  return bat_ads::mojom::DatabaseFiles::New(std::move(database_file),
+                                            std::move(journal_file));
 }
 
 void RegisterResourceComponentsForLocale(const std::string& locale) {
@@ -414,16 +435,32 @@ void AdsServiceImpl::Initialize(const size_t current_start_number) {
     return;
   }
 
-  InitializeDatabase();
+  InitializeDatabase(current_start_number);
+}
 
-  InitializeRewardsWallet(current_start_number);
+void AdsServiceImpl::InitializeDatabase(const size_t current_start_number) {
+  file_task_runner_->PostTaskAndReplyWithResult(
+      FROM_HERE,
+      base::BindOnce(&OpenDatabaseFilesOnFileTaskRunner, base_path_),
+      base::BindOnce(&AdsServiceImpl::InitializeDatabaseCallback, AsWeakPtr(),
+                     current_start_number));
 }
 
-void AdsServiceImpl::InitializeDatabase() {
-  CHECK(!database_);
+void AdsServiceImpl::InitializeDatabaseCallback(
+    const size_t current_start_number,
+    bat_ads::mojom::DatabaseFilesPtr database_files) {
+  if (!ShouldProceedInitialization(current_start_number)) {
+    return;
+  }
+
+  if (!database_files) {
+    VLOG(1) << "Failed to open ads database";
+    return Shutdown();
+  }
+
+  database_files_ = std::move(database_files);
 
-  database_ =
-      std::make_unique<Database>(base_path_.AppendASCII("database.sqlite"));
+  InitializeRewardsWallet(current_start_number);
 }
 
 void AdsServiceImpl::InitializeRewardsWallet(
@@ -466,8 +503,10 @@ void AdsServiceImpl::InitializeBatAds(
     wallet->recovery_seed = base::Base64Encode(rewards_wallet->recovery_seed);
   }
 
+  CHECK(database_files_);
+
   bat_ads_->Initialize(
-      std::move(wallet),
+      std::move(wallet), std::move(database_files_),
       base::BindOnce(&AdsServiceImpl::InitializeBatAdsCallback, AsWeakPtr()));
 }
 
@@ -497,19 +536,49 @@ void AdsServiceImpl::InitializeBatAdsCallback(const bool success) {
 }
 
 void AdsServiceImpl::ShutdownAndResetState() {
-  Shutdown();
-
   VLOG(6) << "Resetting ads state";
 
+  if (!bat_ads_.is_bound()) {
+    return ResetState();
+  }
+
+  // The bat-ads service must close the database before it can be deleted. The
+  // reply is posted so that it does not reenter |Shutdown| if the remote is
+  // reset, and defaults to failure if the service disconnects, in which case
+  // the process has released its file handles.
+  bat_ads_->Shutdown(mojo::WrapCallbackWithDefaultInvokeIfNotRun(
+      base::BindPostTask(
+          base::SequencedTaskRunner::GetCurrentDefault(),
+          base::BindOnce(&AdsServiceImpl::ShutdownAndResetStateCallback,
+                         AsWeakPtr())),
+      /*success*/ false));
+}
+
+void AdsServiceImpl::ShutdownAndResetStateCallback(const bool success) {
+  if (!success) {
+    VLOG(1) << "Failed to shutdown bat-ads service";
+  }
+
+  ResetState();
+}
+
+void AdsServiceImpl::ResetState() {
+  Shutdown();
+
   GetPrefService()->ClearPrefsWithPrefixSilently("brave.brave_ads");
 
   file_task_runner_->PostTaskAndReplyWithResult(
       FROM_HERE, base::BindOnce(&DeletePathOnFileTaskRunner, base_path_),
-      base::BindOnce(&AdsServiceImpl::ShutdownAndResetStateCallback,
-                     AsWeakPtr()));
+      base::BindOnce(&AdsServiceImpl::ResetStateCallback, AsWeakPtr()));
 }
 
-void AdsServiceImpl::ShutdownAndResetStateCallback(const bool /*success*/) {
+void AdsServiceImpl::ResetStateCallback(const bool success) {
+  if (!success) {
+    // Do not restart the service on top of partially deleted state.
+    VLOG(1) << "Failed to delete " << base_path_;
+    return;
+  }
+
   VLOG(6) << "Reset ads state";
 
   MaybeStartBatAdsService();
@@ -1043,11 +1112,7 @@ void AdsServiceImpl::Shutdown() {
 
   CloseAdaptiveCaptcha();
 
-  if (database_) {
-    const bool success =
-        file_task_runner_->DeleteSoon(FROM_HERE, database_.release());
-    CHECK(success) << "Failed to release database";
-  }
+  database_files_.reset();
 
   if (is_bat_ads_initialized_) {
     VLOG(2) << "Shutdown bat-ads service";
@@ -1713,17 +1778,6 @@ void AdsServiceImpl::ShowScheduledCaptchaNotification(
 #endif  // !BUILDFLAG(IS_ANDROID)
 }
 
-void AdsServiceImpl::RunDBTransaction(mojom::DBTransactionInfoPtr transaction,
-                                      RunDBTransactionCallback callback) {
-  CHECK(transaction);
-
-  file_task_runner_->PostTaskAndReplyWithResult(
-      FROM_HERE,
-      base::BindOnce(&RunDBTransactionOnFileTaskRunner, std::move(transaction),
-                     database_.get()),
-      std::move(callback));
-}
-
 void AdsServiceImpl::RecordP2AEvent(const std::string& /*name*/,
                                     base::Value::List list) {
   for (const auto& item : list) {
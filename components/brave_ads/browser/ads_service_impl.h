@@ -62,7 +62,6 @@ namespace brave_ads {
 
 class AdsTooltipsDelegate;
 class BatAdsServiceFactory;
-class Database;
 class DeviceId;
 struct NewTabPageAdInfo;
 
@@ -114,7 +113,10 @@ class AdsServiceImpl : public AdsService,
   void InitializeBasePathDirectoryCallback(size_t current_start_number,
                                            bool success);
   void Initialize(size_t current_start_number);
-  void InitializeDatabase();
+  void InitializeDatabase(size_t current_start_number);
+  void InitializeDatabaseCallback(
+      size_t current_start_number,
+      bat_ads::mojom::DatabaseFilesPtr database_files);
   void InitializeRewardsWallet(size_t current_start_number);
   void InitializeRewardsWalletCallback(
       size_t current_start_number,
@@ -123,7 +125,9 @@ class AdsServiceImpl : public AdsService,
   void InitializeBatAdsCallback(bool success);
 
   void ShutdownAndResetState();
-  void ShutdownAndResetStateCallback(bool /*success*/);
+  void ShutdownAndResetStateCallback(bool success);
+  void ResetState();
+  void ResetStateCallback(bool success);
 
   void SetSysInfo();
   void SetBuildChannel();
@@ -350,9 +354,6 @@ class AdsServiceImpl : public AdsService,
   void ShowScheduledCaptchaNotification(const std::string& payment_id,
                                         const std::string& captcha_id) override;
 
-  void RunDBTransaction(mojom::DBTransactionInfoPtr transaction,
-                        RunDBTransactionCallback callback) override;
-
   // TODO(https://github.com/brave/brave-browser/issues/14666) Decouple P2A
   // business logic.
   void RecordP2AEvent(const std::string& name, base::Value::List list) override;
@@ -427,7 +428,9 @@ class AdsServiceImpl : public AdsService,
 
   mojom::SysInfo sys_info_;
 
-  std::unique_ptr<Database> database_;
+  // Handed over to the bat-ads service on initialization, which opens the
+  // database in-process.
+  bat_ads::mojom::DatabaseFilesPtr database_files_;
 
   base::RepeatingTimer idle_state_timer_;
   ui::IdleState last_idle_state_ = ui::IdleState::IDLE_STATE_ACTIVE;
@@ -22,6 +22,8 @@ namespace brave_ads {
 class ADS_EXPORT Database final {
  public:
   explicit Database(base::FilePath path);
+  // Opens |path| through the SQLite VFS registered as |vfs_name|.
+  Database(base::FilePath path, const char* vfs_name);
 
   Database(const Database&) = delete;
   Database& operator=(const Database&) = delete;
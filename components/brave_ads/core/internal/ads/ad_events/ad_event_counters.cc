@@ -0,0 +1,88 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/core/internal/ads/ad_events/ad_event_counters.h"
+
+#include <iterator>
+
+#include "base/notreached.h"
+#include "base/ranges/algorithm.h"
+
+namespace brave_ads {
+
+AdEventCounters::AdEventCounters(const ConfirmationType& confirmation_type,
+                                 const IdType id_type)
+    : confirmation_type_(confirmation_type), id_type_(id_type) {}
+
+AdEventCounters::AdEventCounters(const ConfirmationType& confirmation_type,
+                                 const IdType id_type,
+                                 const AdEventList& ad_events)
+    : AdEventCounters(confirmation_type, id_type) {
+  // Walk the ad events oldest first so that timestamps are appended.
+  for (auto iter = ad_events.crbegin(); iter != ad_events.crend(); ++iter) {
+    Add(*iter);
+  }
+}
+
+AdEventCounters::AdEventCounters(AdEventCounters&& other) noexcept = default;
+
+AdEventCounters& AdEventCounters::operator=(AdEventCounters&& other) noexcept =
+    default;
+
+AdEventCounters::~AdEventCounters() = default;
+
+void AdEventCounters::Add(const AdEventInfo& ad_event) {
+  if (ad_event.confirmation_type != confirmation_type_) {
+    return;
+  }
+
+  std::vector<base::Time>& times = timestamps_[GetId(ad_event)];
+  if (times.empty() || times.back() <= ad_event.created_at) {
+    times.push_back(ad_event.created_at);
+    return;
+  }
+
+  times.insert(base::ranges::upper_bound(times, ad_event.created_at),
+               ad_event.created_at);
+}
+
+size_t AdEventCounters::Count(const std::string& id,
+                              const base::TimeDelta time_window) const {
+  const auto iter = timestamps_.find(id);
+  if (iter == timestamps_.cend()) {
+    return 0;
+  }
+
+  const std::vector<base::Time>& times = iter->second;
+  if (time_window.is_max()) {
+    return times.size();
+  }
+
+  // Matches ad events where |base::Time::Now() - created_at < time_window|.
+  const base::Time from_time = base::Time::Now() - time_window;
+  return static_cast<size_t>(
+      std::distance(base::ranges::upper_bound(times, from_time), times.cend()));
+}
+
+const std::string& AdEventCounters::GetId(const AdEventInfo& ad_event) const {
+  switch (id_type_) {
+    case IdType::kCampaign: {
+      return ad_event.campaign_id;
+    }
+
+    case IdType::kCreativeSet: {
+      return ad_event.creative_set_id;
+    }
+
+    case IdType::kCreativeInstance: {
+      return ad_event.creative_instance_id;
+    }
+  }
+
+  NOTREACHED_NORETURN() << "Unexpected value for IdType: "
+                        << static_cast<int>(id_type_);
+}
+
+}  // namespace brave_ads
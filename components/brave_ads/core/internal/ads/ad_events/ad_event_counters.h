@@ -0,0 +1,63 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_ADS_AD_EVENTS_AD_EVENT_COUNTERS_H_
+#define BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_ADS_AD_EVENTS_AD_EVENT_COUNTERS_H_
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "base/time/time.h"
+#include "brave/components/brave_ads/core/confirmation_type.h"
+#include "brave/components/brave_ads/core/internal/ads/ad_events/ad_event_info.h"
+
+namespace brave_ads {
+
+// Indexes ad events of a single confirmation type by campaign, creative set or
+// creative instance so that frequency caps can be checked without scanning
+// every ad event for every creative ad.
+class AdEventCounters final {
+ public:
+  enum class IdType { kCampaign, kCreativeSet, kCreativeInstance };
+
+  AdEventCounters(const ConfirmationType& confirmation_type, IdType id_type);
+  // |ad_events| must be ordered newest first, as read from the database.
+  AdEventCounters(const ConfirmationType& confirmation_type,
+                  IdType id_type,
+                  const AdEventList& ad_events);
+
+  AdEventCounters(const AdEventCounters&) = delete;
+  AdEventCounters& operator=(const AdEventCounters&) = delete;
+
+  AdEventCounters(AdEventCounters&&) noexcept;
+  AdEventCounters& operator=(AdEventCounters&&) noexcept;
+
+  ~AdEventCounters();
+
+  // Ad events for other confirmation types are ignored. Adding ad events in the
+  // order they occurred is amortized constant time.
+  void Add(const AdEventInfo& ad_event);
+
+  // Returns the number of ad events for |id| which occurred within
+  // |time_window| of now. Pass |base::TimeDelta::Max()| to count all ad
+  // events.
+  size_t Count(const std::string& id, base::TimeDelta time_window) const;
+
+ private:
+  const std::string& GetId(const AdEventInfo& ad_event) const;
+
+  ConfirmationType confirmation_type_;
+  IdType id_type_;
+
+  // Timestamps are kept sorted so that counting within a time window is a
+  // binary search.
+  std::map<std::string, std::vector<base::Time>> timestamps_;
+};
+
+}  // namespace brave_ads
+
+#endif  // BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_ADS_AD_EVENTS_AD_EVENT_COUNTERS_H_
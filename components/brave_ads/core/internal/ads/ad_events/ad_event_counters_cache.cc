@@ -0,0 +1,130 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/core/internal/ads/ad_events/ad_event_counters_cache.h"
+
+#include "base/check_op.h"
+#include "base/ranges/algorithm.h"
+#include "brave/components/brave_ads/core/internal/global_state/global_state.h"
+
+namespace brave_ads {
+
+namespace {
+
+struct CountersInfo final {
+  ConfirmationType::Value confirmation_type;
+  AdEventCounters::IdType id_type;
+};
+
+// The counters read by exclusion rules.
+constexpr CountersInfo kCounters[] = {
+    {ConfirmationType::kServed, AdEventCounters::IdType::kCampaign},
+    {ConfirmationType::kServed, AdEventCounters::IdType::kCreativeSet},
+    {ConfirmationType::kServed, AdEventCounters::IdType::kCreativeInstance},
+    {ConfirmationType::kConversion, AdEventCounters::IdType::kCreativeSet},
+    {ConfirmationType::kTransferred, AdEventCounters::IdType::kCampaign}};
+
+}  // namespace
+
+AdEventCountersCache::AdEventCountersCache() = default;
+
+AdEventCountersCache::~AdEventCountersCache() = default;
+
+// static
+AdEventCountersCache& AdEventCountersCache::GetInstance() {
+  return GlobalState::GetInstance()->GetAdEventCountersCache();
+}
+
+void AdEventCountersCache::BeginRebuild() {
+  // Ad events recorded from now on might not be read from the database.
+  ++pending_rebuilds_;
+  pending_ad_events_.clear();
+
+  is_rebuilt_ = false;
+  counters_.clear();
+}
+
+void AdEventCountersCache::EndRebuild(const AdEventList& ad_events) {
+  CHECK_GT(pending_rebuilds_, 0);
+
+  --pending_rebuilds_;
+  if (pending_rebuilds_ > 0) {
+    // A later rebuild will read these ad events again.
+    return;
+  }
+
+  for (auto iter = ad_events.crbegin(); iter != ad_events.crend(); ++iter) {
+    AddToCounters(*iter);
+  }
+
+  for (const auto& ad_event : pending_ad_events_) {
+    AddToCounters(ad_event);
+  }
+  pending_ad_events_.clear();
+
+  is_rebuilt_ = true;
+}
+
+void AdEventCountersCache::CancelRebuild() {
+  CHECK_GT(pending_rebuilds_, 0);
+
+  --pending_rebuilds_;
+  if (pending_rebuilds_ == 0) {
+    pending_ad_events_.clear();
+  }
+}
+
+void AdEventCountersCache::Add(const AdEventInfo& ad_event) {
+  if (pending_rebuilds_ > 0) {
+    pending_ad_events_.push_back(ad_event);
+    return;
+  }
+
+  if (is_rebuilt_) {
+    AddToCounters(ad_event);
+  }
+}
+
+const AdEventCounters* AdEventCountersCache::Get(
+    const AdType& ad_type,
+    const ConfirmationType& confirmation_type,
+    const AdEventCounters::IdType id_type) {
+  if (!is_rebuilt_) {
+    return nullptr;
+  }
+
+  const bool is_counted =
+      base::ranges::any_of(kCounters, [&](const CountersInfo& counters) {
+        return counters.confirmation_type == confirmation_type.value() &&
+               counters.id_type == id_type;
+      });
+  if (!is_counted) {
+    return nullptr;
+  }
+
+  return &counters_
+              .try_emplace(KeyType(ad_type.value(), confirmation_type.value(),
+                                   id_type),
+                           confirmation_type, id_type)
+              .first->second;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void AdEventCountersCache::AddToCounters(const AdEventInfo& ad_event) {
+  for (const auto& counters : kCounters) {
+    if (counters.confirmation_type != ad_event.confirmation_type.value()) {
+      continue;
+    }
+
+    counters_
+        .try_emplace(KeyType(ad_event.type.value(), counters.confirmation_type,
+                             counters.id_type),
+                     counters.confirmation_type, counters.id_type)
+        .first->second.Add(ad_event);
+  }
+}
+
+}  // namespace brave_ads
@@ -0,0 +1,70 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_ADS_AD_EVENTS_AD_EVENT_COUNTERS_CACHE_H_
+#define BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_ADS_AD_EVENTS_AD_EVENT_COUNTERS_CACHE_H_
+
+#include <map>
+#include <tuple>
+
+#include "brave/components/brave_ads/core/ad_type.h"
+#include "brave/components/brave_ads/core/confirmation_type.h"
+#include "brave/components/brave_ads/core/internal/ads/ad_events/ad_event_counters.h"
+#include "brave/components/brave_ads/core/internal/ads/ad_events/ad_event_info.h"
+
+namespace brave_ads {
+
+// Keeps the ad event counters used by frequency caps up to date as ad events
+// are recorded, so that serving an ad does not need to index every ad event.
+// The cache is rebuilt from the database alongside the ad event history, and
+// ad events recorded while the database is being read are replayed once it
+// has been read.
+class AdEventCountersCache final {
+ public:
+  AdEventCountersCache();
+
+  AdEventCountersCache(const AdEventCountersCache&) = delete;
+  AdEventCountersCache& operator=(const AdEventCountersCache&) = delete;
+
+  AdEventCountersCache(AdEventCountersCache&&) noexcept = delete;
+  AdEventCountersCache& operator=(AdEventCountersCache&&) noexcept = delete;
+
+  ~AdEventCountersCache();
+
+  static AdEventCountersCache& GetInstance();
+
+  // Call before reading ad events from the database, then call either
+  // |EndRebuild| with the ad events, ordered newest first, or |CancelRebuild|
+  // if they could not be read.
+  void BeginRebuild();
+  void EndRebuild(const AdEventList& ad_events);
+  void CancelRebuild();
+
+  void Add(const AdEventInfo& ad_event);
+
+  // Returns counters for ad events of |ad_type|, or |nullptr| if the cache has
+  // not been rebuilt from the database or does not count |confirmation_type|
+  // ad events by |id_type|.
+  const AdEventCounters* Get(const AdType& ad_type,
+                             const ConfirmationType& confirmation_type,
+                             AdEventCounters::IdType id_type);
+
+ private:
+  using KeyType = std::tuple<AdType::Value,
+                             ConfirmationType::Value,
+                             AdEventCounters::IdType>;
+
+  void AddToCounters(const AdEventInfo& ad_event);
+
+  bool is_rebuilt_ = false;
+  int pending_rebuilds_ = 0;
+  AdEventList pending_ad_events_;
+
+  std::map<KeyType, AdEventCounters> counters_;
+};
+
+}  // namespace brave_ads
+
+#endif  // BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_ADS_AD_EVENTS_AD_EVENT_COUNTERS_CACHE_H_
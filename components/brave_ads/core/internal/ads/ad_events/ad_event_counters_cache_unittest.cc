@@ -0,0 +1,146 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/core/internal/ads/ad_events/ad_event_counters_cache.h"
+
+#include "base/check.h"
+#include "brave/components/brave_ads/core/internal/ads/ad_events/ad_event_unittest_util.h"
+#include "brave/components/brave_ads/core/internal/ads/ad_unittest_constants.h"
+#include "brave/components/brave_ads/core/internal/common/unittest/unittest_base.h"
+#include "brave/components/brave_ads/core/internal/common/unittest/unittest_time_util.h"
+#include "brave/components/brave_ads/core/internal/creatives/creative_ad_info.h"
+
+// npm run test -- brave_unit_tests --filter=BraveAds*
+
+namespace brave_ads {
+
+namespace {
+
+AdEventInfo BuildServedAdEvent(const AdType& ad_type) {
+  CreativeAdInfo creative_ad;
+  creative_ad.campaign_id = kCampaignId;
+  creative_ad.creative_set_id = kCreativeSetId;
+  creative_ad.creative_instance_id = kCreativeInstanceId;
+  return BuildAdEvent(creative_ad, ad_type, ConfirmationType::kServed, Now());
+}
+
+size_t CountServed(AdEventCountersCache& cache, const AdType& ad_type) {
+  const AdEventCounters* const ad_event_counters =
+      cache.Get(ad_type, ConfirmationType::kServed,
+                AdEventCounters::IdType::kCreativeSet);
+  CHECK(ad_event_counters);
+  return ad_event_counters->Count(kCreativeSetId, base::TimeDelta::Max());
+}
+
+}  // namespace
+
+class BraveAdsAdEventCountersCacheTest : public UnitTestBase {};
+
+TEST_F(BraveAdsAdEventCountersCacheTest, DoNotGetIfNotRebuilt) {
+  // Arrange
+  AdEventCountersCache cache;
+  cache.Add(BuildServedAdEvent(AdType::kNotificationAd));
+
+  // Act
+
+  // Assert
+  EXPECT_FALSE(cache.Get(AdType::kNotificationAd, ConfirmationType::kServed,
+                         AdEventCounters::IdType::kCreativeSet));
+}
+
+TEST_F(BraveAdsAdEventCountersCacheTest, DoNotGetUncountedAdEvents) {
+  // Arrange
+  AdEventCountersCache cache;
+  cache.BeginRebuild();
+  cache.EndRebuild(/*ad_events*/ {});
+
+  // Act
+
+  // Assert
+  EXPECT_FALSE(cache.Get(AdType::kNotificationAd, ConfirmationType::kViewed,
+                         AdEventCounters::IdType::kCreativeSet));
+}
+
+TEST_F(BraveAdsAdEventCountersCacheTest, Rebuild) {
+  // Arrange
+  AdEventCountersCache cache;
+
+  const AdEventList ad_events = {
+      BuildServedAdEvent(AdType::kNotificationAd),
+      BuildServedAdEvent(AdType::kNotificationAd),
+      BuildServedAdEvent(AdType::kNewTabPageAd)};
+
+  // Act
+  cache.BeginRebuild();
+  cache.EndRebuild(ad_events);
+
+  // Assert
+  EXPECT_EQ(2U, CountServed(cache, AdType::kNotificationAd));
+  EXPECT_EQ(1U, CountServed(cache, AdType::kNewTabPageAd));
+  EXPECT_EQ(0U, CountServed(cache, AdType::kInlineContentAd));
+}
+
+TEST_F(BraveAdsAdEventCountersCacheTest, AddOnceRebuilt) {
+  // Arrange
+  AdEventCountersCache cache;
+  cache.BeginRebuild();
+  cache.EndRebuild({BuildServedAdEvent(AdType::kNotificationAd)});
+
+  // Act
+  cache.Add(BuildServedAdEvent(AdType::kNotificationAd));
+
+  // Assert
+  EXPECT_EQ(2U, CountServed(cache, AdType::kNotificationAd));
+}
+
+TEST_F(BraveAdsAdEventCountersCacheTest, ReplayAdEventsAddedWhileRebuilding) {
+  // Arrange
+  AdEventCountersCache cache;
+  cache.BeginRebuild();
+  cache.EndRebuild({BuildServedAdEvent(AdType::kNotificationAd)});
+
+  // Act
+  cache.BeginRebuild();
+  cache.Add(BuildServedAdEvent(AdType::kNotificationAd));
+  EXPECT_FALSE(cache.Get(AdType::kNotificationAd, ConfirmationType::kServed,
+                         AdEventCounters::IdType::kCreativeSet));
+  cache.EndRebuild({BuildServedAdEvent(AdType::kNotificationAd)});
+
+  // Assert
+  EXPECT_EQ(2U, CountServed(cache, AdType::kNotificationAd));
+}
+
+TEST_F(BraveAdsAdEventCountersCacheTest, OnlyEndLastRebuild) {
+  // Arrange
+  AdEventCountersCache cache;
+  cache.BeginRebuild();
+  cache.Add(BuildServedAdEvent(AdType::kNotificationAd));
+  cache.BeginRebuild();
+
+  // Act
+  cache.EndRebuild(/*ad_events*/ {});
+  EXPECT_FALSE(cache.Get(AdType::kNotificationAd, ConfirmationType::kServed,
+                         AdEventCounters::IdType::kCreativeSet));
+  cache.EndRebuild({BuildServedAdEvent(AdType::kNotificationAd)});
+
+  // Assert
+  EXPECT_EQ(1U, CountServed(cache, AdType::kNotificationAd));
+}
+
+TEST_F(BraveAdsAdEventCountersCacheTest, CancelRebuild) {
+  // Arrange
+  AdEventCountersCache cache;
+  cache.BeginRebuild();
+  cache.Add(BuildServedAdEvent(AdType::kNotificationAd));
+
+  // Act
+  cache.CancelRebuild();
+
+  // Assert
+  EXPECT_FALSE(cache.Get(AdType::kNotificationAd, ConfirmationType::kServed,
+                         AdEventCounters::IdType::kCreativeSet));
+}
+
+}  // namespace brave_ads
@@ -0,0 +1,140 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/core/internal/ads/ad_events/ad_event_counters.h"
+
+#include "brave/components/brave_ads/core/internal/ads/ad_events/ad_event_unittest_util.h"
+#include "brave/components/brave_ads/core/internal/ads/ad_unittest_constants.h"
+#include "brave/components/brave_ads/core/internal/common/unittest/unittest_base.h"
+#include "brave/components/brave_ads/core/internal/common/unittest/unittest_time_util.h"
+#include "brave/components/brave_ads/core/internal/creatives/creative_ad_info.h"
+
+// npm run test -- brave_unit_tests --filter=BraveAds*
+
+namespace brave_ads {
+
+namespace {
+
+CreativeAdInfo BuildCreativeAd() {
+  CreativeAdInfo creative_ad;
+  creative_ad.campaign_id = kCampaignId;
+  creative_ad.creative_set_id = kCreativeSetId;
+  creative_ad.creative_instance_id = kCreativeInstanceId;
+  return creative_ad;
+}
+
+}  // namespace
+
+class BraveAdsAdEventCountersTest : public UnitTestBase {};
+
+TEST_F(BraveAdsAdEventCountersTest, CountIfNoAdEvents) {
+  // Arrange
+  const AdEventCounters ad_event_counters(
+      ConfirmationType::kServed, AdEventCounters::IdType::kCreativeSet);
+
+  // Act
+
+  // Assert
+  EXPECT_EQ(0U, ad_event_counters.Count(kCreativeSetId, base::Days(1)));
+}
+
+TEST_F(BraveAdsAdEventCountersTest, CountForCampaignCreativeSetAndInstance) {
+  // Arrange
+  const CreativeAdInfo creative_ad = BuildCreativeAd();
+
+  AdEventList ad_events;
+  ad_events.push_back(BuildAdEvent(creative_ad, AdType::kNotificationAd,
+                                   ConfirmationType::kServed, Now()));
+  ad_events.push_back(BuildAdEvent(creative_ad, AdType::kNotificationAd,
+                                   ConfirmationType::kServed, Now()));
+  ad_events.push_back(BuildAdEvent(creative_ad, AdType::kNotificationAd,
+                                   ConfirmationType::kViewed, Now()));
+
+  // Act
+  const AdEventCounters campaign_counters(
+      ConfirmationType::kServed, AdEventCounters::IdType::kCampaign, ad_events);
+  const AdEventCounters creative_set_counters(
+      ConfirmationType::kServed, AdEventCounters::IdType::kCreativeSet,
+      ad_events);
+  const AdEventCounters creative_instance_counters(
+      ConfirmationType::kServed, AdEventCounters::IdType::kCreativeInstance,
+      ad_events);
+  const AdEventCounters viewed_counters(
+      ConfirmationType::kViewed, AdEventCounters::IdType::kCreativeSet,
+      ad_events);
+
+  // Assert
+  EXPECT_EQ(2U, campaign_counters.Count(kCampaignId, base::Days(1)));
+  EXPECT_EQ(2U, creative_set_counters.Count(kCreativeSetId, base::Days(1)));
+  EXPECT_EQ(2U, creative_instance_counters.Count(kCreativeInstanceId,
+                                                 base::Days(1)));
+  EXPECT_EQ(1U, viewed_counters.Count(kCreativeSetId, base::Days(1)));
+}
+
+TEST_F(BraveAdsAdEventCountersTest, DoNotCountAdEventsOutsideTimeWindow) {
+  // Arrange
+  const CreativeAdInfo creative_ad = BuildCreativeAd();
+
+  AdEventCounters ad_event_counters(ConfirmationType::kServed,
+                                    AdEventCounters::IdType::kCreativeSet);
+  ad_event_counters.Add(BuildAdEvent(creative_ad, AdType::kNotificationAd,
+                                     ConfirmationType::kServed, Now()));
+
+  AdvanceClockBy(base::Days(1) - base::Milliseconds(1));
+
+  ad_event_counters.Add(BuildAdEvent(creative_ad, AdType::kNotificationAd,
+                                     ConfirmationType::kServed, Now()));
+
+  // Act
+  AdvanceClockBy(base::Milliseconds(1));
+
+  // Assert
+  EXPECT_EQ(1U, ad_event_counters.Count(kCreativeSetId, base::Days(1)));
+}
+
+TEST_F(BraveAdsAdEventCountersTest, CountAdEventsAddedOutOfOrder) {
+  // Arrange
+  const CreativeAdInfo creative_ad = BuildCreativeAd();
+
+  AdEventCounters ad_event_counters(ConfirmationType::kServed,
+                                    AdEventCounters::IdType::kCreativeSet);
+  ad_event_counters.Add(BuildAdEvent(creative_ad, AdType::kNotificationAd,
+                                     ConfirmationType::kServed, Now()));
+  ad_event_counters.Add(BuildAdEvent(creative_ad, AdType::kNotificationAd,
+                                     ConfirmationType::kServed,
+                                     Now() - base::Days(2)));
+  ad_event_counters.Add(BuildAdEvent(creative_ad, AdType::kNotificationAd,
+                                     ConfirmationType::kServed,
+                                     Now() - base::Hours(1)));
+
+  // Act
+
+  // Assert
+  EXPECT_EQ(2U, ad_event_counters.Count(kCreativeSetId, base::Days(1)));
+}
+
+TEST_F(BraveAdsAdEventCountersTest, CountAllAdEventsForMaxTimeWindow) {
+  // Arrange
+  const CreativeAdInfo creative_ad = BuildCreativeAd();
+
+  AdEventCounters ad_event_counters(ConfirmationType::kServed,
+                                    AdEventCounters::IdType::kCreativeSet);
+  ad_event_counters.Add(BuildAdEvent(creative_ad, AdType::kNotificationAd,
+                                     ConfirmationType::kServed, Now()));
+
+  AdvanceClockBy(base::Days(365));
+
+  ad_event_counters.Add(BuildAdEvent(creative_ad, AdType::kNotificationAd,
+                                     ConfirmationType::kServed,
+                                     Now() - base::Days(1)));
+
+  // Act
+
+  // Assert
+  EXPECT_EQ(2U,
+            ad_event_counters.Count(kCreativeSetId, base::TimeDelta::Max()));
+}
+
+}  // namespace brave_ads
@@ -14,6 +14,7 @@
 #include "brave/components/brave_ads/core/ad_info.h"
 #include "brave/components/brave_ads/core/ad_type.h"
 #include "brave/components/brave_ads/core/confirmation_type.h"
+#include "brave/components/brave_ads/core/internal/ads/ad_events/ad_event_counters_cache.h"
 #include "brave/components/brave_ads/core/internal/ads/ad_events/ad_event_info.h"
 #include "brave/components/brave_ads/core/internal/ads/ad_events/ad_events_database_table.h"
 #include "brave/components/brave_ads/core/internal/ads_client_helper.h"
@@ -22,6 +23,16 @@
 
 namespace brave_ads {
 
+namespace {
+
+void RecordAdEventHistory(const AdEventInfo& ad_event) {
+  AdsClientHelper::GetInstance()->RecordAdEventForId(
+      GetInstanceId(), ad_event.type.ToString(),
+      ad_event.confirmation_type.ToString(), ad_event.created_at);
+}
+
+}  // namespace
+
 void LogAdEvent(const AdInfo& ad,
                 const ConfirmationType& confirmation_type,
                 AdEventCallback callback) {
@@ -74,10 +85,13 @@ void PurgeOrphanedAdEvents(const mojom::AdType ad_type,
 }
 
 void RebuildAdEventHistoryFromDatabase() {
+  AdEventCountersCache::GetInstance().BeginRebuild();
+
   const database::table::AdEvents database_table;
   database_table.GetAll(
       base::BindOnce([](const bool success, const AdEventList& ad_events) {
         if (!success) {
+          AdEventCountersCache::GetInstance().CancelRebuild();
           return BLOG(1, "Failed to get ad events");
         }
 
@@ -86,15 +100,17 @@ void RebuildAdEventHistoryFromDatabase() {
         AdsClientHelper::GetInstance()->ResetAdEventHistoryForId(id);
 
         for (const auto& ad_event : ad_events) {
-          RecordAdEvent(ad_event);
+          RecordAdEventHistory(ad_event);
         }
+
+        AdEventCountersCache::GetInstance().EndRebuild(ad_events);
       }));
 }
 
 void RecordAdEvent(const AdEventInfo& ad_event) {
-  AdsClientHelper::GetInstance()->RecordAdEventForId(
-      GetInstanceId(), ad_event.type.ToString(),
-      ad_event.confirmation_type.ToString(), ad_event.created_at);
+  RecordAdEventHistory(ad_event);
+
+  AdEventCountersCache::GetInstance().Add(ad_event);
 }
 
 std::vector<base::Time> GetAdEventHistory(
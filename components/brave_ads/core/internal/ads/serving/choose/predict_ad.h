@@ -12,6 +12,7 @@
 #include "brave/components/brave_ads/core/internal/ads/serving/choose/eligible_ads_predictor_util.h"
 #include "brave/components/brave_ads/core/internal/ads/serving/choose/sample_ads.h"
 #include "brave/components/brave_ads/core/internal/ads/serving/eligible_ads/pacing/pacing.h"
+#include "brave/components/brave_ads/core/internal/ads/serving/serving_stage_timer.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
 
 namespace brave_ads {
@@ -22,6 +23,8 @@ absl::optional<T> PredictAd(const UserModelInfo& user_model,
                             const std::vector<T>& creative_ads) {
   CHECK(!creative_ads.empty());
 
+  const ServingStageTimer timer(ServingStageType::kPrediction);
+
   const std::vector<T> paced_creative_ads = PaceCreativeAds(creative_ads);
 
   CreativeAdPredictorMap<T> creative_ad_predictors;
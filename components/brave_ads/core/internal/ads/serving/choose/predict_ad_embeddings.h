@@ -16,6 +16,7 @@
 #include "brave/components/brave_ads/core/internal/ads/serving/choose/eligible_ads_predictor_util.h"
 #include "brave/components/brave_ads/core/internal/ads/serving/choose/sample_ads.h"
 #include "brave/components/brave_ads/core/internal/ads/serving/eligible_ads/pacing/pacing.h"
+#include "brave/components/brave_ads/core/internal/ads/serving/serving_stage_timer.h"
 #include "brave/components/brave_ads/core/internal/ads/serving/targeting/user_model_info.h"
 #include "brave/components/brave_ads/core/internal/processors/contextual/text_embedding/text_embedding_html_event_info.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
@@ -28,6 +29,8 @@ absl::optional<T> MaybePredictAdUsingEmbeddings(
     const std::vector<T>& creative_ads) {
   CHECK(!creative_ads.empty());
 
+  const ServingStageTimer timer(ServingStageType::kPrediction);
+
   const std::vector<T> paced_creative_ads = PaceCreativeAds(creative_ads);
 
   if (paced_creative_ads.empty()) {
@@ -5,10 +5,8 @@
 
 #include "brave/components/brave_ads/core/internal/ads/serving/eligible_ads/exclusion_rules/conversion_exclusion_rule.h"
 
-#include <utility>
-
-#include "base/ranges/algorithm.h"
 #include "base/strings/string_util.h"
+#include "base/time/time.h"
 #include "brave/components/brave_ads/core/internal/ads/serving/eligible_ads/exclusion_rules/exclusion_rule_feature.h"
 #include "brave/components/brave_ads/core/internal/creatives/creative_ad_info.h"
 
@@ -18,25 +16,23 @@ namespace {
 
 constexpr size_t kConversionCap = 1;
 
-bool DoesRespectCap(const AdEventList& ad_events,
+bool DoesRespectCap(const AdEventCounters& ad_event_counters,
                     const CreativeAdInfo& creative_ad) {
   if (!kShouldExcludeAdIfConverted.Get()) {
     return true;
   }
 
-  const size_t count = base::ranges::count_if(
-      ad_events, [&creative_ad](const AdEventInfo& ad_event) {
-        return ad_event.confirmation_type == ConfirmationType::kConversion &&
-               ad_event.creative_set_id == creative_ad.creative_set_id;
-      });
+  const size_t count = ad_event_counters.Count(creative_ad.creative_set_id,
+                                               base::TimeDelta::Max());
 
   return count < kConversionCap;
 }
 
 }  // namespace
 
-ConversionExclusionRule::ConversionExclusionRule(AdEventList ad_events)
-    : ad_events_(std::move(ad_events)) {}
+ConversionExclusionRule::ConversionExclusionRule(
+    const AdEventCounters& ad_event_counters)
+    : ad_event_counters_(ad_event_counters) {}
 
 ConversionExclusionRule::~ConversionExclusionRule() = default;
 
@@ -47,7 +43,7 @@ std::string ConversionExclusionRule::GetUuid(
 
 base::expected<void, std::string> ConversionExclusionRule::ShouldInclude(
     const CreativeAdInfo& creative_ad) const {
-  if (!DoesRespectCap(ad_events_, creative_ad)) {
+  if (!DoesRespectCap(*ad_event_counters_, creative_ad)) {
     return base::unexpected(base::ReplaceStringPlaceholders(
         "creativeSetId $1 has exceeded the conversions frequency cap",
         {creative_ad.creative_set_id}, nullptr));
@@ -35,7 +35,9 @@ TEST_F(BraveAdsConversionExclusionRuleTest,
   CreativeAdInfo creative_ad;
   creative_ad.creative_set_id = kCreativeSetId;
 
-  const ConversionExclusionRule exclusion_rule(/*ad_events*/ {});
+  const AdEventCounters ad_event_counters(
+      ConfirmationType::kConversion, AdEventCounters::IdType::kCreativeSet);
+  const ConversionExclusionRule exclusion_rule(ad_event_counters);
 
   // Act
 
@@ -56,7 +58,10 @@ TEST_F(BraveAdsConversionExclusionRuleTest, DoNotAllowAdIfAlreadyConverted) {
 
   ad_events.push_back(ad_event);
 
-  const ConversionExclusionRule exclusion_rule(ad_events);
+  const AdEventCounters ad_event_counters(
+      ConfirmationType::kConversion, AdEventCounters::IdType::kCreativeSet,
+      ad_events);
+  const ConversionExclusionRule exclusion_rule(ad_event_counters);
 
   // Act
 
@@ -89,7 +94,10 @@ TEST_F(BraveAdsConversionExclusionRuleTest,
 
   ad_events.push_back(ad_event);
 
-  const ConversionExclusionRule exclusion_rule(ad_events);
+  const AdEventCounters ad_event_counters(
+      ConfirmationType::kConversion, AdEventCounters::IdType::kCreativeSet,
+      ad_events);
+  const ConversionExclusionRule exclusion_rule(ad_event_counters);
 
   // Act
 
@@ -113,7 +121,10 @@ TEST_F(BraveAdsConversionExclusionRuleTest, AllowAdIfNotAlreadyConverted) {
 
   ad_events.push_back(ad_event);
 
-  const ConversionExclusionRule exclusion_rule(ad_events);
+  const AdEventCounters ad_event_counters(
+      ConfirmationType::kConversion, AdEventCounters::IdType::kCreativeSet,
+      ad_events);
+  const ConversionExclusionRule exclusion_rule(ad_event_counters);
 
   // Act
 
@@ -5,10 +5,7 @@
 
 #include "brave/components/brave_ads/core/internal/ads/serving/eligible_ads/exclusion_rules/creative_instance_exclusion_rule.h"
 
-#include <utility>
-
 #include "base/strings/string_util.h"
-#include "brave/components/brave_ads/core/confirmation_type.h"
 #include "brave/components/brave_ads/core/internal/ads/serving/eligible_ads/exclusion_rules/exclusion_rule_util.h"
 #include "brave/components/brave_ads/core/internal/creatives/creative_ad_info.h"
 
@@ -18,18 +15,17 @@ namespace {
 
 constexpr int kPerHourCap = 1;
 
-bool DoesRespectCap(const AdEventList& ad_events,
+bool DoesRespectCap(const AdEventCounters& ad_event_counters,
                     const CreativeAdInfo& creative_ad) {
-  return DoesRespectCreativeCap(creative_ad, ad_events,
-                                ConfirmationType::kServed, base::Hours(1),
+  return DoesRespectCreativeCap(creative_ad, ad_event_counters, base::Hours(1),
                                 kPerHourCap);
 }
 
 }  // namespace
 
 CreativeInstanceExclusionRule::CreativeInstanceExclusionRule(
-    AdEventList ad_events)
-    : ad_events_(std::move(ad_events)) {}
+    const AdEventCounters& ad_event_counters)
+    : ad_event_counters_(ad_event_counters) {}
 
 CreativeInstanceExclusionRule::~CreativeInstanceExclusionRule() = default;
 
@@ -40,7 +36,7 @@ std::string CreativeInstanceExclusionRule::GetUuid(
 
 base::expected<void, std::string> CreativeInstanceExclusionRule::ShouldInclude(
     const CreativeAdInfo& creative_ad) const {
-  if (!DoesRespectCap(ad_events_, creative_ad)) {
+  if (!DoesRespectCap(*ad_event_counters_, creative_ad)) {
     return base::unexpected(base::ReplaceStringPlaceholders(
         "creativeInstanceId $1 has exceeded the creative instance frequency "
         "cap",
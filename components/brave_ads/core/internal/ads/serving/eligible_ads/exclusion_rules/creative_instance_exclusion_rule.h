@@ -8,7 +8,8 @@
 
 #include <string>
 
-#include "brave/components/brave_ads/core/internal/ads/ad_events/ad_event_info.h"
+#include "base/memory/raw_ref.h"
+#include "brave/components/brave_ads/core/internal/ads/ad_events/ad_event_counters.h"
 #include "brave/components/brave_ads/core/internal/ads/serving/eligible_ads/exclusion_rules/exclusion_rule_interface.h"
 
 namespace brave_ads {
@@ -18,7 +19,8 @@ struct CreativeAdInfo;
 class CreativeInstanceExclusionRule final
     : public ExclusionRuleInterface<CreativeAdInfo> {
  public:
-  explicit CreativeInstanceExclusionRule(AdEventList ad_events);
+  explicit CreativeInstanceExclusionRule(
+      const AdEventCounters& ad_event_counters);
 
   CreativeInstanceExclusionRule(const CreativeInstanceExclusionRule&) = delete;
   CreativeInstanceExclusionRule& operator=(
@@ -37,7 +39,7 @@ class CreativeInstanceExclusionRule final
       const CreativeAdInfo& creative_ad) const override;
 
  private:
-  AdEventList ad_events_;
+  const raw_ref<const AdEventCounters> ad_event_counters_;
 };
 
 }  // namespace brave_ads
@@ -23,7 +23,9 @@ TEST_F(BraveAdsCreativeInstanceExclusionRuleTest,
   CreativeAdInfo creative_ad;
   creative_ad.creative_instance_id = kCreativeInstanceId;
 
-  const CreativeInstanceExclusionRule exclusion_rule(/*ad_events*/ {});
+  const AdEventCounters ad_event_counters(
+      ConfirmationType::kServed, AdEventCounters::IdType::kCreativeInstance);
+  const CreativeInstanceExclusionRule exclusion_rule(ad_event_counters);
 
   // Act
 
@@ -43,7 +45,10 @@ TEST_F(BraveAdsCreativeInstanceExclusionRuleTest, AdAllowedAfter1Hour) {
 
   ad_events.push_back(ad_event);
 
-  const CreativeInstanceExclusionRule exclusion_rule(ad_events);
+  const AdEventCounters ad_event_counters(
+      ConfirmationType::kServed, AdEventCounters::IdType::kCreativeInstance,
+      ad_events);
+  const CreativeInstanceExclusionRule exclusion_rule(ad_event_counters);
 
   AdvanceClockBy(base::Hours(1));
 
@@ -78,7 +83,10 @@ TEST_F(BraveAdsCreativeInstanceExclusionRuleTest,
       creative_ad, AdType::kSearchResultAd, ConfirmationType::kServed, Now());
   ad_events.push_back(ad_event_4);
 
-  const CreativeInstanceExclusionRule exclusion_rule(ad_events);
+  const AdEventCounters ad_event_counters(
+      ConfirmationType::kServed, AdEventCounters::IdType::kCreativeInstance,
+      ad_events);
+  const CreativeInstanceExclusionRule exclusion_rule(ad_event_counters);
 
   AdvanceClockBy(base::Hours(1));
 
@@ -101,7 +109,10 @@ TEST_F(BraveAdsCreativeInstanceExclusionRuleTest,
 
   ad_events.push_back(ad_event);
 
-  const CreativeInstanceExclusionRule exclusion_rule(ad_events);
+  const AdEventCounters ad_event_counters(
+      ConfirmationType::kServed, AdEventCounters::IdType::kCreativeInstance,
+      ad_events);
+  const CreativeInstanceExclusionRule exclusion_rule(ad_event_counters);
 
   AdvanceClockBy(base::Hours(1) - base::Milliseconds(1));
 
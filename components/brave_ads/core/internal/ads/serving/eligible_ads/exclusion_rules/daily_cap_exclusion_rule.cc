@@ -5,10 +5,7 @@
 
 #include "brave/components/brave_ads/core/internal/ads/serving/eligible_ads/exclusion_rules/daily_cap_exclusion_rule.h"
 
-#include <utility>
-
 #include "base/strings/string_util.h"
-#include "brave/components/brave_ads/core/confirmation_type.h"
 #include "brave/components/brave_ads/core/internal/ads/serving/eligible_ads/exclusion_rules/exclusion_rule_util.h"
 #include "brave/components/brave_ads/core/internal/creatives/creative_ad_info.h"
 
@@ -16,17 +13,17 @@ namespace brave_ads {
 
 namespace {
 
-bool DoesRespectCap(const AdEventList& ad_events,
+bool DoesRespectCap(const AdEventCounters& ad_event_counters,
                     const CreativeAdInfo& creative_ad) {
-  return DoesRespectCampaignCap(creative_ad, ad_events,
-                                ConfirmationType::kServed, base::Days(1),
+  return DoesRespectCampaignCap(creative_ad, ad_event_counters, base::Days(1),
                                 creative_ad.daily_cap);
 }
 
 }  // namespace
 
-DailyCapExclusionRule::DailyCapExclusionRule(AdEventList ad_events)
-    : ad_events_(std::move(ad_events)) {}
+DailyCapExclusionRule::DailyCapExclusionRule(
+    const AdEventCounters& ad_event_counters)
+    : ad_event_counters_(ad_event_counters) {}
 
 DailyCapExclusionRule::~DailyCapExclusionRule() = default;
 
@@ -37,7 +34,7 @@ std::string DailyCapExclusionRule::GetUuid(
 
 base::expected<void, std::string> DailyCapExclusionRule::ShouldInclude(
     const CreativeAdInfo& creative_ad) const {
-  if (!DoesRespectCap(ad_events_, creative_ad)) {
+  if (!DoesRespectCap(*ad_event_counters_, creative_ad)) {
     return base::unexpected(base::ReplaceStringPlaceholders(
         "campaignId $1 has exceeded the dailyCap frequency cap",
         {creative_ad.campaign_id}, nullptr));
@@ -31,7 +31,9 @@ TEST_F(BraveAdsDailyCapExclusionRuleTest, AllowAdIfThereIsNoAdsHistory) {
   creative_ad.campaign_id = kCampaignIds[0];
   creative_ad.daily_cap = 2;
 
-  const DailyCapExclusionRule exclusion_rule(/*ad_events*/ {});
+  const AdEventCounters ad_event_counters(ConfirmationType::kServed,
+                                          AdEventCounters::IdType::kCampaign);
+  const DailyCapExclusionRule exclusion_rule(ad_event_counters);
 
   // Act
 
@@ -52,7 +54,9 @@ TEST_F(BraveAdsDailyCapExclusionRuleTest, AllowAdIfDoesNotExceedCap) {
 
   ad_events.push_back(ad_event);
 
-  const DailyCapExclusionRule exclusion_rule(ad_events);
+  const AdEventCounters ad_event_counters(
+      ConfirmationType::kServed, AdEventCounters::IdType::kCampaign, ad_events);
+  const DailyCapExclusionRule exclusion_rule(ad_event_counters);
 
   // Act
 
@@ -77,7 +81,9 @@ TEST_F(BraveAdsDailyCapExclusionRuleTest,
 
   ad_events.push_back(ad_event);
 
-  const DailyCapExclusionRule exclusion_rule(ad_events);
+  const AdEventCounters ad_event_counters(
+      ConfirmationType::kServed, AdEventCounters::IdType::kCampaign, ad_events);
+  const DailyCapExclusionRule exclusion_rule(ad_event_counters);
 
   // Act
 
@@ -98,7 +104,9 @@ TEST_F(BraveAdsDailyCapExclusionRuleTest, AllowAdIfDoesNotExceedCapWithin1Day) {
 
   ad_events.push_back(ad_event);
 
-  const DailyCapExclusionRule exclusion_rule(ad_events);
+  const AdEventCounters ad_event_counters(
+      ConfirmationType::kServed, AdEventCounters::IdType::kCampaign, ad_events);
+  const DailyCapExclusionRule exclusion_rule(ad_event_counters);
 
   AdvanceClockBy(base::Days(1) - base::Milliseconds(1));
 
@@ -121,7 +129,9 @@ TEST_F(BraveAdsDailyCapExclusionRuleTest, AllowAdIfDoesNotExceedCapAfter1Day) {
 
   ad_events.push_back(ad_event);
 
-  const DailyCapExclusionRule exclusion_rule(ad_events);
+  const AdEventCounters ad_event_counters(
+      ConfirmationType::kServed, AdEventCounters::IdType::kCampaign, ad_events);
+  const DailyCapExclusionRule exclusion_rule(ad_event_counters);
 
   AdvanceClockBy(base::Days(1));
 
@@ -145,7 +155,9 @@ TEST_F(BraveAdsDailyCapExclusionRuleTest, DoNotAllowAdIfExceedsCap) {
   ad_events.push_back(ad_event);
   ad_events.push_back(ad_event);
 
-  const DailyCapExclusionRule exclusion_rule(ad_events);
+  const AdEventCounters ad_event_counters(
+      ConfirmationType::kServed, AdEventCounters::IdType::kCampaign, ad_events);
+  const DailyCapExclusionRule exclusion_rule(ad_event_counters);
 
   // Act
 
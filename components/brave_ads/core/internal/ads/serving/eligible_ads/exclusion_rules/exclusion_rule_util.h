@@ -7,7 +7,6 @@
 #define BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_ADS_SERVING_ELIGIBLE_ADS_EXCLUSION_RULES_EXCLUSION_RULE_UTIL_H_
 
 #include "base/check.h"
-#include "brave/components/brave_ads/core/internal/ads/ad_events/ad_event_info.h"
 #include "brave/components/brave_ads/core/internal/ads/serving/eligible_ads/exclusion_rules/exclusion_rule_interface.h"
 #include "brave/components/brave_ads/core/internal/common/logging_util.h"
 
@@ -17,22 +16,19 @@ class TimeDelta;
 
 namespace brave_ads {
 
-class ConfirmationType;
+class AdEventCounters;
 struct CreativeAdInfo;
 
 bool DoesRespectCampaignCap(const CreativeAdInfo& creative_ad,
-                            const AdEventList& ad_events,
-                            const ConfirmationType& confirmation_type,
+                            const AdEventCounters& ad_event_counters,
                             base::TimeDelta time_constraint,
                             size_t cap);
 bool DoesRespectCreativeSetCap(const CreativeAdInfo& creative_ad,
-                               const AdEventList& ad_events,
-                               const ConfirmationType& confirmation_type,
+                               const AdEventCounters& ad_event_counters,
                                base::TimeDelta time_constraint,
                                size_t cap);
 bool DoesRespectCreativeCap(const CreativeAdInfo& creative_ad,
-                            const AdEventList& ad_events,
-                            const ConfirmationType& confirmation_type,
+                            const AdEventCounters& ad_event_counters,
                             base::TimeDelta time_constraint,
                             size_t cap);
 
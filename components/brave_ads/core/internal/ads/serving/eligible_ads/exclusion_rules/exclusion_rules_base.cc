@@ -8,6 +8,7 @@
 #include <utility>
 
 #include "base/ranges/algorithm.h"
+#include "brave/components/brave_ads/core/internal/ads/ad_events/ad_event_counters_cache.h"
 #include "brave/components/brave_ads/core/internal/ads/serving/eligible_ads/exclusion_rules/anti_targeting_exclusion_rule.h"
 #include "brave/components/brave_ads/core/internal/ads/serving/eligible_ads/exclusion_rules/conversion_exclusion_rule.h"
 #include "brave/components/brave_ads/core/internal/ads/serving/eligible_ads/exclusion_rules/daily_cap_exclusion_rule.h"
@@ -30,21 +31,25 @@
 namespace brave_ads {
 
 ExclusionRulesBase::ExclusionRulesBase(
+    const AdType& ad_type,
     const AdEventList& ad_events,
     const SubdivisionTargeting& subdivision_targeting,
     const AntiTargetingResource& anti_targeting_resource,
-    const BrowsingHistoryList& browsing_history) {
+    const BrowsingHistoryList& browsing_history)
+    : ad_type_(ad_type) {
   auto anti_targeting_exclusion_rule =
       std::make_unique<AntiTargetingExclusionRule>(anti_targeting_resource,
                                                    browsing_history);
   exclusion_rules_.push_back(std::move(anti_targeting_exclusion_rule));
 
-  auto conversion_exclusion_rule =
-      std::make_unique<ConversionExclusionRule>(ad_events);
+  auto conversion_exclusion_rule = std::make_unique<ConversionExclusionRule>(
+      GetAdEventCounters(ad_events, ConfirmationType::kConversion,
+                         AdEventCounters::IdType::kCreativeSet));
   exclusion_rules_.push_back(std::move(conversion_exclusion_rule));
 
-  auto daily_cap_exclusion_rule =
-      std::make_unique<DailyCapExclusionRule>(ad_events);
+  auto daily_cap_exclusion_rule = std::make_unique<DailyCapExclusionRule>(
+      GetAdEventCounters(ad_events, ConfirmationType::kServed,
+                         AdEventCounters::IdType::kCampaign));
   exclusion_rules_.push_back(std::move(daily_cap_exclusion_rule));
 
   auto daypart_exclusion_rule = std::make_unique<DaypartExclusionRule>();
@@ -61,16 +66,19 @@ ExclusionRulesBase::ExclusionRulesBase(
       std::make_unique<MarkedAsInappropriateExclusionRule>();
   exclusion_rules_.push_back(std::move(marked_as_inappropriate_exclusion_rule));
 
-  auto per_day_exclusion_rule =
-      std::make_unique<PerDayExclusionRule>(ad_events);
+  auto per_day_exclusion_rule = std::make_unique<PerDayExclusionRule>(
+      GetAdEventCounters(ad_events, ConfirmationType::kServed,
+                         AdEventCounters::IdType::kCreativeSet));
   exclusion_rules_.push_back(std::move(per_day_exclusion_rule));
 
-  auto per_month_exclusion_rule =
-      std::make_unique<PerMonthExclusionRule>(ad_events);
+  auto per_month_exclusion_rule = std::make_unique<PerMonthExclusionRule>(
+      GetAdEventCounters(ad_events, ConfirmationType::kServed,
+                         AdEventCounters::IdType::kCreativeSet));
   exclusion_rules_.push_back(std::move(per_month_exclusion_rule));
 
-  auto per_week_exclusion_rule =
-      std::make_unique<PerWeekExclusionRule>(ad_events);
+  auto per_week_exclusion_rule = std::make_unique<PerWeekExclusionRule>(
+      GetAdEventCounters(ad_events, ConfirmationType::kServed,
+                         AdEventCounters::IdType::kCreativeSet));
   exclusion_rules_.push_back(std::move(per_week_exclusion_rule));
 
   auto split_test_exclusion_rule = std::make_unique<SplitTestExclusionRule>();
@@ -81,12 +89,14 @@ ExclusionRulesBase::ExclusionRulesBase(
           subdivision_targeting);
   exclusion_rules_.push_back(std::move(subdivision_targeting_exclusion_rule));
 
-  auto total_max_exclusion_rule =
-      std::make_unique<TotalMaxExclusionRule>(ad_events);
+  auto total_max_exclusion_rule = std::make_unique<TotalMaxExclusionRule>(
+      GetAdEventCounters(ad_events, ConfirmationType::kServed,
+                         AdEventCounters::IdType::kCreativeSet));
   exclusion_rules_.push_back(std::move(total_max_exclusion_rule));
 
-  auto transferred_exclusion_rule =
-      std::make_unique<TransferredExclusionRule>(ad_events);
+  auto transferred_exclusion_rule = std::make_unique<TransferredExclusionRule>(
+      GetAdEventCounters(ad_events, ConfirmationType::kTransferred,
+                         AdEventCounters::IdType::kCampaign));
   exclusion_rules_.push_back(std::move(transferred_exclusion_rule));
 }
 
@@ -124,6 +134,22 @@ bool ExclusionRulesBase::AddToCacheIfNeeded(
   return true;
 }
 
+const AdEventCounters& ExclusionRulesBase::GetAdEventCounters(
+    const AdEventList& ad_events,
+    const ConfirmationType& confirmation_type,
+    const AdEventCounters::IdType id_type) {
+  if (const AdEventCounters* const ad_event_counters =
+          AdEventCountersCache::GetInstance().Get(ad_type_, confirmation_type,
+                                                  id_type)) {
+    return *ad_event_counters;
+  }
+
+  const auto key = std::make_pair(confirmation_type.value(), id_type);
+  return ad_event_counters_
+      .try_emplace(key, confirmation_type, id_type, ad_events)
+      .first->second;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 bool ExclusionRulesBase::IsCached(const CreativeAdInfo& creative_ad) const {
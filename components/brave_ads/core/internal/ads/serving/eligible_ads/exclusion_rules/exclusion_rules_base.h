@@ -6,11 +6,16 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_ADS_SERVING_ELIGIBLE_ADS_EXCLUSION_RULES_EXCLUSION_RULES_BASE_H_
 #define BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_ADS_SERVING_ELIGIBLE_ADS_EXCLUSION_RULES_EXCLUSION_RULES_BASE_H_
 
+#include <map>
 #include <memory>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "brave/components/brave_ads/core/ad_type.h"
+#include "brave/components/brave_ads/core/confirmation_type.h"
+#include "brave/components/brave_ads/core/internal/ads/ad_events/ad_event_counters.h"
 #include "brave/components/brave_ads/core/internal/ads/ad_events/ad_event_info.h"
 #include "brave/components/brave_ads/core/internal/ads/serving/eligible_ads/exclusion_rules/exclusion_rule_alias.h"
 #include "brave/components/brave_ads/core/internal/ads/serving/eligible_ads/exclusion_rules/exclusion_rule_interface.h"
@@ -34,11 +39,26 @@ class ExclusionRulesBase {
   virtual bool ShouldExcludeCreativeAd(const CreativeAdInfo& creative_ad);
 
  protected:
-  ExclusionRulesBase(const AdEventList& ad_events,
+  ExclusionRulesBase(const AdType& ad_type,
+                     const AdEventList& ad_events,
                      const SubdivisionTargeting& subdivision_targeting,
                      const AntiTargetingResource& anti_targeting_resource,
                      const BrowsingHistoryList& browsing_history);
 
+  // Returns counters for |confirmation_type| ad events by |id_type|. Counters
+  // are kept up to date as ad events are recorded once they have been rebuilt
+  // from the database, otherwise they are built from |ad_events| and shared by
+  // the exclusion rules which need them.
+  const AdEventCounters& GetAdEventCounters(
+      const AdEventList& ad_events,
+      const ConfirmationType& confirmation_type,
+      AdEventCounters::IdType id_type);
+
+  // Must outlive |exclusion_rules_|.
+  std::map<std::pair<ConfirmationType::Value, AdEventCounters::IdType>,
+           AdEventCounters>
+      ad_event_counters_;
+
   std::vector<std::unique_ptr<ExclusionRuleInterface<CreativeAdInfo>>>
       exclusion_rules_;
 
@@ -49,6 +69,8 @@ class ExclusionRulesBase {
           exclusion_rule);
 
  private:
+  const AdType ad_type_;
+
   bool IsCached(const CreativeAdInfo& creative_ad) const;
   void AddToCache(const std::string& uuid);
 };
@@ -12,6 +12,7 @@
 #include "base/ranges/algorithm.h"
 #include "brave/components/brave_ads/core/ad_info.h"
 #include "brave/components/brave_ads/core/internal/ads/serving/eligible_ads/exclusion_rules/exclusion_rules_base.h"
+#include "brave/components/brave_ads/core/internal/ads/serving/serving_stage_timer.h"
 #include "brave/components/brave_ads/core/internal/creatives/creative_ad_info.h"
 
 namespace brave_ads {
@@ -27,6 +28,8 @@ T ApplyExclusionRules(const T& creative_ads,
                       ExclusionRulesBase* exclusion_rules) {
   CHECK(exclusion_rules);
 
+  const ServingStageTimer timer(ServingStageType::kExclusionRules);
+
   const bool should_cap_last_served_creative_ad =
       ShouldCapLastServedCreativeAd(creative_ads);
 
@@ -8,6 +8,8 @@
 #include <memory>
 #include <utility>
 
+#include "brave/components/brave_ads/core/ad_type.h"
+#include "brave/components/brave_ads/core/confirmation_type.h"
 #include "brave/components/brave_ads/core/internal/ads/serving/eligible_ads/exclusion_rules/creative_instance_exclusion_rule.h"
 #include "brave/components/brave_ads/core/internal/geographic/subdivision_targeting/subdivision_targeting.h"
 #include "brave/components/brave_ads/core/internal/resources/behavioral/anti_targeting/anti_targeting_resource.h"
@@ -19,12 +21,15 @@ InlineContentAdExclusionRules::InlineContentAdExclusionRules(
     const SubdivisionTargeting& subdivision_targeting,
     const AntiTargetingResource& anti_targeting_resource,
     const BrowsingHistoryList& browsing_history)
-    : ExclusionRulesBase(ad_events,
+    : ExclusionRulesBase(AdType::kInlineContentAd,
+                         ad_events,
                          subdivision_targeting,
                          anti_targeting_resource,
                          browsing_history) {
   auto creative_instance_exclusion_rule =
-      std::make_unique<CreativeInstanceExclusionRule>(ad_events);
+      std::make_unique<CreativeInstanceExclusionRule>(
+          GetAdEventCounters(ad_events, ConfirmationType::kServed,
+                             AdEventCounters::IdType::kCreativeInstance));
   exclusion_rules_.push_back(std::move(creative_instance_exclusion_rule));
 }
 
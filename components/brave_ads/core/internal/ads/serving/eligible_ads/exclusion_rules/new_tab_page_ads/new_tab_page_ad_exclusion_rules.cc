@@ -5,6 +5,7 @@
 
 #include "brave/components/brave_ads/core/internal/ads/serving/eligible_ads/exclusion_rules/new_tab_page_ads/new_tab_page_ad_exclusion_rules.h"
 
+#include "brave/components/brave_ads/core/ad_type.h"
 #include "brave/components/brave_ads/core/internal/geographic/subdivision_targeting/subdivision_targeting.h"
 #include "brave/components/brave_ads/core/internal/resources/behavioral/anti_targeting/anti_targeting_resource.h"
 
@@ -15,7 +16,8 @@ NewTabPageAdExclusionRules::NewTabPageAdExclusionRules(
     const SubdivisionTargeting& subdivision_targeting,
     const AntiTargetingResource& anti_targeting_resource,
     const BrowsingHistoryList& browsing_history)
-    : ExclusionRulesBase(ad_events,
+    : ExclusionRulesBase(AdType::kNewTabPageAd,
+                         ad_events,
                          subdivision_targeting,
                          anti_targeting_resource,
                          browsing_history) {}
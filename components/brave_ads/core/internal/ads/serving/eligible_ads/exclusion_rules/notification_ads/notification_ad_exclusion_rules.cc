@@ -8,6 +8,8 @@
 #include <memory>
 #include <utility>
 
+#include "brave/components/brave_ads/core/ad_type.h"
+#include "brave/components/brave_ads/core/confirmation_type.h"
 #include "brave/components/brave_ads/core/internal/ads/serving/eligible_ads/exclusion_rules/creative_instance_exclusion_rule.h"
 #include "brave/components/brave_ads/core/internal/ads/serving/eligible_ads/exclusion_rules/notification_ads/notification_ad_dismissed_exclusion_rule.h"
 #include "brave/components/brave_ads/core/internal/ads/serving/eligible_ads/exclusion_rules/notification_ads/notification_ad_embedding_exclusion_rule.h"
@@ -21,12 +23,15 @@ NotificationAdExclusionRules::NotificationAdExclusionRules(
     const SubdivisionTargeting& subdivision_targeting,
     const AntiTargetingResource& anti_targeting_resource,
     const BrowsingHistoryList& browsing_history)
-    : ExclusionRulesBase(ad_events,
+    : ExclusionRulesBase(AdType::kNotificationAd,
+                         ad_events,
                          subdivision_targeting,
                          anti_targeting_resource,
                          browsing_history) {
   auto creative_instance_exclusion_rule =
-      std::make_unique<CreativeInstanceExclusionRule>(ad_events);
+      std::make_unique<CreativeInstanceExclusionRule>(
+          GetAdEventCounters(ad_events, ConfirmationType::kServed,
+                             AdEventCounters::IdType::kCreativeInstance));
   exclusion_rules_.push_back(std::move(creative_instance_exclusion_rule));
 
   auto dismissed_exclusion_rule =
@@ -8,7 +8,8 @@
 
 #include <string>
 
-#include "brave/components/brave_ads/core/internal/ads/ad_events/ad_event_info.h"
+#include "base/memory/raw_ref.h"
+#include "brave/components/brave_ads/core/internal/ads/ad_events/ad_event_counters.h"
 #include "brave/components/brave_ads/core/internal/ads/serving/eligible_ads/exclusion_rules/exclusion_rule_interface.h"
 
 namespace brave_ads {
@@ -18,7 +19,7 @@ struct CreativeAdInfo;
 class PerDayExclusionRule final
     : public ExclusionRuleInterface<CreativeAdInfo> {
  public:
-  explicit PerDayExclusionRule(AdEventList ad_events);
+  explicit PerDayExclusionRule(const AdEventCounters& ad_event_counters);
 
   PerDayExclusionRule(const PerDayExclusionRule&) = delete;
   PerDayExclusionRule& operator=(const PerDayExclusionRule&) = delete;
@@ -34,7 +35,7 @@ class PerDayExclusionRule final
       const CreativeAdInfo& creative_ad) const override;
 
  private:
-  AdEventList ad_events_;
+  const raw_ref<const AdEventCounters> ad_event_counters_;
 };
 
 }  // namespace brave_ads
@@ -23,7 +23,9 @@ TEST_F(BraveAdsPerDayExclusionRuleTest, AllowAdIfThereIsNoAdsHistory) {
   creative_ad.creative_set_id = kCreativeSetId;
   creative_ad.per_day = 2;
 
-  const PerDayExclusionRule exclusion_rule(/*ad_events*/ {});
+  const AdEventCounters ad_event_counters(
+      ConfirmationType::kServed, AdEventCounters::IdType::kCreativeSet);
+  const PerDayExclusionRule exclusion_rule(ad_event_counters);
 
   // Act
 
@@ -37,7 +39,9 @@ TEST_F(BraveAdsPerDayExclusionRuleTest, AllowAdIfZero) {
   creative_ad.creative_set_id = kCreativeSetId;
   creative_ad.per_day = 0;
 
-  const PerDayExclusionRule exclusion_rule(/*ad_events*/ {});
+  const AdEventCounters ad_event_counters(
+      ConfirmationType::kServed, AdEventCounters::IdType::kCreativeSet);
+  const PerDayExclusionRule exclusion_rule(ad_event_counters);
 
   // Act
 
@@ -58,7 +62,10 @@ TEST_F(BraveAdsPerDayExclusionRuleTest, AllowAdIfDoesNotExceedCap) {
 
   ad_events.push_back(ad_event);
 
-  const PerDayExclusionRule exclusion_rule(ad_events);
+  const AdEventCounters ad_event_counters(
+      ConfirmationType::kServed, AdEventCounters::IdType::kCreativeSet,
+      ad_events);
+  const PerDayExclusionRule exclusion_rule(ad_event_counters);
 
   // Act
 
@@ -80,7 +87,10 @@ TEST_F(BraveAdsPerDayExclusionRuleTest, AllowAdIfDoesNotExceedCapAfter1Day) {
   ad_events.push_back(ad_event);
   ad_events.push_back(ad_event);
 
-  const PerDayExclusionRule exclusion_rule(ad_events);
+  const AdEventCounters ad_event_counters(
+      ConfirmationType::kServed, AdEventCounters::IdType::kCreativeSet,
+      ad_events);
+  const PerDayExclusionRule exclusion_rule(ad_event_counters);
 
   AdvanceClockBy(base::Days(1));
 
@@ -104,7 +114,10 @@ TEST_F(BraveAdsPerDayExclusionRuleTest, DoNotAllowAdIfExceedsCapWithin1Day) {
   ad_events.push_back(ad_event);
   ad_events.push_back(ad_event);
 
-  const PerDayExclusionRule exclusion_rule(ad_events);
+  const AdEventCounters ad_event_counters(
+      ConfirmationType::kServed, AdEventCounters::IdType::kCreativeSet,
+      ad_events);
+  const PerDayExclusionRule exclusion_rule(ad_event_counters);
 
   AdvanceClockBy(base::Days(1) - base::Milliseconds(1));
 
@@ -128,7 +141,10 @@ TEST_F(BraveAdsPerDayExclusionRuleTest, DoNotAllowAdIfExceedsCap) {
   ad_events.push_back(ad_event);
   ad_events.push_back(ad_event);
 
-  const PerDayExclusionRule exclusion_rule(ad_events);
+  const AdEventCounters ad_event_counters(
+      ConfirmationType::kServed, AdEventCounters::IdType::kCreativeSet,
+      ad_events);
+  const PerDayExclusionRule exclusion_rule(ad_event_counters);
 
   // Act
 
@@ -5,10 +5,7 @@
 
 #include "brave/components/brave_ads/core/internal/ads/serving/eligible_ads/exclusion_rules/per_month_exclusion_rule.h"
 
-#include <utility>
-
 #include "base/strings/string_util.h"
-#include "brave/components/brave_ads/core/confirmation_type.h"
 #include "brave/components/brave_ads/core/internal/ads/serving/eligible_ads/exclusion_rules/exclusion_rule_util.h"
 #include "brave/components/brave_ads/core/internal/creatives/creative_ad_info.h"
 
@@ -16,22 +13,22 @@ namespace brave_ads {
 
 namespace {
 
-bool DoesRespectCap(const AdEventList& ad_events,
+bool DoesRespectCap(const AdEventCounters& ad_event_counters,
                     const CreativeAdInfo& creative_ad) {
   if (creative_ad.per_month == 0) {
     // Always respect cap if set to 0
     return true;
   }
 
-  return DoesRespectCreativeSetCap(creative_ad, ad_events,
-                                   ConfirmationType::kServed, base::Days(28),
-                                   creative_ad.per_month);
+  return DoesRespectCreativeSetCap(creative_ad, ad_event_counters,
+                                   base::Days(28), creative_ad.per_month);
 }
 
 }  // namespace
 
-PerMonthExclusionRule::PerMonthExclusionRule(AdEventList ad_events)
-    : ad_events_(std::move(ad_events)) {}
+PerMonthExclusionRule::PerMonthExclusionRule(
+    const AdEventCounters& ad_event_counters)
+    : ad_event_counters_(ad_event_counters) {}
 
 PerMonthExclusionRule::~PerMonthExclusionRule() = default;
 
@@ -42,7 +39,7 @@ std::string PerMonthExclusionRule::GetUuid(
 
 base::expected<void, std::string> PerMonthExclusionRule::ShouldInclude(
     const CreativeAdInfo& creative_ad) const {
-  if (!DoesRespectCap(ad_events_, creative_ad)) {
+  if (!DoesRespectCap(*ad_event_counters_, creative_ad)) {
     return base::unexpected(base::ReplaceStringPlaceholders(
         "creativeSetId $1 has exceeded the perMonth frequency cap",
         {creative_ad.creative_set_id}, nullptr));
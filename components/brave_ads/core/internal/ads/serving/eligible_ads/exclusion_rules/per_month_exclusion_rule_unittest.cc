@@ -23,7 +23,9 @@ TEST_F(BraveAdsPerMonthExclusionRuleTest, AllowAdIfThereIsNoAdsHistory) {
   creative_ad.creative_set_id = kCreativeSetId;
   creative_ad.per_month = 2;
 
-  const PerMonthExclusionRule exclusion_rule(/*ad_events*/ {});
+  const AdEventCounters ad_event_counters(
+      ConfirmationType::kServed, AdEventCounters::IdType::kCreativeSet);
+  const PerMonthExclusionRule exclusion_rule(ad_event_counters);
 
   // Act
 
@@ -37,7 +39,9 @@ TEST_F(BraveAdsPerMonthExclusionRuleTest, AllowAdIfZero) {
   creative_ad.creative_set_id = kCreativeSetId;
   creative_ad.per_month = 0;
 
-  const PerMonthExclusionRule exclusion_rule(/*ad_events*/ {});
+  const AdEventCounters ad_event_counters(
+      ConfirmationType::kServed, AdEventCounters::IdType::kCreativeSet);
+  const PerMonthExclusionRule exclusion_rule(ad_event_counters);
 
   // Act
 
@@ -58,7 +62,10 @@ TEST_F(BraveAdsPerMonthExclusionRuleTest, AllowAdIfDoesNotExceedCap) {
 
   ad_events.push_back(ad_event);
 
-  const PerMonthExclusionRule exclusion_rule(ad_events);
+  const AdEventCounters ad_event_counters(
+      ConfirmationType::kServed, AdEventCounters::IdType::kCreativeSet,
+      ad_events);
+  const PerMonthExclusionRule exclusion_rule(ad_event_counters);
 
   // Act
 
@@ -81,7 +88,10 @@ TEST_F(BraveAdsPerMonthExclusionRuleTest,
   ad_events.push_back(ad_event);
   ad_events.push_back(ad_event);
 
-  const PerMonthExclusionRule exclusion_rule(ad_events);
+  const AdEventCounters ad_event_counters(
+      ConfirmationType::kServed, AdEventCounters::IdType::kCreativeSet,
+      ad_events);
+  const PerMonthExclusionRule exclusion_rule(ad_event_counters);
 
   AdvanceClockBy(base::Days(28));
 
@@ -106,7 +116,10 @@ TEST_F(BraveAdsPerMonthExclusionRuleTest,
   ad_events.push_back(ad_event);
   ad_events.push_back(ad_event);
 
-  const PerMonthExclusionRule exclusion_rule(ad_events);
+  const AdEventCounters ad_event_counters(
+      ConfirmationType::kServed, AdEventCounters::IdType::kCreativeSet,
+      ad_events);
+  const PerMonthExclusionRule exclusion_rule(ad_event_counters);
 
   AdvanceClockBy(base::Days(28) - base::Milliseconds(1));
 
@@ -130,7 +143,10 @@ TEST_F(BraveAdsPerMonthExclusionRuleTest, DoNotAllowAdIfExceedsCap) {
   ad_events.push_back(ad_event);
   ad_events.push_back(ad_event);
 
-  const PerMonthExclusionRule exclusion_rule(ad_events);
+  const AdEventCounters ad_event_counters(
+      ConfirmationType::kServed, AdEventCounters::IdType::kCreativeSet,
+      ad_events);
+  const PerMonthExclusionRule exclusion_rule(ad_event_counters);
 
   // Act
 
@@ -23,7 +23,9 @@ TEST_F(BraveAdsPerWeekExclusionRuleTest, AllowAdIfThereIsNoAdsHistory) {
   creative_ad.creative_set_id = kCreativeSetId;
   creative_ad.per_week = 2;
 
-  const PerWeekExclusionRule exclusion_rule(/*ad_events*/ {});
+  const AdEventCounters ad_event_counters(
+      ConfirmationType::kServed, AdEventCounters::IdType::kCreativeSet);
+  const PerWeekExclusionRule exclusion_rule(ad_event_counters);
 
   // Act
 
@@ -37,7 +39,9 @@ TEST_F(BraveAdsPerWeekExclusionRuleTest, AllowAdIfZero) {
   creative_ad.creative_set_id = kCreativeSetId;
   creative_ad.per_week = 0;
 
-  const PerWeekExclusionRule exclusion_rule(/*ad_events*/ {});
+  const AdEventCounters ad_event_counters(
+      ConfirmationType::kServed, AdEventCounters::IdType::kCreativeSet);
+  const PerWeekExclusionRule exclusion_rule(ad_event_counters);
 
   // Act
 
@@ -58,7 +62,10 @@ TEST_F(BraveAdsPerWeekExclusionRuleTest, AllowAdIfDoesNotExceedCap) {
 
   ad_events.push_back(ad_event);
 
-  const PerWeekExclusionRule exclusion_rule(ad_events);
+  const AdEventCounters ad_event_counters(
+      ConfirmationType::kServed, AdEventCounters::IdType::kCreativeSet,
+      ad_events);
+  const PerWeekExclusionRule exclusion_rule(ad_event_counters);
 
   // Act
 
@@ -80,7 +87,10 @@ TEST_F(BraveAdsPerWeekExclusionRuleTest, AllowAdIfDoesNotExceedCapAfter1Week) {
   ad_events.push_back(ad_event);
   ad_events.push_back(ad_event);
 
-  const PerWeekExclusionRule exclusion_rule(ad_events);
+  const AdEventCounters ad_event_counters(
+      ConfirmationType::kServed, AdEventCounters::IdType::kCreativeSet,
+      ad_events);
+  const PerWeekExclusionRule exclusion_rule(ad_event_counters);
 
   AdvanceClockBy(base::Days(7));
 
@@ -104,7 +114,10 @@ TEST_F(BraveAdsPerWeekExclusionRuleTest, DoNotAllowAdIfExceedsCapWithin1Week) {
   ad_events.push_back(ad_event);
   ad_events.push_back(ad_event);
 
-  const PerWeekExclusionRule exclusion_rule(ad_events);
+  const AdEventCounters ad_event_counters(
+      ConfirmationType::kServed, AdEventCounters::IdType::kCreativeSet,
+      ad_events);
+  const PerWeekExclusionRule exclusion_rule(ad_event_counters);
 
   AdvanceClockBy(base::Days(7) - base::Milliseconds(1));
 
@@ -128,7 +141,10 @@ TEST_F(BraveAdsPerWeekExclusionRuleTest, DoNotAllowAdIfExceedsCap) {
   ad_events.push_back(ad_event);
   ad_events.push_back(ad_event);
 
-  const PerWeekExclusionRule exclusion_rule(ad_events);
+  const AdEventCounters ad_event_counters(
+      ConfirmationType::kServed, AdEventCounters::IdType::kCreativeSet,
+      ad_events);
+  const PerWeekExclusionRule exclusion_rule(ad_event_counters);
 
   // Act
 
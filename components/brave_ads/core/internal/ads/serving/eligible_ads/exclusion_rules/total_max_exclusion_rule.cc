@@ -5,31 +5,27 @@
 
 #include "brave/components/brave_ads/core/internal/ads/serving/eligible_ads/exclusion_rules/total_max_exclusion_rule.h"
 
-#include <utility>
-
-#include "base/ranges/algorithm.h"
 #include "base/strings/string_util.h"
+#include "base/time/time.h"
 #include "brave/components/brave_ads/core/internal/creatives/creative_ad_info.h"
 
 namespace brave_ads {
 
 namespace {
 
-bool DoesRespectCap(const AdEventList& ad_events,
+bool DoesRespectCap(const AdEventCounters& ad_event_counters,
                     const CreativeAdInfo& creative_ad) {
-  const size_t count = base::ranges::count_if(
-      ad_events, [&creative_ad](const AdEventInfo& ad_event) {
-        return ad_event.confirmation_type == ConfirmationType::kServed &&
-               ad_event.creative_set_id == creative_ad.creative_set_id;
-      });
+  const size_t count = ad_event_counters.Count(creative_ad.creative_set_id,
+                                               base::TimeDelta::Max());
 
   return static_cast<int>(count) < creative_ad.total_max;
 }
 
 }  // namespace
 
-TotalMaxExclusionRule::TotalMaxExclusionRule(AdEventList ad_events)
-    : ad_events_(std::move(ad_events)) {}
+TotalMaxExclusionRule::TotalMaxExclusionRule(
+    const AdEventCounters& ad_event_counters)
+    : ad_event_counters_(ad_event_counters) {}
 
 TotalMaxExclusionRule::~TotalMaxExclusionRule() = default;
 
@@ -40,7 +36,7 @@ std::string TotalMaxExclusionRule::GetUuid(
 
 base::expected<void, std::string> TotalMaxExclusionRule::ShouldInclude(
     const CreativeAdInfo& creative_ad) const {
-  if (!DoesRespectCap(ad_events_, creative_ad)) {
+  if (!DoesRespectCap(*ad_event_counters_, creative_ad)) {
     return base::unexpected(base::ReplaceStringPlaceholders(
         "creativeSetId $1 has exceeded the totalMax frequency cap",
         {creative_ad.creative_set_id}, nullptr));
@@ -32,7 +32,9 @@ TEST_F(BraveAdsTotalMaxExclusionRuleTest, AllowAdIfThereIsNoAdsHistory) {
   creative_ad.creative_set_id = kCreativeSetIds[0];
   creative_ad.total_max = 2;
 
-  const TotalMaxExclusionRule exclusion_rule(/*ad_events*/ {});
+  const AdEventCounters ad_event_counters(
+      ConfirmationType::kServed, AdEventCounters::IdType::kCreativeSet);
+  const TotalMaxExclusionRule exclusion_rule(ad_event_counters);
 
   // Act
 
@@ -53,7 +55,10 @@ TEST_F(BraveAdsTotalMaxExclusionRuleTest, AllowAdIfDoesNotExceedCap) {
 
   ad_events.push_back(ad_event);
 
-  const TotalMaxExclusionRule exclusion_rule(ad_events);
+  const AdEventCounters ad_event_counters(
+      ConfirmationType::kServed, AdEventCounters::IdType::kCreativeSet,
+      ad_events);
+  const TotalMaxExclusionRule exclusion_rule(ad_event_counters);
 
   // Act
 
@@ -79,7 +84,10 @@ TEST_F(BraveAdsTotalMaxExclusionRuleTest,
   ad_events.push_back(ad_event);
   ad_events.push_back(ad_event);
 
-  const TotalMaxExclusionRule exclusion_rule(ad_events);
+  const AdEventCounters ad_event_counters(
+      ConfirmationType::kServed, AdEventCounters::IdType::kCreativeSet,
+      ad_events);
+  const TotalMaxExclusionRule exclusion_rule(ad_event_counters);
 
   // Act
 
@@ -93,7 +101,9 @@ TEST_F(BraveAdsTotalMaxExclusionRuleTest, DoNotAllowAdIfExceedsZeroCap) {
   creative_ad.creative_set_id = kCreativeSetIds[0];
   creative_ad.total_max = 0;
 
-  const TotalMaxExclusionRule exclusion_rule(/*ad_events*/ {});
+  const AdEventCounters ad_event_counters(
+      ConfirmationType::kServed, AdEventCounters::IdType::kCreativeSet);
+  const TotalMaxExclusionRule exclusion_rule(ad_event_counters);
 
   // Act
 
@@ -115,7 +125,10 @@ TEST_F(BraveAdsTotalMaxExclusionRuleTest, DoNotAllowAdIfExceedsCap) {
   ad_events.push_back(ad_event);
   ad_events.push_back(ad_event);
 
-  const TotalMaxExclusionRule exclusion_rule(ad_events);
+  const AdEventCounters ad_event_counters(
+      ConfirmationType::kServed, AdEventCounters::IdType::kCreativeSet,
+      ad_events);
+  const TotalMaxExclusionRule exclusion_rule(ad_event_counters);
 
   // Act
 
@@ -5,10 +5,7 @@
 
 #include "brave/components/brave_ads/core/internal/ads/serving/eligible_ads/exclusion_rules/transferred_exclusion_rule.h"
 
-#include <utility>
-
 #include "base/strings/string_util.h"
-#include "brave/components/brave_ads/core/confirmation_type.h"
 #include "brave/components/brave_ads/core/internal/ads/serving/eligible_ads/exclusion_rules/exclusion_rule_feature.h"
 #include "brave/components/brave_ads/core/internal/ads/serving/eligible_ads/exclusion_rules/exclusion_rule_util.h"
 #include "brave/components/brave_ads/core/internal/creatives/creative_ad_info.h"
@@ -19,17 +16,18 @@ namespace {
 
 constexpr int kTransferredCap = 1;
 
-bool DoesRespectCap(const AdEventList& ad_events,
+bool DoesRespectCap(const AdEventCounters& ad_event_counters,
                     const CreativeAdInfo& creative_ad) {
   return DoesRespectCampaignCap(
-      creative_ad, ad_events, ConfirmationType::kTransferred,
+      creative_ad, ad_event_counters,
       kShouldExcludeAdIfTransferredWithinTimeWindow.Get(), kTransferredCap);
 }
 
 }  // namespace
 
-TransferredExclusionRule::TransferredExclusionRule(AdEventList ad_events)
-    : ad_events_(std::move(ad_events)) {}
+TransferredExclusionRule::TransferredExclusionRule(
+    const AdEventCounters& ad_event_counters)
+    : ad_event_counters_(ad_event_counters) {}
 
 TransferredExclusionRule::~TransferredExclusionRule() = default;
 
@@ -40,7 +38,7 @@ std::string TransferredExclusionRule::GetUuid(
 
 base::expected<void, std::string> TransferredExclusionRule::ShouldInclude(
     const CreativeAdInfo& creative_ad) const {
-  if (!DoesRespectCap(ad_events_, creative_ad)) {
+  if (!DoesRespectCap(*ad_event_counters_, creative_ad)) {
     return base::unexpected(base::ReplaceStringPlaceholders(
         "campaignId $1 has exceeded the transferred frequency cap",
         {creative_ad.campaign_id}, nullptr));
@@ -34,7 +34,9 @@ TEST_F(BraveAdsTransferredExclusionRuleTest, AllowAdIfThereIsNoAdsHistory) {
   creative_ad.creative_instance_id = kCreativeInstanceId;
   creative_ad.campaign_id = kCampaignIds[0];
 
-  const TransferredExclusionRule exclusion_rule(/*ad_events*/ {});
+  const AdEventCounters ad_event_counters(ConfirmationType::kTransferred,
+                                          AdEventCounters::IdType::kCampaign);
+  const TransferredExclusionRule exclusion_rule(ad_event_counters);
 
   // Act
 
@@ -72,7 +74,10 @@ TEST_F(BraveAdsTransferredExclusionRuleTest,
 
   ad_events.push_back(ad_event);
 
-  const TransferredExclusionRule exclusion_rule(ad_events);
+  const AdEventCounters ad_event_counters(
+      ConfirmationType::kTransferred, AdEventCounters::IdType::kCampaign,
+      ad_events);
+  const TransferredExclusionRule exclusion_rule(ad_event_counters);
 
   AdvanceClockBy(base::Days(2) - base::Milliseconds(1));
 
@@ -126,7 +131,10 @@ TEST_F(BraveAdsTransferredExclusionRuleTest,
                    ConfirmationType::kTransferred, Now());
   ad_events.push_back(ad_event_3);
 
-  const TransferredExclusionRule exclusion_rule(ad_events);
+  const AdEventCounters ad_event_counters(
+      ConfirmationType::kTransferred, AdEventCounters::IdType::kCampaign,
+      ad_events);
+  const TransferredExclusionRule exclusion_rule(ad_event_counters);
 
   AdvanceClockBy(base::Days(2) - base::Milliseconds(1));
 
@@ -162,7 +170,10 @@ TEST_F(BraveAdsTransferredExclusionRuleTest,
 
   ad_events.push_back(ad_event);
 
-  const TransferredExclusionRule exclusion_rule(ad_events);
+  const AdEventCounters ad_event_counters(
+      ConfirmationType::kTransferred, AdEventCounters::IdType::kCampaign,
+      ad_events);
+  const TransferredExclusionRule exclusion_rule(ad_event_counters);
 
   AdvanceClockBy(base::Days(2) - base::Milliseconds(1));
 
@@ -198,7 +209,10 @@ TEST_F(BraveAdsTransferredExclusionRuleTest,
 
   ad_events.push_back(ad_event);
 
-  const TransferredExclusionRule exclusion_rule(ad_events);
+  const AdEventCounters ad_event_counters(
+      ConfirmationType::kTransferred, AdEventCounters::IdType::kCampaign,
+      ad_events);
+  const TransferredExclusionRule exclusion_rule(ad_event_counters);
 
   AdvanceClockBy(base::Days(2) - base::Milliseconds(1));
 
@@ -234,7 +248,10 @@ TEST_F(BraveAdsTransferredExclusionRuleTest,
 
   ad_events.push_back(ad_event);
 
-  const TransferredExclusionRule exclusion_rule(ad_events);
+  const AdEventCounters ad_event_counters(
+      ConfirmationType::kTransferred, AdEventCounters::IdType::kCampaign,
+      ad_events);
+  const TransferredExclusionRule exclusion_rule(ad_event_counters);
 
   AdvanceClockBy(base::Days(2));
 
@@ -274,7 +291,10 @@ TEST_F(BraveAdsTransferredExclusionRuleTest,
 
   ad_events.push_back(ad_event);
 
-  const TransferredExclusionRule exclusion_rule(ad_events);
+  const AdEventCounters ad_event_counters(
+      ConfirmationType::kTransferred, AdEventCounters::IdType::kCampaign,
+      ad_events);
+  const TransferredExclusionRule exclusion_rule(ad_event_counters);
 
   AdvanceClockBy(base::Days(2));
 
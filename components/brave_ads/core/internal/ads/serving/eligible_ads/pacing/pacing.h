@@ -10,6 +10,7 @@
 
 #include "base/ranges/algorithm.h"
 #include "brave/components/brave_ads/core/internal/ads/serving/eligible_ads/pacing/pacing_util.h"
+#include "brave/components/brave_ads/core/internal/ads/serving/serving_stage_timer.h"
 
 namespace brave_ads {
 
@@ -21,6 +22,8 @@ T PaceCreativeAds(const T& creative_ads) {
     return {};
   }
 
+  const ServingStageTimer timer(ServingStageType::kPacing);
+
   T paced_creative_ads;
 
   base::ranges::copy_if(creative_ads, std::back_inserter(paced_creative_ads),
@@ -8,6 +8,7 @@
 
 #include "base/containers/flat_map.h"
 #include "brave/components/brave_ads/core/internal/ads/serving/eligible_ads/priority/priority_util.h"
+#include "brave/components/brave_ads/core/internal/ads/serving/serving_stage_timer.h"
 #include "brave/components/brave_ads/core/internal/common/logging_util.h"
 
 namespace brave_ads {
@@ -18,6 +19,8 @@ T PrioritizeCreativeAds(const T& creative_ads) {
     return {};
   }
 
+  const ServingStageTimer timer(ServingStageType::kPriority);
+
   const base::flat_map<int, T> buckets =
       SortCreativeAdsIntoPrioritizedBuckets(creative_ads);
   if (buckets.empty()) {
@@ -13,6 +13,7 @@
 #include "brave/components/brave_ads/core/internal/ads/serving/eligible_ads/pipelines/new_tab_page_ads/eligible_new_tab_page_ads_factory.h"
 #include "brave/components/brave_ads/core/internal/ads/serving/new_tab_page_ad_serving_feature.h"
 #include "brave/components/brave_ads/core/internal/ads/serving/permission_rules/new_tab_page_ads/new_tab_page_ad_permission_rules.h"
+#include "brave/components/brave_ads/core/internal/ads/serving/serving_stage_timer.h"
 #include "brave/components/brave_ads/core/internal/ads/serving/targeting/top_segments.h"
 #include "brave/components/brave_ads/core/internal/ads/serving/targeting/user_model_builder.h"
 #include "brave/components/brave_ads/core/internal/ads/serving/targeting/user_model_info.h"
@@ -54,16 +55,19 @@ void NewTabPageAdServing::MaybeServeAd(
     return FailedToServeAd(std::move(callback));
   }
 
-  BuildUserModel(base::BindOnce(&NewTabPageAdServing::BuildUserModelCallback,
-                                weak_factory_.GetWeakPtr(),
-                                std::move(callback)));
+  BuildUserModel(base::BindOnce(
+      &NewTabPageAdServing::BuildUserModelCallback, weak_factory_.GetWeakPtr(),
+      std::move(callback), ServingStageTimer(ServingStageType::kTargeting)));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
 void NewTabPageAdServing::BuildUserModelCallback(
     MaybeServeNewTabPageAdCallback callback,
+    ServingStageTimer targeting_timer,
     const UserModelInfo& user_model) {
+  targeting_timer.Stop();
+
   CHECK(eligible_ads_);
   eligible_ads_->GetForUserModel(
       user_model, base::BindOnce(&NewTabPageAdServing::GetForUserModelCallback,
@@ -19,6 +19,7 @@ namespace brave_ads {
 
 class AntiTargetingResource;
 class EligibleNewTabPageAdsBase;
+class ServingStageTimer;
 class SubdivisionTargeting;
 struct NewTabPageAdInfo;
 struct UserModelInfo;
@@ -47,6 +48,7 @@ class NewTabPageAdServing final {
   bool IsSupported() const { return bool{eligible_ads_}; }
 
   void BuildUserModelCallback(MaybeServeNewTabPageAdCallback callback,
+                              ServingStageTimer targeting_timer,
                               const UserModelInfo& user_model);
   void GetForUserModelCallback(MaybeServeNewTabPageAdCallback callback,
                                const UserModelInfo& user_model,
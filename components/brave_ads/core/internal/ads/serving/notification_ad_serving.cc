@@ -14,6 +14,7 @@
 #include "brave/components/brave_ads/core/internal/ads/serving/notification_ad_serving_feature.h"
 #include "brave/components/brave_ads/core/internal/ads/serving/notification_ad_serving_util.h"
 #include "brave/components/brave_ads/core/internal/ads/serving/permission_rules/notification_ads/notification_ad_permission_rules.h"
+#include "brave/components/brave_ads/core/internal/ads/serving/serving_stage_timer.h"
 #include "brave/components/brave_ads/core/internal/ads/serving/targeting/top_segments.h"
 #include "brave/components/brave_ads/core/internal/ads/serving/targeting/user_model_builder.h"
 #include "brave/components/brave_ads/core/internal/ads/serving/targeting/user_model_info.h"
@@ -91,14 +92,19 @@ void NotificationAdServing::MaybeServeAd() {
     return FailedToServeAd();
   }
 
-  BuildUserModel(base::BindOnce(&NotificationAdServing::BuildUserModelCallback,
-                                weak_factory_.GetWeakPtr()));
+  BuildUserModel(base::BindOnce(
+      &NotificationAdServing::BuildUserModelCallback,
+      weak_factory_.GetWeakPtr(),
+      ServingStageTimer(ServingStageType::kTargeting)));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
 void NotificationAdServing::BuildUserModelCallback(
+    ServingStageTimer targeting_timer,
     const UserModelInfo& user_model) {
+  targeting_timer.Stop();
+
   CHECK(eligible_ads_);
   eligible_ads_->GetForUserModel(
       user_model,
@@ -26,6 +26,7 @@ namespace brave_ads {
 
 class AntiTargetingResource;
 class EligibleNotificationAdsBase;
+class ServingStageTimer;
 class SubdivisionTargeting;
 struct NotificationAdInfo;
 struct UserModelInfo;
@@ -57,7 +58,8 @@ class NotificationAdServing final : public AdsClientNotifierObserver {
  private:
   bool IsSupported() const { return bool{eligible_ads_}; }
 
-  void BuildUserModelCallback(const UserModelInfo& user_model);
+  void BuildUserModelCallback(ServingStageTimer targeting_timer,
+                              const UserModelInfo& user_model);
   void GetForUserModelCallback(const UserModelInfo& user_model,
                                bool had_opportunity,
                                const CreativeNotificationAdList& creative_ads);
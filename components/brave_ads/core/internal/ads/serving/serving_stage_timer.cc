@@ -0,0 +1,107 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/core/internal/ads/serving/serving_stage_timer.h"
+
+#include <utility>
+
+#include "base/metrics/histogram_functions.h"
+#include "base/notreached.h"
+#include "base/strings/strcat.h"
+#include "base/trace_event/trace_event.h"
+#include "brave/components/brave_ads/core/internal/diagnostics/entries/serving_stage_duration_diagnostic_util.h"
+
+namespace brave_ads {
+
+namespace {
+
+constexpr char kTraceCategory[] = "brave.ads";
+constexpr char kHistogramNamePrefix[] = "Brave.Ads.ServingStageDuration.";
+
+uint64_t g_next_trace_id = 0;
+
+const char* GetServingStageName(const ServingStageType type) {
+  switch (type) {
+    case ServingStageType::kTargeting: {
+      return "Targeting";
+    }
+
+    case ServingStageType::kDatabase: {
+      return "Database";
+    }
+
+    case ServingStageType::kExclusionRules: {
+      return "ExclusionRules";
+    }
+
+    case ServingStageType::kPacing: {
+      return "Pacing";
+    }
+
+    case ServingStageType::kPriority: {
+      return "Priority";
+    }
+
+    case ServingStageType::kPrediction: {
+      return "Prediction";
+    }
+  }
+
+  NOTREACHED_NORETURN() << "Unexpected value for ServingStageType: "
+                        << static_cast<int>(type);
+}
+
+}  // namespace
+
+ServingStageTimer::ServingStageTimer(const ServingStageType type)
+    : type_(type),
+      trace_id_(g_next_trace_id++),
+      started_at_(base::TimeTicks::Now()) {
+  TRACE_EVENT_NESTABLE_ASYNC_BEGIN0(kTraceCategory, GetServingStageName(type_),
+                                    TRACE_ID_LOCAL(trace_id_));
+}
+
+ServingStageTimer::ServingStageTimer(ServingStageTimer&& other) noexcept
+    : type_(other.type_),
+      trace_id_(other.trace_id_),
+      started_at_(std::exchange(other.started_at_, absl::nullopt)) {}
+
+ServingStageTimer& ServingStageTimer::operator=(
+    ServingStageTimer&& other) noexcept {
+  if (this != &other) {
+    Stop();
+
+    type_ = other.type_;
+    trace_id_ = other.trace_id_;
+    started_at_ = std::exchange(other.started_at_, absl::nullopt);
+  }
+
+  return *this;
+}
+
+ServingStageTimer::~ServingStageTimer() {
+  Stop();
+}
+
+void ServingStageTimer::Stop() {
+  if (!started_at_) {
+    return;
+  }
+
+  const base::TimeDelta duration = base::TimeTicks::Now() - *started_at_;
+  started_at_.reset();
+
+  const char* const name = GetServingStageName(type_);
+
+  TRACE_EVENT_NESTABLE_ASYNC_END0(kTraceCategory, name,
+                                  TRACE_ID_LOCAL(trace_id_));
+
+  base::UmaHistogramTimes(base::StrCat({kHistogramNamePrefix, name}),
+                          duration);
+
+  SetServingStageDurationDiagnosticEntry(type_, duration);
+}
+
+}  // namespace brave_ads
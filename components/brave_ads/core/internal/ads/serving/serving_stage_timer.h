@@ -0,0 +1,44 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_ADS_SERVING_SERVING_STAGE_TIMER_H_
+#define BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_ADS_SERVING_SERVING_STAGE_TIMER_H_
+
+#include <cstdint>
+
+#include "base/time/time.h"
+#include "brave/components/brave_ads/core/internal/ads/serving/serving_stage_types.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+
+namespace brave_ads {
+
+// Measures a stage of serving an ad. The stage is traced using the "brave.ads"
+// category and, when the timer is stopped or destroyed, its duration is
+// recorded to the "Brave.Ads.ServingStageDuration.*" histograms and to the
+// diagnostics shown on brave://ads-internals. Move the timer into a callback
+// to measure an asynchronous stage.
+class ServingStageTimer final {
+ public:
+  explicit ServingStageTimer(ServingStageType type);
+
+  ServingStageTimer(const ServingStageTimer&) = delete;
+  ServingStageTimer& operator=(const ServingStageTimer&) = delete;
+
+  ServingStageTimer(ServingStageTimer&&) noexcept;
+  ServingStageTimer& operator=(ServingStageTimer&&) noexcept;
+
+  ~ServingStageTimer();
+
+  void Stop();
+
+ private:
+  ServingStageType type_;
+  uint64_t trace_id_ = 0;
+  absl::optional<base::TimeTicks> started_at_;
+};
+
+}  // namespace brave_ads
+
+#endif  // BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_ADS_SERVING_SERVING_STAGE_TIMER_H_
@@ -0,0 +1,70 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/core/internal/ads/serving/serving_stage_timer.h"
+
+#include <utility>
+
+#include "base/test/metrics/histogram_tester.h"
+#include "brave/components/brave_ads/core/internal/common/unittest/unittest_base.h"
+
+// npm run test -- brave_unit_tests --filter=BraveAds*
+
+namespace brave_ads {
+
+class BraveAdsServingStageTimerTest : public UnitTestBase {
+ protected:
+  base::HistogramTester histogram_tester_;
+};
+
+TEST_F(BraveAdsServingStageTimerTest, RecordDurationWhenDestroyed) {
+  // Arrange
+
+  // Act
+  {
+    const ServingStageTimer timer(ServingStageType::kExclusionRules);
+    AdvanceClockBy(base::Milliseconds(7));
+  }
+
+  // Assert
+  histogram_tester_.ExpectUniqueTimeSample(
+      "Brave.Ads.ServingStageDuration.ExclusionRules", base::Milliseconds(7),
+      /*expected_bucket_count*/ 1);
+}
+
+TEST_F(BraveAdsServingStageTimerTest, RecordDurationWhenStopped) {
+  // Arrange
+  ServingStageTimer timer(ServingStageType::kDatabase);
+  AdvanceClockBy(base::Milliseconds(3));
+
+  // Act
+  timer.Stop();
+  AdvanceClockBy(base::Milliseconds(5));
+  timer.Stop();
+
+  // Assert
+  histogram_tester_.ExpectUniqueTimeSample(
+      "Brave.Ads.ServingStageDuration.Database", base::Milliseconds(3),
+      /*expected_bucket_count*/ 1);
+}
+
+TEST_F(BraveAdsServingStageTimerTest, RecordDurationOnceWhenMoved) {
+  // Arrange
+  ServingStageTimer timer(ServingStageType::kTargeting);
+  AdvanceClockBy(base::Milliseconds(2));
+
+  // Act
+  {
+    const ServingStageTimer moved_timer = std::move(timer);
+    AdvanceClockBy(base::Milliseconds(9));
+  }
+
+  // Assert
+  histogram_tester_.ExpectUniqueTimeSample(
+      "Brave.Ads.ServingStageDuration.Targeting", base::Milliseconds(11),
+      /*expected_bucket_count*/ 1);
+}
+
+}  // namespace brave_ads
@@ -8,6 +8,7 @@
 
 #include "base/feature_list.h"
 #include "base/metrics/field_trial_params.h"
+#include "base/time/time.h"
 
 namespace brave_ads {
 
@@ -21,6 +22,18 @@ constexpr base::FeatureParam<int> kTextEmbeddingResourceVersion{
 constexpr base::FeatureParam<int> kTextEmbeddingHistorySize{
     &kTextEmbeddingFeature, "history_size", 10};
 
+// Text embedding HTML events are buffered and written to the database in a
+// single transaction once |kTextEmbeddingHtmlEventsBatchSize| events have been
+// buffered or |kTextEmbeddingHtmlEventsFlushAfter| has elapsed since the first
+// buffered event, whichever comes first.
+constexpr base::FeatureParam<int> kTextEmbeddingHtmlEventsBatchSize{
+    &kTextEmbeddingFeature, "html_events_batch_size", 5};
+
+constexpr base::FeatureParam<base::TimeDelta>
+    kTextEmbeddingHtmlEventsFlushAfter{&kTextEmbeddingFeature,
+                                       "html_events_flush_after",
+                                       base::Seconds(30)};
+
 }  // namespace brave_ads
 
 #endif  // BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_ADS_SERVING_TARGETING_CONTEXTUAL_TEXT_EMBEDDING_TEXT_EMBEDDING_FEATURE_H_
@@ -133,4 +133,62 @@ TEST(BraveAdsTextClassificationFeatureTest,
   EXPECT_EQ(10, kTextEmbeddingHistorySize.Get());
 }
 
+TEST(BraveAdsTextEmbeddingFeatureTest, GetTextEmbeddingHtmlEventsBatchSize) {
+  // Arrange
+  base::FieldTrialParams params;
+  params["html_events_batch_size"] = "7";
+  std::vector<base::test::FeatureRefAndParams> enabled_features;
+  enabled_features.emplace_back(kTextEmbeddingFeature, params);
+
+  const std::vector<base::test::FeatureRef> disabled_features;
+
+  base::test::ScopedFeatureList scoped_feature_list;
+  scoped_feature_list.InitWithFeaturesAndParameters(enabled_features,
+                                                    disabled_features);
+
+  // Act
+
+  // Assert
+  EXPECT_EQ(7, kTextEmbeddingHtmlEventsBatchSize.Get());
+}
+
+TEST(BraveAdsTextEmbeddingFeatureTest,
+     DefaultTextEmbeddingHtmlEventsBatchSize) {
+  // Arrange
+
+  // Act
+
+  // Assert
+  EXPECT_EQ(5, kTextEmbeddingHtmlEventsBatchSize.Get());
+}
+
+TEST(BraveAdsTextEmbeddingFeatureTest, GetTextEmbeddingHtmlEventsFlushAfter) {
+  // Arrange
+  base::FieldTrialParams params;
+  params["html_events_flush_after"] = "1m";
+  std::vector<base::test::FeatureRefAndParams> enabled_features;
+  enabled_features.emplace_back(kTextEmbeddingFeature, params);
+
+  const std::vector<base::test::FeatureRef> disabled_features;
+
+  base::test::ScopedFeatureList scoped_feature_list;
+  scoped_feature_list.InitWithFeaturesAndParameters(enabled_features,
+                                                    disabled_features);
+
+  // Act
+
+  // Assert
+  EXPECT_EQ(base::Minutes(1), kTextEmbeddingHtmlEventsFlushAfter.Get());
+}
+
+TEST(BraveAdsTextEmbeddingFeatureTest,
+     DefaultTextEmbeddingHtmlEventsFlushAfter) {
+  // Arrange
+
+  // Act
+
+  // Assert
+  EXPECT_EQ(base::Seconds(30), kTextEmbeddingHtmlEventsFlushAfter.Get());
+}
+
 }  // namespace brave_ads
@@ -0,0 +1,21 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/core/internal/creatives/creative_ads_cache.h"
+
+#include "brave/components/brave_ads/core/internal/global_state/global_state.h"
+
+namespace brave_ads {
+
+CreativeAdsCache::CreativeAdsCache() = default;
+
+CreativeAdsCache::~CreativeAdsCache() = default;
+
+// static
+CreativeAdsCache& CreativeAdsCache::GetInstance() {
+  return GlobalState::GetInstance()->GetCreativeAdsCache();
+}
+
+}  // namespace brave_ads
@@ -0,0 +1,147 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_CREATIVES_CREATIVE_ADS_CACHE_H_
+#define BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_CREATIVES_CREATIVE_ADS_CACHE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include "base/containers/contains.h"
+#include "base/ranges/algorithm.h"
+#include "base/time/time.h"
+#include "brave/components/brave_ads/core/internal/creatives/inline_content_ads/creative_inline_content_ad_info.h"
+#include "brave/components/brave_ads/core/internal/creatives/new_tab_page_ads/creative_new_tab_page_ad_info.h"
+#include "brave/components/brave_ads/core/internal/creatives/notification_ads/creative_notification_ad_info.h"
+#include "brave/components/brave_ads/core/internal/segments/segment_alias.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+
+namespace brave_ads {
+
+template <typename T>
+T GetCreativeAdsForRunningCampaigns(const T& creative_ads) {
+  const base::Time now = base::Time::Now();
+
+  T running_creative_ads;
+  base::ranges::copy_if(
+      creative_ads, std::back_inserter(running_creative_ads),
+      [now](const auto& creative_ad) {
+        return now >= creative_ad.start_at && now <= creative_ad.end_at;
+      });
+  return running_creative_ads;
+}
+
+// Caches creative ads read from the database for a list of segments so that
+// serving an ad does not need to query the database unless the creative ads
+// have changed. Entries for an ad type are invalidated whenever its creative
+// ads are saved or deleted, i.e. when the catalog is updated or reset. Ads
+// for campaigns which have not started or have ended are filtered on read, so
+// entries do not need to expire. At most |kMaxEntries| lists of segments are
+// cached per ad type, the least recently used entry is evicted first.
+class CreativeAdsCache final {
+ public:
+  static constexpr size_t kMaxEntries = 25;
+
+  CreativeAdsCache();
+
+  CreativeAdsCache(const CreativeAdsCache&) = delete;
+  CreativeAdsCache& operator=(const CreativeAdsCache&) = delete;
+
+  CreativeAdsCache(CreativeAdsCache&&) noexcept = delete;
+  CreativeAdsCache& operator=(CreativeAdsCache&&) noexcept = delete;
+
+  ~CreativeAdsCache();
+
+  static CreativeAdsCache& GetInstance();
+
+  // Returns an opaque value which changes whenever creative ads of type |T|
+  // are invalidated. Pass the value obtained before reading from the database
+  // to |Set| so that a read which raced with a write is not cached.
+  template <typename T>
+  uint64_t GetGeneration() const {
+    return std::get<AdTypeEntries<T>>(ad_type_entries_).generation;
+  }
+
+  // Returns creative ads for |segments| with running campaigns, or
+  // |absl::nullopt| if the cache does not contain |segments|. |dimensions| is
+  // only set for ad types which are served for a given size, i.e. inline
+  // content ads.
+  template <typename T>
+  absl::optional<T> Get(const SegmentList& segments,
+                        const std::string& dimensions = {}) const {
+    const AdTypeEntries<T>& ad_type_entries =
+        std::get<AdTypeEntries<T>>(ad_type_entries_);
+
+    const auto iter = ad_type_entries.entries.find(Key{segments, dimensions});
+    if (iter == ad_type_entries.entries.cend()) {
+      return absl::nullopt;
+    }
+
+    iter->second.last_used = ++ad_type_entries.clock;
+
+    return GetCreativeAdsForRunningCampaigns(iter->second.creative_ads);
+  }
+
+  template <typename T>
+  void Set(const SegmentList& segments,
+           const T& creative_ads,
+           const uint64_t generation,
+           const std::string& dimensions = {}) {
+    AdTypeEntries<T>& ad_type_entries =
+        std::get<AdTypeEntries<T>>(ad_type_entries_);
+    if (generation != ad_type_entries.generation) {
+      return;
+    }
+
+    Key key{segments, dimensions};
+    auto& entries = ad_type_entries.entries;
+    if (entries.size() >= kMaxEntries && !base::Contains(entries, key)) {
+      entries.erase(base::ranges::min_element(
+          entries, [](const auto& lhs, const auto& rhs) {
+            return lhs.second.last_used < rhs.second.last_used;
+          }));
+    }
+
+    entries[std::move(key)] = {creative_ads, ++ad_type_entries.clock};
+  }
+
+  template <typename T>
+  void Invalidate() {
+    AdTypeEntries<T>& ad_type_entries =
+        std::get<AdTypeEntries<T>>(ad_type_entries_);
+    ad_type_entries.entries.clear();
+    ++ad_type_entries.generation;
+  }
+
+ private:
+  using Key = std::pair<SegmentList, /*dimensions*/ std::string>;
+
+  template <typename T>
+  struct Entry final {
+    T creative_ads;
+    mutable uint64_t last_used = 0;
+  };
+
+  template <typename T>
+  struct AdTypeEntries final {
+    std::map<Key, Entry<T>> entries;
+    uint64_t generation = 0;
+    mutable uint64_t clock = 0;
+  };
+
+  std::tuple<AdTypeEntries<CreativeInlineContentAdList>,
+             AdTypeEntries<CreativeNotificationAdList>,
+             AdTypeEntries<CreativeNewTabPageAdList>>
+      ad_type_entries_;
+};
+
+}  // namespace brave_ads
+
+#endif  // BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_CREATIVES_CREATIVE_ADS_CACHE_H_
@@ -0,0 +1,175 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/core/internal/creatives/creative_ads_cache.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#include "base/strings/string_number_conversions.h"
+
+#include "brave/components/brave_ads/core/internal/common/unittest/unittest_base.h"
+#include "brave/components/brave_ads/core/internal/common/unittest/unittest_time_util.h"
+#include "brave/components/brave_ads/core/internal/creatives/inline_content_ads/creative_inline_content_ad_unittest_util.h"
+#include "brave/components/brave_ads/core/internal/creatives/notification_ads/creative_notification_ad_unittest_util.h"
+
+// npm run test -- brave_unit_tests --filter=BraveAds*
+
+namespace brave_ads {
+
+class BraveAdsCreativeAdsCacheTest : public UnitTestBase {
+ protected:
+  CreativeAdsCache cache_;
+};
+
+TEST_F(BraveAdsCreativeAdsCacheTest, GetForSegments) {
+  // Arrange
+  const CreativeNotificationAdList creative_ads =
+      BuildCreativeNotificationAds(/*count*/ 2);
+
+  cache_.Set({"technology & computing"}, creative_ads,
+             cache_.GetGeneration<CreativeNotificationAdList>());
+
+  // Act
+  const absl::optional<CreativeNotificationAdList> cached_creative_ads =
+      cache_.Get<CreativeNotificationAdList>({"technology & computing"});
+
+  // Assert
+  EXPECT_EQ(creative_ads, cached_creative_ads);
+}
+
+TEST_F(BraveAdsCreativeAdsCacheTest, DoNotGetForUncachedSegments) {
+  // Arrange
+  cache_.Set({"technology & computing"},
+             BuildCreativeNotificationAds(/*count*/ 1),
+             cache_.GetGeneration<CreativeNotificationAdList>());
+
+  // Act
+  const absl::optional<CreativeNotificationAdList> cached_creative_ads =
+      cache_.Get<CreativeNotificationAdList>({"untargeted"});
+
+  // Assert
+  EXPECT_FALSE(cached_creative_ads);
+}
+
+TEST_F(BraveAdsCreativeAdsCacheTest, DoNotGetForOtherAdType) {
+  // Arrange
+  cache_.Set({"technology & computing"},
+             BuildCreativeNotificationAds(/*count*/ 1),
+             cache_.GetGeneration<CreativeNotificationAdList>());
+
+  // Act
+  const absl::optional<CreativeNewTabPageAdList> cached_creative_ads =
+      cache_.Get<CreativeNewTabPageAdList>({"technology & computing"});
+
+  // Assert
+  EXPECT_FALSE(cached_creative_ads);
+}
+
+TEST_F(BraveAdsCreativeAdsCacheTest, DoNotGetCreativeAdsForEndedCampaigns) {
+  // Arrange
+  CreativeNotificationAdInfo creative_ad =
+      BuildCreativeNotificationAd(/*should_use_random_uuids*/ true);
+  creative_ad.end_at = Now() + base::Days(1);
+
+  cache_.Set({"technology & computing"}, {creative_ad},
+             cache_.GetGeneration<CreativeNotificationAdList>());
+
+  AdvanceClockBy(base::Days(1) + base::Milliseconds(1));
+
+  // Act
+  const absl::optional<CreativeNotificationAdList> cached_creative_ads =
+      cache_.Get<CreativeNotificationAdList>({"technology & computing"});
+
+  // Assert
+  EXPECT_EQ(CreativeNotificationAdList{}, cached_creative_ads);
+}
+
+TEST_F(BraveAdsCreativeAdsCacheTest, GetCreativeAdsForStartedCampaigns) {
+  // Arrange
+  CreativeNotificationAdInfo creative_ad =
+      BuildCreativeNotificationAd(/*should_use_random_uuids*/ true);
+  creative_ad.start_at = Now() + base::Days(1);
+
+  cache_.Set({"technology & computing"}, {creative_ad},
+             cache_.GetGeneration<CreativeNotificationAdList>());
+
+  AdvanceClockBy(base::Days(1));
+
+  // Act
+  const absl::optional<CreativeNotificationAdList> cached_creative_ads =
+      cache_.Get<CreativeNotificationAdList>({"technology & computing"});
+
+  // Assert
+  EXPECT_EQ(CreativeNotificationAdList{creative_ad}, cached_creative_ads);
+}
+
+TEST_F(BraveAdsCreativeAdsCacheTest, Invalidate) {
+  // Arrange
+  cache_.Set({"technology & computing"},
+             BuildCreativeNotificationAds(/*count*/ 1),
+             cache_.GetGeneration<CreativeNotificationAdList>());
+
+  // Act
+  cache_.Invalidate<CreativeNotificationAdList>();
+
+  // Assert
+  EXPECT_FALSE(
+      cache_.Get<CreativeNotificationAdList>({"technology & computing"}));
+}
+
+TEST_F(BraveAdsCreativeAdsCacheTest, DoNotSetIfInvalidatedWhileReading) {
+  // Arrange
+  const uint64_t generation =
+      cache_.GetGeneration<CreativeNotificationAdList>();
+
+  cache_.Invalidate<CreativeNotificationAdList>();
+
+  // Act
+  cache_.Set({"technology & computing"},
+             BuildCreativeNotificationAds(/*count*/ 1), generation);
+
+  // Assert
+  EXPECT_FALSE(
+      cache_.Get<CreativeNotificationAdList>({"technology & computing"}));
+}
+
+TEST_F(BraveAdsCreativeAdsCacheTest, GetForSegmentsAndDimensions) {
+  // Arrange
+  const CreativeInlineContentAdList creative_ads =
+      BuildCreativeInlineContentAds(/*count*/ 1);
+
+  cache_.Set({"technology & computing"}, creative_ads,
+             cache_.GetGeneration<CreativeInlineContentAdList>(),
+             /*dimensions*/ "200x100");
+
+  // Act & Assert
+  EXPECT_EQ(creative_ads, cache_.Get<CreativeInlineContentAdList>(
+                              {"technology & computing"}, "200x100"));
+  EXPECT_FALSE(cache_.Get<CreativeInlineContentAdList>(
+      {"technology & computing"}, "300x200"));
+}
+
+TEST_F(BraveAdsCreativeAdsCacheTest, EvictLeastRecentlyUsedSegments) {
+  // Arrange
+  for (size_t i = 0; i < CreativeAdsCache::kMaxEntries; ++i) {
+    cache_.Set({base::NumberToString(i)},
+               BuildCreativeNotificationAds(/*count*/ 1),
+               cache_.GetGeneration<CreativeNotificationAdList>());
+  }
+
+  ASSERT_TRUE(cache_.Get<CreativeNotificationAdList>({"0"}));
+
+  // Act
+  cache_.Set({"untargeted"}, BuildCreativeNotificationAds(/*count*/ 1),
+             cache_.GetGeneration<CreativeNotificationAdList>());
+
+  // Assert
+  EXPECT_TRUE(cache_.Get<CreativeNotificationAdList>({"0"}));
+  EXPECT_FALSE(cache_.Get<CreativeNotificationAdList>({"1"}));
+  EXPECT_TRUE(cache_.Get<CreativeNotificationAdList>({"untargeted"}));
+}
+
+}  // namespace brave_ads
@@ -6,6 +6,7 @@
 #include "brave/components/brave_ads/core/internal/creatives/inline_content_ads/creative_inline_content_ads_database_table.h"
 
 #include <cinttypes>
+#include <cstdint>
 #include <map>
 #include <utility>
 #include <vector>
@@ -24,6 +25,7 @@
 #include "brave/components/brave_ads/core/internal/common/database/database_transaction_util.h"
 #include "brave/components/brave_ads/core/internal/common/logging_util.h"
 #include "brave/components/brave_ads/core/internal/creatives/creative_ad_info.h"
+#include "brave/components/brave_ads/core/internal/creatives/creative_ads_cache.h"
 #include "brave/components/brave_ads/core/internal/segments/segment_util.h"
 #include "url/gurl.h"
 
@@ -216,6 +218,8 @@ void GetForCreativeInstanceIdCallback(
 
 void GetForSegmentsAndDimensionsCallback(
     const SegmentList& segments,
+    const std::string& dimensions,
+    const uint64_t cache_generation,
     GetCreativeInlineContentAdsCallback callback,
     mojom::DBCommandResponseInfoPtr command_response) {
   if (!command_response ||
@@ -229,7 +233,11 @@ void GetForSegmentsAndDimensionsCallback(
   const CreativeInlineContentAdList creative_ads =
       GetCreativeAdsFromResponse(std::move(command_response));
 
-  std::move(callback).Run(/*success*/ true, segments, creative_ads);
+  CreativeAdsCache::GetInstance().Set(segments, creative_ads, cache_generation,
+                                      dimensions);
+
+  std::move(callback).Run(/*success*/ true, segments,
+                          GetCreativeAdsForRunningCampaigns(creative_ads));
 }
 
 void GetForDimensionsCallback(
@@ -296,6 +304,8 @@ void CreativeInlineContentAds::Save(
     return std::move(callback).Run(/*success*/ true);
   }
 
+  CreativeAdsCache::GetInstance().Invalidate<CreativeInlineContentAdList>();
+
   mojom::DBTransactionInfoPtr transaction = mojom::DBTransactionInfo::New();
 
   const std::vector<CreativeInlineContentAdList> batches =
@@ -319,6 +329,8 @@ void CreativeInlineContentAds::Save(
 }
 
 void CreativeInlineContentAds::Delete(ResultCallback callback) const {
+  CreativeAdsCache::GetInstance().Invalidate<CreativeInlineContentAdList>();
+
   mojom::DBTransactionInfoPtr transaction = mojom::DBTransactionInfo::New();
 
   DeleteTable(&*transaction, GetTableName());
@@ -371,6 +383,14 @@ void CreativeInlineContentAds::GetForSegmentsAndDimensions(
                                    /*creative_ads*/ {});
   }
 
+  const CreativeAdsCache& cache = CreativeAdsCache::GetInstance();
+  if (const absl::optional<CreativeInlineContentAdList> creative_ads =
+          cache.Get<CreativeInlineContentAdList>(segments, dimensions)) {
+    return std::move(callback).Run(/*success*/ true, segments, *creative_ads);
+  }
+
+  // Campaigns which have not started or have ended are not excluded by the
+  // query so that the result can be cached, see |CreativeAdsCache|.
   mojom::DBTransactionInfoPtr transaction = mojom::DBTransactionInfo::New();
 
   mojom::DBCommandInfoPtr command = mojom::DBCommandInfo::New();
@@ -389,12 +409,10 @@ void CreativeInlineContentAds::GetForSegmentsAndDimensions(
       "cbna.creative_instance_id INNER JOIN geo_targets AS gt ON "
       "gt.campaign_id = cbna.campaign_id INNER JOIN dayparts AS dp ON "
       "dp.campaign_id = cbna.campaign_id WHERE s.segment IN %s AND "
-      "cbna.dimensions = '%s' AND %" PRId64
-      " BETWEEN cam.start_at AND cam.end_at;",
+      "cbna.dimensions = '%s';",
       GetTableName().c_str(),
       BuildBindingParameterPlaceholder(segments.size()).c_str(),
-      dimensions.c_str(),
-      base::Time::Now().ToDeltaSinceWindowsEpoch().InMicroseconds());
+      dimensions.c_str());
   BindRecords(&*command);
 
   int index = 0;
@@ -408,6 +426,8 @@ void CreativeInlineContentAds::GetForSegmentsAndDimensions(
   AdsClientHelper::GetInstance()->RunDBTransaction(
       std::move(transaction),
       base::BindOnce(&GetForSegmentsAndDimensionsCallback, segments,
+                     dimensions,
+                     cache.GetGeneration<CreativeInlineContentAdList>(),
                      std::move(callback)));
 }
 
@@ -6,6 +6,7 @@
 #include "brave/components/brave_ads/core/internal/creatives/new_tab_page_ads/creative_new_tab_page_ads_database_table.h"
 
 #include <cinttypes>
+#include <cstdint>
 #include <map>
 #include <utility>
 
@@ -16,6 +17,7 @@
 #include "base/strings/stringprintf.h"
 #include "base/time/time.h"
 #include "brave/components/brave_ads/common/interfaces/brave_ads.mojom.h"
+#include "brave/components/brave_ads/core/internal/ads/serving/serving_stage_timer.h"
 #include "brave/components/brave_ads/core/internal/ads_client_helper.h"
 #include "brave/components/brave_ads/core/internal/common/containers/container_util.h"
 #include "brave/components/brave_ads/core/internal/common/database/database_bind_util.h"
@@ -24,6 +26,7 @@
 #include "brave/components/brave_ads/core/internal/common/database/database_transaction_util.h"
 #include "brave/components/brave_ads/core/internal/common/logging_util.h"
 #include "brave/components/brave_ads/core/internal/creatives/creative_ad_info.h"
+#include "brave/components/brave_ads/core/internal/creatives/creative_ads_cache.h"
 #include "brave/components/brave_ads/core/internal/segments/segment_util.h"
 #include "url/gurl.h"
 
@@ -226,8 +229,12 @@ void GetForCreativeInstanceIdCallback(
 }
 
 void GetForSegmentsCallback(const SegmentList& segments,
+                            const uint64_t cache_generation,
+                            ServingStageTimer database_timer,
                             GetCreativeNewTabPageAdsCallback callback,
                             mojom::DBCommandResponseInfoPtr command_response) {
+  database_timer.Stop();
+
   if (!command_response ||
       command_response->status !=
           mojom::DBCommandResponseInfo::StatusType::RESPONSE_OK) {
@@ -239,7 +246,10 @@ void GetForSegmentsCallback(const SegmentList& segments,
   const CreativeNewTabPageAdList creative_ads =
       GetCreativeAdsFromResponse(std::move(command_response));
 
-  std::move(callback).Run(/*success*/ true, segments, creative_ads);
+  CreativeAdsCache::GetInstance().Set(segments, creative_ads, cache_generation);
+
+  std::move(callback).Run(/*success*/ true, segments,
+                          GetCreativeAdsForRunningCampaigns(creative_ads));
 }
 
 void GetAllCallback(GetCreativeNewTabPageAdsCallback callback,
@@ -288,6 +298,8 @@ void CreativeNewTabPageAds::Save(const CreativeNewTabPageAdList& creative_ads,
     return std::move(callback).Run(/*success*/ true);
   }
 
+  CreativeAdsCache::GetInstance().Invalidate<CreativeNewTabPageAdList>();
+
   mojom::DBTransactionInfoPtr transaction = mojom::DBTransactionInfo::New();
 
   const std::vector<CreativeNewTabPageAdList> batches =
@@ -313,6 +325,8 @@ void CreativeNewTabPageAds::Save(const CreativeNewTabPageAdList& creative_ads,
 }
 
 void CreativeNewTabPageAds::Delete(ResultCallback callback) const {
+  CreativeAdsCache::GetInstance().Invalidate<CreativeNewTabPageAdList>();
+
   mojom::DBTransactionInfoPtr transaction = mojom::DBTransactionInfo::New();
 
   DeleteTable(&*transaction, GetTableName());
@@ -365,6 +379,17 @@ void CreativeNewTabPageAds::GetForSegments(
                                    /*creative_ads*/ {});
   }
 
+  ServingStageTimer database_timer(ServingStageType::kDatabase);
+
+  const CreativeAdsCache& cache = CreativeAdsCache::GetInstance();
+  if (const absl::optional<CreativeNewTabPageAdList> creative_ads =
+          cache.Get<CreativeNewTabPageAdList>(segments)) {
+    database_timer.Stop();
+    return std::move(callback).Run(/*success*/ true, segments, *creative_ads);
+  }
+
+  // Campaigns which have not started or have ended are not excluded by the
+  // query so that the result can be cached, see |CreativeAdsCache|.
   mojom::DBTransactionInfoPtr transaction = mojom::DBTransactionInfo::New();
 
   mojom::DBCommandInfoPtr command = mojom::DBCommandInfo::New();
@@ -384,11 +409,9 @@ void CreativeNewTabPageAds::GetForSegments(
       "gt.campaign_id = cntpa.campaign_id INNER JOIN dayparts AS dp ON "
       "dp.campaign_id = cntpa.campaign_id INNER JOIN "
       "creative_new_tab_page_ad_wallpapers AS wp ON wp.creative_instance_id = "
-      "cntpa.creative_instance_id WHERE s.segment IN %s AND %" PRId64
-      " BETWEEN cam.start_at AND cam.end_at;",
+      "cntpa.creative_instance_id WHERE s.segment IN %s;",
       GetTableName().c_str(),
-      BuildBindingParameterPlaceholder(segments.size()).c_str(),
-      base::Time::Now().ToDeltaSinceWindowsEpoch().InMicroseconds());
+      BuildBindingParameterPlaceholder(segments.size()).c_str());
   BindRecords(&*command);
 
   int index = 0;
@@ -401,7 +424,9 @@ void CreativeNewTabPageAds::GetForSegments(
 
   AdsClientHelper::GetInstance()->RunDBTransaction(
       std::move(transaction),
-      base::BindOnce(&GetForSegmentsCallback, segments, std::move(callback)));
+      base::BindOnce(&GetForSegmentsCallback, segments,
+                     cache.GetGeneration<CreativeNewTabPageAdList>(),
+                     std::move(database_timer), std::move(callback)));
 }
 
 void CreativeNewTabPageAds::GetAll(
@@ -6,6 +6,7 @@
 #include "brave/components/brave_ads/core/internal/creatives/notification_ads/creative_notification_ads_database_table.h"
 
 #include <cinttypes>
+#include <cstdint>
 #include <map>
 #include <utility>
 
@@ -15,6 +16,7 @@
 #include "base/strings/stringprintf.h"
 #include "base/time/time.h"
 #include "brave/components/brave_ads/common/interfaces/brave_ads.mojom.h"
+#include "brave/components/brave_ads/core/internal/ads/serving/serving_stage_timer.h"
 #include "brave/components/brave_ads/core/internal/ads_client_helper.h"
 #include "brave/components/brave_ads/core/internal/common/containers/container_util.h"
 #include "brave/components/brave_ads/core/internal/common/database/database_bind_util.h"
@@ -24,6 +26,7 @@
 #include "brave/components/brave_ads/core/internal/common/logging_util.h"
 #include "brave/components/brave_ads/core/internal/common/strings/string_conversions_util.h"
 #include "brave/components/brave_ads/core/internal/creatives/creative_ad_info.h"
+#include "brave/components/brave_ads/core/internal/creatives/creative_ads_cache.h"
 #include "brave/components/brave_ads/core/internal/segments/segment_util.h"
 #include "url/gurl.h"
 
@@ -183,8 +186,12 @@ CreativeNotificationAdList GetCreativeAdsFromResponse(
 }
 
 void GetForSegmentsCallback(const SegmentList& segments,
+                            const uint64_t cache_generation,
+                            ServingStageTimer database_timer,
                             GetCreativeNotificationAdsCallback callback,
                             mojom::DBCommandResponseInfoPtr command_response) {
+  database_timer.Stop();
+
   if (!command_response ||
       command_response->status !=
           mojom::DBCommandResponseInfo::StatusType::RESPONSE_OK) {
@@ -196,7 +203,10 @@ void GetForSegmentsCallback(const SegmentList& segments,
   const CreativeNotificationAdList creative_ads =
       GetCreativeAdsFromResponse(std::move(command_response));
 
-  std::move(callback).Run(/*success*/ true, segments, creative_ads);
+  CreativeAdsCache::GetInstance().Set(segments, creative_ads, cache_generation);
+
+  std::move(callback).Run(/*success*/ true, segments,
+                          GetCreativeAdsForRunningCampaigns(creative_ads));
 }
 
 void GetAllCallback(GetCreativeNotificationAdsCallback callback,
@@ -246,6 +256,8 @@ void CreativeNotificationAds::Save(
     return std::move(callback).Run(/*success*/ true);
   }
 
+  CreativeAdsCache::GetInstance().Invalidate<CreativeNotificationAdList>();
+
   mojom::DBTransactionInfoPtr transaction = mojom::DBTransactionInfo::New();
 
   const std::vector<CreativeNotificationAdList> batches =
@@ -271,6 +283,8 @@ void CreativeNotificationAds::Save(
 }
 
 void CreativeNotificationAds::Delete(ResultCallback callback) const {
+  CreativeAdsCache::GetInstance().Invalidate<CreativeNotificationAdList>();
+
   mojom::DBTransactionInfoPtr transaction = mojom::DBTransactionInfo::New();
 
   DeleteTable(&*transaction, GetTableName());
@@ -286,6 +300,17 @@ void CreativeNotificationAds::GetForSegments(
                                    /*creative_ads*/ {});
   }
 
+  ServingStageTimer database_timer(ServingStageType::kDatabase);
+
+  const CreativeAdsCache& cache = CreativeAdsCache::GetInstance();
+  if (const absl::optional<CreativeNotificationAdList> creative_ads =
+          cache.Get<CreativeNotificationAdList>(segments)) {
+    database_timer.Stop();
+    return std::move(callback).Run(/*success*/ true, segments, *creative_ads);
+  }
+
+  // Campaigns which have not started or have ended are not excluded by the
+  // query so that the result can be cached, see |CreativeAdsCache|.
   mojom::DBTransactionInfoPtr transaction = mojom::DBTransactionInfo::New();
   mojom::DBCommandInfoPtr command = mojom::DBCommandInfo::New();
   command->type = mojom::DBCommandInfo::Type::READ;
@@ -302,11 +327,9 @@ void CreativeNotificationAds::GetForSegments(
       "creative_ads AS ca ON ca.creative_instance_id = "
       "can.creative_instance_id INNER JOIN geo_targets AS gt ON gt.campaign_id "
       "= can.campaign_id INNER JOIN dayparts AS dp ON dp.campaign_id = "
-      "can.campaign_id WHERE s.segment IN %s AND %" PRId64
-      " BETWEEN cam.start_at AND cam.end_at;",
+      "can.campaign_id WHERE s.segment IN %s;",
       GetTableName().c_str(),
-      BuildBindingParameterPlaceholder(segments.size()).c_str(),
-      base::Time::Now().ToDeltaSinceWindowsEpoch().InMicroseconds());
+      BuildBindingParameterPlaceholder(segments.size()).c_str());
   BindRecords(&*command);
 
   int index = 0;
@@ -319,7 +342,9 @@ void CreativeNotificationAds::GetForSegments(
 
   AdsClientHelper::GetInstance()->RunDBTransaction(
       std::move(transaction),
-      base::BindOnce(&GetForSegmentsCallback, segments, std::move(callback)));
+      base::BindOnce(&GetForSegmentsCallback, segments,
+                     cache.GetGeneration<CreativeNotificationAdList>(),
+                     std::move(database_timer), std::move(callback)));
 }
 
 void CreativeNotificationAds::GetAll(
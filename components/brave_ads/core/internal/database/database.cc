@@ -19,7 +19,21 @@
 
 namespace brave_ads {
 
-Database::Database(base::FilePath path) : db_path_(std::move(path)) {
+namespace {
+
+sql::DatabaseOptions GetDatabaseOptions(const char* vfs_name) {
+  sql::DatabaseOptions options;
+  options.vfs_name_discouraged = vfs_name;
+  return options;
+}
+
+}  // namespace
+
+Database::Database(base::FilePath path)
+    : Database(std::move(path), /*vfs_name=*/nullptr) {}
+
+Database::Database(base::FilePath path, const char* vfs_name)
+    : db_path_(std::move(path)), db_(GetDatabaseOptions(vfs_name)) {
   DETACH_FROM_SEQUENCE(sequence_checker_);
 
   db_.set_error_callback(base::BindRepeating(&Database::ErrorCallback,
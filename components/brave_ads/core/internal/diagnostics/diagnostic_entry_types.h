@@ -15,7 +15,13 @@ enum class DiagnosticEntryType {
   kLocale,
   kCatalogId,
   kCatalogLastUpdated,
-  kLastUnIdleTime
+  kLastUnIdleTime,
+  kTargetingDuration,
+  kDatabaseDuration,
+  kExclusionRulesDuration,
+  kPacingDuration,
+  kPriorityDuration,
+  kPredictionDuration
 };
 
 }  // namespace brave_ads
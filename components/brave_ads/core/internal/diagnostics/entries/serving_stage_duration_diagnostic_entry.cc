@@ -0,0 +1,84 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/core/internal/diagnostics/entries/serving_stage_duration_diagnostic_entry.h"
+
+#include "base/notreached.h"
+#include "base/strings/stringprintf.h"
+
+namespace brave_ads {
+
+ServingStageDurationDiagnosticEntry::ServingStageDurationDiagnosticEntry(
+    const ServingStageType type,
+    const base::TimeDelta duration)
+    : type_(type), duration_(duration) {}
+
+DiagnosticEntryType ServingStageDurationDiagnosticEntry::GetType() const {
+  switch (type_) {
+    case ServingStageType::kTargeting: {
+      return DiagnosticEntryType::kTargetingDuration;
+    }
+
+    case ServingStageType::kDatabase: {
+      return DiagnosticEntryType::kDatabaseDuration;
+    }
+
+    case ServingStageType::kExclusionRules: {
+      return DiagnosticEntryType::kExclusionRulesDuration;
+    }
+
+    case ServingStageType::kPacing: {
+      return DiagnosticEntryType::kPacingDuration;
+    }
+
+    case ServingStageType::kPriority: {
+      return DiagnosticEntryType::kPriorityDuration;
+    }
+
+    case ServingStageType::kPrediction: {
+      return DiagnosticEntryType::kPredictionDuration;
+    }
+  }
+
+  NOTREACHED_NORETURN() << "Unexpected value for ServingStageType: "
+                        << static_cast<int>(type_);
+}
+
+std::string ServingStageDurationDiagnosticEntry::GetName() const {
+  switch (type_) {
+    case ServingStageType::kTargeting: {
+      return "Last ad serving targeting duration";
+    }
+
+    case ServingStageType::kDatabase: {
+      return "Last ad serving database duration";
+    }
+
+    case ServingStageType::kExclusionRules: {
+      return "Last ad serving exclusion rules duration";
+    }
+
+    case ServingStageType::kPacing: {
+      return "Last ad serving pacing duration";
+    }
+
+    case ServingStageType::kPriority: {
+      return "Last ad serving priority duration";
+    }
+
+    case ServingStageType::kPrediction: {
+      return "Last ad serving prediction duration";
+    }
+  }
+
+  NOTREACHED_NORETURN() << "Unexpected value for ServingStageType: "
+                        << static_cast<int>(type_);
+}
+
+std::string ServingStageDurationDiagnosticEntry::GetValue() const {
+  return base::StringPrintf("%.3f ms", duration_.InMillisecondsF());
+}
+
+}  // namespace brave_ads
@@ -0,0 +1,35 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_DIAGNOSTICS_ENTRIES_SERVING_STAGE_DURATION_DIAGNOSTIC_ENTRY_H_
+#define BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_DIAGNOSTICS_ENTRIES_SERVING_STAGE_DURATION_DIAGNOSTIC_ENTRY_H_
+
+#include <string>
+
+#include "base/time/time.h"
+#include "brave/components/brave_ads/core/internal/ads/serving/serving_stage_types.h"
+#include "brave/components/brave_ads/core/internal/diagnostics/entries/diagnostic_entry_interface.h"
+
+namespace brave_ads {
+
+class ServingStageDurationDiagnosticEntry final
+    : public DiagnosticEntryInterface {
+ public:
+  ServingStageDurationDiagnosticEntry(ServingStageType type,
+                                      base::TimeDelta duration);
+
+  // DiagnosticEntryInterface:
+  DiagnosticEntryType GetType() const override;
+  std::string GetName() const override;
+  std::string GetValue() const override;
+
+ private:
+  ServingStageType type_;
+  base::TimeDelta duration_;
+};
+
+}  // namespace brave_ads
+
+#endif  // BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_DIAGNOSTICS_ENTRIES_SERVING_STAGE_DURATION_DIAGNOSTIC_ENTRY_H_
@@ -0,0 +1,47 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/core/internal/diagnostics/entries/serving_stage_duration_diagnostic_entry.h"
+
+#include "brave/components/brave_ads/core/internal/common/unittest/unittest_base.h"
+#include "brave/components/brave_ads/core/internal/diagnostics/diagnostic_entry_types.h"
+
+// npm run test -- brave_unit_tests --filter=BraveAds.*
+
+namespace brave_ads {
+
+class BraveAdsServingStageDurationDiagnosticEntryTest : public UnitTestBase {};
+
+TEST_F(BraveAdsServingStageDurationDiagnosticEntryTest, TargetingDuration) {
+  // Arrange
+
+  // Act
+  const ServingStageDurationDiagnosticEntry diagnostic_entry(
+      ServingStageType::kTargeting, base::Microseconds(12'345));
+
+  // Assert
+  EXPECT_EQ(DiagnosticEntryType::kTargetingDuration,
+            diagnostic_entry.GetType());
+  EXPECT_EQ("Last ad serving targeting duration", diagnostic_entry.GetName());
+  EXPECT_EQ("12.345 ms", diagnostic_entry.GetValue());
+}
+
+TEST_F(BraveAdsServingStageDurationDiagnosticEntryTest,
+       ExclusionRulesDuration) {
+  // Arrange
+
+  // Act
+  const ServingStageDurationDiagnosticEntry diagnostic_entry(
+      ServingStageType::kExclusionRules, base::Milliseconds(2));
+
+  // Assert
+  EXPECT_EQ(DiagnosticEntryType::kExclusionRulesDuration,
+            diagnostic_entry.GetType());
+  EXPECT_EQ("Last ad serving exclusion rules duration",
+            diagnostic_entry.GetName());
+  EXPECT_EQ("2.000 ms", diagnostic_entry.GetValue());
+}
+
+}  // namespace brave_ads
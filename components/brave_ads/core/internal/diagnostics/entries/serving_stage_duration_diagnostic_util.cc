@@ -0,0 +1,26 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/core/internal/diagnostics/entries/serving_stage_duration_diagnostic_util.h"
+
+#include <memory>
+#include <utility>
+
+#include "base/time/time.h"
+#include "brave/components/brave_ads/core/internal/diagnostics/diagnostic_manager.h"
+#include "brave/components/brave_ads/core/internal/diagnostics/entries/serving_stage_duration_diagnostic_entry.h"
+
+namespace brave_ads {
+
+void SetServingStageDurationDiagnosticEntry(const ServingStageType type,
+                                            const base::TimeDelta duration) {
+  auto serving_stage_duration_diagnostic_entry =
+      std::make_unique<ServingStageDurationDiagnosticEntry>(type, duration);
+
+  DiagnosticManager::GetInstance().SetEntry(
+      std::move(serving_stage_duration_diagnostic_entry));
+}
+
+}  // namespace brave_ads
@@ -0,0 +1,22 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_DIAGNOSTICS_ENTRIES_SERVING_STAGE_DURATION_DIAGNOSTIC_UTIL_H_
+#define BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_DIAGNOSTICS_ENTRIES_SERVING_STAGE_DURATION_DIAGNOSTIC_UTIL_H_
+
+#include "brave/components/brave_ads/core/internal/ads/serving/serving_stage_types.h"
+
+namespace base {
+class TimeDelta;
+}  // namespace base
+
+namespace brave_ads {
+
+void SetServingStageDurationDiagnosticEntry(ServingStageType type,
+                                            base::TimeDelta duration);
+
+}  // namespace brave_ads
+
+#endif  // BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_DIAGNOSTICS_ENTRIES_SERVING_STAGE_DURATION_DIAGNOSTIC_UTIL_H_
@@ -7,7 +7,9 @@
 
 #include "base/check.h"
 #include "brave/components/brave_ads/core/ads_client.h"
+#include "brave/components/brave_ads/core/internal/ads/ad_events/ad_event_counters_cache.h"
 #include "brave/components/brave_ads/core/internal/browser/browser_manager.h"
+#include "brave/components/brave_ads/core/internal/creatives/creative_ads_cache.h"
 #include "brave/components/brave_ads/core/internal/creatives/notification_ads/notification_ad_manager.h"
 #include "brave/components/brave_ads/core/internal/database/database_manager.h"
 #include "brave/components/brave_ads/core/internal/deprecated/client/client_state_manager.h"
@@ -27,9 +29,11 @@ GlobalState::GlobalState(AdsClient* ads_client)
       global_state_holder_(std::make_unique<GlobalStateHolder>(this)) {
   CHECK(ads_client_);
 
+  ad_event_counters_cache_ = std::make_unique<AdEventCountersCache>();
   browser_manager_ = std::make_unique<BrowserManager>();
   client_state_manager_ = std::make_unique<ClientStateManager>();
   confirmation_state_manager_ = std::make_unique<ConfirmationStateManager>();
+  creative_ads_cache_ = std::make_unique<CreativeAdsCache>();
   predictors_manager_ = std::make_unique<PredictorsManager>();
   database_manager_ = std::make_unique<DatabaseManager>();
   diagnostic_manager_ = std::make_unique<DiagnosticManager>();
@@ -61,6 +65,12 @@ AdsClient* GlobalState::GetAdsClient() {
   return ads_client_;
 }
 
+AdEventCountersCache& GlobalState::GetAdEventCountersCache() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  CHECK(ad_event_counters_cache_);
+  return *ad_event_counters_cache_;
+}
+
 BrowserManager& GlobalState::GetBrowserManager() {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
   CHECK(browser_manager_);
@@ -79,6 +89,12 @@ ConfirmationStateManager& GlobalState::GetConfirmationStateManager() {
   return *confirmation_state_manager_;
 }
 
+CreativeAdsCache& GlobalState::GetCreativeAdsCache() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  CHECK(creative_ads_cache_);
+  return *creative_ads_cache_;
+}
+
 DatabaseManager& GlobalState::GetDatabaseManager() {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
   CHECK(database_manager_);
@@ -14,10 +14,12 @@
 
 namespace brave_ads {
 
+class AdEventCountersCache;
 class AdsClient;
 class BrowserManager;
 class ClientStateManager;
 class ConfirmationStateManager;
+class CreativeAdsCache;
 class DatabaseManager;
 class DiagnosticManager;
 class GlobalStateHolder;
@@ -46,9 +48,11 @@ class GlobalState final {
 
   AdsClient* GetAdsClient();
 
+  AdEventCountersCache& GetAdEventCountersCache();
   BrowserManager& GetBrowserManager();
   ClientStateManager& GetClientStateManager();
   ConfirmationStateManager& GetConfirmationStateManager();
+  CreativeAdsCache& GetCreativeAdsCache();
   DatabaseManager& GetDatabaseManager();
   DiagnosticManager& GetDiagnosticManager();
   HistoryManager& GetHistoryManager();
@@ -70,9 +74,11 @@ class GlobalState final {
 
   const std::unique_ptr<GlobalStateHolder> global_state_holder_;
 
+  std::unique_ptr<AdEventCountersCache> ad_event_counters_cache_;
   std::unique_ptr<BrowserManager> browser_manager_;
   std::unique_ptr<ClientStateManager> client_state_manager_;
   std::unique_ptr<ConfirmationStateManager> confirmation_state_manager_;
+  std::unique_ptr<CreativeAdsCache> creative_ads_cache_;
   std::unique_ptr<DatabaseManager> database_manager_;
   std::unique_ptr<DiagnosticManager> diagnostic_manager_;
   std::unique_ptr<HistoryManager> history_manager_;
@@ -44,12 +44,12 @@ TextEmbeddingHtmlEventInfo BuildTextEmbeddingHtmlEvent(
   return text_embedding_html_event;
 }
 
-void LogTextEmbeddingHtmlEvent(
-    const TextEmbeddingHtmlEventInfo& text_embedding_html_event,
+void LogTextEmbeddingHtmlEvents(
+    const TextEmbeddingHtmlEventList& text_embedding_html_events,
     LogTextEmbeddingHtmlEventCallback callback) {
   database::table::TextEmbeddingHtmlEvents database_table;
-  database_table.LogEvent(
-      text_embedding_html_event,
+  database_table.LogEvents(
+      text_embedding_html_events,
       base::BindOnce(
           [](LogTextEmbeddingHtmlEventCallback callback, const bool success) {
             std::move(callback).Run(success);
@@ -57,16 +57,6 @@ void LogTextEmbeddingHtmlEvent(
           std::move(callback)));
 }
 
-void PurgeStaleTextEmbeddingHtmlEvents(
-    LogTextEmbeddingHtmlEventCallback callback) {
-  const database::table::TextEmbeddingHtmlEvents database_table;
-  database_table.PurgeStale(base::BindOnce(
-      [](LogTextEmbeddingHtmlEventCallback callback, const bool success) {
-        std::move(callback).Run(success);
-      },
-      std::move(callback)));
-}
-
 void GetTextEmbeddingHtmlEventsFromDatabase(
     database::table::GetTextEmbeddingHtmlEventsCallback callback) {
   const database::table::TextEmbeddingHtmlEvents database_table;
@@ -20,11 +20,10 @@ struct TextEmbeddingHtmlEventInfo;
 TextEmbeddingHtmlEventInfo BuildTextEmbeddingHtmlEvent(
     const ml::pipeline::TextEmbeddingInfo& text_embedding);
 
-void LogTextEmbeddingHtmlEvent(
-    const TextEmbeddingHtmlEventInfo& text_embedding_html_event,
-    LogTextEmbeddingHtmlEventCallback callback);
-
-void PurgeStaleTextEmbeddingHtmlEvents(
+// Logs |text_embedding_html_events| and purges stale events in a single
+// transaction.
+void LogTextEmbeddingHtmlEvents(
+    const TextEmbeddingHtmlEventList& text_embedding_html_events,
     LogTextEmbeddingHtmlEventCallback callback);
 
 void GetTextEmbeddingHtmlEventsFromDatabase(
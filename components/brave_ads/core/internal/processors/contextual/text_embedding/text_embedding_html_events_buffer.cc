@@ -0,0 +1,66 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/core/internal/processors/contextual/text_embedding/text_embedding_html_events_buffer.h"
+
+#include <utility>
+
+#include "base/functional/bind.h"
+#include "base/functional/callback_helpers.h"
+#include "brave/components/brave_ads/core/internal/ads/serving/targeting/contextual/text_embedding/text_embedding_feature.h"
+#include "brave/components/brave_ads/core/internal/common/logging_util.h"
+#include "brave/components/brave_ads/core/internal/processors/contextual/text_embedding/text_embedding_html_events.h"
+
+namespace brave_ads {
+
+TextEmbeddingHtmlEventsBuffer::TextEmbeddingHtmlEventsBuffer() = default;
+
+TextEmbeddingHtmlEventsBuffer::~TextEmbeddingHtmlEventsBuffer() {
+  if (!text_embedding_html_events_.empty()) {
+    // Do not log the result, as logging is unavailable after shutdown.
+    LogTextEmbeddingHtmlEvents(text_embedding_html_events_, base::DoNothing());
+  }
+}
+
+void TextEmbeddingHtmlEventsBuffer::Add(
+    const TextEmbeddingHtmlEventInfo& text_embedding_html_event) {
+  text_embedding_html_events_.push_back(text_embedding_html_event);
+
+  if (static_cast<int>(text_embedding_html_events_.size()) >=
+      kTextEmbeddingHtmlEventsBatchSize.Get()) {
+    return Flush();
+  }
+
+  if (!timer_.IsRunning()) {
+    timer_.Start(FROM_HERE, kTextEmbeddingHtmlEventsFlushAfter.Get(),
+                 base::BindOnce(&TextEmbeddingHtmlEventsBuffer::Flush,
+                                base::Unretained(this)));
+  }
+}
+
+void TextEmbeddingHtmlEventsBuffer::Flush() {
+  timer_.Stop();
+
+  if (text_embedding_html_events_.empty()) {
+    return;
+  }
+
+  TextEmbeddingHtmlEventList text_embedding_html_events;
+  std::swap(text_embedding_html_events, text_embedding_html_events_);
+
+  BLOG(3, "Logging " << text_embedding_html_events.size()
+                     << " text embedding HTML events");
+
+  LogTextEmbeddingHtmlEvents(
+      text_embedding_html_events, base::BindOnce([](const bool success) {
+        if (!success) {
+          return BLOG(1, "Failed to log text embedding HTML events");
+        }
+
+        BLOG(3, "Successfully logged text embedding HTML events");
+      }));
+}
+
+}  // namespace brave_ads
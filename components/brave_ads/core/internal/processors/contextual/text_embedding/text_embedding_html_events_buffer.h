@@ -0,0 +1,46 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_PROCESSORS_CONTEXTUAL_TEXT_EMBEDDING_TEXT_EMBEDDING_HTML_EVENTS_BUFFER_H_
+#define BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_PROCESSORS_CONTEXTUAL_TEXT_EMBEDDING_TEXT_EMBEDDING_HTML_EVENTS_BUFFER_H_
+
+#include "brave/components/brave_ads/core/internal/common/timer/timer.h"
+#include "brave/components/brave_ads/core/internal/processors/contextual/text_embedding/text_embedding_html_event_info.h"
+
+namespace brave_ads {
+
+// Buffers text embedding HTML events so that they are logged, and stale events
+// purged, in a single database transaction once
+// |kTextEmbeddingHtmlEventsBatchSize| events have been buffered or
+// |kTextEmbeddingHtmlEventsFlushAfter| has elapsed since the first buffered
+// event. Buffered events are flushed on destruction.
+class TextEmbeddingHtmlEventsBuffer final {
+ public:
+  TextEmbeddingHtmlEventsBuffer();
+
+  TextEmbeddingHtmlEventsBuffer(const TextEmbeddingHtmlEventsBuffer&) = delete;
+  TextEmbeddingHtmlEventsBuffer& operator=(
+      const TextEmbeddingHtmlEventsBuffer&) = delete;
+
+  TextEmbeddingHtmlEventsBuffer(TextEmbeddingHtmlEventsBuffer&&) noexcept =
+      delete;
+  TextEmbeddingHtmlEventsBuffer& operator=(
+      TextEmbeddingHtmlEventsBuffer&&) noexcept = delete;
+
+  ~TextEmbeddingHtmlEventsBuffer();
+
+  void Add(const TextEmbeddingHtmlEventInfo& text_embedding_html_event);
+
+  void Flush();
+
+ private:
+  TextEmbeddingHtmlEventList text_embedding_html_events_;
+
+  Timer timer_;
+};
+
+}  // namespace brave_ads
+
+#endif  // BRAVE_COMPONENTS_BRAVE_ADS_CORE_INTERNAL_PROCESSORS_CONTEXTUAL_TEXT_EMBEDDING_TEXT_EMBEDDING_HTML_EVENTS_BUFFER_H_
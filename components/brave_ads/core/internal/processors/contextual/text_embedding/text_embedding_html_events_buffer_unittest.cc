@@ -0,0 +1,128 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_ads/core/internal/processors/contextual/text_embedding/text_embedding_html_events_buffer.h"
+
+#include <string>
+
+#include "base/base64.h"
+#include "base/functional/bind.h"
+#include "base/strings/string_number_conversions.h"
+#include "brave/components/brave_ads/core/internal/ads/serving/targeting/contextual/text_embedding/text_embedding_feature.h"
+#include "brave/components/brave_ads/core/internal/common/unittest/unittest_base.h"
+#include "brave/components/brave_ads/core/internal/ml/pipeline/text_processing/embedding_info.h"
+#include "brave/components/brave_ads/core/internal/processors/contextual/text_embedding/text_embedding_html_event_info.h"
+#include "brave/components/brave_ads/core/internal/processors/contextual/text_embedding/text_embedding_html_event_unittest_util.h"
+#include "brave/components/brave_ads/core/internal/processors/contextual/text_embedding/text_embedding_html_events.h"
+
+// npm run test -- brave_unit_tests --filter=BraveAds*
+
+namespace brave_ads {
+
+namespace {
+
+TextEmbeddingHtmlEventInfo BuildEvent(const int index) {
+  ml::pipeline::TextEmbeddingInfo text_embedding = BuildTextEmbedding();
+  text_embedding.hashed_text_base64 =
+      base::Base64Encode(base::NumberToString(index));
+
+  return BuildTextEmbeddingHtmlEvent(text_embedding);
+}
+
+void ExpectTextEmbeddingHtmlEventCountEquals(const int expected_count) {
+  GetTextEmbeddingHtmlEventsFromDatabase(base::BindOnce(
+      [](const int expected_count, const bool success,
+         const TextEmbeddingHtmlEventList& text_embedding_html_events) {
+        ASSERT_TRUE(success);
+
+        EXPECT_EQ(expected_count,
+                  static_cast<int>(text_embedding_html_events.size()));
+      },
+      expected_count));
+}
+
+}  // namespace
+
+class BraveAdsTextEmbeddingHtmlEventsBufferTest : public UnitTestBase {
+ protected:
+  TextEmbeddingHtmlEventsBuffer buffer_;
+};
+
+TEST_F(BraveAdsTextEmbeddingHtmlEventsBufferTest,
+       DoNotLogEventsBeforeReachingBatchSize) {
+  // Arrange
+
+  // Act
+  for (int i = 0; i < kTextEmbeddingHtmlEventsBatchSize.Get() - 1; i++) {
+    buffer_.Add(BuildEvent(i));
+  }
+
+  // Assert
+  ExpectTextEmbeddingHtmlEventCountEquals(0);
+}
+
+TEST_F(BraveAdsTextEmbeddingHtmlEventsBufferTest,
+       LogEventsWhenReachingBatchSize) {
+  // Arrange
+
+  // Act
+  for (int i = 0; i < kTextEmbeddingHtmlEventsBatchSize.Get(); i++) {
+    buffer_.Add(BuildEvent(i));
+  }
+
+  // Assert
+  ExpectTextEmbeddingHtmlEventCountEquals(
+      kTextEmbeddingHtmlEventsBatchSize.Get());
+}
+
+TEST_F(BraveAdsTextEmbeddingHtmlEventsBufferTest, LogEventsAfterFlushDelay) {
+  // Arrange
+  buffer_.Add(BuildEvent(/*index*/ 0));
+
+  // Act
+  FastForwardClockBy(kTextEmbeddingHtmlEventsFlushAfter.Get());
+
+  // Assert
+  ExpectTextEmbeddingHtmlEventCountEquals(1);
+}
+
+TEST_F(BraveAdsTextEmbeddingHtmlEventsBufferTest, Flush) {
+  // Arrange
+  buffer_.Add(BuildEvent(/*index*/ 0));
+
+  // Act
+  buffer_.Flush();
+
+  // Assert
+  ExpectTextEmbeddingHtmlEventCountEquals(1);
+}
+
+TEST_F(BraveAdsTextEmbeddingHtmlEventsBufferTest, FlushOnDestruction) {
+  // Arrange
+  {
+    TextEmbeddingHtmlEventsBuffer buffer;
+    buffer.Add(BuildEvent(/*index*/ 0));
+
+    // Act
+  }
+
+  // Assert
+  ExpectTextEmbeddingHtmlEventCountEquals(1);
+}
+
+TEST_F(BraveAdsTextEmbeddingHtmlEventsBufferTest, PurgeStaleEvents) {
+  // Arrange
+
+  // Act
+  for (int i = 0; i < kTextEmbeddingHistorySize.Get() * 2; i++) {
+    buffer_.Add(BuildEvent(i));
+  }
+  buffer_.Flush();
+
+  // Assert
+  ExpectTextEmbeddingHtmlEventCountEquals(kTextEmbeddingHistorySize.Get());
+}
+
+}  // namespace brave_ads
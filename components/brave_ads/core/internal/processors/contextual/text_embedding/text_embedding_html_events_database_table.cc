@@ -5,12 +5,13 @@
 
 #include "brave/components/brave_ads/core/internal/processors/contextual/text_embedding/text_embedding_html_events_database_table.h"
 
+#include <string>
 #include <utility>
 
 #include "base/check.h"
 #include "base/functional/callback.h"
+#include "base/strings/string_number_conversions.h"
 #include "base/strings/string_util.h"
-#include "base/strings/stringprintf.h"
 #include "base/time/time.h"
 #include "brave/components/brave_ads/common/interfaces/brave_ads.mojom.h"
 #include "brave/components/brave_ads/core/internal/ads/serving/targeting/contextual/text_embedding/text_embedding_feature.h"
@@ -100,6 +101,23 @@ void GetAllCallback(GetTextEmbeddingHtmlEventsCallback callback,
   std::move(callback).Run(/* success */ true, text_embedding_html_events);
 }
 
+// Keeps the |kTextEmbeddingHistorySize| most recently created events. Ids are
+// not contiguous because replacing an event with the same hashed text deletes
+// its row and inserts a new one.
+void PurgeStaleEvents(mojom::DBTransactionInfo* transaction,
+                      const std::string& table_name) {
+  CHECK(transaction);
+
+  mojom::DBCommandInfoPtr command = mojom::DBCommandInfo::New();
+  command->type = mojom::DBCommandInfo::Type::EXECUTE;
+  command->sql = base::ReplaceStringPlaceholders(
+      "DELETE FROM $1 WHERE id NOT IN (SELECT id FROM $1 ORDER BY created_at "
+      "DESC, id DESC LIMIT $2);",
+      {table_name, base::NumberToString(kTextEmbeddingHistorySize.Get())},
+      nullptr);
+  transaction->commands.push_back(std::move(command));
+}
+
 void MigrateToV25(mojom::DBTransactionInfo* transaction) {
   CHECK(transaction);
 
@@ -126,12 +144,18 @@ void MigrateToV29(mojom::DBTransactionInfo* transaction) {
 
 }  // namespace
 
-void TextEmbeddingHtmlEvents::LogEvent(
-    const TextEmbeddingHtmlEventInfo& text_embedding_html_event,
+void TextEmbeddingHtmlEvents::LogEvents(
+    const TextEmbeddingHtmlEventList& text_embedding_html_events,
     ResultCallback callback) {
+  if (text_embedding_html_events.empty()) {
+    return std::move(callback).Run(/*success*/ true);
+  }
+
   mojom::DBTransactionInfoPtr transaction = mojom::DBTransactionInfo::New();
 
-  InsertOrUpdate(&*transaction, {text_embedding_html_event});
+  InsertOrUpdate(&*transaction, text_embedding_html_events);
+
+  PurgeStaleEvents(&*transaction, GetTableName());
 
   RunTransaction(std::move(transaction), std::move(callback));
 }
@@ -153,20 +177,6 @@ void TextEmbeddingHtmlEvents::GetAll(
       base::BindOnce(&GetAllCallback, std::move(callback)));
 }
 
-void TextEmbeddingHtmlEvents::PurgeStale(ResultCallback callback) const {
-  mojom::DBTransactionInfoPtr transaction = mojom::DBTransactionInfo::New();
-  mojom::DBCommandInfoPtr command = mojom::DBCommandInfo::New();
-  command->type = mojom::DBCommandInfo::Type::EXECUTE;
-  command->sql = base::StringPrintf(
-      "DELETE FROM %s WHERE id NOT IN (SELECT id from %s ORDER BY created_at "
-      "DESC LIMIT %d);",
-      GetTableName().c_str(), GetTableName().c_str(),
-      kTextEmbeddingHistorySize.Get());
-  transaction->commands.push_back(std::move(command));
-
-  RunTransaction(std::move(transaction), std::move(callback));
-}
-
 std::string TextEmbeddingHtmlEvents::GetTableName() const {
   return kTableName;
 }
@@ -22,13 +22,13 @@ using GetTextEmbeddingHtmlEventsCallback = base::OnceCallback<void(
 
 class TextEmbeddingHtmlEvents final : public TableInterface {
  public:
-  void LogEvent(const TextEmbeddingHtmlEventInfo& text_embedding_html_event,
-                ResultCallback callback);
+  // Logs |text_embedding_html_events| and purges stale events in a single
+  // transaction, so the table never exceeds |kTextEmbeddingHistorySize| rows.
+  void LogEvents(const TextEmbeddingHtmlEventList& text_embedding_html_events,
+                 ResultCallback callback);
 
   void GetAll(GetTextEmbeddingHtmlEventsCallback callback) const;
 
-  void PurgeStale(ResultCallback callback) const;
-
   std::string GetTableName() const override;
 
   void Create(mojom::DBTransactionInfo* transaction) override;
@@ -5,7 +5,10 @@
 
 #include "brave/components/brave_ads/core/internal/processors/contextual/text_embedding/text_embedding_html_events.h"
 
+#include "base/base64.h"
 #include "base/functional/bind.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/time/time.h"
 #include "brave/components/brave_ads/core/internal/ads/serving/targeting/contextual/text_embedding/text_embedding_feature.h"
 #include "brave/components/brave_ads/core/internal/common/unittest/unittest_base.h"
 #include "brave/components/brave_ads/core/internal/ml/pipeline/text_processing/embedding_info.h"
@@ -16,6 +19,18 @@
 
 namespace brave_ads {
 
+namespace {
+
+TextEmbeddingHtmlEventInfo BuildEvent(const int index) {
+  ml::pipeline::TextEmbeddingInfo text_embedding = BuildTextEmbedding();
+  text_embedding.hashed_text_base64 =
+      base::Base64Encode(base::NumberToString(index));
+
+  return BuildTextEmbeddingHtmlEvent(text_embedding);
+}
+
+}  // namespace
+
 class BraveAdsTextEmbeddingHtmlEventsTest : public UnitTestBase {};
 
 TEST_F(BraveAdsTextEmbeddingHtmlEventsTest, BuildEvent) {
@@ -33,13 +48,13 @@ TEST_F(BraveAdsTextEmbeddingHtmlEventsTest, BuildEvent) {
   EXPECT_EQ(text_embedding.embedding, text_embedding_html_event.embedding);
 }
 
-TEST_F(BraveAdsTextEmbeddingHtmlEventsTest, LogEvent) {
+TEST_F(BraveAdsTextEmbeddingHtmlEventsTest, LogEvents) {
   // Arrange
   const ml::pipeline::TextEmbeddingInfo text_embedding = BuildTextEmbedding();
 
   // Act
-  LogTextEmbeddingHtmlEvent(
-      BuildTextEmbeddingHtmlEvent(text_embedding),
+  LogTextEmbeddingHtmlEvents(
+      {BuildTextEmbeddingHtmlEvent(text_embedding)},
       base::BindOnce([](const bool success) { ASSERT_TRUE(success); }));
 
   GetTextEmbeddingHtmlEventsFromDatabase(base::BindOnce(
@@ -56,28 +71,46 @@ TEST_F(BraveAdsTextEmbeddingHtmlEventsTest, LogEvent) {
       text_embedding));
 }
 
-TEST_F(BraveAdsTextEmbeddingHtmlEventsTest, PurgeEvents) {
+TEST_F(BraveAdsTextEmbeddingHtmlEventsTest, PurgeStaleEvents) {
   // Arrange
-  for (int i = 0; i < kTextEmbeddingHistorySize.Get() + 4; i++) {
-    const ml::pipeline::TextEmbeddingInfo text_embedding = BuildTextEmbedding();
-    LogTextEmbeddingHtmlEvent(
-        BuildTextEmbeddingHtmlEvent(text_embedding),
+  const int history_size = kTextEmbeddingHistorySize.Get();
+
+  for (int i = 0; i < history_size; i++) {
+    LogTextEmbeddingHtmlEvents(
+        {BuildEvent(i)},
         base::BindOnce([](const bool success) { ASSERT_TRUE(success); }));
+    AdvanceClockBy(base::Seconds(1));
   }
 
+  // Replacing an event leaves a gap in the ids.
+  const int replaced_index = history_size / 2;
+  LogTextEmbeddingHtmlEvents(
+      {BuildEvent(replaced_index)},
+      base::BindOnce([](const bool success) { ASSERT_TRUE(success); }));
+  AdvanceClockBy(base::Seconds(1));
+
   // Act
-  PurgeStaleTextEmbeddingHtmlEvents(
+  LogTextEmbeddingHtmlEvents(
+      {BuildEvent(history_size)},
       base::BindOnce([](const bool success) { ASSERT_TRUE(success); }));
 
   // Assert
   GetTextEmbeddingHtmlEventsFromDatabase(base::BindOnce(
-      [](const bool success,
+      [](const int history_size, const int replaced_index, const bool success,
          const TextEmbeddingHtmlEventList& text_embedding_html_events) {
         ASSERT_TRUE(success);
 
-        EXPECT_LE(static_cast<int>(text_embedding_html_events.size()),
-                  kTextEmbeddingHistorySize.Get());
-      }));
+        ASSERT_EQ(history_size,
+                  static_cast<int>(text_embedding_html_events.size()));
+        EXPECT_EQ(BuildEvent(history_size).hashed_text_base64,
+                  text_embedding_html_events.front().hashed_text_base64);
+        EXPECT_EQ(BuildEvent(replaced_index).hashed_text_base64,
+                  text_embedding_html_events[1].hashed_text_base64);
+        // Only the oldest event is purged.
+        EXPECT_EQ(BuildEvent(1).hashed_text_base64,
+                  text_embedding_html_events.back().hashed_text_base64);
+      },
+      history_size, replaced_index));
 }
 
 }  // namespace brave_ads
@@ -11,6 +11,7 @@
 #include <vector>
 
 #include "base/memory/raw_ref.h"
+#include "brave/components/brave_ads/core/internal/processors/contextual/text_embedding/text_embedding_html_events_buffer.h"
 #include "brave/components/brave_ads/core/internal/tabs/tab_manager_observer.h"
 
 class GURL;
@@ -40,6 +41,8 @@ class TextEmbeddingProcessor final : public TabManagerObserver {
                               const std::string& content) override;
 
   const raw_ref<TextEmbeddingResource> resource_;
+
+  TextEmbeddingHtmlEventsBuffer text_embedding_html_events_buffer_;
 };
 
 }  // namespace brave_ads
@@ -41,6 +41,12 @@ void AsyncDataStore::LoadTrainingData(
   data_store_.AsyncCall(&DataStore::LoadTrainingData).Then(std::move(callback));
 }
 
+void AsyncDataStore::LoadTrainingMatrix(
+    base::OnceCallback<void(TrainingMatrix)> callback) {
+  data_store_.AsyncCall(&DataStore::LoadTrainingMatrix)
+      .Then(std::move(callback));
+}
+
 void AsyncDataStore::PurgeTrainingDataAfterExpirationDate() {
   data_store_.AsyncCall(&DataStore::PurgeTrainingDataAfterExpirationDate);
 }
@@ -32,6 +32,7 @@ class AsyncDataStore {
       std::vector<brave_federated::mojom::CovariateInfoPtr> training_instance,
       base::OnceCallback<void(bool)> callback);
   void LoadTrainingData(base::OnceCallback<void(TrainingData)> callback);
+  void LoadTrainingMatrix(base::OnceCallback<void(TrainingMatrix)> callback);
   void PurgeTrainingDataAfterExpirationDate();
 
  private:
@@ -5,44 +5,45 @@
 
 #include "brave/components/brave_federated/data_stores/data_store.h"
 
+#include <algorithm>
+#include <limits>
 #include <utility>
 
 #include "base/check.h"
 #include "base/containers/flat_map.h"
 #include "base/functional/bind.h"
 #include "base/numerics/safe_conversions.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/string_piece.h"
+#include "base/strings/string_util.h"
 #include "base/strings/stringprintf.h"
 #include "base/time/time.h"
-#include "sql/recovery.h"
+#include "brave/components/sql_utils/database_error_callback.h"
 #include "sql/statement.h"
 #include "sql/transaction.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
 
 namespace {
 
-void DatabaseErrorCallback(sql::Database* db,
-                           const base::FilePath& db_file_path,
-                           int extended_error,
-                           sql::Statement* stmt) {
-  if (sql::Recovery::ShouldRecover(extended_error)) {
-    // Prevent reentrant calls.
-    db->reset_error_callback();
-
-    // After this call, the |db| handle is poisoned so that future calls will
-    // return errors until the handle is re-opened.
-    sql::Recovery::RecoverDatabase(db, db_file_path);
-
-    // The DLOG(FATAL) below is intended to draw immediate attention to errors
-    // in newly-written code.  Database corruption is generally a result of OS
-    // or hardware issues, not coding errors at the client level, so displaying
-    // the error would probably lead to confusion.  The ignored call signals the
-    // test-expectation framework that the error was handled.
-    std::ignore = sql::Database::IsExpectedSqliteError(extended_error);
-    return;
+// Notification ad events are logged as the name of their
+// NotificationAdEventType, e.g. "NotificationAdEventType::kClicked".
+constexpr char kNotificationAdClickedEvent[] = "kClicked";
+
+// String covariates with a numeric encoding, so they can be used as features
+// or labels. Returns nullopt for string covariates that are left out.
+absl::optional<double> EncodeStringCovariate(
+    brave_federated::mojom::CovariateType type,
+    base::StringPiece value) {
+  if (type == brave_federated::mojom::CovariateType::kNotificationAdEvent) {
+    // Whether the ad was clicked.
+    return base::EndsWith(value, kNotificationAdClickedEvent) ? 1 : 0;
   }
 
-  // The default handling is to assert on debug and to ignore on release.
-  if (!sql::Database::IsExpectedSqliteError(extended_error))
-    DLOG(FATAL) << db->GetErrorMessage();
+  return absl::nullopt;
+}
+
+bool IsEncodedStringCovariate(brave_federated::mojom::CovariateType type) {
+  return EncodeStringCovariate(type, "").has_value();
 }
 
 void BindCovariateToStatement(
@@ -63,6 +64,11 @@ void BindCovariateToStatement(
 
 namespace brave_federated {
 
+TrainingMatrix::TrainingMatrix() = default;
+TrainingMatrix::~TrainingMatrix() = default;
+TrainingMatrix::TrainingMatrix(TrainingMatrix&&) = default;
+TrainingMatrix& TrainingMatrix::operator=(TrainingMatrix&&) = default;
+
 DataStore::DataStore(const DataStoreTask data_store_task,
                      const base::FilePath& db_file_path)
     : database_(
@@ -77,15 +83,16 @@ bool DataStore::InitializeDatabase() {
   database_.set_histogram_tag(data_store_task_.name);
 
   // To recover from corruption.
-  database_.set_error_callback(
-      base::BindRepeating(&DatabaseErrorCallback, &database_, db_file_path_));
+  database_.set_error_callback(base::BindRepeating(
+      &sql_utils::DatabaseErrorCallback, &database_, db_file_path_));
 
   // Attach the database to our index file.
   return database_.Open(db_file_path_) && MaybeCreateTable();
 }
 
 int DataStore::GetNextTrainingInstanceId() {
-  sql::Statement statement(database_.GetUniqueStatement(
+  sql::Statement statement(database_.GetCachedStatement(
+      SQL_FROM_HERE,
       base::StringPrintf("SELECT MAX(training_instance_id) FROM %s",
                          data_store_task_.name.c_str())
           .c_str()));
@@ -96,11 +103,12 @@ int DataStore::GetNextTrainingInstanceId() {
   return 0;
 }
 
-void DataStore::SaveCovariate(
+bool DataStore::SaveCovariate(
     const brave_federated::mojom::CovariateInfo& covariate,
     int training_instance_id,
     const base::Time created_at) {
-  sql::Statement statement(database_.GetUniqueStatement(
+  sql::Statement statement(database_.GetCachedStatement(
+      SQL_FROM_HERE,
       base::StringPrintf("INSERT INTO %s (training_instance_id, "
                          "feature_name, feature_type, "
                          "feature_value, created_at) "
@@ -110,7 +118,7 @@ void DataStore::SaveCovariate(
 
   BindCovariateToStatement(covariate, training_instance_id, created_at,
                            &statement);
-  statement.Run();
+  return statement.Run();
 }
 
 bool DataStore::AddTrainingInstance(
@@ -118,14 +126,25 @@ bool DataStore::AddTrainingInstance(
         training_instance) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
+  // All covariates of an instance are written in a single transaction, which
+  // also trims the oldest records beyond |max_number_of_records|.
+  sql::Transaction transaction(&database_);
+  if (!transaction.Begin()) {
+    return false;
+  }
+
   const int training_instance_id = GetNextTrainingInstanceId();
   const base::Time created_at = base::Time::Now();
 
+  // The transaction rolls back if it is not committed, so a failed insert
+  // does not leave a partial instance.
   for (const auto& covariate : training_instance) {
-    SaveCovariate(*covariate, training_instance_id, created_at);
+    if (!SaveCovariate(*covariate, training_instance_id, created_at)) {
+      return false;
+    }
   }
 
-  return true;
+  return EnforceMaxNumberOfRecords() && transaction.Commit();
 }
 
 TrainingData DataStore::LoadTrainingData() {
@@ -152,6 +171,91 @@ TrainingData DataStore::LoadTrainingData() {
   return training_instances;
 }
 
+TrainingMatrix DataStore::LoadTrainingMatrix() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  TrainingMatrix matrix;
+
+  sql::Statement columns_statement(database_.GetCachedStatement(
+      SQL_FROM_HERE,
+      base::StringPrintf("SELECT DISTINCT feature_name, feature_type FROM %s "
+                         "ORDER BY feature_name",
+                         data_store_task_.name.c_str())
+          .c_str()));
+  base::flat_map<int, size_t> column_indices;
+  while (columns_statement.Step()) {
+    const int feature_name = columns_statement.ColumnInt(0);
+    const auto type = static_cast<mojom::CovariateType>(feature_name);
+    if (columns_statement.ColumnInt(1) ==
+            static_cast<int>(mojom::DataType::kString) &&
+        !IsEncodedStringCovariate(type)) {
+      continue;
+    }
+    if (column_indices.contains(feature_name)) {
+      continue;
+    }
+    column_indices.emplace_hint(column_indices.end(), feature_name,
+                                matrix.columns.size());
+    matrix.columns.push_back(type);
+  }
+  if (matrix.columns.empty()) {
+    return matrix;
+  }
+
+  // Covariates of an instance are inserted together, so ordering by id keeps
+  // them contiguous and rows in insertion order.
+  sql::Statement statement(database_.GetCachedStatement(
+      SQL_FROM_HERE,
+      base::StringPrintf("SELECT training_instance_id, feature_name, "
+                         "feature_type, feature_value FROM %s ORDER BY id",
+                         data_store_task_.name.c_str())
+          .c_str()));
+
+  const size_t num_columns = matrix.columns.size();
+  std::vector<double> row(num_columns);
+  std::vector<bool> row_filled(num_columns);
+  size_t filled_count = 0;
+  int current_instance_id = -1;
+
+  auto commit_row = [&]() {
+    if (current_instance_id != -1 && filled_count == num_columns) {
+      matrix.training_instance_ids.push_back(current_instance_id);
+      matrix.values.insert(matrix.values.end(), row.begin(), row.end());
+    }
+    std::fill(row_filled.begin(), row_filled.end(), false);
+    filled_count = 0;
+  };
+
+  while (statement.Step()) {
+    const int training_instance_id = statement.ColumnInt(0);
+    if (training_instance_id != current_instance_id) {
+      commit_row();
+      current_instance_id = training_instance_id;
+    }
+
+    const auto it = column_indices.find(statement.ColumnInt(1));
+    if (it == column_indices.end()) {
+      continue;
+    }
+    const std::string feature_value = statement.ColumnString(3);
+    double value = 0;
+    if (statement.ColumnInt(2) == static_cast<int>(mojom::DataType::kString)) {
+      value = EncodeStringCovariate(matrix.columns[it->second], feature_value)
+                  .value_or(std::numeric_limits<double>::quiet_NaN());
+    } else if (!base::StringToDouble(feature_value, &value)) {
+      value = std::numeric_limits<double>::quiet_NaN();
+    }
+    row[it->second] = value;
+    if (!row_filled[it->second]) {
+      row_filled[it->second] = true;
+      filled_count++;
+    }
+  }
+  commit_row();
+
+  return matrix;
+}
+
 bool DataStore::DeleteTrainingData() {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
@@ -167,34 +271,74 @@ bool DataStore::DeleteTrainingData() {
 void DataStore::PurgeTrainingDataAfterExpirationDate() {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
 
-  sql::Statement delete_statement(database_.GetUniqueStatement(
-      base::StringPrintf(" DELETE FROM %s WHERE created_at < ? OR id NOT IN "
-                         "(SELECT id FROM %s ORDER BY id DESC LIMIT ?)",
-                         data_store_task_.name.c_str(),
+  sql::Transaction transaction(&database_);
+  if (!transaction.Begin()) {
+    return;
+  }
+
+  sql::Statement delete_statement(database_.GetCachedStatement(
+      SQL_FROM_HERE,
+      base::StringPrintf("DELETE FROM %s WHERE created_at < ?",
                          data_store_task_.name.c_str())
           .c_str()));
   base::Time expiration_threshold =
       base::Time::Now() - data_store_task_.max_retention_days;
   delete_statement.BindDouble(0, expiration_threshold.ToDoubleT());
-  delete_statement.BindInt(1, data_store_task_.max_number_of_records);
-  delete_statement.Run();
+  if (!delete_statement.Run() || !EnforceMaxNumberOfRecords()) {
+    return;
+  }
+
+  std::ignore = transaction.Commit();
+}
+
+bool DataStore::EnforceMaxNumberOfRecords() {
+  // Ids only grow, so the oldest records are the ones with an id up to that
+  // of the first record past the newest |max_number_of_records|. Finding it
+  // walks |max_number_of_records| entries of the primary key, which is bounded
+  // by the limit rather than by the size of the table.
+  sql::Statement delete_statement(database_.GetCachedStatement(
+      SQL_FROM_HERE,
+      base::StringPrintf("DELETE FROM %s WHERE id <= (SELECT id FROM %s "
+                         "ORDER BY id DESC LIMIT 1 OFFSET ?)",
+                         data_store_task_.name.c_str(),
+                         data_store_task_.name.c_str())
+          .c_str()));
+  delete_statement.BindInt(0, data_store_task_.max_number_of_records);
+  return delete_statement.Run();
 }
 
 bool DataStore::MaybeCreateTable() {
-  if (database_.DoesTableExist(data_store_task_.name)) {
-    return true;
-  }
+  const char* name = data_store_task_.name.c_str();
 
   sql::Transaction transaction(&database_);
-  return transaction.Begin() &&
-         database_.Execute(
-             base::StringPrintf(
-                 "CREATE TABLE %s (id INTEGER PRIMARY KEY AUTOINCREMENT, "
-                 "training_instance_id INTEGER NOT NULL, feature_name INTEGER "
-                 "NOT NULL, feature_type INTEGER NOT NULL, "
-                 "feature_value TEXT NOT NULL, created_at DOUBLE NOT NULL)",
-                 data_store_task_.name.c_str())
+  if (!transaction.Begin()) {
+    return false;
+  }
+
+  if (!database_.DoesTableExist(data_store_task_.name) &&
+      !database_.Execute(
+          base::StringPrintf(
+              "CREATE TABLE %s (id INTEGER PRIMARY KEY AUTOINCREMENT, "
+              "training_instance_id INTEGER NOT NULL, feature_name INTEGER "
+              "NOT NULL, feature_type INTEGER NOT NULL, "
+              "feature_value TEXT NOT NULL, created_at DOUBLE NOT NULL)",
+              name)
+              .c_str())) {
+    return false;
+  }
+
+  // Tables created before the indices were added get them here as well.
+  return database_.Execute(
+             base::StringPrintf("CREATE INDEX IF NOT EXISTS "
+                                "%s_training_instance_id_index ON "
+                                "%s(training_instance_id)",
+                                name, name)
                  .c_str()) &&
+         database_.Execute(base::StringPrintf("CREATE INDEX IF NOT EXISTS "
+                                              "%s_created_at_index ON "
+                                              "%s(created_at)",
+                                              name, name)
+                               .c_str()) &&
          transaction.Commit();
 }
 
@@ -9,6 +9,7 @@
 #include <string>
 #include <vector>
 
+#include "base/containers/flat_map.h"
 #include "base/files/file_path.h"
 #include "base/gtest_prod_util.h"
 #include "base/sequence_checker.h"
@@ -19,6 +20,28 @@ namespace brave_federated {
 
 using TrainingData = base::flat_map<int, std::vector<mojom::CovariateInfoPtr>>;
 
+// Numerically encoded covariates of complete training instances laid out
+// densely, ready to be used for training without further parsing.
+struct TrainingMatrix {
+  TrainingMatrix();
+  ~TrainingMatrix();
+  TrainingMatrix(TrainingMatrix&&);
+  TrainingMatrix& operator=(TrainingMatrix&&);
+
+  size_t num_rows() const { return training_instance_ids.size(); }
+  size_t num_columns() const { return columns.size(); }
+  double at(size_t row, size_t column) const {
+    return values[row * columns.size() + column];
+  }
+
+  // Covariate type of each column, in ascending order.
+  std::vector<mojom::CovariateType> columns;
+  // Training instance of each row, in insertion order.
+  std::vector<int> training_instance_ids;
+  // Row-major, |num_columns()| values per row.
+  std::vector<double> values;
+};
+
 struct DataStoreTask {
   int id = 0;
   const std::string name;
@@ -38,7 +61,7 @@ class DataStore {
   bool InitializeDatabase();
 
   int GetNextTrainingInstanceId();
-  void SaveCovariate(const brave_federated::mojom::CovariateInfo& covariate,
+  bool SaveCovariate(const brave_federated::mojom::CovariateInfo& covariate,
                      int training_instance_id,
                      const base::Time created_at);
   bool AddTrainingInstance(
@@ -47,6 +70,11 @@ class DataStore {
 
   bool DeleteTrainingData();
   TrainingData LoadTrainingData();
+  // String covariates are left out unless they have a numeric encoding, e.g.
+  // notification ad events are encoded as 1 if the ad was clicked and 0
+  // otherwise. Instances missing a covariate, e.g. after being trimmed to
+  // |max_number_of_records|, are skipped.
+  TrainingMatrix LoadTrainingMatrix();
   void PurgeTrainingDataAfterExpirationDate();
 
  protected:
@@ -58,6 +86,7 @@ class DataStore {
 
  private:
   bool MaybeCreateTable();
+  bool EnforceMaxNumberOfRecords();
 
   SEQUENCE_CHECKER(sequence_checker_);
 };
@@ -10,13 +10,16 @@
 #include "base/check.h"
 #include "base/files/scoped_temp_dir.h"
 #include "base/path_service.h"
+#include "base/strings/string_number_conversions.h"
 #include "base/time/time.h"
 #include "brave/components/brave_federated/data_stores/data_store.h"
+#include "brave/components/brave_federated/notification_ad_task_constants.h"
 #include "content/public/test/browser_task_environment.h"
 #include "sql/statement.h"
 #include "sql/test/scoped_error_expecter.h"
 #include "sql/test/test_helpers.h"
 #include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/sqlite/sqlite3.h"
 
 // npm run test -- brave_unit_tests --filter=DataStoreTest*
 
@@ -36,6 +39,33 @@ struct TrainingDataInfo {
     {1, 2, 1, "42"},
 };
 
+mojom::CovariateInfoPtr MakeCovariate(mojom::CovariateType type,
+                                      mojom::DataType data_type,
+                                      const std::string& value) {
+  mojom::CovariateInfoPtr covariate = mojom::CovariateInfo::New();
+  covariate->type = type;
+  covariate->data_type = data_type;
+  covariate->value = value;
+  return covariate;
+}
+
+std::vector<mojom::CovariateInfoPtr> MakeTrainingInstance(
+    const std::string& event,
+    const std::string& click_through_rate,
+    const std::string& last_ad_was_clicked) {
+  std::vector<mojom::CovariateInfoPtr> training_instance;
+  training_instance.push_back(
+      MakeCovariate(mojom::CovariateType::kNotificationAdEvent,
+                    mojom::DataType::kString, event));
+  training_instance.push_back(
+      MakeCovariate(mojom::CovariateType::kLastNotificationAdWasClicked,
+                    mojom::DataType::kBool, last_ad_was_clicked));
+  training_instance.push_back(
+      MakeCovariate(mojom::CovariateType::kAverageClickthroughRate,
+                    mojom::DataType::kDouble, click_through_rate));
+  return training_instance;
+}
+
 }  // namespace
 
 class DataStoreTest : public testing::Test {
@@ -51,6 +81,7 @@ class DataStoreTest : public testing::Test {
 
   bool AddTrainingInstance(std::vector<mojom::CovariateInfoPtr> covariates);
   void InitializeDataStore();
+  void SetMaxNumberOfRecords(int max_number_of_records);
 
   base::test::TaskEnvironment task_environment_;
   base::ScopedTempDir temp_dir_;
@@ -113,6 +144,10 @@ void DataStoreTest::InitializeDataStore() {
             static_cast<unsigned int>(TrainingInstanceCount()));
 }
 
+void DataStoreTest::SetMaxNumberOfRecords(int max_number_of_records) {
+  data_store_->data_store_task_.max_number_of_records = max_number_of_records;
+}
+
 bool DataStoreTest::AddTrainingInstance(
     std::vector<mojom::CovariateInfoPtr> covariates) {
   std::vector<brave_federated::mojom::CovariateInfoPtr> training_instance;
@@ -139,11 +174,14 @@ TEST_F(DataStoreTest, GetNextTrainingInstanceId) {
 
 TEST_F(DataStoreTest, SaveCovariate) {
   TrainingData training_data = TrainingDataFromTestInfo();
-  data_store_->SaveCovariate(*training_data[0][0], 0, base::Time::Now());
+  EXPECT_TRUE(
+      data_store_->SaveCovariate(*training_data[0][0], 0, base::Time::Now()));
   EXPECT_EQ(1, TrainingInstanceCount());
-  data_store_->SaveCovariate(*training_data[0][0], 0, base::Time::Now());
+  EXPECT_TRUE(
+      data_store_->SaveCovariate(*training_data[0][0], 0, base::Time::Now()));
   EXPECT_EQ(1, TrainingInstanceCount());
-  data_store_->SaveCovariate(*training_data[0][0], 1, base::Time::Now());
+  EXPECT_TRUE(
+      data_store_->SaveCovariate(*training_data[0][0], 1, base::Time::Now()));
   EXPECT_EQ(2, TrainingInstanceCount());
 }
 
@@ -155,6 +193,23 @@ TEST_F(DataStoreTest, AddTrainingInstance) {
   EXPECT_EQ(2, TrainingInstanceCount());
 }
 
+TEST_F(DataStoreTest, AddTrainingInstanceRollsBackIfCovariateFails) {
+  // Only the first covariate of an instance can be inserted.
+  ASSERT_TRUE(data_store_->database_.Execute(
+      "CREATE TRIGGER fail_insert BEFORE INSERT ON test_federated_task "
+      "WHEN (SELECT count(*) FROM test_federated_task) > 0 "
+      "BEGIN SELECT RAISE(ABORT, 'fail_insert'); END"));
+
+  TrainingData training_data = TrainingDataFromTestInfo();
+  {
+    sql::test::ScopedErrorExpecter expecter;
+    expecter.ExpectError(SQLITE_CONSTRAINT);
+    EXPECT_FALSE(AddTrainingInstance(std::move(training_data[0])));
+    EXPECT_TRUE(expecter.SawExpectedErrors());
+  }
+  EXPECT_EQ(0, RecordCount());
+}
+
 TEST_F(DataStoreTest, LoadTrainingData) {
   InitializeDataStore();
   EXPECT_EQ(4, RecordCount());
@@ -192,4 +247,112 @@ TEST_F(DataStoreTest, PurgeTrainingDataAfterExpirationDate) {
   EXPECT_EQ(0, RecordCount());
 }
 
+TEST_F(DataStoreTest, LoadTrainingMatrix) {
+  EXPECT_TRUE(data_store_->AddTrainingInstance(MakeTrainingInstance(
+      "NotificationAdEventType::kClicked", "0.5", "1")));
+  EXPECT_TRUE(data_store_->AddTrainingInstance(MakeTrainingInstance(
+      "NotificationAdEventType::kDismissed", "0.25", "0")));
+  // Instances missing a covariate are skipped.
+  std::vector<mojom::CovariateInfoPtr> incomplete_instance;
+  incomplete_instance.push_back(
+      MakeCovariate(mojom::CovariateType::kAverageClickthroughRate,
+                    mojom::DataType::kDouble, "1"));
+  EXPECT_TRUE(data_store_->AddTrainingInstance(std::move(incomplete_instance)));
+
+  const TrainingMatrix matrix = data_store_->LoadTrainingMatrix();
+  ASSERT_EQ(3U, matrix.num_columns());
+  EXPECT_EQ(mojom::CovariateType::kNotificationAdEvent, matrix.columns[0]);
+  EXPECT_EQ(mojom::CovariateType::kAverageClickthroughRate, matrix.columns[1]);
+  EXPECT_EQ(mojom::CovariateType::kLastNotificationAdWasClicked,
+            matrix.columns[2]);
+  ASSERT_EQ(2U, matrix.num_rows());
+  EXPECT_EQ(1, matrix.training_instance_ids[0]);
+  EXPECT_EQ(2, matrix.training_instance_ids[1]);
+  // Notification ad events are encoded as whether the ad was clicked.
+  EXPECT_DOUBLE_EQ(1, matrix.at(0, 0));
+  EXPECT_DOUBLE_EQ(0.5, matrix.at(0, 1));
+  EXPECT_DOUBLE_EQ(1, matrix.at(0, 2));
+  EXPECT_DOUBLE_EQ(0, matrix.at(1, 0));
+  EXPECT_DOUBLE_EQ(0.25, matrix.at(1, 1));
+  EXPECT_DOUBLE_EQ(0, matrix.at(1, 2));
+}
+
+TEST_F(DataStoreTest, LoadTrainingMatrixLeavesOutStringCovariates) {
+  std::vector<mojom::CovariateInfoPtr> training_instance;
+  training_instance.push_back(
+      MakeCovariate(mojom::CovariateType::kNotificationAdServedAt,
+                    mojom::DataType::kString, "yesterday"));
+  training_instance.push_back(
+      MakeCovariate(mojom::CovariateType::kAverageClickthroughRate,
+                    mojom::DataType::kDouble, "0.5"));
+  EXPECT_TRUE(data_store_->AddTrainingInstance(std::move(training_instance)));
+
+  const TrainingMatrix matrix = data_store_->LoadTrainingMatrix();
+  ASSERT_EQ(1U, matrix.num_columns());
+  EXPECT_EQ(mojom::CovariateType::kAverageClickthroughRate, matrix.columns[0]);
+  ASSERT_EQ(1U, matrix.num_rows());
+  EXPECT_DOUBLE_EQ(0.5, matrix.at(0, 0));
+}
+
+TEST_F(DataStoreTest, LoadTrainingMatrixWhenDatabaseEmpty) {
+  const TrainingMatrix matrix = data_store_->LoadTrainingMatrix();
+  EXPECT_EQ(0U, matrix.num_columns());
+  EXPECT_EQ(0U, matrix.num_rows());
+}
+
+TEST_F(DataStoreTest, AddTrainingInstanceEnforcesMaxNumberOfRecords) {
+  // 3 records per instance, 50 records at most.
+  for (int i = 0; i < 20; ++i) {
+    EXPECT_TRUE(data_store_->AddTrainingInstance(MakeTrainingInstance(
+        "NotificationAdEventType::kClicked", "0.5", "1")));
+  }
+  EXPECT_EQ(50, RecordCount());
+
+  // The oldest records are removed, the 4th instance lost its first covariate
+  // and is incomplete.
+  const TrainingMatrix matrix = data_store_->LoadTrainingMatrix();
+  ASSERT_EQ(16U, matrix.num_rows());
+  EXPECT_EQ(5, matrix.training_instance_ids.front());
+  EXPECT_EQ(20, matrix.training_instance_ids.back());
+}
+
+TEST_F(DataStoreTest, PurgeTrainingDataEnforcesMaxNumberOfRecords) {
+  InitializeDataStore();
+  SetMaxNumberOfRecords(3);
+
+  data_store_->PurgeTrainingDataAfterExpirationDate();
+  EXPECT_EQ(3, RecordCount());
+  EXPECT_EQ(2, TrainingInstanceCount());
+}
+
+TEST_F(DataStoreTest, RecordLimitKeepsCompleteInstances) {
+  constexpr int kEvents = 5;
+  base::FilePath db_path(
+      temp_dir_.GetPath().Append(FILE_PATH_LITERAL("notification_ad_store")));
+  DataStore data_store({kNotificationAdTaskId, kNotificationAdTaskName,
+                        kEvents * kFeaturesPerEvent, kMaxRetentionDays},
+                       db_path);
+  ASSERT_TRUE(data_store.InitializeDatabase());
+
+  // Twice the limit, so that older records are trimmed as well.
+  for (int i = 0; i < 2 * kEvents; ++i) {
+    std::vector<mojom::CovariateInfoPtr> training_instance;
+    for (int j = 0; j < kFeaturesPerEvent; ++j) {
+      training_instance.push_back(
+          MakeCovariate(static_cast<mojom::CovariateType>(j),
+                        mojom::DataType::kDouble, base::NumberToString(i + j)));
+    }
+    ASSERT_TRUE(data_store.AddTrainingInstance(std::move(training_instance)));
+  }
+
+  const TrainingData training_data = data_store.LoadTrainingData();
+  const TrainingMatrix matrix = data_store.LoadTrainingMatrix();
+  EXPECT_EQ(static_cast<size_t>(kEvents), training_data.size());
+  ASSERT_EQ(static_cast<size_t>(kEvents), matrix.num_rows());
+  ASSERT_EQ(static_cast<size_t>(kFeaturesPerEvent), matrix.num_columns());
+  EXPECT_EQ(kEvents + 1, matrix.training_instance_ids.front());
+  EXPECT_DOUBLE_EQ(2 * kEvents - 1 + kFeaturesPerEvent - 1,
+                   matrix.at(kEvents - 1, kFeaturesPerEvent - 1));
+}
+
 }  // namespace brave_federated
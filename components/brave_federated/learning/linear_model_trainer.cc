@@ -0,0 +1,363 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_federated/learning/linear_model_trainer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include "base/check.h"
+#include "base/functional/bind.h"
+#include "base/ranges/algorithm.h"
+#include "base/task/thread_pool.h"
+#include "base/timer/elapsed_timer.h"
+#include "brave/components/brave_federated/data_stores/async_data_store.h"
+
+namespace brave_federated {
+
+namespace {
+
+constexpr double kMinProbability = 1e-12;
+
+// Predictor variables use -1 for missing values.
+constexpr double kMissingValue = -1;
+
+bool IsMissingValue(double value) {
+  return !std::isfinite(value) || value == kMissingValue;
+}
+
+// Training matrix split into contiguous features and labels, so the inner
+// loops run over dense arrays.
+struct Examples {
+  size_t num_features = 0;
+  size_t num_examples = 0;
+  // Row-major, |num_features| values per example.
+  std::vector<double> features;
+  std::vector<double> labels;
+
+  base::span<const double> GetFeatures(size_t index) const {
+    return base::make_span(features).subspan(index * num_features,
+                                             num_features);
+  }
+};
+
+absl::optional<Examples> SplitLabel(const TrainingMatrix& matrix,
+                                    mojom::CovariateType label) {
+  const auto label_it = base::ranges::find(matrix.columns, label);
+  if (label_it == matrix.columns.end() || matrix.num_rows() == 0) {
+    return absl::nullopt;
+  }
+  const size_t label_column = label_it - matrix.columns.begin();
+
+  Examples examples;
+  examples.num_features = matrix.num_columns() - 1;
+  examples.features.reserve(matrix.num_rows() * examples.num_features);
+  examples.labels.reserve(matrix.num_rows());
+  for (size_t row = 0; row < matrix.num_rows(); ++row) {
+    const base::span<const double> values =
+        base::make_span(matrix.values)
+            .subspan(row * matrix.num_columns(), matrix.num_columns());
+    if (base::ranges::any_of(values, &IsMissingValue)) {
+      continue;
+    }
+
+    for (size_t column = 0; column < matrix.num_columns(); ++column) {
+      if (column == label_column) {
+        examples.labels.push_back(values[column]);
+      } else {
+        examples.features.push_back(values[column]);
+      }
+    }
+    examples.num_examples++;
+  }
+
+  if (examples.num_examples == 0) {
+    return absl::nullopt;
+  }
+
+  return examples;
+}
+
+// Independent partial sums let the compiler vectorize the reduction without
+// reassociating floating point additions.
+double Dot(base::span<const double> a, base::span<const double> b) {
+  DCHECK_EQ(a.size(), b.size());
+  double sums[4] = {0, 0, 0, 0};
+  size_t i = 0;
+  for (; i + 4 <= a.size(); i += 4) {
+    sums[0] += a[i] * b[i];
+    sums[1] += a[i + 1] * b[i + 1];
+    sums[2] += a[i + 2] * b[i + 2];
+    sums[3] += a[i + 3] * b[i + 3];
+  }
+  for (; i < a.size(); ++i) {
+    sums[0] += a[i] * b[i];
+  }
+  return (sums[0] + sums[1]) + (sums[2] + sums[3]);
+}
+
+// y += alpha * x
+void Axpy(double alpha, base::span<const double> x, base::span<double> y) {
+  DCHECK_EQ(x.size(), y.size());
+  for (size_t i = 0; i < x.size(); ++i) {
+    y[i] += alpha * x[i];
+  }
+}
+
+// Sets the means and standard deviations of the features of |examples| on
+// |model|. Constant features keep a scale of 1.
+void ComputeStandardization(const Examples& examples, LinearModel* model) {
+  const size_t num_features = examples.num_features;
+  model->means.assign(num_features, 0);
+  model->scales.assign(num_features, 0);
+
+  for (size_t i = 0; i < examples.num_examples; ++i) {
+    Axpy(1, examples.GetFeatures(i), model->means);
+  }
+  for (double& mean : model->means) {
+    mean /= examples.num_examples;
+  }
+
+  for (size_t i = 0; i < examples.num_examples; ++i) {
+    const base::span<const double> features = examples.GetFeatures(i);
+    for (size_t j = 0; j < num_features; ++j) {
+      const double deviation = features[j] - model->means[j];
+      model->scales[j] += deviation * deviation;
+    }
+  }
+  for (double& scale : model->scales) {
+    scale = std::sqrt(scale / examples.num_examples);
+    if (scale == 0) {
+      scale = 1;
+    }
+  }
+}
+
+void Standardize(const LinearModel& model, Examples* examples) {
+  if (model.means.empty()) {
+    return;
+  }
+
+  const size_t num_features = examples->num_features;
+  for (size_t i = 0; i < examples->features.size(); ++i) {
+    const size_t j = i % num_features;
+    examples->features[i] =
+        (examples->features[i] - model.means[j]) / model.scales[j];
+  }
+}
+
+bool HasValidStandardization(const LinearModel& model, size_t num_features) {
+  return (model.means.empty() && model.scales.empty()) ||
+         (model.means.size() == num_features &&
+          model.scales.size() == num_features &&
+          !base::ranges::count(model.scales, 0));
+}
+
+double Activate(LinearModelType type, double z) {
+  if (type == LinearModelType::kLogisticRegression) {
+    return 1 / (1 + std::exp(-z));
+  }
+
+  return z;
+}
+
+// Prediction for features that are already standardized.
+double PredictStandardized(const LinearModel& model,
+                           base::span<const double> features) {
+  return Activate(model.type, Dot(model.weights, features) + model.bias);
+}
+
+double Loss(LinearModelType type, double prediction, double label) {
+  if (type == LinearModelType::kLogisticRegression) {
+    const double p =
+        std::clamp(prediction, kMinProbability, 1 - kMinProbability);
+    return -(label * std::log(p) + (1 - label) * std::log(1 - p));
+  }
+
+  return 0.5 * (prediction - label) * (prediction - label);
+}
+
+double MeanLoss(const Examples& examples, const LinearModel& model) {
+  double loss = 0;
+  for (size_t i = 0; i < examples.num_examples; ++i) {
+    loss += Loss(model.type,
+                 PredictStandardized(model, examples.GetFeatures(i)),
+                 examples.labels[i]);
+  }
+  return loss / examples.num_examples;
+}
+
+absl::optional<LinearModelDelta> TrainOnMatrix(
+    TrainingMatrix matrix,
+    const LinearModelTrainingConfig& config,
+    const LinearModel& model) {
+  return TrainLinearModel(matrix, config, model);
+}
+
+void OnTrainingMatrixLoaded(
+    const LinearModelTrainingConfig& config,
+    const LinearModel& model,
+    base::OnceCallback<void(absl::optional<LinearModelDelta>)> callback,
+    TrainingMatrix matrix) {
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE,
+      {base::TaskPriority::BEST_EFFORT,
+       base::TaskShutdownBehavior::CONTINUE_ON_SHUTDOWN},
+      base::BindOnce(&TrainOnMatrix, std::move(matrix), config, model),
+      std::move(callback));
+}
+
+}  // namespace
+
+LinearModel::LinearModel() = default;
+LinearModel::~LinearModel() = default;
+LinearModel::LinearModel(const LinearModel&) = default;
+LinearModel& LinearModel::operator=(const LinearModel&) = default;
+
+double LinearModel::Predict(base::span<const double> features) const {
+  if (means.empty()) {
+    return PredictStandardized(*this, features);
+  }
+
+  DCHECK_EQ(weights.size(), features.size());
+  double z = bias;
+  for (size_t i = 0; i < features.size(); ++i) {
+    z += weights[i] * (features[i] - means[i]) / scales[i];
+  }
+  return Activate(type, z);
+}
+
+LinearModelDelta::LinearModelDelta() = default;
+LinearModelDelta::~LinearModelDelta() = default;
+LinearModelDelta::LinearModelDelta(LinearModelDelta&&) = default;
+LinearModelDelta& LinearModelDelta::operator=(LinearModelDelta&&) = default;
+
+void ApplyLinearModelDelta(const LinearModelDelta& delta, LinearModel* model) {
+  DCHECK(model);
+
+  if (model->weights.empty()) {
+    model->weights.assign(delta.weights.size(), 0);
+    model->means = delta.means;
+    model->scales = delta.scales;
+  }
+  Axpy(1, delta.weights, model->weights);
+  model->bias += delta.bias;
+}
+
+absl::optional<LinearModelDelta> TrainLinearModel(
+    const TrainingMatrix& matrix,
+    const LinearModelTrainingConfig& config,
+    const LinearModel& model) {
+  absl::optional<Examples> examples = SplitLabel(matrix, config.label);
+  if (!examples) {
+    return absl::nullopt;
+  }
+
+  const size_t num_features = examples->num_features;
+  LinearModel trained = model;
+  if (trained.weights.empty()) {
+    trained.weights.assign(num_features, 0);
+    ComputeStandardization(*examples, &trained);
+  }
+  if (trained.weights.size() != num_features ||
+      !HasValidStandardization(trained, num_features)) {
+    return absl::nullopt;
+  }
+  Standardize(trained, &*examples);
+
+  LinearModelDelta delta;
+  delta.means = trained.means;
+  delta.scales = trained.scales;
+  delta.num_examples = examples->num_examples;
+
+  const size_t batch_size = std::max<size_t>(config.batch_size, 1);
+  std::vector<double> gradient(num_features);
+  base::ElapsedThreadTimer timer;
+
+  // Both losses have the same gradient, (prediction - label) * features.
+  for (int epoch = 0; epoch < config.max_epochs; ++epoch) {
+    for (size_t begin = 0; begin < examples->num_examples;
+         begin += batch_size) {
+      const size_t end = std::min(begin + batch_size, examples->num_examples);
+
+      base::ranges::fill(gradient, 0);
+      double bias_gradient = 0;
+      for (size_t i = begin; i < end; ++i) {
+        const base::span<const double> features = examples->GetFeatures(i);
+        const double error =
+            PredictStandardized(trained, features) - examples->labels[i];
+        Axpy(error, features, gradient);
+        bias_gradient += error;
+      }
+
+      const double step = config.learning_rate / (end - begin);
+      Axpy(-step, gradient, trained.weights);
+      trained.bias -= step * bias_gradient;
+      delta.num_batches++;
+
+      if (timer.is_supported() && timer.Elapsed() >= config.cpu_budget) {
+        delta.cpu_budget_exhausted = true;
+        break;
+      }
+    }
+
+    if (delta.cpu_budget_exhausted) {
+      break;
+    }
+  }
+
+  delta.weights = trained.weights;
+  if (!model.weights.empty()) {
+    Axpy(-1, model.weights, delta.weights);
+  }
+  delta.bias = trained.bias - model.bias;
+  delta.loss = MeanLoss(*examples, trained);
+  return delta;
+}
+
+absl::optional<LinearModelEvaluation> EvaluateLinearModel(
+    const TrainingMatrix& matrix,
+    mojom::CovariateType label,
+    const LinearModel& model) {
+  absl::optional<Examples> examples = SplitLabel(matrix, label);
+  if (!examples || model.weights.size() != examples->num_features ||
+      !HasValidStandardization(model, examples->num_features)) {
+    return absl::nullopt;
+  }
+  Standardize(model, &*examples);
+
+  LinearModelEvaluation evaluation;
+  evaluation.loss = MeanLoss(*examples, model);
+
+  if (model.type == LinearModelType::kLogisticRegression) {
+    size_t correct_count = 0;
+    for (size_t i = 0; i < examples->num_examples; ++i) {
+      const bool predicted =
+          PredictStandardized(model, examples->GetFeatures(i)) >= 0.5;
+      if (predicted == (examples->labels[i] >= 0.5)) {
+        correct_count++;
+      }
+    }
+    evaluation.accuracy =
+        static_cast<double>(correct_count) / examples->num_examples;
+  }
+
+  return evaluation;
+}
+
+void TrainLinearModelOnDataStore(
+    AsyncDataStore* data_store,
+    const LinearModelTrainingConfig& config,
+    const LinearModel& model,
+    base::OnceCallback<void(absl::optional<LinearModelDelta>)> callback) {
+  DCHECK(data_store);
+
+  data_store->LoadTrainingMatrix(base::BindOnce(&OnTrainingMatrixLoaded, config,
+                                                model, std::move(callback)));
+}
+
+}  // namespace brave_federated
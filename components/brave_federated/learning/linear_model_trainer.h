@@ -0,0 +1,113 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_FEDERATED_LEARNING_LINEAR_MODEL_TRAINER_H_
+#define BRAVE_COMPONENTS_BRAVE_FEDERATED_LEARNING_LINEAR_MODEL_TRAINER_H_
+
+#include <vector>
+
+#include "base/containers/span.h"
+#include "base/functional/callback.h"
+#include "base/time/time.h"
+#include "brave/components/brave_federated/data_stores/data_store.h"
+#include "brave/components/brave_federated/public/interfaces/brave_federated.mojom.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+
+namespace brave_federated {
+
+class AsyncDataStore;
+
+enum class LinearModelType {
+  kLinearRegression,    // Squared error loss
+  kLogisticRegression,  // Log loss, predictions are probabilities
+};
+
+struct LinearModel {
+  LinearModel();
+  ~LinearModel();
+  LinearModel(const LinearModel&);
+  LinearModel& operator=(const LinearModel&);
+
+  double Predict(base::span<const double> features) const;
+
+  LinearModelType type = LinearModelType::kLinearRegression;
+  // One weight per feature, features are the columns of the training matrix
+  // other than the label, in the same order.
+  std::vector<double> weights;
+  double bias = 0;
+  // Features are standardized as (feature - mean) / scale before being
+  // weighted. Both are empty if features are weighted as they are.
+  std::vector<double> means;
+  std::vector<double> scales;
+};
+
+struct LinearModelTrainingConfig {
+  // Covariate predicted by the model, by default whether the notification ad
+  // was clicked.
+  mojom::CovariateType label = mojom::CovariateType::kNotificationAdEvent;
+  double learning_rate = 0.01;
+  size_t batch_size = 32;
+  int max_epochs = 10;
+  // Training stops after the mini-batch that exceeds this much CPU time. Only
+  // |max_epochs| applies on platforms without thread CPU time.
+  base::TimeDelta cpu_budget = base::Seconds(1);
+};
+
+// Difference between the trained model and the one training started from.
+struct LinearModelDelta {
+  LinearModelDelta();
+  ~LinearModelDelta();
+  LinearModelDelta(LinearModelDelta&&);
+  LinearModelDelta& operator=(LinearModelDelta&&);
+
+  std::vector<double> weights;
+  double bias = 0;
+  // Standardization used for training, set on models without weights when
+  // the delta is applied.
+  std::vector<double> means;
+  std::vector<double> scales;
+  size_t num_examples = 0;
+  size_t num_batches = 0;
+  // Mean loss of the trained model over the training data.
+  double loss = 0;
+  bool cpu_budget_exhausted = false;
+};
+
+struct LinearModelEvaluation {
+  double loss = 0;
+  // Fraction of predictions on the same side of 0.5 as the label, only set
+  // for logistic regression.
+  absl::optional<double> accuracy;
+};
+
+void ApplyLinearModelDelta(const LinearModelDelta& delta, LinearModel* model);
+
+// Runs mini-batch SGD over |matrix| starting from |model|. Models without
+// weights are zero initialized and trained on features standardized with the
+// means and scales of |matrix|, other models keep their standardization. Rows
+// with a missing value, i.e. NaN or the -1 of predictor variables, are
+// skipped. Returns nullopt if no row is left, |matrix| lacks the label column
+// or doesn't match the number of weights.
+absl::optional<LinearModelDelta> TrainLinearModel(
+    const TrainingMatrix& matrix,
+    const LinearModelTrainingConfig& config,
+    const LinearModel& model);
+
+absl::optional<LinearModelEvaluation> EvaluateLinearModel(
+    const TrainingMatrix& matrix,
+    mojom::CovariateType label,
+    const LinearModel& model);
+
+// Loads the training matrix of |data_store| and trains on a best effort
+// background sequence, replying on the calling sequence.
+void TrainLinearModelOnDataStore(
+    AsyncDataStore* data_store,
+    const LinearModelTrainingConfig& config,
+    const LinearModel& model,
+    base::OnceCallback<void(absl::optional<LinearModelDelta>)> callback);
+
+}  // namespace brave_federated
+
+#endif  // BRAVE_COMPONENTS_BRAVE_FEDERATED_LEARNING_LINEAR_MODEL_TRAINER_H_
@@ -0,0 +1,274 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_federated/learning/linear_model_trainer.h"
+
+#include <cmath>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/files/scoped_temp_dir.h"
+#include "base/functional/bind.h"
+#include "base/run_loop.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/test/task_environment.h"
+#include "base/time/time.h"
+#include "brave/components/brave_federated/data_stores/async_data_store.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+// npm run test -- brave_unit_tests --filter=LinearModelTrainerTest*
+
+namespace brave_federated {
+
+namespace {
+
+constexpr mojom::CovariateType kFirstFeature =
+    mojom::CovariateType::kAverageClickthroughRate;
+constexpr mojom::CovariateType kSecondFeature =
+    mojom::CovariateType::kLastNotificationAdWasClicked;
+constexpr mojom::CovariateType kLabel =
+    mojom::CovariateType::kNumberOfClickedLinkEvents;
+
+// 100 examples on a 10x10 grid of [0, 0.9]^2, with labels computed from the
+// two features.
+TrainingMatrix MakeTrainingMatrix(double (*label)(double, double)) {
+  TrainingMatrix matrix;
+  matrix.columns = {kFirstFeature, kSecondFeature, kLabel};
+  for (int i = 0; i < 100; ++i) {
+    const double x0 = (i % 10) / 10.0;
+    const double x1 = (i / 10) / 10.0;
+    matrix.training_instance_ids.push_back(i + 1);
+    matrix.values.insert(matrix.values.end(), {x0, x1, label(x0, x1)});
+  }
+  return matrix;
+}
+
+double LinearLabel(double x0, double x1) {
+  return 2 * x0 - x1 + 0.5;
+}
+
+double LogisticLabel(double x0, double x1) {
+  return x0 - x1 + 0.05 > 0 ? 1 : 0;
+}
+
+LinearModelTrainingConfig MakeConfig(double learning_rate, int max_epochs) {
+  LinearModelTrainingConfig config;
+  config.label = kLabel;
+  config.learning_rate = learning_rate;
+  config.batch_size = 10;
+  config.max_epochs = max_epochs;
+  config.cpu_budget = base::TimeDelta::Max();
+  return config;
+}
+
+mojom::CovariateInfoPtr MakeCovariate(mojom::CovariateType type,
+                                      double value) {
+  mojom::CovariateInfoPtr covariate = mojom::CovariateInfo::New();
+  covariate->type = type;
+  covariate->data_type = mojom::DataType::kDouble;
+  covariate->value = base::NumberToString(value);
+  return covariate;
+}
+
+double Predict(const LinearModel& model, const std::vector<double>& features) {
+  return model.Predict(features);
+}
+
+}  // namespace
+
+class LinearModelTrainerTest : public testing::Test {
+ protected:
+  base::test::TaskEnvironment task_environment_;
+};
+
+TEST_F(LinearModelTrainerTest, LinearRegression) {
+  const TrainingMatrix matrix = MakeTrainingMatrix(&LinearLabel);
+
+  LinearModel model;
+  const absl::optional<LinearModelDelta> delta =
+      TrainLinearModel(matrix, MakeConfig(0.5, 500), model);
+  ASSERT_TRUE(delta);
+  EXPECT_EQ(100U, delta->num_examples);
+  EXPECT_EQ(5000U, delta->num_batches);
+  EXPECT_FALSE(delta->cpu_budget_exhausted);
+
+  ApplyLinearModelDelta(*delta, &model);
+  ASSERT_EQ(2U, model.weights.size());
+  // Features are standardized, both have a mean of 0.45.
+  ASSERT_EQ(2U, model.means.size());
+  EXPECT_DOUBLE_EQ(0.45, model.means[0]);
+  EXPECT_DOUBLE_EQ(0.45, model.means[1]);
+  EXPECT_NEAR(2 * model.scales[0], model.weights[0], 1e-3);
+  EXPECT_NEAR(-1 * model.scales[1], model.weights[1], 1e-3);
+  EXPECT_NEAR(LinearLabel(0.2, 0.7), Predict(model, {0.2, 0.7}), 1e-3);
+  EXPECT_NEAR(0, delta->loss, 1e-6);
+}
+
+TEST_F(LinearModelTrainerTest, LogisticRegression) {
+  const TrainingMatrix matrix = MakeTrainingMatrix(&LogisticLabel);
+
+  LinearModel model;
+  model.type = LinearModelType::kLogisticRegression;
+  const absl::optional<LinearModelDelta> delta =
+      TrainLinearModel(matrix, MakeConfig(1, 200), model);
+  ASSERT_TRUE(delta);
+  ApplyLinearModelDelta(*delta, &model);
+
+  const absl::optional<LinearModelEvaluation> evaluation =
+      EvaluateLinearModel(matrix, kLabel, model);
+  ASSERT_TRUE(evaluation);
+  EXPECT_DOUBLE_EQ(delta->loss, evaluation->loss);
+  ASSERT_TRUE(evaluation->accuracy);
+  EXPECT_GE(*evaluation->accuracy, 0.95);
+}
+
+TEST_F(LinearModelTrainerTest, DeltaFromExistingModel) {
+  const TrainingMatrix matrix = MakeTrainingMatrix(&LinearLabel);
+
+  LinearModel model;
+  model.weights = {1, 1};
+  model.bias = 1;
+  const absl::optional<LinearModelDelta> delta =
+      TrainLinearModel(matrix, MakeConfig(0.5, 500), model);
+  ASSERT_TRUE(delta);
+  EXPECT_NEAR(1, delta->weights[0], 1e-3);
+  EXPECT_NEAR(-2, delta->weights[1], 1e-3);
+  EXPECT_NEAR(-0.5, delta->bias, 1e-3);
+}
+
+TEST_F(LinearModelTrainerTest, CpuBudget) {
+  if (!base::ThreadTicks::IsSupported()) {
+    GTEST_SKIP() << "Thread CPU time is not supported";
+  }
+
+  LinearModelTrainingConfig config = MakeConfig(0.5, 500);
+  config.cpu_budget = base::TimeDelta();
+  const absl::optional<LinearModelDelta> delta =
+      TrainLinearModel(MakeTrainingMatrix(&LinearLabel), config, {});
+  ASSERT_TRUE(delta);
+  EXPECT_TRUE(delta->cpu_budget_exhausted);
+  EXPECT_EQ(1U, delta->num_batches);
+}
+
+TEST_F(LinearModelTrainerTest, InvalidInput) {
+  const TrainingMatrix matrix = MakeTrainingMatrix(&LinearLabel);
+
+  EXPECT_FALSE(TrainLinearModel(TrainingMatrix(), MakeConfig(0.5, 1), {}));
+
+  LinearModelTrainingConfig config = MakeConfig(0.5, 1);
+  config.label = mojom::CovariateType::kNotificationAdEvent;
+  EXPECT_FALSE(TrainLinearModel(matrix, config, {}));
+
+  LinearModel model;
+  model.weights = {1, 2, 3};
+  EXPECT_FALSE(TrainLinearModel(matrix, MakeConfig(0.5, 1), model));
+  EXPECT_FALSE(EvaluateLinearModel(matrix, kLabel, model));
+}
+
+TEST_F(LinearModelTrainerTest, TrainOnDataStore) {
+  base::ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+  AsyncDataStore data_store(
+      {0, "test_federated_task", /* max_number_of_records */ 1000,
+       base::Days(30)},
+      temp_dir.GetPath().Append(FILE_PATH_LITERAL("test_data_store")));
+  data_store.InitializeDatabase(
+      base::BindOnce([](bool success) { EXPECT_TRUE(success); }));
+
+  const TrainingMatrix matrix = MakeTrainingMatrix(&LinearLabel);
+  for (size_t row = 0; row < matrix.num_rows(); ++row) {
+    std::vector<mojom::CovariateInfoPtr> training_instance;
+    for (size_t column = 0; column < matrix.num_columns(); ++column) {
+      training_instance.push_back(
+          MakeCovariate(matrix.columns[column], matrix.at(row, column)));
+    }
+    data_store.AddTrainingInstance(
+        std::move(training_instance),
+        base::BindOnce([](bool success) { EXPECT_TRUE(success); }));
+  }
+
+  absl::optional<LinearModelDelta> delta;
+  base::RunLoop run_loop;
+  TrainLinearModelOnDataStore(
+      &data_store, MakeConfig(0.5, 500), {},
+      base::BindOnce(
+          [](absl::optional<LinearModelDelta>* delta, base::OnceClosure quit,
+             absl::optional<LinearModelDelta> result) {
+            *delta = std::move(result);
+            std::move(quit).Run();
+          },
+          &delta, run_loop.QuitClosure()));
+  run_loop.Run();
+
+  ASSERT_TRUE(delta);
+  EXPECT_EQ(100U, delta->num_examples);
+  LinearModel model;
+  ApplyLinearModelDelta(*delta, &model);
+  EXPECT_NEAR(LinearLabel(0.2, 0.7), Predict(model, {0.2, 0.7}), 1e-3);
+}
+
+TEST_F(LinearModelTrainerTest, SkipMissingValues) {
+  TrainingMatrix matrix = MakeTrainingMatrix(&LinearLabel);
+  matrix.values[0] = std::numeric_limits<double>::quiet_NaN();
+  matrix.values[4] = -1;
+  matrix.values[8] = std::numeric_limits<double>::infinity();
+
+  LinearModel model;
+  const absl::optional<LinearModelDelta> delta =
+      TrainLinearModel(matrix, MakeConfig(0.5, 500), model);
+  ASSERT_TRUE(delta);
+  EXPECT_EQ(97U, delta->num_examples);
+  ApplyLinearModelDelta(*delta, &model);
+  EXPECT_NEAR(LinearLabel(0.2, 0.7), Predict(model, {0.2, 0.7}), 1e-3);
+
+  // Nothing is left to train on.
+  for (size_t row = 0; row < matrix.num_rows(); ++row) {
+    matrix.values[row * matrix.num_columns()] = -1;
+  }
+  EXPECT_FALSE(TrainLinearModel(matrix, MakeConfig(0.5, 1), {}));
+}
+
+// Covariates as logged by the notification ad task: times in seconds, event
+// counts and a clickthrough rate, labeled by whether the ad was clicked.
+TEST_F(LinearModelTrainerTest, RealisticCovariateMagnitudes) {
+  TrainingMatrix matrix;
+  matrix.columns = {mojom::CovariateType::kNotificationAdEvent,
+                    mojom::CovariateType::kAverageClickthroughRate,
+                    mojom::CovariateType::kNumberOfClickedLinkEvents,
+                    mojom::CovariateType::kTimeSinceLastClickedLinkEvent};
+  for (int i = 0; i < 200; ++i) {
+    const double time_since_last_clicked_link = (i * 37 % 200) * 432.0;
+    const double number_of_clicked_link_events = i % 50;
+    const double average_clickthrough_rate = (i % 10) / 100.0;
+    const double clicked = time_since_last_clicked_link < 20000 ? 1 : 0;
+    matrix.training_instance_ids.push_back(i + 1);
+    matrix.values.insert(
+        matrix.values.end(),
+        {clicked, average_clickthrough_rate, number_of_clicked_link_events,
+         time_since_last_clicked_link});
+  }
+
+  LinearModel model;
+  model.type = LinearModelType::kLogisticRegression;
+  LinearModelTrainingConfig config = MakeConfig(0.5, 200);
+  config.label = LinearModelTrainingConfig().label;
+  const absl::optional<LinearModelDelta> delta =
+      TrainLinearModel(matrix, config, model);
+  ASSERT_TRUE(delta);
+  ApplyLinearModelDelta(*delta, &model);
+
+  const absl::optional<LinearModelEvaluation> evaluation =
+      EvaluateLinearModel(matrix, config.label, model);
+  ASSERT_TRUE(evaluation);
+  EXPECT_TRUE(std::isfinite(evaluation->loss));
+  ASSERT_TRUE(evaluation->accuracy);
+  EXPECT_GE(*evaluation->accuracy, 0.95);
+  EXPECT_GT(Predict(model, {0.05, 10, 600}), 0.5);
+  EXPECT_LT(Predict(model, {0.05, 10, 80000}), 0.5);
+}
+
+}  // namespace brave_federated
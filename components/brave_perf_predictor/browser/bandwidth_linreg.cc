@@ -17,18 +17,19 @@ namespace brave_perf_predictor {
 
 namespace {
 
+// Standardises the leading numeric features in place.
 bool StandardiseFeatsNoOutliers(
-    std::array<double, standardise_feat_count>* features,
+    std::array<double, feature_count>* features,
     const std::array<double, standardise_feat_count>& means,
     const std::array<double, standardise_feat_count>& scale) {
   for (unsigned int i = 0; i < standardise_feat_count; i++) {
-    features->at(i) = (features->at(i) - means[i]) / scale[i];
+    (*features)[i] = ((*features)[i] - means[i]) / scale[i];
   }
   for (unsigned int i = 0; i < standardise_feat_count; i++) {
-    if (features->at(i) > kOutlierThreshold ||
-        features->at(i) < -kOutlierThreshold) {
+    if ((*features)[i] > kOutlierThreshold ||
+        (*features)[i] < -kOutlierThreshold) {
       VLOG(2) << "Outlier feature " << feature_sequence.at(i) << " with value "
-              << features->at(i);
+              << (*features)[i];
       return true;
     }
   }
@@ -38,25 +39,15 @@ bool StandardiseFeatsNoOutliers(
 }  // namespace
 
 double LinregPredictVector(const std::array<double, feature_count>& features) {
-  // Standardise numeric features
-  std::array<double, standardise_feat_count> numeric_features;
-  std::copy(features.begin(), features.begin() + standardise_feat_count,
-            numeric_features.begin());
+  // Standardise numeric features, the rest are used as-is
+  std::array<double, feature_count> standardised_features = features;
   bool has_outliers = StandardiseFeatsNoOutliers(
-      &numeric_features, standardise_feat_means, standardise_feat_scale);
+      &standardised_features, standardise_feat_means, standardise_feat_scale);
   if (has_outliers) {
     VLOG(2) << "Feature set has outliers, return 0";
     return 0;
   }
 
-  // Create a new feature vector to include all features
-  std::array<double, feature_count> standardised_features;
-  std::move(numeric_features.begin(), numeric_features.end(),
-            standardised_features.begin());
-  // Just copy the rest of the features as-is
-  std::copy(features.begin() + standardise_feat_count, features.end(),
-            standardised_features.begin() + standardise_feat_count);
-
   // Calculate the prediction
   double log_prediction = std::inner_product(
       standardised_features.begin(), standardised_features.end(),
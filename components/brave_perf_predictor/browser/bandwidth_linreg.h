@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "base/containers/flat_map.h"
+#include "base/strings/string_piece.h"
 #include "brave/components/brave_perf_predictor/browser/bandwidth_linreg_parameters.h"
 
 namespace brave_perf_predictor {
@@ -18,6 +19,16 @@ constexpr double kOutlierThreshold = 6;
 // if above 20MB _and_ more than 6x of the transfer size, probably an outlier
 constexpr double kSavingsAbsoluteOutlier = 20 << 20;
 
+// Index of |name| in |feature_sequence|, or |feature_count| if the model
+// doesn't use it. Evaluated at compile time for constant names.
+constexpr size_t GetFeatureIndex(base::StringPiece name) {
+  for (size_t i = 0; i < feature_sequence.size(); i++) {
+    if (feature_sequence[i] == name)
+      return i;
+  }
+  return feature_sequence.size();
+}
+
 // Computes prediction based on the provided feature vector.
 // It is the client's responsibility to provide features in
 // the exact order expected by the predictor.
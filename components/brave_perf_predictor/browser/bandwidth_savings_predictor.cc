@@ -5,16 +5,109 @@
 
 #include "brave/components/brave_perf_predictor/browser/bandwidth_savings_predictor.h"
 
-#include <iostream>
-
+#include "base/check_op.h"
 #include "base/logging.h"
 #include "brave/components/brave_perf_predictor/browser/bandwidth_linreg.h"
+#include "brave/components/brave_perf_predictor/browser/named_third_parties.h"
 #include "components/page_load_metrics/common/page_load_metrics.mojom.h"
 #include "net/base/registry_controlled_domains/registry_controlled_domain.h"
 #include "third_party/blink/public/mojom/loader/resource_load_info.mojom.h"
 
 namespace brave_perf_predictor {
 
+namespace {
+
+// Indices into |feature_sequence|, resolved at compile time.
+constexpr size_t kAdblockRequests = GetFeatureIndex("adblockRequests");
+constexpr size_t kFirstMeaningfulPaint =
+    GetFeatureIndex("metrics.firstMeaningfulPaint");
+constexpr size_t kObservedDomContentLoaded =
+    GetFeatureIndex("metrics.observedDomContentLoaded");
+constexpr size_t kObservedFirstVisualChange =
+    GetFeatureIndex("metrics.observedFirstVisualChange");
+constexpr size_t kObservedLoad = GetFeatureIndex("metrics.observedLoad");
+constexpr size_t kThirdPartyRequestCount =
+    GetFeatureIndex("resources.third-party.requestCount");
+constexpr size_t kThirdPartySize =
+    GetFeatureIndex("resources.third-party.size");
+constexpr size_t kTotalRequestCount =
+    GetFeatureIndex("resources.total.requestCount");
+constexpr size_t kTotalSize = GetFeatureIndex("resources.total.size");
+
+struct ResourceTypeFeatures {
+  size_t request_count;
+  size_t size;
+};
+
+constexpr ResourceTypeFeatures kDocumentFeatures = {
+    GetFeatureIndex("resources.document.requestCount"),
+    GetFeatureIndex("resources.document.size")};
+constexpr ResourceTypeFeatures kFontFeatures = {
+    GetFeatureIndex("resources.font.requestCount"),
+    GetFeatureIndex("resources.font.size")};
+constexpr ResourceTypeFeatures kImageFeatures = {
+    GetFeatureIndex("resources.image.requestCount"),
+    GetFeatureIndex("resources.image.size")};
+constexpr ResourceTypeFeatures kMediaFeatures = {
+    GetFeatureIndex("resources.media.requestCount"),
+    GetFeatureIndex("resources.media.size")};
+constexpr ResourceTypeFeatures kOtherFeatures = {
+    GetFeatureIndex("resources.other.requestCount"),
+    GetFeatureIndex("resources.other.size")};
+constexpr ResourceTypeFeatures kScriptFeatures = {
+    GetFeatureIndex("resources.script.requestCount"),
+    GetFeatureIndex("resources.script.size")};
+constexpr ResourceTypeFeatures kStylesheetFeatures = {
+    GetFeatureIndex("resources.stylesheet.requestCount"),
+    GetFeatureIndex("resources.stylesheet.size")};
+
+static_assert(kAdblockRequests < feature_count &&
+                  kFirstMeaningfulPaint < feature_count &&
+                  kObservedDomContentLoaded < feature_count &&
+                  kObservedFirstVisualChange < feature_count &&
+                  kObservedLoad < feature_count &&
+                  kThirdPartyRequestCount < feature_count &&
+                  kThirdPartySize < feature_count &&
+                  kTotalRequestCount < feature_count &&
+                  kTotalSize < feature_count,
+              "Model parameters are missing a page feature");
+
+constexpr bool IsValid(const ResourceTypeFeatures& features) {
+  return features.request_count < feature_count &&
+         features.size < feature_count;
+}
+
+static_assert(IsValid(kDocumentFeatures) && IsValid(kFontFeatures) &&
+                  IsValid(kImageFeatures) && IsValid(kMediaFeatures) &&
+                  IsValid(kOtherFeatures) && IsValid(kScriptFeatures) &&
+                  IsValid(kStylesheetFeatures),
+              "Model parameters are missing a resource type feature");
+
+const ResourceTypeFeatures& GetResourceTypeFeatures(
+    network::mojom::RequestDestination destination) {
+  switch (destination) {
+    case network::mojom::RequestDestination::kDocument:
+    case network::mojom::RequestDestination::kIframe:
+      return kDocumentFeatures;
+    case network::mojom::RequestDestination::kStyle:
+      return kStylesheetFeatures;
+    case network::mojom::RequestDestination::kScript:
+      return kScriptFeatures;
+    case network::mojom::RequestDestination::kImage:
+      return kImageFeatures;
+    case network::mojom::RequestDestination::kFont:
+      return kFontFeatures;
+    case network::mojom::RequestDestination::kAudio:
+    case network::mojom::RequestDestination::kTrack:
+    case network::mojom::RequestDestination::kVideo:
+      return kMediaFeatures;
+    default:
+      return kOtherFeatures;
+  }
+}
+
+}  // namespace
+
 BandwidthSavingsPredictor::BandwidthSavingsPredictor(
     const NamedThirdPartyRegistry* registry)
     : tp_registry_(registry) {}
@@ -25,34 +118,37 @@ void BandwidthSavingsPredictor::OnPageLoadTimingUpdated(
     const page_load_metrics::mojom::PageLoadTiming& timing) {
   // First meaningful paint
   if (timing.paint_timing->first_meaningful_paint.has_value())
-    feature_map_["metrics.firstMeaningfulPaint"] =
+    features_[kFirstMeaningfulPaint] =
         timing.paint_timing->first_meaningful_paint.value().InMillisecondsF();
 
   // DOM Content Loaded
   if (timing.document_timing->dom_content_loaded_event_start.has_value())
-    feature_map_["metrics.observedDomContentLoaded"] =
+    features_[kObservedDomContentLoaded] =
         timing.document_timing->dom_content_loaded_event_start.value()
             .InMillisecondsF();
 
   // First contentful paint
   if (timing.paint_timing->first_contentful_paint.has_value())
-    feature_map_["metrics.observedFirstVisualChange"] =
+    features_[kObservedFirstVisualChange] =
         timing.paint_timing->first_contentful_paint.value().InMillisecondsF();
 
   // Load
   if (timing.document_timing->load_event_start.has_value())
-    feature_map_["metrics.observedLoad"] =
+    features_[kObservedLoad] =
         timing.document_timing->load_event_start.value().InMillisecondsF();
 }
 
 void BandwidthSavingsPredictor::OnSubresourceBlocked(
     const std::string& resource_url) {
-  feature_map_["adblockRequests"] += 1;
+  features_[kAdblockRequests] += 1;
 
   if (tp_registry_) {
-    const auto tp_name = tp_registry_->GetThirdParty(resource_url);
-    if (tp_name.has_value())
-      feature_map_["thirdParties." + tp_name.value() + ".blocked"] = 1;
+    const auto entity = tp_registry_->GetThirdPartyEntity(resource_url);
+    if (entity.has_value()) {
+      const auto entity_features = GetNamedThirdPartyEntityFeatures();
+      DCHECK_LT(*entity, entity_features.size());
+      features_[entity_features[*entity]] = 1;
+    }
   }
 }
 
@@ -73,47 +169,18 @@ void BandwidthSavingsPredictor::OnResourceLoadComplete(
           net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES);
 
   if (is_third_party) {
-    feature_map_["resources.third-party.requestCount"] += 1;
-    feature_map_["resources.third-party.size"] +=
-        resource_load_info.raw_body_bytes;
+    features_[kThirdPartyRequestCount] += 1;
+    features_[kThirdPartySize] += resource_load_info.raw_body_bytes;
   }
 
-  feature_map_["resources.total.requestCount"] += 1;
-  feature_map_["resources.total.size"] += resource_load_info.raw_body_bytes;
-  feature_map_["transfer.total.size"] +=
-      resource_load_info.total_received_bytes;
-  std::string resource_type;
-  switch (resource_load_info.request_destination) {
-    case network::mojom::RequestDestination::kDocument:
-      resource_type = "document";
-      break;
-    case network::mojom::RequestDestination::kIframe:
-      resource_type = "document";
-      break;
-    case network::mojom::RequestDestination::kStyle:
-      resource_type = "stylesheet";
-      break;
-    case network::mojom::RequestDestination::kScript:
-      resource_type = "script";
-      break;
-    case network::mojom::RequestDestination::kImage:
-      resource_type = "image";
-      break;
-    case network::mojom::RequestDestination::kFont:
-      resource_type = "font";
-      break;
-    case network::mojom::RequestDestination::kAudio:
-    case network::mojom::RequestDestination::kTrack:
-    case network::mojom::RequestDestination::kVideo:
-      resource_type = "media";
-      break;
-    default:
-      resource_type = "other";
-      break;
-  }
-  feature_map_["resources." + resource_type + ".requestCount"] += 1;
-  feature_map_["resources." + resource_type + ".size"] +=
-      resource_load_info.raw_body_bytes;
+  features_[kTotalRequestCount] += 1;
+  features_[kTotalSize] += resource_load_info.raw_body_bytes;
+  transfer_total_size_ += resource_load_info.total_received_bytes;
+
+  const ResourceTypeFeatures& resource_type =
+      GetResourceTypeFeatures(resource_load_info.request_destination);
+  features_[resource_type.request_count] += 1;
+  features_[resource_type.size] += resource_load_info.raw_body_bytes;
 }
 
 double BandwidthSavingsPredictor::PredictSavingsBytes() const {
@@ -121,37 +188,37 @@ double BandwidthSavingsPredictor::PredictSavingsBytes() const {
       !main_frame_url_.SchemeIsHTTPOrHTTPS()) {
     return 0;
   }
-  const auto total_size = feature_map_.find("transfer.total.size");
-  if (total_size != feature_map_.end() && total_size->second > 0) {
-    VLOG(2) << main_frame_url_ << " total download size " << total_size->second
-            << " bytes";
+  if (transfer_total_size_ > 0) {
+    VLOG(2) << main_frame_url_ << " total download size "
+            << transfer_total_size_ << " bytes";
   } else {
     return 0;
   }
 
   // Short-circuit if nothing got blocked
-  const auto adblock_requests = feature_map_.find("adblockRequests");
-  if (adblock_requests == feature_map_.end() || adblock_requests->second < 1) {
+  if (features_[kAdblockRequests] < 1) {
     return 0;
   }
   if (VLOG_IS_ON(3)) {
-    VLOG(3) << "Predicting on feature map:";
-    for (const auto& feature : feature_map_) {
-      VLOG(3) << feature.first << " :: " << feature.second;
+    VLOG(3) << "Predicting on features:";
+    for (size_t i = 0; i < features_.size(); i++) {
+      if (features_[i] != 0)
+        VLOG(3) << feature_sequence[i] << " :: " << features_[i];
     }
   }
-  double prediction = ::brave_perf_predictor::LinregPredictNamed(feature_map_);
+  double prediction = ::brave_perf_predictor::LinregPredictVector(features_);
   VLOG(2) << main_frame_url_ << " estimated saving " << prediction << " bytes";
   // Sanity check for predicted saving
   if (prediction > kSavingsAbsoluteOutlier &&
-      (prediction / kOutlierThreshold) > total_size->second) {
+      (prediction / kOutlierThreshold) > transfer_total_size_) {
     return 0;
   }
   return prediction;
 }
 
 void BandwidthSavingsPredictor::Reset() {
-  feature_map_.clear();
+  features_.fill(0);
+  transfer_total_size_ = 0;
   main_frame_url_ = {};
 }
 
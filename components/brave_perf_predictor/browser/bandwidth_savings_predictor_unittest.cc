@@ -9,8 +9,10 @@
 
 #include "base/containers/flat_map.h"
 #include "base/run_loop.h"
+#include "base/strings/string_piece.h"
 #include "base/test/task_environment.h"
 #include "base/time/time.h"
+#include "brave/components/brave_perf_predictor/browser/bandwidth_linreg.h"
 #include "chrome/browser/predictors/loading_test_util.h"
 #include "components/page_load_metrics/common/page_load_metrics.mojom.h"
 #include "components/page_load_metrics/common/page_load_timing.h"
@@ -32,6 +34,13 @@ class BandwidthSavingsPredictorTest : public ::testing::Test {
   }
 
  protected:
+  double GetFeature(base::StringPiece name) const {
+    const size_t index = GetFeatureIndex(name);
+    EXPECT_LT(index, predictor_->features_.size()) << name;
+    return index < predictor_->features_.size() ? predictor_->features_[index]
+                                                : 0;
+  }
+
   base::test::TaskEnvironment env_;
   std::unique_ptr<NamedThirdPartyRegistry> tp_registry_;
   std::unique_ptr<BandwidthSavingsPredictor> predictor_;
@@ -39,42 +48,41 @@ class BandwidthSavingsPredictorTest : public ::testing::Test {
 
 TEST_F(BandwidthSavingsPredictorTest, FeaturiseBlocked) {
   predictor_->OnSubresourceBlocked("https://google-analytics.com");
-  EXPECT_EQ(predictor_->feature_map_["adblockRequests"], 1);
-  EXPECT_EQ(predictor_->feature_map_["thirdParties.Google Analytics.blocked"],
-            1);
+  EXPECT_EQ(GetFeature("adblockRequests"), 1);
+  EXPECT_EQ(GetFeature("thirdParties.Google Analytics.blocked"), 1);
   predictor_->OnSubresourceBlocked("https://test.m.facebook.com");
-  EXPECT_EQ(predictor_->feature_map_["adblockRequests"], 2);
+  EXPECT_EQ(GetFeature("adblockRequests"), 2);
 }
 
 TEST_F(BandwidthSavingsPredictorTest, FeaturiseTiming) {
   const auto empty_timing = page_load_metrics::CreatePageLoadTiming();
   predictor_->OnPageLoadTimingUpdated(*empty_timing);
-  EXPECT_EQ(predictor_->feature_map_["metrics.firstMeaningfulPaint"], 0);
-  EXPECT_EQ(predictor_->feature_map_["metrics.observedDomContentLoaded"], 0);
-  EXPECT_EQ(predictor_->feature_map_["metrics.observedFirstVisualChange"], 0);
-  EXPECT_EQ(predictor_->feature_map_["metrics.observedLoad"], 0);
+  EXPECT_EQ(GetFeature("metrics.firstMeaningfulPaint"), 0);
+  EXPECT_EQ(GetFeature("metrics.observedDomContentLoaded"), 0);
+  EXPECT_EQ(GetFeature("metrics.observedFirstVisualChange"), 0);
+  EXPECT_EQ(GetFeature("metrics.observedLoad"), 0);
 
   auto timing = page_load_metrics::CreatePageLoadTiming();
   timing->document_timing->dom_content_loaded_event_start =
       base::Milliseconds(1000);
   predictor_->OnPageLoadTimingUpdated(*timing);
-  EXPECT_EQ(predictor_->feature_map_["metrics.observedDomContentLoaded"], 1000);
+  EXPECT_EQ(GetFeature("metrics.observedDomContentLoaded"), 1000);
 
   timing->document_timing->load_event_start = base::Milliseconds(2000);
   predictor_->OnPageLoadTimingUpdated(*timing);
-  EXPECT_EQ(predictor_->feature_map_["metrics.observedLoad"], 2000);
+  EXPECT_EQ(GetFeature("metrics.observedLoad"), 2000);
 
   timing->paint_timing->first_meaningful_paint = base::Milliseconds(1500);
   predictor_->OnPageLoadTimingUpdated(*timing);
-  EXPECT_EQ(predictor_->feature_map_["metrics.firstMeaningfulPaint"], 1500);
+  EXPECT_EQ(GetFeature("metrics.firstMeaningfulPaint"), 1500);
 
   timing->paint_timing->first_contentful_paint = base::Milliseconds(800);
   predictor_->OnPageLoadTimingUpdated(*timing);
-  EXPECT_EQ(predictor_->feature_map_["metrics.observedFirstVisualChange"], 800);
+  EXPECT_EQ(GetFeature("metrics.observedFirstVisualChange"), 800);
 }
 
 TEST_F(BandwidthSavingsPredictorTest, FeaturiseResourceLoading) {
-  EXPECT_EQ(predictor_->feature_map_["resources.third-party.requestCount"], 0);
+  EXPECT_EQ(GetFeature("resources.third-party.requestCount"), 0);
 
   const GURL main_frame("https://brave.com/");
 
@@ -83,9 +91,9 @@ TEST_F(BandwidthSavingsPredictorTest, FeaturiseResourceLoading) {
       network::mojom::RequestDestination::kStyle);
   fp_style->raw_body_bytes = 1000;
   predictor_->OnResourceLoadComplete(main_frame, *fp_style);
-  EXPECT_EQ(predictor_->feature_map_["resources.third-party.requestCount"], 0);
-  EXPECT_EQ(predictor_->feature_map_["resources.stylesheet.requestCount"], 1);
-  EXPECT_EQ(predictor_->feature_map_["resources.stylesheet.size"], 1000);
+  EXPECT_EQ(GetFeature("resources.third-party.requestCount"), 0);
+  EXPECT_EQ(GetFeature("resources.stylesheet.requestCount"), 1);
+  EXPECT_EQ(GetFeature("resources.stylesheet.size"), 1000);
 
   auto tp_style = predictors::CreateResourceLoadInfo(
       "https://stackpath.bootstrapcdn.com/bootstrap/4.4.1/css/bootstrap.min.js",
@@ -93,14 +101,14 @@ TEST_F(BandwidthSavingsPredictorTest, FeaturiseResourceLoading) {
   tp_style->raw_body_bytes = 1001;
   predictor_->OnResourceLoadComplete(main_frame, *tp_style);
 
-  EXPECT_EQ(predictor_->feature_map_["resources.third-party.requestCount"], 1);
-  EXPECT_EQ(predictor_->feature_map_["resources.stylesheet.requestCount"], 1);
-  EXPECT_EQ(predictor_->feature_map_["resources.script.requestCount"], 1);
-  EXPECT_EQ(predictor_->feature_map_["resources.stylesheet.size"], 1000);
-  EXPECT_EQ(predictor_->feature_map_["resources.script.size"], 1001);
+  EXPECT_EQ(GetFeature("resources.third-party.requestCount"), 1);
+  EXPECT_EQ(GetFeature("resources.stylesheet.requestCount"), 1);
+  EXPECT_EQ(GetFeature("resources.script.requestCount"), 1);
+  EXPECT_EQ(GetFeature("resources.stylesheet.size"), 1000);
+  EXPECT_EQ(GetFeature("resources.script.size"), 1001);
 
-  EXPECT_EQ(predictor_->feature_map_["resources.total.requestCount"], 2);
-  EXPECT_EQ(predictor_->feature_map_["resources.total.size"], 2001);
+  EXPECT_EQ(GetFeature("resources.total.requestCount"), 2);
+  EXPECT_EQ(GetFeature("resources.total.size"), 2001);
 }
 
 TEST_F(BandwidthSavingsPredictorTest, PredictZeroNoData) {
@@ -157,4 +165,76 @@ TEST_F(BandwidthSavingsPredictorTest, PredictNonZero) {
   EXPECT_NE(predictor_->PredictSavingsBytes(), 0);
 }
 
+TEST_F(BandwidthSavingsPredictorTest, MatchesNamedFeaturePrediction) {
+  const GURL main_frame("https://brave.com");
+
+  auto timing = page_load_metrics::CreatePageLoadTiming();
+  timing->document_timing->dom_content_loaded_event_start =
+      base::Milliseconds(1200);
+  timing->document_timing->load_event_start = base::Milliseconds(2500);
+  timing->paint_timing->first_meaningful_paint = base::Milliseconds(1400);
+  timing->paint_timing->first_contentful_paint = base::Milliseconds(900);
+  predictor_->OnPageLoadTimingUpdated(*timing);
+
+  auto document = predictors::CreateResourceLoadInfo(
+      "https://brave.com/", network::mojom::RequestDestination::kDocument);
+  document->raw_body_bytes = 50000;
+  document->total_received_bytes = 51000;
+  predictor_->OnResourceLoadComplete(main_frame, *document);
+  auto style = predictors::CreateResourceLoadInfo(
+      "https://brave.com/style.css",
+      network::mojom::RequestDestination::kStyle);
+  style->raw_body_bytes = 200000;
+  style->total_received_bytes = 200000;
+  predictor_->OnResourceLoadComplete(main_frame, *style);
+  auto image = predictors::CreateResourceLoadInfo(
+      "https://cdn.example.com/logo.png",
+      network::mojom::RequestDestination::kImage);
+  image->raw_body_bytes = 30000;
+  image->total_received_bytes = 30500;
+  predictor_->OnResourceLoadComplete(main_frame, *image);
+
+  predictor_->OnSubresourceBlocked("https://google-analytics.com/ga.js");
+  predictor_->OnSubresourceBlocked("https://connect.facebook.net/sdk.js");
+  predictor_->OnSubresourceBlocked("https://unknown.example.com/ad.js");
+  auto blocked = predictors::CreateResourceLoadInfo(
+      "https://google-analytics.com/ga.js",
+      network::mojom::RequestDestination::kScript);
+  blocked->raw_body_bytes = 0;
+  predictor_->OnResourceLoadComplete(main_frame, *blocked);
+
+  // The same page as a named feature map, as accumulated before features
+  // were indexed at compile time.
+  const base::flat_map<std::string, double> named_features = {
+      {"adblockRequests", 3},
+      {"metrics.firstMeaningfulPaint", 1400},
+      {"metrics.observedDomContentLoaded", 1200},
+      {"metrics.observedFirstVisualChange", 900},
+      {"metrics.observedLoad", 2500},
+      {"resources.document.requestCount", 1},
+      {"resources.document.size", 50000},
+      {"resources.image.requestCount", 1},
+      {"resources.image.size", 30000},
+      {"resources.script.requestCount", 1},
+      {"resources.script.size", 0},
+      {"resources.stylesheet.requestCount", 1},
+      {"resources.stylesheet.size", 200000},
+      {"resources.third-party.requestCount", 2},
+      {"resources.third-party.size", 30000},
+      {"resources.total.requestCount", 4},
+      {"resources.total.size", 280000},
+      {"thirdParties.Facebook.blocked", 1},
+      {"thirdParties.Google Analytics.blocked", 1},
+      {"transfer.total.size", 281500},
+  };
+
+  // Computed with the model arithmetic from before features were indexed at
+  // compile time.
+  constexpr double kExpectedPrediction = 101485.17933662601;
+
+  const double prediction = predictor_->PredictSavingsBytes();
+  EXPECT_DOUBLE_EQ(prediction, kExpectedPrediction);
+  EXPECT_EQ(prediction, LinregPredictNamed(named_features));
+}
+
 }  // namespace brave_perf_predictor
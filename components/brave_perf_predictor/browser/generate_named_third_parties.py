@@ -0,0 +1,224 @@
+# Copyright (c) 2023 The Brave Authors. All rights reserved.
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this file,
+# You can obtain one at https://mozilla.org/MPL/2.0/.
+
+"""Generates named_third_parties_data.cc, the perfect hash tables mapping
+domains and root domains of the named third parties relevant to the bandwidth
+prediction model to their entity names."""
+
+import argparse
+import json
+import re
+
+# Must match HashNamedThirdPartyDomain in named_third_parties.cc.
+FNV_OFFSET_BASIS = 0x811c9dc5
+FNV_PRIME = 0x01000193
+MASK = 0xffffffff
+
+# Average number of keys per bucket of seeds.
+KEYS_PER_BUCKET = 4
+
+# Relevant entities are those with a feature in the model parameters.
+FEATURE_SEQUENCE_PATTERN = re.compile(r'feature_sequence\{(.*?)\};', re.DOTALL)
+ENTITY_FEATURE_PATTERN = re.compile(r'thirdParties\.(.+)\.blocked')
+
+
+def hash_domain(domain, seed):
+    h = FNV_OFFSET_BASIS ^ seed
+    for c in domain.encode('utf-8'):
+        h ^= c
+        h = (h * FNV_PRIME) & MASK
+    h ^= h >> 16
+    h = (h * 0x85ebca6b) & MASK
+    h ^= h >> 13
+    h = (h * 0xc2b2ae35) & MASK
+    h ^= h >> 16
+    return h
+
+
+class PublicSuffixList:
+    """Registrable domains as computed by
+    net::registry_controlled_domains::GetDomainAndRegistry with
+    INCLUDE_PRIVATE_REGISTRIES."""
+
+    def __init__(self, filename):
+        self.rules = set()
+        self.wildcards = set()
+        self.exceptions = set()
+        with open(filename, encoding='utf-8') as f:
+            for line in f:
+                rule = line.strip()
+                if not rule or rule.startswith('//'):
+                    continue
+                rule = self._to_ascii(rule.split()[0])
+                if rule.startswith('!'):
+                    self.exceptions.add(rule[1:])
+                elif rule.startswith('*.'):
+                    self.wildcards.add(rule[2:])
+                else:
+                    self.rules.add(rule)
+
+    @staticmethod
+    def _to_ascii(rule):
+        labels = []
+        for label in rule.split('.'):
+            if label.isascii():
+                labels.append(label)
+            else:
+                labels.append('xn--' + label.encode('punycode').decode('ascii'))
+        return '.'.join(labels).lower()
+
+    def _public_suffix_length(self, labels):
+        # Number of labels of the longest matching rule, exceptions first.
+        # Unknown registries are handled as single label suffixes.
+        suffix_length = 1
+        for i in range(len(labels)):
+            candidate = '.'.join(labels[i:])
+            if candidate in self.exceptions:
+                return len(labels) - i - 1
+            parent = '.'.join(labels[i + 1:])
+            if candidate in self.rules:
+                suffix_length = max(suffix_length, len(labels) - i)
+            elif i + 1 < len(labels) and parent in self.wildcards:
+                suffix_length = max(suffix_length, len(labels) - i)
+        return suffix_length
+
+    def get_domain_and_registry(self, host):
+        host = host.lower().rstrip('.')
+        if not host or re.fullmatch(r'[0-9.]+', host) or ':' in host:
+            return ''
+        labels = host.split('.')
+        suffix_length = self._public_suffix_length(labels)
+        if suffix_length >= len(labels):
+            return ''
+        return '.'.join(labels[-suffix_length - 1:])
+
+
+def build_perfect_hash(mapping):
+    """Hash and displace: each bucket of keys gets the first seed that puts
+    all of its keys in free slots of a table with exactly one slot per key."""
+    keys = sorted(mapping)
+    if not keys:
+        return [], []
+
+    num_buckets = (len(keys) + KEYS_PER_BUCKET - 1) // KEYS_PER_BUCKET
+    buckets = [[] for _ in range(num_buckets)]
+    for key in keys:
+        buckets[hash_domain(key, 0) % num_buckets].append(key)
+
+    seeds = [0] * num_buckets
+    slots = [None] * len(keys)
+    for bucket_index in sorted(range(num_buckets),
+                               key=lambda i: (-len(buckets[i]), i)):
+        bucket = buckets[bucket_index]
+        if not bucket:
+            continue
+        seed = 1
+        while True:
+            positions = [hash_domain(key, seed) % len(keys) for key in bucket]
+            if len(set(positions)) == len(positions) and all(
+                    slots[p] is None for p in positions):
+                break
+            seed += 1
+        seeds[bucket_index] = seed
+        for key, position in zip(bucket, positions):
+            slots[position] = (key, mapping[key])
+
+    return seeds, slots
+
+
+def read_entity_features(parameters_file):
+    """Returns the index of each entity's feature in feature_sequence."""
+    with open(parameters_file, encoding='utf-8') as f:
+        sequence = FEATURE_SEQUENCE_PATTERN.search(f.read()).group(1)
+    entity_features = {}
+    for index, feature in enumerate(re.findall(r'"(.*?)"', sequence)):
+        match = ENTITY_FEATURE_PATTERN.fullmatch(feature)
+        if match:
+            entity_features[match.group(1)] = index
+    return entity_features
+
+
+def generate_mappings(entities_file, relevant_entities, public_suffix_file):
+    with open(entities_file, encoding='utf-8') as f:
+        entities = json.load(f)
+    psl = PublicSuffixList(public_suffix_file)
+
+    entity_by_domain = {}
+    root_domain_entities = {}
+    for entity in entities:
+        name = entity.get('name')
+        if name not in relevant_entities:
+            continue
+        for domain in entity.get('domains', []):
+            if not isinstance(domain, str):
+                continue
+            # The first entity listing a domain wins.
+            entity_by_domain.setdefault(domain, name)
+            root_domain = psl.get_domain_and_registry(domain)
+            if root_domain:
+                root_domain_entities.setdefault(root_domain, set()).add(name)
+
+    # If there is a clash at root domain level, neither is correct.
+    entity_by_root_domain = {
+        root_domain: names.pop()
+        for root_domain, names in root_domain_entities.items()
+        if len(names) == 1
+    }
+    return entity_by_domain, entity_by_root_domain
+
+
+def format_table(name, mapping, entity_indices):
+    seeds, slots = build_perfect_hash(mapping)
+    lines = [f'constexpr uint32_t k{name}Seeds[] = {{']
+    lines += [f'    {seed},' for seed in seeds]
+    lines.append('};')
+    lines.append(f'constexpr NamedThirdPartyEntry k{name}Entries[] = {{')
+    lines += [
+        f'    {{{json.dumps(domain)}, {entity_indices[entity]}}},'
+        for domain, entity in slots
+    ]
+    lines.append('};')
+    return '\n'.join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--entities', required=True)
+    parser.add_argument('--parameters', required=True)
+    parser.add_argument('--public_suffix_list', required=True)
+    parser.add_argument('--template_cc', required=True)
+    parser.add_argument('--output_cc', required=True)
+    args = parser.parse_args()
+
+    entity_features = read_entity_features(args.parameters)
+    entity_by_domain, entity_by_root_domain = generate_mappings(
+        args.entities, entity_features, args.public_suffix_list)
+    entity_names = sorted(set(entity_by_domain.values()))
+    if len(entity_names) > 0xffff:
+        raise ValueError('Too many entities for uint16_t indices')
+    entity_indices = {name: i for i, name in enumerate(entity_names)}
+
+    with open(args.template_cc, encoding='utf-8') as f:
+        result = f.read()
+    result = result.replace(
+        'ENTITY_NAMES',
+        '\n'.join(f'    {json.dumps(name)},' for name in entity_names))
+    result = result.replace(
+        'ENTITY_FEATURES',
+        '\n'.join(f'    {entity_features[name]},' for name in entity_names))
+    # ROOT_DOMAIN_TABLE contains DOMAIN_TABLE, so it goes first.
+    result = result.replace(
+        'ROOT_DOMAIN_TABLE',
+        format_table('RootDomain', entity_by_root_domain, entity_indices))
+    result = result.replace(
+        'DOMAIN_TABLE',
+        format_table('Domain', entity_by_domain, entity_indices))
+
+    with open(args.output_cc, 'w', encoding='utf-8') as f:
+        f.write(result)
+
+
+if __name__ == '__main__':
+    main()
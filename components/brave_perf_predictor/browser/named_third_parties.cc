@@ -0,0 +1,43 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_perf_predictor/browser/named_third_parties.h"
+
+namespace brave_perf_predictor {
+
+uint32_t HashNamedThirdPartyDomain(base::StringPiece domain, uint32_t seed) {
+  // FNV-1a followed by the MurmurHash3 finalizer, so that seeds differing in
+  // a few bits still give unrelated slots.
+  uint32_t hash = 0x811c9dc5 ^ seed;
+  for (const char c : domain) {
+    hash ^= static_cast<uint8_t>(c);
+    hash *= 0x01000193;
+  }
+  hash ^= hash >> 16;
+  hash *= 0x85ebca6b;
+  hash ^= hash >> 13;
+  hash *= 0xc2b2ae35;
+  hash ^= hash >> 16;
+  return hash;
+}
+
+absl::optional<uint16_t> FindNamedThirdParty(const NamedThirdPartyTable& table,
+                                             base::StringPiece domain) {
+  if (table.seeds.empty() || table.entries.empty()) {
+    return absl::nullopt;
+  }
+
+  const uint32_t seed =
+      table.seeds[HashNamedThirdPartyDomain(domain, 0) % table.seeds.size()];
+  const NamedThirdPartyEntry& entry =
+      table.entries[HashNamedThirdPartyDomain(domain, seed) %
+                    table.entries.size()];
+  if (domain != entry.domain) {
+    return absl::nullopt;
+  }
+  return entry.entity;
+}
+
+}  // namespace brave_perf_predictor
@@ -0,0 +1,54 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_PERF_PREDICTOR_BROWSER_NAMED_THIRD_PARTIES_H_
+#define BRAVE_COMPONENTS_BRAVE_PERF_PREDICTOR_BROWSER_NAMED_THIRD_PARTIES_H_
+
+#include <cstdint>
+
+#include "base/containers/span.h"
+#include "base/strings/string_piece.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+
+namespace brave_perf_predictor {
+
+// Named third parties relevant to the bandwidth prediction model, compiled at
+// build time from entities-httparchive-nostats.json by
+// generate_named_third_parties.py.
+
+struct NamedThirdPartyEntry {
+  const char* domain;
+  // Index into GetNamedThirdPartyEntities().
+  uint16_t entity;
+};
+
+// Perfect hash table, every domain has a single possible slot determined by
+// the seed of its bucket.
+struct NamedThirdPartyTable {
+  base::span<const uint32_t> seeds;
+  base::span<const NamedThirdPartyEntry> entries;
+};
+
+// Interned entity names, in ascending order.
+base::span<const char* const> GetNamedThirdPartyEntities();
+// Index of the "thirdParties.<name>.blocked" feature of each entity in
+// feature_sequence.
+base::span<const uint16_t> GetNamedThirdPartyEntityFeatures();
+// Exact domains listed for each entity.
+NamedThirdPartyTable GetNamedThirdPartyDomainTable();
+// Registrable domains of the listed domains, except those shared by several
+// entities.
+NamedThirdPartyTable GetNamedThirdPartyRootDomainTable();
+
+// Must match hash_domain in generate_named_third_parties.py.
+uint32_t HashNamedThirdPartyDomain(base::StringPiece domain, uint32_t seed);
+
+// Returns the index of the entity |domain| maps to in |table|.
+absl::optional<uint16_t> FindNamedThirdParty(const NamedThirdPartyTable& table,
+                                             base::StringPiece domain);
+
+}  // namespace brave_perf_predictor
+
+#endif  // BRAVE_COMPONENTS_BRAVE_PERF_PREDICTOR_BROWSER_NAMED_THIRD_PARTIES_H_
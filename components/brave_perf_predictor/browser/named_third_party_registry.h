@@ -6,19 +6,18 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_PERF_PREDICTOR_BROWSER_NAMED_THIRD_PARTY_REGISTRY_H_
 #define BRAVE_COMPONENTS_BRAVE_PERF_PREDICTOR_BROWSER_NAMED_THIRD_PARTY_REGISTRY_H_
 
-#include <string>
-#include <tuple>
+#include <cstdint>
 
-#include "base/containers/flat_map.h"
-#include "base/memory/weak_ptr.h"
-#include "base/values.h"
+#include "base/strings/string_piece.h"
 #include "components/keyed_service/core/keyed_service.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
 
 namespace brave_perf_predictor {
 
 // Retrieves publicly known Third Party (organisation) for a given URL, using
 // data from the Third Party Web repository
-// (https://github.com/patrickhulce/third-party-web).
+// (https://github.com/patrickhulce/third-party-web), compiled into the
+// tables of named_third_parties.h at build time.
 class NamedThirdPartyRegistry : public KeyedService {
  public:
   NamedThirdPartyRegistry();
@@ -27,27 +26,21 @@ class NamedThirdPartyRegistry : public KeyedService {
   NamedThirdPartyRegistry(const NamedThirdPartyRegistry&) = delete;
   NamedThirdPartyRegistry& operator=(const NamedThirdPartyRegistry&) = delete;
 
-  // Parse the provided mappings (in JSON format), potentially discarding
-  // entities not relevant to the bandwith prediction model (i.e. those not
-  // seen in training the model).
-  bool LoadMappings(const base::StringPiece entities, bool discard_irrelevant);
-  // Default initialization - asynchronously load from bundled resource
+  // Default initialization - use the compiled mappings, only entities
+  // relevant to the bandwidth prediction model are included.
   void InitializeDefault();
-  absl::optional<std::string> GetThirdParty(
-      const base::StringPiece domain) const;
+  // The returned name is interned and valid for the lifetime of the process.
+  absl::optional<base::StringPiece> GetThirdParty(
+      const base::StringPiece request_url) const;
+  // Same as above, returning the index of the entity in
+  // GetNamedThirdPartyEntities().
+  absl::optional<uint16_t> GetThirdPartyEntity(
+      const base::StringPiece request_url) const;
 
  private:
   bool IsInitialized() const { return initialized_; }
-  void MarkInitialized(bool initialized) { initialized_ = initialized; }
-  void UpdateMappings(
-      std::tuple<base::flat_map<std::string, std::string>,
-                 base::flat_map<std::string, std::string>> entity_mappings);
 
   bool initialized_ = false;
-  base::flat_map<std::string, std::string> entity_by_domain_;
-  base::flat_map<std::string, std::string> entity_by_root_domain_;
-
-  base::WeakPtrFactory<NamedThirdPartyRegistry> weak_factory_{this};
 };
 
 }  // namespace brave_perf_predictor
@@ -5,37 +5,23 @@
 
 #include "brave/components/brave_perf_predictor/browser/named_third_party_registry.h"
 
+#include <string>
+
+#include "base/containers/flat_set.h"
 #include "base/files/file_path.h"
 #include "base/files/file_util.h"
+#include "base/json/json_reader.h"
 #include "base/path_service.h"
+#include "base/strings/strcat.h"
+#include "base/values.h"
+#include "brave/components/brave_perf_predictor/browser/bandwidth_linreg_parameters.h"
+#include "brave/components/brave_perf_predictor/browser/named_third_parties.h"
+#include "net/base/registry_controlled_domains/registry_controlled_domain.h"
 #include "testing/gtest/include/gtest/gtest.h"
+#include "url/gurl.h"
 
 namespace brave_perf_predictor {
 
-constexpr char test_mapping[] = R"(
-[
-{
-    "name":"Google Analytics",
-    "company":"Google",
-    "homepage":"https://www.google.com/analytics/analytics/",
-    "categories":["analytics"],
-    "domains":["www.google-analytics.com","ssl.google-analytics.com",
-      "google-analytics.com","urchin.com"]
-},
-{
-    "name":"Facebook",
-    "homepage":"https://www.facebook.com",
-    "categories":["social"],
-    "domains":["www.facebook.com","connect.facebook.net",
-      "staticxx.facebook.com","static.xx.fbcdn.net","m.facebook.com",
-      "atlassbx.com","fbcdn-photos-e-a.akamaihd.net","23.62.3.183",
-      "akamai.net","akamaiedge.net","akamaitechnologies.com",
-      "akamaitechnologies.fr","akamaized.net","edgefcs.net",
-      "edgekey.net","edgesuite.net","srip.net","cquotient.com",
-      "demandware.net","platform-lookaside.fbsbx.com"]
-}
-])";
-
 namespace {
 
 std::string LoadFile() {
@@ -57,66 +43,94 @@ std::string LoadFile() {
 
 }  // namespace
 
-TEST(NamedThirdPartyRegistryTest, HandlesEmptyJSON) {
-  NamedThirdPartyRegistry* extractor = new NamedThirdPartyRegistry();
-  bool parsed = extractor->LoadMappings("", false);
-  EXPECT_FALSE(parsed);
-}
-
-TEST(NamedThirdPartyRegistryTest, ParsesJSON) {
-  NamedThirdPartyRegistry* extractor = new NamedThirdPartyRegistry();
-  bool parsed = extractor->LoadMappings(test_mapping, false);
-  EXPECT_TRUE(parsed);
-}
-
-TEST(NamedThirdPartyRegistryTest, HandlesInvalidJSON) {
-  NamedThirdPartyRegistry* extractor = new NamedThirdPartyRegistry();
-  bool parsed =
-      extractor->LoadMappings(R"([{"name":"Google Analytics")", false);
-  EXPECT_FALSE(parsed);
-}
-
-TEST(NamedThirdPartyRegistryTest, HandlesFullDataset) {
-  NamedThirdPartyRegistry* extractor = new NamedThirdPartyRegistry();
-  auto dataset = LoadFile();
-  bool parsed = extractor->LoadMappings(dataset, true);
-  EXPECT_TRUE(parsed);
+TEST(NamedThirdPartyRegistryTest, NotInitialized) {
+  NamedThirdPartyRegistry extractor;
+  EXPECT_FALSE(extractor.GetThirdParty("https://google-analytics.com"));
 }
 
 TEST(NamedThirdPartyRegistryTest, ExtractsThirdPartyURLTest) {
-  NamedThirdPartyRegistry* extractor = new NamedThirdPartyRegistry();
-  auto dataset = LoadFile();
-  extractor->LoadMappings(dataset, true);
+  NamedThirdPartyRegistry extractor;
+  extractor.InitializeDefault();
 
-  auto entity = extractor->GetThirdParty("https://google-analytics.com/ga.js");
+  auto entity = extractor.GetThirdParty("https://google-analytics.com/ga.js");
   ASSERT_TRUE(entity.has_value());
   EXPECT_EQ(entity.value(), "Google Analytics");
 }
 
 TEST(NamedThirdPartyRegistryTest, ExtractsThirdPartyHostnameTest) {
-  NamedThirdPartyRegistry* extractor = new NamedThirdPartyRegistry();
-  auto dataset = LoadFile();
-  extractor->LoadMappings(dataset, true);
-  auto entity = extractor->GetThirdParty("https://google-analytics.com");
+  NamedThirdPartyRegistry extractor;
+  extractor.InitializeDefault();
+  auto entity = extractor.GetThirdParty("https://google-analytics.com");
   ASSERT_TRUE(entity.has_value());
   EXPECT_EQ(entity.value(), "Google Analytics");
 }
 
 TEST(NamedThirdPartyRegistryTest, ExtractsThirdPartyRootDomainTest) {
-  NamedThirdPartyRegistry* extractor = new NamedThirdPartyRegistry();
-  auto dataset = LoadFile();
-  extractor->LoadMappings(dataset, true);
-  auto entity = extractor->GetThirdParty("https://test.m.facebook.com");
+  NamedThirdPartyRegistry extractor;
+  extractor.InitializeDefault();
+  auto entity = extractor.GetThirdParty("https://test.m.facebook.com");
   ASSERT_TRUE(entity.has_value());
   EXPECT_EQ(entity.value(), "Facebook");
 }
 
+TEST(NamedThirdPartyRegistryTest, RootDomainsAreRegistrableDomains) {
+  namespace rcd = net::registry_controlled_domains;
+
+  // Root domains are computed at build time by the generator's own public
+  // suffix list parser. Every key must be what GetDomainAndRegistry returns
+  // for it, otherwise it can never be matched.
+  const NamedThirdPartyTable table = GetNamedThirdPartyRootDomainTable();
+  ASSERT_FALSE(table.entries.empty());
+  for (const auto& entry : table.entries) {
+    EXPECT_EQ(entry.domain, rcd::GetDomainAndRegistry(
+                                entry.domain, rcd::INCLUDE_PRIVATE_REGISTRIES));
+  }
+}
+
 TEST(NamedThirdPartyRegistryTest, HandlesUnrecognisedThirdPartyTest) {
-  NamedThirdPartyRegistry* extractor = new NamedThirdPartyRegistry();
-  auto dataset = LoadFile();
-  extractor->LoadMappings(dataset, true);
-  auto entity = extractor->GetThirdParty("http://example.com");
-  EXPECT_FALSE(entity.has_value());
+  NamedThirdPartyRegistry extractor;
+  extractor.InitializeDefault();
+  EXPECT_FALSE(extractor.GetThirdParty("http://example.com"));
+  // Hosts without a registrable domain don't match any root domain.
+  EXPECT_FALSE(extractor.GetThirdParty("http://localhost/"));
+  EXPECT_FALSE(extractor.GetThirdParty("http://10.0.0.1/"));
+  EXPECT_FALSE(extractor.GetThirdParty("not a url"));
+}
+
+TEST(NamedThirdPartyRegistryTest, MatchesFullDataset) {
+  NamedThirdPartyRegistry extractor;
+  extractor.InitializeDefault();
+
+  absl::optional<base::Value> document = base::JSONReader::Read(LoadFile());
+  ASSERT_TRUE(document && document->is_list());
+
+  // Every domain of a relevant entity maps to the first entity listing it.
+  base::flat_set<std::string> seen_domains;
+  size_t domain_count = 0;
+  for (const auto& item : document->GetList()) {
+    const std::string* entity_name = item.GetDict().FindString("name");
+    const base::Value::List* domains = item.GetDict().FindList("domains");
+    if (!entity_name || !domains) {
+      continue;
+    }
+
+    for (const auto& domain_value : *domains) {
+      if (!domain_value.is_string()) {
+        continue;
+      }
+      const std::string& domain = domain_value.GetString();
+      if (!seen_domains.insert(domain).second ||
+          !relevant_entity_set.contains(*entity_name)) {
+        continue;
+      }
+
+      auto entity = extractor.GetThirdParty(base::StrCat({"https://", domain}));
+      ASSERT_TRUE(entity) << domain;
+      EXPECT_EQ(*entity, *entity_name) << domain;
+      domain_count++;
+    }
+  }
+  EXPECT_GT(domain_count, 0U);
 }
 
 }  // namespace brave_perf_predictor
@@ -67,6 +67,13 @@ void Database::NormalizeActivityInfoList(
   activity_info_.NormalizeList(std::move(list), callback);
 }
 
+void Database::UpdateNormalizedActivityInfoList(
+    std::vector<mojom::PublisherInfoPtr> list,
+    const base::flat_set<std::string>& changed_ids,
+    LegacyResultCallback callback) {
+  activity_info_.UpdateNormalizedList(std::move(list), changed_ids, callback);
+}
+
 void Database::GetActivityInfoList(uint32_t start,
                                    uint32_t limit,
                                    mojom::ActivityInfoFilterPtr filter,
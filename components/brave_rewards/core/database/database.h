@@ -11,6 +11,7 @@
 #include <map>
 #include <string>
 #include <vector>
+#include "base/containers/flat_set.h"
 #include "base/functional/callback_forward.h"
 #include "base/memory/raw_ref.h"
 #include "base/time/time.h"
@@ -58,6 +59,11 @@ class Database {
   void NormalizeActivityInfoList(std::vector<mojom::PublisherInfoPtr> list,
                                  LegacyResultCallback callback);
 
+  void UpdateNormalizedActivityInfoList(
+      std::vector<mojom::PublisherInfoPtr> list,
+      const base::flat_set<std::string>& changed_ids,
+      LegacyResultCallback callback);
+
   void GetActivityInfoList(uint32_t start,
                            uint32_t limit,
                            mojom::ActivityInfoFilterPtr filter,
@@ -143,7 +143,35 @@ void DatabaseActivityInfo::NormalizeList(
         kTableName, info->percent, info->weight, info->id.c_str());
   }
 
-  if (main_query.empty()) {
+  RunNormalizeQuery(std::move(main_query), std::move(list), callback);
+}
+
+void DatabaseActivityInfo::UpdateNormalizedList(
+    std::vector<mojom::PublisherInfoPtr> list,
+    const base::flat_set<std::string>& changed_ids,
+    LegacyResultCallback callback) {
+  if (list.empty() || changed_ids.empty()) {
+    callback(mojom::Result::LEDGER_OK);
+    return;
+  }
+  std::string main_query;
+  for (const auto& info : list) {
+    if (!changed_ids.contains(info->id)) {
+      continue;
+    }
+    main_query += base::StringPrintf(
+        "UPDATE %s SET percent = %d, weight = %f WHERE publisher_id = '%s';",
+        kTableName, info->percent, info->weight, info->id.c_str());
+  }
+
+  RunNormalizeQuery(std::move(main_query), std::move(list), callback);
+}
+
+void DatabaseActivityInfo::RunNormalizeQuery(
+    std::string query,
+    std::vector<mojom::PublisherInfoPtr> list,
+    LegacyResultCallback callback) {
+  if (query.empty()) {
     callback(mojom::Result::LEDGER_ERROR);
     return;
   }
@@ -151,7 +179,7 @@ void DatabaseActivityInfo::NormalizeList(
   auto transaction = mojom::DBTransaction::New();
   auto command = mojom::DBCommand::New();
   command->type = mojom::DBCommand::Type::EXECUTE;
-  command->command = main_query;
+  command->command = std::move(query);
 
   transaction->commands.push_back(std::move(command));
 
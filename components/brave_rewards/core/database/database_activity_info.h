@@ -9,6 +9,7 @@
 #include <string>
 #include <vector>
 
+#include "base/containers/flat_set.h"
 #include "brave/components/brave_rewards/core/database/database_table.h"
 
 namespace brave_rewards::internal {
@@ -25,6 +26,12 @@ class DatabaseActivityInfo : public DatabaseTable {
   void NormalizeList(std::vector<mojom::PublisherInfoPtr> list,
                      LegacyResultCallback callback);
 
+  // Only writes the percent and weight of the |changed_ids| entries, observers
+  // are still notified with the whole normalized |list|.
+  void UpdateNormalizedList(std::vector<mojom::PublisherInfoPtr> list,
+                            const base::flat_set<std::string>& changed_ids,
+                            LegacyResultCallback callback);
+
   void GetRecordsList(const int start,
                       const int limit,
                       mojom::ActivityInfoFilterPtr filter,
@@ -39,6 +46,10 @@ class DatabaseActivityInfo : public DatabaseTable {
   void CreateInsertOrUpdate(mojom::DBTransaction* transaction,
                             mojom::PublisherInfoPtr info);
 
+  void RunNormalizeQuery(std::string query,
+                         std::vector<mojom::PublisherInfoPtr> list,
+                         LegacyResultCallback callback);
+
   void OnGetRecordsList(mojom::DBCommandResponsePtr response,
                         GetActivityInfoListCallback callback);
 };
@@ -5,11 +5,17 @@
 
 #include "brave/components/brave_rewards/core/database/database_publisher_prefix_list.h"
 
+#include <algorithm>
 #include <tuple>
 #include <utility>
+#include <vector>
 
+#include "base/functional/bind.h"
+#include "base/location.h"
 #include "base/strings/string_number_conversions.h"
+#include "base/strings/string_piece.h"
 #include "base/strings/stringprintf.h"
+#include "base/task/sequenced_task_runner.h"
 #include "brave/components/brave_rewards/core/database/database_util.h"
 #include "brave/components/brave_rewards/core/ledger_impl.h"
 #include "brave/components/brave_rewards/core/publisher/prefix_util.h"
@@ -34,8 +40,9 @@ std::tuple<publisher::PrefixIterator, std::string, size_t> GetPrefixInsertList(
        ++count, ++iter) {
     auto prefix = *iter;
     DCHECK(prefix.size() >= kHashPrefixSize);
-    std::string hex = base::HexEncode(prefix.data(), kHashPrefixSize);
-    values.append(base::StringPrintf("(x'%s'),", hex.c_str()));
+    values.append("(x'");
+    values.append(base::HexEncode(prefix.data(), kHashPrefixSize));
+    values.append("'),");
   }
   // Remove last comma
   if (!values.empty()) {
@@ -44,6 +51,41 @@ std::tuple<publisher::PrefixIterator, std::string, size_t> GetPrefixInsertList(
   return {iter, std::move(values), count};
 }
 
+uint32_t PrefixToUint32(base::StringPiece prefix) {
+  DCHECK(prefix.size() >= kHashPrefixSize);
+  uint32_t value = 0;
+  for (size_t i = 0; i < kHashPrefixSize; ++i) {
+    value = (value << 8) | static_cast<uint8_t>(prefix[i]);
+  }
+  return value;
+}
+
+absl::optional<std::vector<uint32_t>> ParseHexPrefixes(
+    base::StringPiece hex_prefixes) {
+  constexpr size_t kHexPrefixSize = kHashPrefixSize * 2;
+  if (hex_prefixes.size() % kHexPrefixSize != 0) {
+    return absl::nullopt;
+  }
+
+  std::vector<uint32_t> prefixes;
+  prefixes.reserve(hex_prefixes.size() / kHexPrefixSize);
+  for (size_t i = 0; i < hex_prefixes.size(); i += kHexPrefixSize) {
+    uint32_t prefix = 0;
+    if (!base::HexStringToUInt(hex_prefixes.substr(i, kHexPrefixSize),
+                               &prefix)) {
+      return absl::nullopt;
+    }
+    prefixes.push_back(prefix);
+  }
+
+  // SQLite does not guarantee that group_concat keeps the subquery order.
+  if (!std::is_sorted(prefixes.begin(), prefixes.end())) {
+    std::sort(prefixes.begin(), prefixes.end());
+  }
+
+  return prefixes;
+}
+
 }  // namespace
 
 namespace database {
@@ -56,6 +98,99 @@ DatabasePublisherPrefixList::~DatabasePublisherPrefixList() = default;
 void DatabasePublisherPrefixList::Search(
     const std::string& publisher_key,
     SearchPublisherPrefixListCallback callback) {
+  switch (load_state_) {
+    case LoadState::kLoaded: {
+      // Callers expect the result asynchronously, as from the database.
+      base::SequencedTaskRunner::GetCurrentDefault()->PostTask(
+          FROM_HERE,
+          base::BindOnce([](SearchPublisherPrefixListCallback callback,
+                            bool exists) { callback(exists); },
+                         std::move(callback), Contains(publisher_key)));
+      return;
+    }
+    case LoadState::kFailed: {
+      SearchInDatabase(publisher_key, std::move(callback));
+      return;
+    }
+    case LoadState::kNotLoaded:
+    case LoadState::kLoading: {
+      pending_searches_.emplace_back(publisher_key, std::move(callback));
+      if (load_state_ == LoadState::kNotLoaded) {
+        LoadPrefixes();
+      }
+      return;
+    }
+  }
+}
+
+bool DatabasePublisherPrefixList::Contains(
+    const std::string& publisher_key) const {
+  DCHECK(load_state_ == LoadState::kLoaded);
+  const std::string prefix =
+      publisher::GetHashPrefixRaw(publisher_key, kHashPrefixSize);
+  return std::binary_search(prefixes_.begin(), prefixes_.end(),
+                            PrefixToUint32(prefix));
+}
+
+void DatabasePublisherPrefixList::LoadPrefixes() {
+  DCHECK(load_state_ == LoadState::kNotLoaded);
+  load_state_ = LoadState::kLoading;
+
+  // The table holds about a million prefixes, so they are read as a single
+  // row of concatenated hex prefixes rather than one record per prefix.
+  auto command = mojom::DBCommand::New();
+  command->type = mojom::DBCommand::Type::READ;
+  command->command = base::StringPrintf(
+      "SELECT ifnull(group_concat(prefix, ''), '') FROM "
+      "(SELECT hex(hash_prefix) AS prefix FROM %s ORDER BY hash_prefix)",
+      kTableName);
+
+  command->record_bindings = {mojom::DBCommand::RecordBindingType::STRING_TYPE};
+
+  auto transaction = mojom::DBTransaction::New();
+  transaction->commands.push_back(std::move(command));
+
+  ledger_->RunDBTransaction(std::move(transaction),
+                            [this](mojom::DBCommandResponsePtr response) {
+                              OnLoadPrefixes(std::move(response));
+                            });
+}
+
+void DatabasePublisherPrefixList::OnLoadPrefixes(
+    mojom::DBCommandResponsePtr response) {
+  // A reset while loading has already replaced the list.
+  if (load_state_ == LoadState::kLoading) {
+    absl::optional<std::vector<uint32_t>> prefixes;
+    if (response && response->result &&
+        response->status == mojom::DBCommandResponse::Status::RESPONSE_OK &&
+        response->result->get_records().size() == 1) {
+      prefixes = ParseHexPrefixes(
+          GetStringColumn(response->result->get_records()[0].get(), 0));
+    }
+
+    if (!prefixes) {
+      BLOG(0, "Unable to load publisher prefix list");
+      load_state_ = LoadState::kFailed;
+    } else {
+      prefixes_ = std::move(*prefixes);
+      load_state_ = LoadState::kLoaded;
+    }
+  }
+
+  auto pending_searches = std::move(pending_searches_);
+  pending_searches_.clear();
+  for (auto& [publisher_key, callback] : pending_searches) {
+    if (load_state_ == LoadState::kLoaded) {
+      callback(Contains(publisher_key));
+    } else {
+      SearchInDatabase(publisher_key, std::move(callback));
+    }
+  }
+}
+
+void DatabasePublisherPrefixList::SearchInDatabase(
+    const std::string& publisher_key,
+    SearchPublisherPrefixListCallback callback) {
   std::string hex =
       publisher::GetHashPrefixInHex(publisher_key, kHashPrefixSize);
 
@@ -98,6 +233,23 @@ void DatabasePublisherPrefixList::Reset(publisher::PrefixListReader reader,
     return;
   }
   reader_ = std::move(reader);
+
+  // Searches use the new list right away, the table is only written for the
+  // next startup.
+  prefixes_.clear();
+  prefixes_.reserve(reader_->size());
+  for (auto prefix : *reader_) {
+    prefixes_.push_back(PrefixToUint32(prefix));
+  }
+  // Only the first few prefixes are checked when parsing, and longer prefixes
+  // may share their first bytes.
+  if (!std::is_sorted(prefixes_.begin(), prefixes_.end())) {
+    std::sort(prefixes_.begin(), prefixes_.end());
+  }
+  prefixes_.erase(std::unique(prefixes_.begin(), prefixes_.end()),
+                  prefixes_.end());
+  load_state_ = LoadState::kLoaded;
+
   InsertNext(reader_->begin(), callback);
 }
 
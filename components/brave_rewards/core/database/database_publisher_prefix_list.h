@@ -7,6 +7,8 @@
 #define BRAVE_COMPONENTS_BRAVE_REWARDS_CORE_DATABASE_DATABASE_PUBLISHER_PREFIX_LIST_H_
 
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "brave/components/brave_rewards/core/database/database_table.h"
 #include "brave/components/brave_rewards/core/publisher/prefix_list_reader.h"
@@ -17,6 +19,9 @@ namespace database {
 
 using SearchPublisherPrefixListCallback = std::function<void(bool)>;
 
+// The prefix list is kept in memory as a sorted array of hash prefixes, which
+// is searched without a database round trip. The table only persists the list
+// across restarts and is read once, on the first search after startup.
 class DatabasePublisherPrefixList : public DatabaseTable {
  public:
   explicit DatabasePublisherPrefixList(LedgerImpl& ledger);
@@ -28,10 +33,26 @@ class DatabasePublisherPrefixList : public DatabaseTable {
               SearchPublisherPrefixListCallback callback);
 
  private:
+  enum class LoadState { kNotLoaded, kLoading, kLoaded, kFailed };
+
   void InsertNext(publisher::PrefixIterator begin,
                   LegacyResultCallback callback);
 
+  bool Contains(const std::string& publisher_key) const;
+  void LoadPrefixes();
+  void OnLoadPrefixes(mojom::DBCommandResponsePtr response);
+
+  // Used when the prefixes could not be loaded from the table.
+  void SearchInDatabase(const std::string& publisher_key,
+                        SearchPublisherPrefixListCallback callback);
+
   absl::optional<publisher::PrefixListReader> reader_;
+
+  // Sorted, unique hash prefixes, big endian.
+  std::vector<uint32_t> prefixes_;
+  LoadState load_state_ = LoadState::kNotLoaded;
+  std::vector<std::pair<std::string, SearchPublisherPrefixListCallback>>
+      pending_searches_;
 };
 
 }  // namespace database
@@ -3,6 +3,7 @@
  * License, v. 2.0. If a copy of the MPL was not distributed with this file,
  * You can obtain one at https://mozilla.org/MPL/2.0/. */
 
+#include <algorithm>
 #include <string>
 #include <utility>
 #include <vector>
@@ -13,6 +14,7 @@
 #include "brave/components/brave_rewards/core/database/database_publisher_prefix_list.h"
 #include "brave/components/brave_rewards/core/ledger_client_mock.h"
 #include "brave/components/brave_rewards/core/ledger_impl_mock.h"
+#include "brave/components/brave_rewards/core/publisher/prefix_util.h"
 #include "brave/components/brave_rewards/core/publisher/protos/publisher_prefix_list.pb.h"
 
 // npm run test -- brave_unit_tests --filter=DatabasePublisherPrefixListTest.*
@@ -36,7 +38,26 @@ class DatabasePublisherPrefixListTest : public ::testing::Test {
     for (uint32_t i = 0; i < prefix_count; ++i) {
       base::WriteBigEndian(&prefixes[i * 4], i);
     }
+    return CreateReaderFromPrefixes(std::move(prefixes));
+  }
+
+  publisher::PrefixListReader CreateReaderForPublishers(
+      const std::vector<std::string>& publisher_keys) {
+    std::vector<std::string> hashes;
+    for (const auto& publisher_key : publisher_keys) {
+      hashes.push_back(publisher::GetHashPrefixRaw(publisher_key, 4));
+    }
+    std::sort(hashes.begin(), hashes.end());
+
+    std::string prefixes;
+    for (const auto& hash : hashes) {
+      prefixes.append(hash);
+    }
+    return CreateReaderFromPrefixes(std::move(prefixes));
+  }
 
+  publisher::PrefixListReader CreateReaderFromPrefixes(std::string prefixes) {
+    publisher::PrefixListReader reader;
     publishers_pb::PublisherPrefixList message;
     message.set_prefix_size(4);
     message.set_compression_type(
@@ -50,6 +71,14 @@ class DatabasePublisherPrefixListTest : public ::testing::Test {
     return reader;
   }
 
+  bool Search(const std::string& publisher_key) {
+    bool result = false;
+    database_prefix_list_.Search(publisher_key,
+                                 [&result](bool exists) { result = exists; });
+    task_environment_.RunUntilIdle();
+    return result;
+  }
+
   base::test::TaskEnvironment task_environment_;
   MockLedgerImpl mock_ledger_impl_;
   DatabasePublisherPrefixList database_prefix_list_{mock_ledger_impl_};
@@ -89,5 +118,113 @@ TEST_F(DatabasePublisherPrefixListTest, Reset) {
   task_environment_.RunUntilIdle();
 }
 
+TEST_F(DatabasePublisherPrefixListTest, SearchAfterReset) {
+  // Only the reset is written to the database, searches are answered from
+  // memory.
+  EXPECT_CALL(*mock_ledger_impl_.mock_client(), RunDBTransaction(_, _))
+      .Times(1)
+      .WillOnce([](mojom::DBTransactionPtr transaction, auto callback) {
+        auto response = mojom::DBCommandResponse::New();
+        response->status = mojom::DBCommandResponse::Status::RESPONSE_OK;
+        std::move(callback).Run(std::move(response));
+      });
+
+  MockFunction<LegacyResultCallback> callback;
+  EXPECT_CALL(callback, Call(mojom::Result::LEDGER_OK)).Times(1);
+  database_prefix_list_.Reset(
+      CreateReaderForPublishers({"brave.com", "basicattentiontoken.org"}),
+      callback.AsStdFunction());
+
+  EXPECT_TRUE(Search("brave.com"));
+  EXPECT_TRUE(Search("basicattentiontoken.org"));
+  EXPECT_FALSE(Search("example.com"));
+}
+
+TEST_F(DatabasePublisherPrefixListTest, SearchLoadsPrefixesOnce) {
+  EXPECT_CALL(*mock_ledger_impl_.mock_client(), RunDBTransaction(_, _))
+      .Times(1)
+      .WillOnce([](mojom::DBTransactionPtr transaction, auto callback) {
+        ASSERT_EQ(transaction->commands.size(), 1u);
+        EXPECT_EQ(transaction->commands[0]->command,
+                  "SELECT ifnull(group_concat(prefix, ''), '') FROM "
+                  "(SELECT hex(hash_prefix) AS prefix FROM "
+                  "publisher_prefix_list ORDER BY hash_prefix)");
+
+        // Prefixes are not necessarily concatenated in order.
+        const std::string hex =
+            publisher::GetHashPrefixInHex("brave.com", 4) + "00000000";
+        std::vector<mojom::DBRecordPtr> records;
+        records.push_back(mojom::DBRecord::New());
+        records.back()->fields.push_back(mojom::DBValue::NewStringValue(hex));
+
+        auto response = mojom::DBCommandResponse::New();
+        response->status = mojom::DBCommandResponse::Status::RESPONSE_OK;
+        response->result =
+            mojom::DBCommandResult::NewRecords(std::move(records));
+        std::move(callback).Run(std::move(response));
+      });
+
+  std::vector<bool> results;
+  for (const char* publisher_key : {"brave.com", "example.com", "brave.com"}) {
+    database_prefix_list_.Search(
+        publisher_key, [&results](bool exists) { results.push_back(exists); });
+  }
+  task_environment_.RunUntilIdle();
+  EXPECT_EQ(results, std::vector<bool>({true, false, true}));
+
+  EXPECT_TRUE(Search("brave.com"));
+  EXPECT_FALSE(Search("example.com"));
+}
+
+TEST_F(DatabasePublisherPrefixListTest, SearchInDatabaseIfPrefixesMalformed) {
+  EXPECT_CALL(*mock_ledger_impl_.mock_client(), RunDBTransaction(_, _))
+      .Times(2)
+      .WillOnce([](mojom::DBTransactionPtr transaction, auto callback) {
+        std::vector<mojom::DBRecordPtr> records;
+        records.push_back(mojom::DBRecord::New());
+        records.back()->fields.push_back(
+            mojom::DBValue::NewStringValue("0000000"));
+
+        auto response = mojom::DBCommandResponse::New();
+        response->status = mojom::DBCommandResponse::Status::RESPONSE_OK;
+        response->result =
+            mojom::DBCommandResult::NewRecords(std::move(records));
+        std::move(callback).Run(std::move(response));
+      })
+      .WillOnce([](mojom::DBTransactionPtr transaction, auto callback) {
+        ASSERT_EQ(transaction->commands.size(), 1u);
+        EXPECT_TRUE(base::StartsWith(transaction->commands[0]->command,
+                                     "SELECT EXISTS("));
+        std::move(callback).Run(db_error_response->Clone());
+      });
+
+  EXPECT_FALSE(Search("brave.com"));
+}
+
+TEST_F(DatabasePublisherPrefixListTest, SearchInDatabaseIfLoadFails) {
+  EXPECT_CALL(*mock_ledger_impl_.mock_client(), RunDBTransaction(_, _))
+      .Times(2)
+      .WillOnce([](mojom::DBTransactionPtr transaction, auto callback) {
+        std::move(callback).Run(db_error_response->Clone());
+      })
+      .WillOnce([](mojom::DBTransactionPtr transaction, auto callback) {
+        ASSERT_EQ(transaction->commands.size(), 1u);
+        EXPECT_TRUE(base::StartsWith(transaction->commands[0]->command,
+                                     "SELECT EXISTS("));
+
+        std::vector<mojom::DBRecordPtr> records;
+        records.push_back(mojom::DBRecord::New());
+        records.back()->fields.push_back(mojom::DBValue::NewBoolValue(true));
+
+        auto response = mojom::DBCommandResponse::New();
+        response->status = mojom::DBCommandResponse::Status::RESPONSE_OK;
+        response->result =
+            mojom::DBCommandResult::NewRecords(std::move(records));
+        std::move(callback).Run(std::move(response));
+      });
+
+  EXPECT_TRUE(Search("brave.com"));
+}
+
 }  // namespace database
 }  // namespace brave_rewards::internal
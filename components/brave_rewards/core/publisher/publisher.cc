@@ -8,9 +8,11 @@
 #include <ctime>
 #include <map>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
+#include "base/containers/flat_set.h"
 #include "base/strings/stringprintf.h"
 #include "base/uuid.h"
 #include "brave/components/brave_rewards/core/constants.h"
@@ -286,11 +288,14 @@ void Publisher::SaveVisitInternal(const mojom::PublisherStatus status,
 
     panel_info = publisher_info->Clone();
 
-    auto publisher_info_saved_callback =
-        std::bind(&Publisher::OnPublisherInfoSaved, this, _1);
+    auto activity_info_saved_callback =
+        std::bind(&Publisher::OnActivityInfoSaved, this,
+                  std::make_shared<mojom::PublisherInfoPtr>(
+                      publisher_info->Clone()),
+                  _1);
 
     ledger_->database()->SaveActivityInfo(std::move(publisher_info),
-                                          publisher_info_saved_callback);
+                                          activity_info_saved_callback);
   }
 
   if (panel_info) {
@@ -494,9 +499,18 @@ void Publisher::synopsisNormalizerInternal(
 }
 
 void Publisher::SynopsisNormalizer() {
+  // Requests made while the list is loading are coalesced into one more pass.
+  if (normalizing_) {
+    normalize_again_ = true;
+    return;
+  }
+
+  normalizing_ = true;
+  normalized_list_valid_ = false;
+  normalized_reconcile_stamp_ = ledger_->state()->GetReconcileStamp();
   auto filter =
       CreateActivityFilter("", mojom::ExcludeFilter::FILTER_ALL_EXCEPT_EXCLUDED,
-                           true, ledger_->state()->GetReconcileStamp(), false,
+                           true, normalized_reconcile_stamp_, false,
                            ledger_->state()->GetPublisherMinVisits());
   ledger_->database()->GetActivityInfoList(
       0, 0, std::move(filter),
@@ -505,17 +519,88 @@ void Publisher::SynopsisNormalizer() {
 
 void Publisher::SynopsisNormalizerCallback(
     std::vector<mojom::PublisherInfoPtr> list) {
-  std::vector<mojom::PublisherInfoPtr> normalized_list;
-  synopsisNormalizerInternal(&normalized_list, &list, 0);
+  normalizing_ = false;
+  if (normalize_again_) {
+    normalize_again_ = false;
+    SynopsisNormalizer();
+    return;
+  }
+
+  synopsisNormalizerInternal(nullptr, &list, 0);
   std::vector<mojom::PublisherInfoPtr> save_list;
   for (auto& item : list) {
     save_list.push_back(item.Clone());
   }
+  normalized_list_ = std::move(list);
+  normalized_list_valid_ = true;
 
   ledger_->database()->NormalizeActivityInfoList(std::move(save_list),
                                                  [](const mojom::Result) {});
 }
 
+void Publisher::OnActivityInfoSaved(
+    std::shared_ptr<mojom::PublisherInfoPtr> info,
+    mojom::Result result) {
+  if (result != mojom::Result::LEDGER_OK) {
+    BLOG(0, "Activity info was not saved!");
+    return;
+  }
+
+  UpdateNormalizedList(std::move(*info));
+}
+
+void Publisher::UpdateNormalizedList(mojom::PublisherInfoPtr info) {
+  DCHECK(info);
+  if (!normalized_list_valid_ ||
+      normalized_reconcile_stamp_ != ledger_->state()->GetReconcileStamp()) {
+    SynopsisNormalizer();
+    return;
+  }
+
+  auto iter = std::find_if(
+      normalized_list_.begin(), normalized_list_.end(),
+      [&info](const auto& entry) { return entry->id == info->id; });
+  if (iter == normalized_list_.end()) {
+    // Publishers below the minimums are not part of the list. Those reaching
+    // them need a full pass, which also checks their server publisher info.
+    if (info->visits <
+            static_cast<uint32_t>(ledger_->state()->GetPublisherMinVisits()) ||
+        info->duration < static_cast<uint64_t>(
+                             ledger_->state()->GetPublisherMinVisitTime())) {
+      return;
+    }
+    SynopsisNormalizer();
+    return;
+  }
+
+  // Every percent may change with the total score, but only the rows whose
+  // rounded percent changed are written. The weights of the other rows are
+  // refreshed by the next full pass, contributions recompute them anyway.
+  std::vector<uint32_t> old_percents;
+  old_percents.reserve(normalized_list_.size());
+  for (const auto& entry : normalized_list_) {
+    old_percents.push_back(entry->percent);
+  }
+
+  const std::string publisher_id = info->id;
+  *iter = std::move(info);
+  synopsisNormalizerInternal(nullptr, &normalized_list_, 0);
+
+  base::flat_set<std::string> changed_ids;
+  std::vector<mojom::PublisherInfoPtr> save_list;
+  save_list.reserve(normalized_list_.size());
+  for (size_t i = 0; i < normalized_list_.size(); ++i) {
+    const auto& entry = normalized_list_[i];
+    if (entry->id == publisher_id || entry->percent != old_percents[i]) {
+      changed_ids.insert(entry->id);
+    }
+    save_list.push_back(entry.Clone());
+  }
+
+  ledger_->database()->UpdateNormalizedActivityInfoList(
+      std::move(save_list), changed_ids, [](const mojom::Result) {});
+}
+
 bool Publisher::IsVerified(mojom::PublisherStatus status) {
   return status != mojom::PublisherStatus::NOT_VERIFIED;
 }
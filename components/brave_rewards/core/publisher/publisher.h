@@ -6,6 +6,7 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_REWARDS_CORE_PUBLISHER_PUBLISHER_H_
 #define BRAVE_COMPONENTS_BRAVE_REWARDS_CORE_PUBLISHER_PUBLISHER_H_
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -76,6 +77,8 @@ class Publisher {
 
   bool IsVerified(mojom::PublisherStatus);
 
+  // Recomputes the percent and weight of every publisher in the activity
+  // list for the current reconcile stamp and filter settings.
   void SynopsisNormalizer();
 
   void CalcScoreConsts(const int min_duration_seconds);
@@ -161,6 +164,13 @@ class Publisher {
 
   void SynopsisNormalizerCallback(std::vector<mojom::PublisherInfoPtr> list);
 
+  void OnActivityInfoSaved(std::shared_ptr<mojom::PublisherInfoPtr> info,
+                           mojom::Result result);
+
+  // Updates |normalized_list_| for a visit to |info| without reloading the
+  // activity list, only the changed rows are written.
+  void UpdateNormalizedList(mojom::PublisherInfoPtr info);
+
   void synopsisNormalizerInternal(
       std::vector<mojom::PublisherInfoPtr>* newList,
       const std::vector<mojom::PublisherInfoPtr>* list,
@@ -201,10 +211,19 @@ class Publisher {
   PublisherPrefixListUpdater prefix_list_updater_;
   ServerPublisherFetcher server_publisher_fetcher_;
 
+  // Activity list of the last full normalization, kept up to date by
+  // UpdateNormalizedList.
+  std::vector<mojom::PublisherInfoPtr> normalized_list_;
+  uint64_t normalized_reconcile_stamp_ = 0;
+  bool normalized_list_valid_ = false;
+  bool normalizing_ = false;
+  bool normalize_again_ = false;
+
   // For testing purposes
   friend class PublisherTest;
   FRIEND_TEST_ALL_PREFIXES(PublisherTest, concaveScore);
   FRIEND_TEST_ALL_PREFIXES(PublisherTest, synopsisNormalizerInternal);
+  FRIEND_TEST_ALL_PREFIXES(PublisherTest, UpdateNormalizedList);
 };
 
 }  // namespace publisher
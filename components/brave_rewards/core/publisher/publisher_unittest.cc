@@ -4,7 +4,9 @@
  * You can obtain one at https://mozilla.org/MPL/2.0/. */
 
 #include <iostream>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "base/containers/flat_map.h"
 #include "base/test/task_environment.h"
@@ -169,6 +171,86 @@ TEST_F(PublisherTest, synopsisNormalizerInternal) {
   task_environment_.RunUntilIdle();
 }
 
+TEST_F(PublisherTest, UpdateNormalizedList) {
+  ON_CALL(*mock_ledger_impl_.mock_client(),
+          GetUint64State(state::kNextReconcileStamp, _))
+      .WillByDefault([](const std::string&, auto callback) {
+        std::move(callback).Run(100);
+      });
+  ON_CALL(*mock_ledger_impl_.mock_client(), GetIntegerState(_, _))
+      .WillByDefault([](const std::string&, auto callback) {
+        std::move(callback).Run(1);
+      });
+
+  const auto create_info = [](const std::string& id, double score) {
+    auto info = mojom::PublisherInfo::New();
+    info->id = id;
+    info->score = score;
+    info->duration = 10;
+    info->visits = 1;
+    info->reconcile_stamp = 100;
+    return info;
+  };
+  for (const auto& [id, score] :
+       std::vector<std::pair<std::string, double>>{
+           {"a.com", 40}, {"b.com", 40}, {"c.com", 10}, {"d.com", 10}}) {
+    publisher_.normalized_list_.push_back(create_info(id, score));
+  }
+  publisher_.synopsisNormalizerInternal(nullptr, &publisher_.normalized_list_,
+                                        0);
+  publisher_.normalized_reconcile_stamp_ = 100;
+  publisher_.normalized_list_valid_ = true;
+
+  std::vector<std::string> commands;
+  ON_CALL(*mock_ledger_impl_.mock_client(), RunDBTransaction(_, _))
+      .WillByDefault(
+          [&commands](mojom::DBTransactionPtr transaction, auto callback) {
+            for (const auto& command : transaction->commands) {
+              commands.push_back(command->command);
+            }
+            auto response = mojom::DBCommandResponse::New();
+            response->status = mojom::DBCommandResponse::Status::RESPONSE_OK;
+            std::move(callback).Run(std::move(response));
+          });
+  EXPECT_CALL(*mock_ledger_impl_.mock_client(), PublisherListNormalized(_))
+      .Times(2)
+      .WillRepeatedly([](std::vector<mojom::PublisherInfoPtr> list) {
+        EXPECT_EQ(list.size(), 4u);
+      });
+
+  // The rounded percents are unchanged, only the visited row is written.
+  publisher_.UpdateNormalizedList(create_info("d.com", 10.5));
+  task_environment_.RunUntilIdle();
+  ASSERT_EQ(commands.size(), 1u);
+  EXPECT_NE(commands[0].find("publisher_id = 'd.com'"), std::string::npos);
+  EXPECT_EQ(commands[0].find("publisher_id = 'a.com'"), std::string::npos);
+
+  // Every percent changes.
+  commands.clear();
+  publisher_.UpdateNormalizedList(create_info("d.com", 60));
+  task_environment_.RunUntilIdle();
+  ASSERT_EQ(commands.size(), 1u);
+  for (const char* id : {"a.com", "b.com", "c.com", "d.com"}) {
+    EXPECT_NE(commands[0].find(std::string("publisher_id = '") + id + "'"),
+              std::string::npos);
+  }
+  uint32_t total_percent = 0;
+  for (const auto& entry : publisher_.normalized_list_) {
+    total_percent += entry->percent;
+  }
+  EXPECT_EQ(total_percent, 100u);
+  EXPECT_EQ(publisher_.normalized_list_[3]->percent, 40u);
+
+  // Publishers below the minimum visits leave the list unchanged.
+  commands.clear();
+  auto unvisited = create_info("e.com", 5);
+  unvisited->visits = 0;
+  publisher_.UpdateNormalizedList(std::move(unvisited));
+  task_environment_.RunUntilIdle();
+  EXPECT_TRUE(commands.empty());
+  EXPECT_EQ(publisher_.normalized_list_.size(), 4u);
+}
+
 TEST_F(PublisherTest, GetShareURL) {
   base::flat_map<std::string, std::string> args;
 
@@ -9,8 +9,11 @@
 #include <utility>
 
 #include "base/base64.h"
+#include "base/check_op.h"
+#include "base/containers/flat_set.h"
 #include "base/environment.h"
 #include "base/strings/strcat.h"
+#include "base/strings/string_util.h"
 #include "brave/components/brave_wallet/browser/blockchain_registry.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_service.h"
 #include "brave/components/brave_wallet/browser/json_rpc_service.h"
@@ -23,6 +26,10 @@
 
 namespace {
 
+// Limits the number of RPC and SimpleHash requests in flight for users with
+// many accounts on many chains.
+constexpr size_t kMaxConcurrentRequests = 8;
+
 constexpr char kEthereum[] = "ethereum";
 constexpr char kSolana[] = "solana";
 constexpr char kPolygon[] = "polygon";
@@ -108,6 +115,24 @@ base::flat_map<std::string, std::string> MakeBraveServicesKeyHeader() {
   return request_headers;
 }
 
+// Returns |addresses| without duplicates, so the same request is never made
+// twice. Ethereum addresses are compared case-insensitively.
+std::vector<std::string> GetUniqueAddresses(
+    const std::vector<std::string>& addresses,
+    brave_wallet::mojom::CoinType coin) {
+  std::vector<std::string> result;
+  base::flat_set<std::string> seen;
+  for (const auto& address : addresses) {
+    if (seen.insert(coin == brave_wallet::mojom::CoinType::ETH
+                        ? base::ToLowerASCII(address)
+                        : address)
+            .second) {
+      result.push_back(address);
+    }
+  }
+  return result;
+}
+
 }  // namespace
 
 namespace brave_wallet {
@@ -150,13 +175,19 @@ void AssetDiscoveryTask::DiscoverAssets(
   // Notify frontend asset discovery has started
   wallet_service_->OnDiscoverAssetsStarted();
 
+  // An account listed twice would otherwise be requested twice
+  std::map<mojom::CoinType, std::vector<std::string>> unique_account_addresses;
+  for (const auto& [coin, addresses] : account_addresses) {
+    unique_account_addresses[coin] = GetUniqueAddresses(addresses, coin);
+  }
+
   // Create list of accounts and chain IDs to be used as arguments
-  auto sol_it = account_addresses.find(mojom::CoinType::SOL);
-  const auto& sol_account_addresses = sol_it != account_addresses.end()
+  auto sol_it = unique_account_addresses.find(mojom::CoinType::SOL);
+  const auto& sol_account_addresses = sol_it != unique_account_addresses.end()
                                           ? sol_it->second
                                           : std::vector<std::string>();
-  auto eth_it = account_addresses.find(mojom::CoinType::ETH);
-  const auto& eth_account_addresses = eth_it != account_addresses.end()
+  auto eth_it = unique_account_addresses.find(mojom::CoinType::ETH);
+  const auto& eth_account_addresses = eth_it != unique_account_addresses.end()
                                           ? eth_it->second
                                           : std::vector<std::string>();
   eth_it = fungible_chain_ids.find(mojom::CoinType::ETH);
@@ -165,7 +196,8 @@ void AssetDiscoveryTask::DiscoverAssets(
                                   : std::vector<std::string>();
 
   // Concurrently discover ETH ERC20s on our registry, Solana tokens on our
-  // Registry and NFTs on both platforms, then merge the results
+  // Registry and NFTs on both platforms, then merge the results. Each of them
+  // fans out one request per account (and chain) through RunRequest.
   const auto barrier_callback =
       base::BarrierCallback<std::vector<mojom::BlockchainTokenPtr>>(
           3,
@@ -175,7 +207,8 @@ void AssetDiscoveryTask::DiscoverAssets(
   DiscoverSPLTokensFromRegistry(sol_account_addresses, barrier_callback);
   DiscoverERC20sFromRegistry(eth_chain_ids, eth_account_addresses,
                              barrier_callback);
-  DiscoverNFTs(non_fungible_chain_ids, account_addresses, barrier_callback);
+  DiscoverNFTs(non_fungible_chain_ids, unique_account_addresses,
+               barrier_callback);
 }
 
 void AssetDiscoveryTask::MergeDiscoveredAssets(
@@ -189,10 +222,38 @@ void AssetDiscoveryTask::MergeDiscoveredAssets(
     }
   }
 
-  wallet_service_->OnDiscoverAssetsCompleted(std::move(flattened_assets));
+  // Add everything in a single pref update, which also drops the assets the
+  // user already has.
+  std::vector<mojom::BlockchainTokenPtr> added_assets =
+      BraveWalletService::AddUserAssets(std::move(flattened_assets), prefs_);
+
+  wallet_service_->OnDiscoverAssetsCompleted(std::move(added_assets));
   std::move(callback).Run();
 }
 
+void AssetDiscoveryTask::RunRequest(Request request) {
+  pending_requests_.push_back(std::move(request));
+  RunPendingRequests();
+}
+
+void AssetDiscoveryTask::RunPendingRequests() {
+  while (requests_in_flight_ < kMaxConcurrentRequests &&
+         !pending_requests_.empty()) {
+    Request request = std::move(pending_requests_.front());
+    pending_requests_.pop_front();
+    requests_in_flight_++;
+    std::move(request).Run(
+        base::BindOnce(&AssetDiscoveryTask::OnRequestCompleted,
+                       weak_ptr_factory_.GetWeakPtr()));
+  }
+}
+
+void AssetDiscoveryTask::OnRequestCompleted() {
+  DCHECK_GT(requests_in_flight_, 0u);
+  requests_in_flight_--;
+  RunPendingRequests();
+}
+
 void AssetDiscoveryTask::DiscoverERC20sFromRegistry(
     const std::vector<std::string>& chain_ids,
     const std::vector<std::string>& account_addresses,
@@ -204,8 +265,6 @@ void AssetDiscoveryTask::DiscoverERC20sFromRegistry(
 
   std::vector<mojom::BlockchainTokenPtr> user_assets =
       BraveWalletService::GetUserAssets(prefs_);
-  TokenListMap token_list_map =
-      BlockchainRegistry::GetInstance()->GetEthTokenListMap(chain_ids);
 
   // Create set of all user assets per chain to use to ensure we don't
   // include assets the user has already added in the call to the BalanceScanner
@@ -216,28 +275,23 @@ void AssetDiscoveryTask::DiscoverERC20sFromRegistry(
         user_asset->contract_address);
   }
 
-  // Create a map of chain_id to a map contract address to BlockchainToken
-  // to easily lookup tokens by contract address when the results of the
-  // BalanceScanner calls are merged
-  base::flat_map<std::string,
-                 base::flat_map<std::string, mojom::BlockchainTokenPtr>>
-      chain_id_to_contract_address_to_token;
-
   // Create a map of chain_id to a vector of contract addresses (strings, rather
-  // than BlockchainTokens) to pass to GetERC20TokenBalances
+  // than BlockchainTokens) to pass to GetERC20TokenBalances. The token lists
+  // are read in place, only discovered tokens are copied once the
+  // BalanceScanner calls are merged.
   base::flat_map<std::string, std::vector<std::string>>
       chain_id_to_contract_addresses;
-
-  // Populate the chain_id_to_contract_addresses using the token_list_map of
-  // BlockchainTokenPtrs
-  for (auto& [chain_id, token_list] : token_list_map) {
-    for (auto& token : token_list) {
+  auto* blockchain_registry = BlockchainRegistry::GetInstance();
+  for (const auto& chain_id : chain_ids) {
+    const auto* token_list =
+        blockchain_registry->GetTokenList(chain_id, mojom::CoinType::ETH);
+    if (!token_list) {
+      continue;
+    }
+    for (const auto& token : *token_list) {
       if (!user_assets_per_chain[chain_id].contains(token->contract_address)) {
         chain_id_to_contract_addresses[chain_id].push_back(
             token->contract_address);
-        chain_id_to_contract_address_to_token[chain_id]
-                                             [token->contract_address] =
-                                                 std::move(token);
       }
     }
   }
@@ -248,25 +302,38 @@ void AssetDiscoveryTask::DiscoverERC20sFromRegistry(
       base::BarrierCallback<std::map<std::string, std::vector<std::string>>>(
           account_addresses.size() * chain_id_to_contract_addresses.size(),
           base::BindOnce(&AssetDiscoveryTask::MergeDiscoveredERC20s,
-                         weak_ptr_factory_.GetWeakPtr(),
-                         std::move(chain_id_to_contract_address_to_token),
-                         std::move(callback)));
+                         weak_ptr_factory_.GetWeakPtr(), std::move(callback)));
 
-  // For each account address, call GetERC20TokenBalances for each chain ID
+  // For each account address, call GetERC20TokenBalances for each chain ID.
+  // Pending requests are owned by this task, so it can be bound unretained.
   for (const auto& account_address : account_addresses) {
     for (const auto& [chain_id, contract_addresses] :
          chain_id_to_contract_addresses) {
-      auto internal_callback =
-          base::BindOnce(&AssetDiscoveryTask::OnGetERC20TokenBalances,
-                         weak_ptr_factory_.GetWeakPtr(), barrier_callback,
-                         chain_id, contract_addresses);
-      json_rpc_service_->GetERC20TokenBalances(contract_addresses,
-                                               account_address, chain_id,
-                                               std::move(internal_callback));
+      RunRequest(base::BindOnce(&AssetDiscoveryTask::GetERC20TokenBalances,
+                                base::Unretained(this), account_address,
+                                chain_id, contract_addresses,
+                                barrier_callback));
     }
   }
 }
 
+void AssetDiscoveryTask::GetERC20TokenBalances(
+    const std::string& account_address,
+    const std::string& chain_id,
+    const std::vector<std::string>& contract_addresses,
+    base::OnceCallback<void(std::map<std::string, std::vector<std::string>>)>
+        barrier_callback,
+    base::OnceClosure done) {
+  auto internal_callback = base::BindOnce(
+      &AssetDiscoveryTask::OnGetERC20TokenBalances,
+      weak_ptr_factory_.GetWeakPtr(),
+      std::move(barrier_callback).Then(std::move(done)), chain_id,
+      contract_addresses);
+  json_rpc_service_->GetERC20TokenBalances(contract_addresses, account_address,
+                                           chain_id,
+                                           std::move(internal_callback));
+}
+
 void AssetDiscoveryTask::OnGetERC20TokenBalances(
     base::OnceCallback<void(std::map<std::string, std::vector<std::string>>)>
         barrier_callback,
@@ -304,9 +371,6 @@ void AssetDiscoveryTask::OnGetERC20TokenBalances(
 }
 
 void AssetDiscoveryTask::MergeDiscoveredERC20s(
-    base::flat_map<std::string,
-                   base::flat_map<std::string, mojom::BlockchainTokenPtr>>
-        chain_id_to_contract_address_to_token,
     DiscoverAssetsCompletedCallback callback,
     const std::vector<std::map<std::string, std::vector<std::string>>>&
         discovered_assets_results) {
@@ -316,6 +380,7 @@ void AssetDiscoveryTask::MergeDiscoveredERC20s(
   // Keep track of which contract addresses have been seen per chain
   base::flat_map<std::string, base::flat_set<base::StringPiece>>
       seen_contract_addresses;
+  auto* blockchain_registry = BlockchainRegistry::GetInstance();
   for (const auto& discovered_assets_result : discovered_assets_results) {
     for (const auto& [chain_id, contract_addresses] :
          discovered_assets_result) {
@@ -327,10 +392,10 @@ void AssetDiscoveryTask::MergeDiscoveredERC20s(
 
         // Add to seen and discovered_tokens if not
         seen_contract_addresses[chain_id].insert(contract_address);
-        auto token = std::move(
-            chain_id_to_contract_address_to_token[chain_id][contract_address]);
-        if (token && BraveWalletService::AddUserAsset(token.Clone(), prefs_)) {
-          discovered_tokens.push_back(std::move(token));
+        const auto* token = blockchain_registry->FindTokenByAddress(
+            chain_id, mojom::CoinType::ETH, contract_address);
+        if (token) {
+          discovered_tokens.push_back(token->Clone());
         }
       }
     }
@@ -367,14 +432,24 @@ void AssetDiscoveryTask::DiscoverSPLTokensFromRegistry(
           base::BindOnce(&AssetDiscoveryTask::MergeDiscoveredSPLTokens,
                          weak_ptr_factory_.GetWeakPtr(), std::move(callback)));
   for (const auto& account_address : solana_addresses) {
-    // Solana Mainnet is the only network supported currently
-    json_rpc_service_->GetSolanaTokenAccountsByOwner(
-        account_address, mojom::kSolanaMainnet,
-        base::BindOnce(&AssetDiscoveryTask::OnGetSolanaTokenAccountsByOwner,
-                       weak_ptr_factory_.GetWeakPtr(), barrier_callback));
+    RunRequest(base::BindOnce(
+        &AssetDiscoveryTask::GetSolanaTokenAccountsByOwner,
+        base::Unretained(this), account_address, barrier_callback));
   }
 }
 
+void AssetDiscoveryTask::GetSolanaTokenAccountsByOwner(
+    const SolanaAddress& account_address,
+    base::OnceCallback<void(std::vector<SolanaAddress>)> barrier_callback,
+    base::OnceClosure done) {
+  // Solana Mainnet is the only network supported currently
+  json_rpc_service_->GetSolanaTokenAccountsByOwner(
+      account_address, mojom::kSolanaMainnet,
+      base::BindOnce(&AssetDiscoveryTask::OnGetSolanaTokenAccountsByOwner,
+                     weak_ptr_factory_.GetWeakPtr(),
+                     std::move(barrier_callback).Then(std::move(done))));
+}
+
 void AssetDiscoveryTask::OnGetSolanaTokenAccountsByOwner(
     base::OnceCallback<void(std::vector<SolanaAddress>)> barrier_callback,
     const std::vector<SolanaAccountInfo>& token_accounts,
@@ -442,12 +517,9 @@ void AssetDiscoveryTask::OnGetSolanaTokenRegistry(
     const base::flat_set<std::string>& discovered_mint_addresses,
     std::vector<mojom::BlockchainTokenPtr> sol_token_registry) {
   std::vector<mojom::BlockchainTokenPtr> discovered_tokens;
-  for (const auto& token : sol_token_registry) {
+  for (auto& token : sol_token_registry) {
     if (discovered_mint_addresses.contains(token->contract_address)) {
-      if (!BraveWalletService::AddUserAsset(token.Clone(), prefs_)) {
-        continue;
-      }
-      discovered_tokens.push_back(token.Clone());
+      discovered_tokens.push_back(std::move(token));
     }
   }
 
@@ -889,14 +961,28 @@ void AssetDiscoveryTask::DiscoverNFTs(
           eth_account_addresses.size() + sol_account_addresses.size(),
           base::BindOnce(&AssetDiscoveryTask::MergeDiscoveredNFTs,
                          weak_ptr_factory_.GetWeakPtr(), std::move(callback)));
+  // Fetching all pages of one account holds a single request slot.
+  auto fetch_nfts = [](AssetDiscoveryTask* task,
+                       const std::string& account_address,
+                       const std::vector<std::string>& chain_ids,
+                       mojom::CoinType coin,
+                       FetchNFTsFromSimpleHashCallback callback,
+                       base::OnceClosure done) {
+    task->FetchNFTsFromSimpleHash(account_address, chain_ids, coin,
+                                  std::move(callback).Then(std::move(done)));
+  };
   for (const auto& account_address : eth_account_addresses) {
-    FetchNFTsFromSimpleHash(account_address, chain_ids.at(mojom::CoinType::ETH),
-                            mojom::CoinType::ETH, barrier_callback);
+    RunRequest(base::BindOnce(fetch_nfts, base::Unretained(this),
+                              account_address,
+                              chain_ids.at(mojom::CoinType::ETH),
+                              mojom::CoinType::ETH, barrier_callback));
   }
 
   for (const auto& account_address : sol_account_addresses) {
-    FetchNFTsFromSimpleHash(account_address, chain_ids.at(mojom::CoinType::SOL),
-                            mojom::CoinType::SOL, barrier_callback);
+    RunRequest(base::BindOnce(fetch_nfts, base::Unretained(this),
+                              account_address,
+                              chain_ids.at(mojom::CoinType::SOL),
+                              mojom::CoinType::SOL, barrier_callback));
   }
 }
 
@@ -912,11 +998,7 @@ void AssetDiscoveryTask::MergeDiscoveredNFTs(
         continue;
       }
       seen_nft.insert(nft.Clone());
-
-      // Add the NFT to the user's assets
-      if (BraveWalletService::AddUserAsset(nft.Clone(), prefs_)) {
-        discovered_nfts.push_back(nft.Clone());
-      }
+      discovered_nfts.push_back(nft.Clone());
     }
   }
 
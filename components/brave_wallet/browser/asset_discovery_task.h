@@ -13,6 +13,7 @@
 #include <vector>
 
 #include "base/barrier_callback.h"
+#include "base/containers/circular_deque.h"
 #include "base/gtest_prod_util.h"
 #include "base/memory/raw_ptr.h"
 #include "base/memory/weak_ptr.h"
@@ -28,6 +29,10 @@ namespace brave_wallet {
 class BraveWalletService;
 class JsonRpcService;
 
+// Discovers the assets of every (account, chain) pair concurrently. Requests
+// are deduplicated and at most kMaxConcurrentRequests of them are in flight at
+// once. Discovered assets are added to the user assets pref in one update once
+// every request has completed.
 class AssetDiscoveryTask {
  public:
   using APIRequestHelper = api_request_helper::APIRequestHelper;
@@ -52,6 +57,8 @@ class AssetDiscoveryTask {
 
  private:
   friend class AssetDiscoveryTaskUnitTest;
+  FRIEND_TEST_ALL_PREFIXES(AssetDiscoveryTaskUnitTest,
+                           DiscoverAssetsWithManyAccounts);
   FRIEND_TEST_ALL_PREFIXES(AssetDiscoveryTaskUnitTest, DecodeMintAddress);
   FRIEND_TEST_ALL_PREFIXES(AssetDiscoveryTaskUnitTest,
                            GetSimpleHashNftsByWalletUrl);
@@ -70,6 +77,15 @@ class AssetDiscoveryTask {
       const std::vector<std::vector<mojom::BlockchainTokenPtr>>&
           discovered_assets);
 
+  // A request receives the closure to run once it has completed.
+  using Request = base::OnceCallback<void(base::OnceClosure done)>;
+
+  // Runs |request| as soon as fewer than kMaxConcurrentRequests requests are
+  // in flight.
+  void RunRequest(Request request);
+  void RunPendingRequests();
+  void OnRequestCompleted();
+
   using DiscoverAssetsCompletedCallback =
       base::OnceCallback<void(std::vector<mojom::BlockchainTokenPtr> tokens)>;
 
@@ -77,6 +93,13 @@ class AssetDiscoveryTask {
       const std::vector<std::string>& chain_ids,
       const std::vector<std::string>& account_addresses,
       DiscoverAssetsCompletedCallback callback);
+  void GetERC20TokenBalances(
+      const std::string& account_address,
+      const std::string& chain_id,
+      const std::vector<std::string>& contract_addresses,
+      base::OnceCallback<void(std::map<std::string, std::vector<std::string>>)>
+          barrier_callback,
+      base::OnceClosure done);
   void OnGetERC20TokenBalances(
       base::OnceCallback<void(std::map<std::string, std::vector<std::string>>)>
           barrier_callback,
@@ -86,9 +109,6 @@ class AssetDiscoveryTask {
       mojom::ProviderError error,
       const std::string& error_message);
   void MergeDiscoveredERC20s(
-      base::flat_map<std::string,
-                     base::flat_map<std::string, mojom::BlockchainTokenPtr>>
-          chain_id_to_contract_address_to_token,
       DiscoverAssetsCompletedCallback callback,
       const std::vector<std::map<std::string, std::vector<std::string>>>&
           discovered_assets);
@@ -96,6 +116,10 @@ class AssetDiscoveryTask {
   void DiscoverSPLTokensFromRegistry(
       const std::vector<std::string>& account_addresses,
       DiscoverAssetsCompletedCallback callback);
+  void GetSolanaTokenAccountsByOwner(
+      const SolanaAddress& account_address,
+      base::OnceCallback<void(std::vector<SolanaAddress>)> barrier_callback,
+      base::OnceClosure done);
   void OnGetSolanaTokenAccountsByOwner(
       base::OnceCallback<void(std::vector<SolanaAddress>)> barrier_callback,
       const std::vector<SolanaAccountInfo>& token_accounts,
@@ -143,6 +167,8 @@ class AssetDiscoveryTask {
   raw_ptr<BraveWalletService> wallet_service_;
   raw_ptr<JsonRpcService> json_rpc_service_;
   raw_ptr<PrefService> prefs_;
+  base::circular_deque<Request> pending_requests_;
+  size_t requests_in_flight_ = 0;
   base::WeakPtrFactory<AssetDiscoveryTask> weak_ptr_factory_;
 };
 
@@ -5,7 +5,6 @@
 
 #include "brave/components/brave_wallet/browser/bitcoin/bitcoin_block_tracker.h"
 
-#include <memory>
 #include <utility>
 
 #include "base/functional/bind.h"
@@ -25,14 +24,13 @@ BitcoinBlockTracker::~BitcoinBlockTracker() = default;
 
 void BitcoinBlockTracker::Start(const std::string& chain_id,
                                 base::TimeDelta interval) {
-  if (!base::Contains(timers_, chain_id)) {
-    timers_[chain_id] = std::make_unique<base::RepeatingTimer>();
-  }
+  StartPolling(chain_id, interval,
+               base::BindRepeating(&BitcoinBlockTracker::GetBlockHeight,
+                                   weak_ptr_factory_.GetWeakPtr(), chain_id));
+}
 
-  timers_[chain_id]->Start(
-      FROM_HERE, interval,
-      base::BindRepeating(&BitcoinBlockTracker::GetBlockHeight,
-                          weak_ptr_factory_.GetWeakPtr(), chain_id));
+bool BitcoinBlockTracker::HasObservers() const {
+  return !observers_.empty();
 }
 
 void BitcoinBlockTracker::GetBlockHeight(const std::string& chain_id) {
@@ -48,8 +46,10 @@ void BitcoinBlockTracker::OnGetBlockHeight(
     return;
   }
   if (latest_height_ == latest_height) {
+    ReportPollResult(chain_id, false);
     return;
   }
+  ReportPollResult(chain_id, true);
   latest_height_ = latest_height.value();
   for (auto& observer : observers_) {
     observer.OnLatestHeightUpdated(chain_id, latest_height_);
@@ -40,6 +40,7 @@ class BitcoinBlockTracker : public BlockTracker {
   void Start(const std::string& chain_id, base::TimeDelta interval) override;
 
  private:
+  bool HasObservers() const override;
   void GetBlockHeight(const std::string& chain_id);
   void OnGetBlockHeight(const std::string& chain_id,
                         base::expected<uint32_t, std::string> latest_height);
@@ -8,6 +8,7 @@
 #include <utility>
 
 #include "base/functional/bind.h"
+#include "base/ranges/algorithm.h"
 #include "base/time/time.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_utils.h"
 
@@ -19,6 +20,12 @@ BitcoinDatabaseSynchronizer::BitcoinDatabaseSynchronizer(
     BitcoinTransactionDatabase* database)
     : network_id_(network_id), bitcoin_rpc_(bitcoin_rpc), database_(database) {
   DCHECK(IsBitcoinNetwork(network_id_));
+
+  // Syncing before the stored sync states are loaded would fetch the whole
+  // history again, so addresses are only synced once loaded.
+  database_->RunWhenLoaded(
+      base::BindOnce(&BitcoinDatabaseSynchronizer::SyncAllAddresses,
+                     weak_ptr_factory_.GetWeakPtr()));
 }
 
 BitcoinDatabaseSynchronizer::~BitcoinDatabaseSynchronizer() = default;
@@ -45,7 +52,7 @@ void BitcoinDatabaseSynchronizer::AddWatchAddresses(
       continue;
     }
 
-    addresses_.insert({a, WatchedAddressData()});
+    addresses_.insert(a);
     if (current_height) {
       SyncAddress(a, current_height.value());
     }
@@ -76,57 +83,81 @@ void BitcoinDatabaseSynchronizer::OnFetchChainHeight(
 void BitcoinDatabaseSynchronizer::SyncAllAddresses() {
   if (auto max_block_height = database_->GetChainHeight()) {
     for (const auto& a : addresses_) {
-      SyncAddress(a.first, max_block_height.value());
+      SyncAddress(a, max_block_height.value());
     }
   }
 }
 
 void BitcoinDatabaseSynchronizer::SyncAddress(const std::string& address,
                                               const uint32_t max_block_height) {
-  FetchAddressHistory(address, max_block_height, "");
+  if (!database_->IsLoaded()) {
+    return;
+  }
+
+  FetchAddressHistory(address, max_block_height, "", "");
 }
 
 void BitcoinDatabaseSynchronizer::FetchAddressHistory(
     const std::string& address,
     const uint32_t max_block_height,
-    const std::string& last_seen_txid_filter) {
+    const std::string& last_seen_txid_filter,
+    const std::string& newest_txid) {
   bitcoin_rpc_->GetAddressHistory(
       network_id_, address, max_block_height, last_seen_txid_filter,
       base::BindOnce(&BitcoinDatabaseSynchronizer::OnFetchAddressHistory,
                      weak_ptr_factory_.GetWeakPtr(), address, max_block_height,
-                     last_seen_txid_filter));
+                     last_seen_txid_filter, newest_txid));
 }
 
 void BitcoinDatabaseSynchronizer::OnFetchAddressHistory(
     const std::string& address,
     const uint32_t max_block_height,
     const std::string& last_seen_txid_filter,
+    std::string newest_txid,
     base::expected<std::vector<bitcoin::Transaction>, std::string>
         transactions) {
   if (!transactions.has_value()) {
     return;
   }
 
-  // TODO(apaymyshev): stop fetching transaction history when no new entries are
-  // expected.
-
-  if (!transactions.value().empty()) {
-    if (last_seen_txid_filter.empty()) {
-      addresses_[address].newest_txid = transactions.value().front().txid;
-    }
-  }
+  BitcoinAddressSyncState sync_state = database_->GetSyncState(address);
 
+  // Reached the end of the history.
   if (transactions.value().empty()) {
+    if (!newest_txid.empty()) {
+      sync_state.newest_txid = newest_txid;
+    }
     if (!last_seen_txid_filter.empty()) {
-      addresses_[address].oldest_txid = last_seen_txid_filter;
+      sync_state.oldest_txid = last_seen_txid_filter;
     }
+    database_->SetSyncState(address, sync_state);
+    return;
+  }
+
+  if (newest_txid.empty()) {
+    newest_txid = transactions.value().front().txid;
+  }
+
+  // Everything from the newest transaction of the previous sync onwards is
+  // already in the database, stop there. The watermark only moves once the
+  // whole gap has been fetched, so an interrupted sync starts over.
+  auto watermark = base::ranges::find(transactions.value(),
+                                      sync_state.newest_txid,
+                                      &bitcoin::Transaction::txid);
+  if (!sync_state.newest_txid.empty() &&
+      watermark != transactions.value().end()) {
+    transactions.value().erase(watermark, transactions.value().end());
+    database_->AddTransactions(address, std::move(transactions.value()));
+    sync_state.newest_txid = newest_txid;
+    database_->SetSyncState(address, sync_state);
     return;
   }
 
   auto new_last_seen_txid_filter = transactions.value().back().txid;
   database_->AddTransactions(address, std::move(transactions.value()));
 
-  FetchAddressHistory(address, max_block_height, new_last_seen_txid_filter);
+  FetchAddressHistory(address, max_block_height, new_last_seen_txid_filter,
+                      newest_txid);
 }
 
 }  // namespace brave_wallet
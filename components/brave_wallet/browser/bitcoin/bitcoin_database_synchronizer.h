@@ -6,7 +6,6 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_BITCOIN_BITCOIN_DATABASE_SYNCHRONIZER_H_
 #define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_BITCOIN_BITCOIN_DATABASE_SYNCHRONIZER_H_
 
-#include <map>
 #include <set>
 #include <string>
 #include <vector>
@@ -18,7 +17,9 @@
 
 namespace brave_wallet {
 
-// TODO(apaymyshev): test this class
+// Keeps the transaction database of a network up to date with the history of
+// the watched addresses. Only transactions newer than the newest one fetched
+// by the previous sync are requested.
 class BitcoinDatabaseSynchronizer {
  public:
   BitcoinDatabaseSynchronizer(const std::string& network_id,
@@ -30,26 +31,27 @@ class BitcoinDatabaseSynchronizer {
   void AddWatchAddresses(const std::vector<std::string>& addresses);
 
  private:
-  struct WatchedAddressData {
-    std::string newest_txid;
-    std::string oldest_txid;
-  };
+  friend class BitcoinDatabaseSynchronizerUnitTest;
 
   void FetchChainHeight();
   void OnFetchChainHeight(base::expected<uint32_t, std::string> height);
 
   void SyncAllAddresses();
   void SyncAddress(const std::string& address, const uint32_t max_block_height);
+  // |newest_txid| is the most recent transaction fetched by this sync, empty
+  // until the first page arrives.
   void FetchAddressHistory(const std::string& address,
                            const uint32_t max_block_height,
-                           const std::string& last_seen_txid_filter);
+                           const std::string& last_seen_txid_filter,
+                           const std::string& newest_txid);
   void OnFetchAddressHistory(const std::string& address,
                              const uint32_t max_block_height,
                              const std::string& last_seen_txid_filter,
+                             std::string newest_txid,
                              base::expected<std::vector<bitcoin::Transaction>,
                                             std::string> transactions);
 
-  std::map<std::string, WatchedAddressData> addresses_;
+  std::set<std::string> addresses_;
 
   base::RepeatingTimer timer_;
   std::string network_id_;
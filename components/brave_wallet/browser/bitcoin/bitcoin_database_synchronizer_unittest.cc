@@ -0,0 +1,219 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_wallet/browser/bitcoin/bitcoin_database_synchronizer.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/command_line.h"
+#include "base/files/scoped_temp_dir.h"
+#include "base/strings/strcat.h"
+#include "base/strings/string_util.h"
+#include "base/task/thread_pool.h"
+#include "base/test/task_environment.h"
+#include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
+#include "brave/components/brave_wallet/common/switches.h"
+#include "services/network/public/cpp/weak_wrapper_shared_url_loader_factory.h"
+#include "services/network/test/test_url_loader_factory.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace brave_wallet {
+
+namespace {
+
+constexpr char kAddress[] = "tb1qaddress";
+constexpr uint32_t kChainHeight = 1000;
+
+bitcoin::Transaction MakeTransaction(uint8_t txid) {
+  bitcoin::Output output;
+  output.outpoint.txid = std::vector<uint8_t>(32, txid);
+  output.outpoint.index = 0;
+  output.scriptpubkey_type = "v0_p2wpkh";
+  output.scriptpubkey_address = kAddress;
+  output.value = 1000;
+
+  bitcoin::Transaction tx;
+  tx.txid = std::string(64, 'a' + txid);
+  tx.vout.push_back(std::move(output));
+  tx.block_height = 100 + txid;
+  return tx;
+}
+
+std::string TxId(uint8_t txid) {
+  return std::string(64, 'a' + txid);
+}
+
+// Pages are returned newest first.
+std::vector<bitcoin::Transaction> MakePage(std::vector<uint8_t> txids) {
+  std::vector<bitcoin::Transaction> page;
+  for (auto txid : txids) {
+    page.push_back(MakeTransaction(txid));
+  }
+  return page;
+}
+
+}  // namespace
+
+class BitcoinDatabaseSynchronizerUnitTest : public testing::Test {
+ public:
+  BitcoinDatabaseSynchronizerUnitTest()
+      : shared_url_loader_factory_(
+            base::MakeRefCounted<network::WeakWrapperSharedURLLoaderFactory>(
+                &url_loader_factory_)),
+        bitcoin_rpc_(shared_url_loader_factory_) {}
+
+ protected:
+  void SetUp() override {
+    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
+    base::CommandLine::ForCurrentProcess()->AppendSwitchASCII(
+        switches::kBitcoinRpcHost, "bitcoin.rpc.brave.com");
+  }
+
+  std::unique_ptr<base::SequenceBound<BitcoinUtxoStore>> CreateStore() {
+    auto store = std::make_unique<base::SequenceBound<BitcoinUtxoStore>>(
+        base::ThreadPool::CreateSequencedTaskRunner({base::MayBlock()}),
+        temp_dir_.GetPath().Append(FILE_PATH_LITERAL("utxos")));
+    store->AsyncCall(&BitcoinUtxoStore::Init);
+    return store;
+  }
+
+  void OnFetchAddressHistory(BitcoinDatabaseSynchronizer& synchronizer,
+                             const std::string& last_seen_txid_filter,
+                             const std::string& newest_txid,
+                             std::vector<bitcoin::Transaction> page) {
+    synchronizer.OnFetchAddressHistory(kAddress, kChainHeight,
+                                       last_seen_txid_filter, newest_txid,
+                                       base::ok(std::move(page)));
+  }
+
+  // Returns the last_seen_txid filter of the only pending history request.
+  std::string TakePendingHistoryFilter() {
+    EXPECT_EQ(url_loader_factory_.NumPending(), 1);
+    if (url_loader_factory_.NumPending() != 1) {
+      return "";
+    }
+    const std::string path =
+        url_loader_factory_.pending_requests()->front().request.url.path();
+    url_loader_factory_.pending_requests()->clear();
+    const std::string prefix =
+        base::StrCat({"/testnet/api/address/", kAddress, "/txs/chain"});
+    EXPECT_TRUE(base::StartsWith(path, prefix));
+    return path.size() > prefix.size() ? path.substr(prefix.size() + 1) : "";
+  }
+
+  base::test::TaskEnvironment task_environment_;
+  base::ScopedTempDir temp_dir_;
+  network::TestURLLoaderFactory url_loader_factory_;
+  scoped_refptr<network::SharedURLLoaderFactory> shared_url_loader_factory_;
+  BitcoinRpc bitcoin_rpc_;
+};
+
+TEST_F(BitcoinDatabaseSynchronizerUnitTest, FullHistory) {
+  BitcoinTransactionDatabase database(mojom::kBitcoinTestnet, nullptr);
+  BitcoinDatabaseSynchronizer synchronizer(mojom::kBitcoinTestnet,
+                                           &bitcoin_rpc_, &database);
+
+  // A full page is stored and the next page is requested from its oldest
+  // transaction.
+  OnFetchAddressHistory(synchronizer, "", "", MakePage({5, 4}));
+  EXPECT_EQ(database.GetBalance(kAddress), 2000u);
+  EXPECT_EQ(TakePendingHistoryFilter(), TxId(4));
+  EXPECT_TRUE(database.GetSyncState(kAddress).newest_txid.empty());
+
+  OnFetchAddressHistory(synchronizer, TxId(4), TxId(5), MakePage({3}));
+  EXPECT_EQ(database.GetBalance(kAddress), 3000u);
+  EXPECT_EQ(TakePendingHistoryFilter(), TxId(3));
+  EXPECT_TRUE(database.GetSyncState(kAddress).newest_txid.empty());
+
+  // The watermarks only move once the end of the history is reached.
+  OnFetchAddressHistory(synchronizer, TxId(3), TxId(5), {});
+  EXPECT_EQ(url_loader_factory_.NumPending(), 0);
+  EXPECT_EQ(database.GetSyncState(kAddress).newest_txid, TxId(5));
+  EXPECT_EQ(database.GetSyncState(kAddress).oldest_txid, TxId(3));
+}
+
+TEST_F(BitcoinDatabaseSynchronizerUnitTest, StopsAtWatermark) {
+  BitcoinTransactionDatabase database(mojom::kBitcoinTestnet, nullptr);
+  database.SetSyncState(kAddress, {TxId(3), TxId(1)});
+  BitcoinDatabaseSynchronizer synchronizer(mojom::kBitcoinTestnet,
+                                           &bitcoin_rpc_, &database);
+
+  // Transactions from the watermark on were fetched by a previous sync.
+  OnFetchAddressHistory(synchronizer, "", "", MakePage({5, 4, 3, 2}));
+  EXPECT_EQ(url_loader_factory_.NumPending(), 0);
+  EXPECT_EQ(database.GetBalance(kAddress), 2000u);
+  EXPECT_EQ(database.GetSyncState(kAddress).newest_txid, TxId(5));
+  EXPECT_EQ(database.GetSyncState(kAddress).oldest_txid, TxId(1));
+}
+
+TEST_F(BitcoinDatabaseSynchronizerUnitTest, WatermarkOnLaterPage) {
+  BitcoinTransactionDatabase database(mojom::kBitcoinTestnet, nullptr);
+  database.SetSyncState(kAddress, {TxId(3), TxId(1)});
+  BitcoinDatabaseSynchronizer synchronizer(mojom::kBitcoinTestnet,
+                                           &bitcoin_rpc_, &database);
+
+  // The watermark is not reached yet, so it must not move.
+  OnFetchAddressHistory(synchronizer, "", "", MakePage({6, 5}));
+  EXPECT_EQ(TakePendingHistoryFilter(), TxId(5));
+  EXPECT_EQ(database.GetSyncState(kAddress).newest_txid, TxId(3));
+
+  OnFetchAddressHistory(synchronizer, TxId(5), TxId(6), MakePage({4, 3}));
+  EXPECT_EQ(url_loader_factory_.NumPending(), 0);
+  EXPECT_EQ(database.GetBalance(kAddress), 3000u);
+  EXPECT_EQ(database.GetSyncState(kAddress).newest_txid, TxId(6));
+  EXPECT_EQ(database.GetSyncState(kAddress).oldest_txid, TxId(1));
+}
+
+TEST_F(BitcoinDatabaseSynchronizerUnitTest, NoNewTransactions) {
+  BitcoinTransactionDatabase database(mojom::kBitcoinTestnet, nullptr);
+  database.SetSyncState(kAddress, {TxId(3), TxId(1)});
+  BitcoinDatabaseSynchronizer synchronizer(mojom::kBitcoinTestnet,
+                                           &bitcoin_rpc_, &database);
+
+  OnFetchAddressHistory(synchronizer, "", "", MakePage({3, 2}));
+  EXPECT_EQ(url_loader_factory_.NumPending(), 0);
+  EXPECT_EQ(database.GetBalance(kAddress), 0u);
+  EXPECT_EQ(database.GetSyncState(kAddress).newest_txid, TxId(3));
+
+  // An empty first page leaves the sync state as it is.
+  OnFetchAddressHistory(synchronizer, "", "", {});
+  EXPECT_EQ(database.GetSyncState(kAddress).newest_txid, TxId(3));
+  EXPECT_EQ(database.GetSyncState(kAddress).oldest_txid, TxId(1));
+}
+
+TEST_F(BitcoinDatabaseSynchronizerUnitTest, FetchError) {
+  BitcoinTransactionDatabase database(mojom::kBitcoinTestnet, nullptr);
+  database.SetSyncState(kAddress, {TxId(3), TxId(1)});
+  BitcoinDatabaseSynchronizer synchronizer(mojom::kBitcoinTestnet,
+                                           &bitcoin_rpc_, &database);
+
+  synchronizer.OnFetchAddressHistory(kAddress, kChainHeight, TxId(5), TxId(6),
+                                     base::unexpected("error"));
+  EXPECT_EQ(url_loader_factory_.NumPending(), 0);
+  EXPECT_EQ(database.GetSyncState(kAddress).newest_txid, TxId(3));
+  EXPECT_EQ(database.GetSyncState(kAddress).oldest_txid, TxId(1));
+}
+
+TEST_F(BitcoinDatabaseSynchronizerUnitTest, SyncOnlyOnceLoaded) {
+  auto store = CreateStore();
+  BitcoinTransactionDatabase database(mojom::kBitcoinTestnet, store.get());
+  database.SetChainHeight(kChainHeight);
+  BitcoinDatabaseSynchronizer synchronizer(mojom::kBitcoinTestnet,
+                                           &bitcoin_rpc_, &database);
+
+  // Watched addresses are not synced until the database is loaded.
+  ASSERT_FALSE(database.IsLoaded());
+  synchronizer.AddWatchAddresses({kAddress});
+  EXPECT_EQ(url_loader_factory_.NumPending(), 0);
+
+  task_environment_.RunUntilIdle();
+  ASSERT_TRUE(database.IsLoaded());
+  EXPECT_EQ(TakePendingHistoryFilter(), "");
+}
+
+}  // namespace brave_wallet
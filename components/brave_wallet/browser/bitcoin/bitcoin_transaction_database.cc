@@ -5,56 +5,38 @@
 
 #include "brave/components/brave_wallet/browser/bitcoin/bitcoin_transaction_database.h"
 
-#include <sstream>
 #include <utility>
 
-#include "base/notreached.h"
-#include "base/strings/string_number_conversions.h"
+#include "base/check.h"
+#include "base/containers/contains.h"
+#include "base/functional/bind.h"
 
 namespace brave_wallet {
 
-namespace {
-
-void FindUnspentOutputs(const std::string& address,
-                        const std::set<bitcoin::Transaction>& transactions,
-                        std::vector<bitcoin::Output>& result) {
-  std::map<bitcoin::Outpoint, const bitcoin::Output*> outputs;
-
-  // Search for outpoints to address and save them.
-  for (const auto& tx : transactions) {
-    for (const auto& o : tx.vout) {
-      if (o.scriptpubkey_address != address) {
-        continue;
-      }
-
-      outputs[o.outpoint] = &o;
-    }
+BitcoinTransactionDatabase::BitcoinTransactionDatabase(
+    const std::string& network_id,
+    base::SequenceBound<BitcoinUtxoStore>* store)
+    : network_id_(network_id), store_(store) {
+  if (!store_) {
+    is_loaded_ = true;
+    return;
   }
 
-  // Consider ouptpoints for inputs from address as spent and remove them.
-  for (const auto& tx : transactions) {
-    for (const auto& i : tx.vin) {
-      if (i.scriptpubkey_address != address) {
-        continue;
-      }
+  store_->AsyncCall(&BitcoinUtxoStore::Load)
+      .WithArgs(network_id_)
+      .Then(base::BindOnce(&BitcoinTransactionDatabase::OnLoaded,
+                           weak_ptr_factory_.GetWeakPtr()));
+}
 
-      if (!outputs.erase(i.outpoint)) {
-        NOTREACHED() << "No output to spend for outpoint "
-                     << i.outpoint.txid_hex() << ":" << i.outpoint.index;
-      }
-    }
-  }
+BitcoinTransactionDatabase::~BitcoinTransactionDatabase() = default;
 
-  // Now there are only unspent outputs.
-  for (auto& o : outputs) {
-    result.push_back(*o.second);
+void BitcoinTransactionDatabase::RunWhenLoaded(base::OnceClosure callback) {
+  if (is_loaded_) {
+    return std::move(callback).Run();
   }
-}
-
-}  // namespace
 
-BitcoinTransactionDatabase::BitcoinTransactionDatabase() = default;
-BitcoinTransactionDatabase::~BitcoinTransactionDatabase() = default;
+  on_loaded_callbacks_.push_back(std::move(callback));
+}
 
 void BitcoinTransactionDatabase::SetChainHeight(uint32_t chain_height) {
   chain_height_ = chain_height;
@@ -67,48 +49,160 @@ absl::optional<uint32_t> BitcoinTransactionDatabase::GetChainHeight() const {
 bool BitcoinTransactionDatabase::AddTransactions(
     const std::string& address,
     std::vector<bitcoin::Transaction> transactions) {
-  for (auto& tr : transactions) {
-    // TODO(apaymyshev): should check that transaction with same txid in set
-    // fully matches incoming one?
+  BitcoinUtxoChanges changes;
+
+  // History is fetched newest first, so an input may be seen before the
+  // output it spends. Spent outpoints are remembered to handle both orders.
+  for (const auto& tx : transactions) {
+    for (const auto& i : tx.vin) {
+      if (i.scriptpubkey_address != address) {
+        continue;
+      }
+
+      if (!base::Contains(spent_outpoints_, i.outpoint)) {
+        SpendOutpoint(i.outpoint);
+        changes.spent_outpoints.push_back(i.outpoint);
+      }
+    }
 
-    transactions_[address].insert(std::move(tr));
+    for (const auto& o : tx.vout) {
+      if (o.scriptpubkey_address != address) {
+        continue;
+      }
+
+      if (AddOutput(o)) {
+        changes.added_outputs.push_back(o);
+      }
+    }
   }
 
+  Persist(std::move(changes));
   return true;
 }
 
 std::vector<bitcoin::Output> BitcoinTransactionDatabase::GetUnspentOutputs(
-    const std::string& address) {
+    const std::string& address) const {
   std::vector<bitcoin::Output> result;
 
-  auto it = transactions_.find(address);
-  if (it == transactions_.end()) {
+  auto it = utxos_.find(address);
+  if (it == utxos_.end()) {
     return result;
   }
 
-  FindUnspentOutputs(it->first, it->second, result);
+  result.reserve(it->second.size());
+  for (const auto& [outpoint, output] : it->second) {
+    result.push_back(output);
+  }
 
   return result;
 }
 
-std::vector<bitcoin::Output>
-BitcoinTransactionDatabase::GetAllUnspentOutputs() {
+std::vector<bitcoin::Output> BitcoinTransactionDatabase::GetAllUnspentOutputs()
+    const {
   std::vector<bitcoin::Output> result;
+  result.reserve(utxo_addresses_.size());
 
-  for (auto& address_item : transactions_) {
-    FindUnspentOutputs(address_item.first, address_item.second, result);
+  for (const auto& [address, outputs] : utxos_) {
+    for (const auto& [outpoint, output] : outputs) {
+      result.push_back(output);
+    }
   }
 
   return result;
 }
 
-uint64_t BitcoinTransactionDatabase::GetBalance(const std::string& address) {
-  uint64_t balance = 0;
-  for (auto& uo : GetUnspentOutputs(address)) {
-    balance += uo.value;
+uint64_t BitcoinTransactionDatabase::GetBalance(
+    const std::string& address) const {
+  auto it = balances_.find(address);
+  return it == balances_.end() ? 0 : it->second;
+}
+
+BitcoinAddressSyncState BitcoinTransactionDatabase::GetSyncState(
+    const std::string& address) const {
+  auto it = sync_states_.find(address);
+  return it == sync_states_.end() ? BitcoinAddressSyncState() : it->second;
+}
+
+void BitcoinTransactionDatabase::SetSyncState(
+    const std::string& address,
+    const BitcoinAddressSyncState& sync_state) {
+  if (GetSyncState(address) == sync_state) {
+    return;
   }
 
-  return balance;
+  sync_states_[address] = sync_state;
+
+  BitcoinUtxoChanges changes;
+  changes.sync_states[address] = sync_state;
+  Persist(std::move(changes));
+}
+
+bool BitcoinTransactionDatabase::AddOutput(const bitcoin::Output& output) {
+  if (base::Contains(spent_outpoints_, output.outpoint) ||
+      base::Contains(utxo_addresses_, output.outpoint)) {
+    return false;
+  }
+
+  const std::string& address = output.scriptpubkey_address;
+  utxos_[address][output.outpoint] = output;
+  utxo_addresses_[output.outpoint] = address;
+  balances_[address] += output.value;
+  return true;
+}
+
+bool BitcoinTransactionDatabase::SpendOutpoint(
+    const bitcoin::Outpoint& outpoint) {
+  spent_outpoints_.insert(outpoint);
+
+  auto address_it = utxo_addresses_.find(outpoint);
+  if (address_it == utxo_addresses_.end()) {
+    return false;
+  }
+
+  const std::string address = std::move(address_it->second);
+  utxo_addresses_.erase(address_it);
+
+  auto& outputs = utxos_[address];
+  auto output_it = outputs.find(outpoint);
+  DCHECK(output_it != outputs.end());
+  balances_[address] -= output_it->second.value;
+  outputs.erase(output_it);
+  if (outputs.empty()) {
+    utxos_.erase(address);
+    balances_.erase(address);
+  }
+  return true;
+}
+
+void BitcoinTransactionDatabase::Persist(BitcoinUtxoChanges changes) {
+  if (!store_ || changes.empty()) {
+    return;
+  }
+
+  store_->AsyncCall(&BitcoinUtxoStore::Apply)
+      .WithArgs(network_id_, std::move(changes));
+}
+
+void BitcoinTransactionDatabase::OnLoaded(BitcoinUtxoChanges loaded) {
+  // Everything added before loading completed is kept, the UTXO set is the
+  // same whichever order outputs and spends are applied in.
+  for (const auto& outpoint : loaded.spent_outpoints) {
+    SpendOutpoint(outpoint);
+  }
+  for (const auto& output : loaded.added_outputs) {
+    AddOutput(output);
+  }
+  for (auto& [address, sync_state] : loaded.sync_states) {
+    sync_states_.emplace(address, std::move(sync_state));
+  }
+
+  is_loaded_ = true;
+
+  std::vector<base::OnceClosure> callbacks;
+  callbacks.swap(on_loaded_callbacks_);
+  for (auto& callback : callbacks) {
+    std::move(callback).Run();
+  }
 }
 
 }  // namespace brave_wallet
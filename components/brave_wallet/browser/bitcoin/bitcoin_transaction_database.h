@@ -11,31 +11,73 @@
 #include <string>
 #include <vector>
 
+#include "base/functional/callback.h"
+#include "base/memory/raw_ptr.h"
+#include "base/memory/weak_ptr.h"
+#include "base/threading/sequence_bound.h"
 #include "brave/components/brave_wallet/browser/bitcoin/bitcoin_transaction.h"
+#include "brave/components/brave_wallet/browser/bitcoin/bitcoin_utxo_store.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
 
 namespace brave_wallet {
 
-// TODO(apaymyshev): tests for this class
+// Unspent outputs of the watched addresses of one bitcoin network, updated
+// incrementally as transactions are added and indexed by address, along with
+// per-address balances and sync state. Every change is persisted to a
+// BitcoinUtxoStore, which is loaded asynchronously on construction.
 class BitcoinTransactionDatabase {
  public:
-  BitcoinTransactionDatabase();
+  // Everything is kept in memory only if |store| is null.
+  BitcoinTransactionDatabase(const std::string& network_id,
+                             base::SequenceBound<BitcoinUtxoStore>* store);
   ~BitcoinTransactionDatabase();
   BitcoinTransactionDatabase(BitcoinTransactionDatabase& other) = delete;
   BitcoinTransactionDatabase& operator=(BitcoinTransactionDatabase& other) =
       delete;
 
+  bool IsLoaded() const { return is_loaded_; }
+  // Runs |callback| once the store is loaded, right away if it already is.
+  void RunWhenLoaded(base::OnceClosure callback);
+
   void SetChainHeight(uint32_t chain_height);
   absl::optional<uint32_t> GetChainHeight() const;
   bool AddTransactions(const std::string& address,
                        std::vector<bitcoin::Transaction> transactions);
-  std::vector<bitcoin::Output> GetUnspentOutputs(const std::string& address);
-  std::vector<bitcoin::Output> GetAllUnspentOutputs();
-  uint64_t GetBalance(const std::string& address);
+  std::vector<bitcoin::Output> GetUnspentOutputs(
+      const std::string& address) const;
+  std::vector<bitcoin::Output> GetAllUnspentOutputs() const;
+  uint64_t GetBalance(const std::string& address) const;
+
+  BitcoinAddressSyncState GetSyncState(const std::string& address) const;
+  void SetSyncState(const std::string& address,
+                    const BitcoinAddressSyncState& sync_state);
 
  private:
+  // Both return true if the UTXO set changed.
+  bool AddOutput(const bitcoin::Output& output);
+  bool SpendOutpoint(const bitcoin::Outpoint& outpoint);
+
+  void Persist(BitcoinUtxoChanges changes);
+  void OnLoaded(BitcoinUtxoChanges loaded);
+
+  const std::string network_id_;
   absl::optional<uint32_t> chain_height_;
-  // TODO(apaymyshev): avoid transaction duplicates for different addresses?
-  std::map<std::string, std::set<bitcoin::Transaction>> transactions_;
+
+  // <address, <outpoint, output>>
+  std::map<std::string, std::map<bitcoin::Outpoint, bitcoin::Output>> utxos_;
+  // <outpoint, address> for every output in |utxos_|.
+  std::map<bitcoin::Outpoint, std::string> utxo_addresses_;
+  // Outpoints spent by inputs seen so far, their outputs may not be known
+  // yet.
+  std::set<bitcoin::Outpoint> spent_outpoints_;
+  // <address, sum of unspent output values>
+  std::map<std::string, uint64_t> balances_;
+  std::map<std::string, BitcoinAddressSyncState> sync_states_;
+
+  bool is_loaded_ = false;
+  std::vector<base::OnceClosure> on_loaded_callbacks_;
+  raw_ptr<base::SequenceBound<BitcoinUtxoStore>> store_ = nullptr;
+  base::WeakPtrFactory<BitcoinTransactionDatabase> weak_ptr_factory_{this};
 };
 
 }  // namespace brave_wallet
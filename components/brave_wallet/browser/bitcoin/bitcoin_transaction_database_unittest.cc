@@ -0,0 +1,176 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_wallet/browser/bitcoin/bitcoin_transaction_database.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/files/scoped_temp_dir.h"
+#include "base/task/thread_pool.h"
+#include "base/test/task_environment.h"
+#include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace brave_wallet {
+
+namespace {
+
+constexpr char kAddress[] = "tb1qaddress";
+constexpr char kOtherAddress[] = "tb1qother";
+
+bitcoin::Outpoint MakeOutpoint(uint8_t txid, uint32_t index) {
+  bitcoin::Outpoint outpoint;
+  outpoint.txid = std::vector<uint8_t>(32, txid);
+  outpoint.index = index;
+  return outpoint;
+}
+
+bitcoin::Output MakeOutput(uint8_t txid,
+                           uint32_t index,
+                           const std::string& address,
+                           uint64_t value) {
+  bitcoin::Output output;
+  output.outpoint = MakeOutpoint(txid, index);
+  output.scriptpubkey_type = "v0_p2wpkh";
+  output.scriptpubkey_address = address;
+  output.value = value;
+  return output;
+}
+
+bitcoin::Input MakeInput(const bitcoin::Output& spent_output) {
+  bitcoin::Input input;
+  input.outpoint = spent_output.outpoint;
+  input.scriptpubkey_type = spent_output.scriptpubkey_type;
+  input.scriptpubkey_address = spent_output.scriptpubkey_address;
+  input.value = spent_output.value;
+  return input;
+}
+
+bitcoin::Transaction MakeTransaction(uint8_t txid,
+                                     std::vector<bitcoin::Input> vin,
+                                     std::vector<bitcoin::Output> vout) {
+  bitcoin::Transaction tx;
+  tx.txid = std::string(64, 'a' + txid);
+  tx.vin = std::move(vin);
+  tx.vout = std::move(vout);
+  tx.block_height = 100 + txid;
+  return tx;
+}
+
+}  // namespace
+
+class BitcoinTransactionDatabaseUnitTest : public testing::Test {
+ protected:
+  void SetUp() override { ASSERT_TRUE(temp_dir_.CreateUniqueTempDir()); }
+
+  std::unique_ptr<base::SequenceBound<BitcoinUtxoStore>> CreateStore() {
+    auto store = std::make_unique<base::SequenceBound<BitcoinUtxoStore>>(
+        base::ThreadPool::CreateSequencedTaskRunner({base::MayBlock()}),
+        temp_dir_.GetPath().Append(FILE_PATH_LITERAL("utxos")));
+    store->AsyncCall(&BitcoinUtxoStore::Init);
+    return store;
+  }
+
+  base::test::TaskEnvironment task_environment_;
+  base::ScopedTempDir temp_dir_;
+};
+
+TEST_F(BitcoinTransactionDatabaseUnitTest, UnspentOutputs) {
+  BitcoinTransactionDatabase database(mojom::kBitcoinTestnet, nullptr);
+  EXPECT_TRUE(database.IsLoaded());
+
+  const auto received = MakeOutput(1, 0, kAddress, 1000);
+  const auto change = MakeOutput(2, 1, kAddress, 300);
+  const auto sent = MakeOutput(2, 0, kOtherAddress, 600);
+
+  // Newest first, the spending transaction arrives before the output it
+  // spends.
+  std::vector<bitcoin::Transaction> transactions;
+  transactions.push_back(MakeTransaction(2, {MakeInput(received)},
+                                         {sent, change}));
+  ASSERT_TRUE(database.AddTransactions(kAddress, std::move(transactions)));
+  EXPECT_EQ(database.GetBalance(kAddress), 300u);
+
+  transactions.clear();
+  transactions.push_back(MakeTransaction(1, {}, {received}));
+  ASSERT_TRUE(database.AddTransactions(kAddress, std::move(transactions)));
+
+  auto outputs = database.GetUnspentOutputs(kAddress);
+  ASSERT_EQ(outputs.size(), 1u);
+  EXPECT_EQ(outputs[0].outpoint.txid, change.outpoint.txid);
+  EXPECT_EQ(outputs[0].outpoint.index, 1u);
+  EXPECT_EQ(database.GetBalance(kAddress), 300u);
+  // Outputs to other addresses are not tracked for |kAddress|.
+  EXPECT_TRUE(database.GetUnspentOutputs(kOtherAddress).empty());
+  EXPECT_EQ(database.GetBalance(kOtherAddress), 0u);
+
+  // Adding the same transactions again changes nothing.
+  transactions.clear();
+  transactions.push_back(MakeTransaction(1, {}, {received}));
+  transactions.push_back(MakeTransaction(2, {MakeInput(received)},
+                                         {sent, change}));
+  ASSERT_TRUE(database.AddTransactions(kAddress, std::move(transactions)));
+  EXPECT_EQ(database.GetAllUnspentOutputs().size(), 1u);
+  EXPECT_EQ(database.GetBalance(kAddress), 300u);
+
+  // Spending the change empties the address.
+  transactions.clear();
+  transactions.push_back(MakeTransaction(3, {MakeInput(change)}, {}));
+  ASSERT_TRUE(database.AddTransactions(kAddress, std::move(transactions)));
+  EXPECT_TRUE(database.GetAllUnspentOutputs().empty());
+  EXPECT_EQ(database.GetBalance(kAddress), 0u);
+}
+
+TEST_F(BitcoinTransactionDatabaseUnitTest, Persistence) {
+  const auto received = MakeOutput(1, 0, kAddress, 1000);
+  const auto spent = MakeOutput(2, 0, kAddress, 500);
+
+  {
+    auto store = CreateStore();
+    BitcoinTransactionDatabase database(mojom::kBitcoinTestnet, store.get());
+    task_environment_.RunUntilIdle();
+    ASSERT_TRUE(database.IsLoaded());
+
+    std::vector<bitcoin::Transaction> transactions;
+    transactions.push_back(MakeTransaction(3, {MakeInput(spent)}, {}));
+    transactions.push_back(MakeTransaction(2, {}, {spent}));
+    transactions.push_back(MakeTransaction(1, {}, {received}));
+    ASSERT_TRUE(database.AddTransactions(kAddress, std::move(transactions)));
+    database.SetSyncState(kAddress, {"newest", "oldest"});
+    task_environment_.RunUntilIdle();
+  }
+  // Let the database close before reopening it.
+  task_environment_.RunUntilIdle();
+
+  auto store = CreateStore();
+  BitcoinTransactionDatabase database(mojom::kBitcoinTestnet, store.get());
+  BitcoinTransactionDatabase other_network(mojom::kBitcoinMainnet,
+                                           store.get());
+  task_environment_.RunUntilIdle();
+  ASSERT_TRUE(database.IsLoaded());
+
+  auto outputs = database.GetUnspentOutputs(kAddress);
+  ASSERT_EQ(outputs.size(), 1u);
+  EXPECT_EQ(outputs[0].outpoint.txid, received.outpoint.txid);
+  EXPECT_EQ(outputs[0].value, 1000u);
+  EXPECT_EQ(outputs[0].scriptpubkey_type, "v0_p2wpkh");
+  EXPECT_EQ(database.GetBalance(kAddress), 1000u);
+  EXPECT_EQ(database.GetSyncState(kAddress).newest_txid, "newest");
+  EXPECT_EQ(database.GetSyncState(kAddress).oldest_txid, "oldest");
+
+  // Spends loaded from disk still apply to outputs added again.
+  std::vector<bitcoin::Transaction> transactions;
+  transactions.push_back(MakeTransaction(2, {}, {spent}));
+  ASSERT_TRUE(database.AddTransactions(kAddress, std::move(transactions)));
+  EXPECT_EQ(database.GetBalance(kAddress), 1000u);
+
+  EXPECT_TRUE(other_network.GetAllUnspentOutputs().empty());
+  EXPECT_TRUE(other_network.GetSyncState(kAddress).newest_txid.empty());
+}
+
+}  // namespace brave_wallet
@@ -20,9 +20,11 @@ BitcoinTxManager::BitcoinTxManager(TxService* tx_service,
                                    JsonRpcService* json_rpc_service,
                                    BitcoinWalletService* bitcoin_wallet_service,
                                    KeyringService* keyring_service,
-                                   PrefService* prefs)
+                                   PrefService* prefs,
+                                   TxStorage* tx_storage)
     : TxManager(
-          std::make_unique<BitcoinTxStateManager>(prefs, json_rpc_service),
+          std::make_unique<BitcoinTxStateManager>(prefs, tx_storage,
+                                                  json_rpc_service),
           std::make_unique<BitcoinBlockTracker>(json_rpc_service,
                                                 bitcoin_wallet_service),
           tx_service,
@@ -19,6 +19,7 @@ namespace brave_wallet {
 class TxService;
 class JsonRpcService;
 class KeyringService;
+class TxStorage;
 class BitcoinWalletService;
 
 class BitcoinTxManager : public TxManager {
@@ -27,7 +28,8 @@ class BitcoinTxManager : public TxManager {
                    JsonRpcService* json_rpc_service,
                    BitcoinWalletService* bitcoin_wallet_service,
                    KeyringService* keyring_service,
-                   PrefService* prefs);
+                   PrefService* prefs,
+                   TxStorage* tx_storage);
   ~BitcoinTxManager() override;
   BitcoinTxManager(const BitcoinTxManager&) = delete;
   BitcoinTxManager& operator=(const BitcoinTxManager&) = delete;
@@ -16,19 +16,12 @@
 namespace brave_wallet {
 
 BitcoinTxStateManager::BitcoinTxStateManager(PrefService* prefs,
+                                             TxStorage* tx_storage,
                                              JsonRpcService* json_rpc_service)
-    : TxStateManager(prefs) {}
+    : TxStateManager(prefs, tx_storage) {}
 
 BitcoinTxStateManager::~BitcoinTxStateManager() = default;
 
-std::string BitcoinTxStateManager::GetTxPrefPathPrefix(
-    const absl::optional<std::string>& chain_id) {
-  // TODO(apaymyshev): implement
-  NOTIMPLEMENTED();
-
-  return "";
-}
-
 mojom::CoinType BitcoinTxStateManager::GetCoinType() const {
   return mojom::CoinType::BTC;
 }
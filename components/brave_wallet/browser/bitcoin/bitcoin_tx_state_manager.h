@@ -21,11 +21,14 @@ class Value;
 namespace brave_wallet {
 
 class TxMeta;
+class TxStorage;
 class JsonRpcService;
 
 class BitcoinTxStateManager : public TxStateManager {
  public:
-  BitcoinTxStateManager(PrefService* prefs, JsonRpcService* json_rpc_service);
+  BitcoinTxStateManager(PrefService* prefs,
+                        TxStorage* tx_storage,
+                        JsonRpcService* json_rpc_service);
   ~BitcoinTxStateManager() override;
   BitcoinTxStateManager(const BitcoinTxStateManager&) = delete;
   BitcoinTxStateManager operator=(const BitcoinTxStateManager&) = delete;
@@ -35,8 +38,6 @@ class BitcoinTxStateManager : public TxStateManager {
 
   std::unique_ptr<TxMeta> ValueToTxMeta(
       const base::Value::Dict& value) override;
-  std::string GetTxPrefPathPrefix(
-      const absl::optional<std::string>& chain_id) override;
 };
 
 }  // namespace brave_wallet
@@ -0,0 +1,216 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_wallet/browser/bitcoin/bitcoin_utxo_store.h"
+
+#include <utility>
+
+#include "base/check.h"
+#include "base/functional/bind.h"
+#include "base/logging.h"
+#include "base/strings/string_number_conversions.h"
+#include "brave/components/sql_utils/database_error_callback.h"
+#include "sql/statement.h"
+#include "sql/transaction.h"
+
+namespace brave_wallet {
+
+namespace {
+
+// Version 1: utxos, spent_outpoints and sync_states tables.
+constexpr int kCurrentVersionNumber = 1;
+constexpr int kCompatibleVersionNumber = 1;
+
+bool ReadOutpoint(sql::Statement& statement,
+                  int col,
+                  bitcoin::Outpoint& outpoint) {
+  outpoint.txid.clear();
+  if (!base::HexStringToBytes(statement.ColumnString(col), &outpoint.txid)) {
+    return false;
+  }
+  outpoint.index = static_cast<uint32_t>(statement.ColumnInt64(col + 1));
+  return true;
+}
+
+}  // namespace
+
+BitcoinUtxoChanges::BitcoinUtxoChanges() = default;
+BitcoinUtxoChanges::~BitcoinUtxoChanges() = default;
+BitcoinUtxoChanges::BitcoinUtxoChanges(BitcoinUtxoChanges&&) = default;
+BitcoinUtxoChanges& BitcoinUtxoChanges::operator=(BitcoinUtxoChanges&&) =
+    default;
+
+BitcoinUtxoStore::BitcoinUtxoStore(const base::FilePath& db_file_path)
+    : database_({.exclusive_locking = true, .page_size = 4096}),
+      db_file_path_(db_file_path) {
+  DETACH_FROM_SEQUENCE(sequence_checker_);
+}
+
+BitcoinUtxoStore::~BitcoinUtxoStore() = default;
+
+bool BitcoinUtxoStore::Init() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  database_.set_histogram_tag("BraveWalletBitcoinUtxos");
+
+  // To recover from corruption.
+  database_.set_error_callback(base::BindRepeating(
+      &sql_utils::DatabaseErrorCallback, &database_, db_file_path_));
+
+  return database_.Open(db_file_path_) && InitSchema();
+}
+
+BitcoinUtxoChanges BitcoinUtxoStore::Load(const std::string& network_id) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  BitcoinUtxoChanges result;
+  if (!database_.is_open()) {
+    return result;
+  }
+
+  sql::Statement outputs(database_.GetUniqueStatement(
+      "SELECT txid, vout, address, scriptpubkey_type, value FROM utxos "
+      "WHERE network_id = ?"));
+  outputs.BindString(0, network_id);
+  while (outputs.Step()) {
+    bitcoin::Output output;
+    if (!ReadOutpoint(outputs, 0, output.outpoint)) {
+      continue;
+    }
+    output.scriptpubkey_address = outputs.ColumnString(2);
+    output.scriptpubkey_type = outputs.ColumnString(3);
+    output.value = static_cast<uint64_t>(outputs.ColumnInt64(4));
+    result.added_outputs.push_back(std::move(output));
+  }
+
+  sql::Statement spent(database_.GetUniqueStatement(
+      "SELECT txid, vout FROM spent_outpoints WHERE network_id = ?"));
+  spent.BindString(0, network_id);
+  while (spent.Step()) {
+    bitcoin::Outpoint outpoint;
+    if (ReadOutpoint(spent, 0, outpoint)) {
+      result.spent_outpoints.push_back(std::move(outpoint));
+    }
+  }
+
+  sql::Statement sync_states(database_.GetUniqueStatement(
+      "SELECT address, newest_txid, oldest_txid FROM sync_states "
+      "WHERE network_id = ?"));
+  sync_states.BindString(0, network_id);
+  while (sync_states.Step()) {
+    result.sync_states[sync_states.ColumnString(0)] = {
+        sync_states.ColumnString(1), sync_states.ColumnString(2)};
+  }
+
+  return result;
+}
+
+bool BitcoinUtxoStore::Apply(const std::string& network_id,
+                             BitcoinUtxoChanges changes) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  sql::Transaction transaction(&database_);
+  if (!transaction.Begin()) {
+    return false;
+  }
+
+  sql::Statement add_output(database_.GetUniqueStatement(
+      "INSERT OR IGNORE INTO utxos (network_id, txid, vout, address, "
+      "scriptpubkey_type, value) VALUES (?,?,?,?,?,?)"));
+  for (const auto& output : changes.added_outputs) {
+    add_output.Reset(/*clear_bound_vars=*/true);
+    add_output.BindString(0, network_id);
+    add_output.BindString(1, output.outpoint.txid_hex());
+    add_output.BindInt64(2, output.outpoint.index);
+    add_output.BindString(3, output.scriptpubkey_address);
+    add_output.BindString(4, output.scriptpubkey_type);
+    add_output.BindInt64(5, static_cast<int64_t>(output.value));
+    if (!add_output.Run()) {
+      return false;
+    }
+  }
+
+  sql::Statement add_spent(database_.GetUniqueStatement(
+      "INSERT OR IGNORE INTO spent_outpoints (network_id, txid, vout) "
+      "VALUES (?,?,?)"));
+  sql::Statement remove_output(database_.GetUniqueStatement(
+      "DELETE FROM utxos WHERE network_id = ? AND txid = ? AND vout = ?"));
+  for (const auto& outpoint : changes.spent_outpoints) {
+    for (auto* statement : {&add_spent, &remove_output}) {
+      statement->Reset(/*clear_bound_vars=*/true);
+      statement->BindString(0, network_id);
+      statement->BindString(1, outpoint.txid_hex());
+      statement->BindInt64(2, outpoint.index);
+      if (!statement->Run()) {
+        return false;
+      }
+    }
+  }
+
+  sql::Statement set_sync_state(database_.GetUniqueStatement(
+      "INSERT OR REPLACE INTO sync_states (network_id, address, newest_txid, "
+      "oldest_txid) VALUES (?,?,?,?)"));
+  for (const auto& [address, sync_state] : changes.sync_states) {
+    set_sync_state.Reset(/*clear_bound_vars=*/true);
+    set_sync_state.BindString(0, network_id);
+    set_sync_state.BindString(1, address);
+    set_sync_state.BindString(2, sync_state.newest_txid);
+    set_sync_state.BindString(3, sync_state.oldest_txid);
+    if (!set_sync_state.Run()) {
+      return false;
+    }
+  }
+
+  return transaction.Commit();
+}
+
+bool BitcoinUtxoStore::DeleteAll() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  sql::Transaction transaction(&database_);
+  return transaction.Begin() && database_.Execute("DELETE FROM utxos") &&
+         database_.Execute("DELETE FROM spent_outpoints") &&
+         database_.Execute("DELETE FROM sync_states") && transaction.Commit();
+}
+
+bool BitcoinUtxoStore::InitSchema() {
+  sql::Transaction transaction(&database_);
+  if (!transaction.Begin() ||
+      !meta_table_.Init(&database_, kCurrentVersionNumber,
+                        kCompatibleVersionNumber)) {
+    return false;
+  }
+
+  if (meta_table_.GetCompatibleVersionNumber() > kCurrentVersionNumber) {
+    LOG(WARNING) << "Bitcoin UTXO database is too new";
+    return false;
+  }
+
+  if (!database_.DoesTableExist("utxos") && !CreateTables()) {
+    return false;
+  }
+
+  return transaction.Commit();
+}
+
+bool BitcoinUtxoStore::CreateTables() {
+  return database_.Execute(
+             "CREATE TABLE utxos (network_id TEXT NOT NULL, "
+             "txid TEXT NOT NULL, vout INTEGER NOT NULL, "
+             "address TEXT NOT NULL, scriptpubkey_type TEXT NOT NULL, "
+             "value INTEGER NOT NULL, PRIMARY KEY (network_id, txid, vout))") &&
+         database_.Execute(
+             "CREATE INDEX utxos_address_index ON utxos "
+             "(network_id, address)") &&
+         database_.Execute(
+             "CREATE TABLE spent_outpoints (network_id TEXT NOT NULL, "
+             "txid TEXT NOT NULL, vout INTEGER NOT NULL, "
+             "PRIMARY KEY (network_id, txid, vout))") &&
+         database_.Execute(
+             "CREATE TABLE sync_states (network_id TEXT NOT NULL, "
+             "address TEXT NOT NULL, newest_txid TEXT NOT NULL, "
+             "oldest_txid TEXT NOT NULL, PRIMARY KEY (network_id, address))");
+}
+
+}  // namespace brave_wallet
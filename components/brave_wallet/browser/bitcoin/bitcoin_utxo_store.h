@@ -0,0 +1,87 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_BITCOIN_BITCOIN_UTXO_STORE_H_
+#define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_BITCOIN_BITCOIN_UTXO_STORE_H_
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "base/files/file_path.h"
+#include "base/sequence_checker.h"
+#include "brave/components/brave_wallet/browser/bitcoin/bitcoin_transaction.h"
+#include "sql/database.h"
+#include "sql/meta_table.h"
+
+namespace brave_wallet {
+
+// How far the transaction history of an address has been synced.
+struct BitcoinAddressSyncState {
+  // Most recent transaction fetched. History is synced from the tip down to
+  // this transaction.
+  std::string newest_txid;
+  // Oldest transaction of the address, set once the whole history has been
+  // fetched.
+  std::string oldest_txid;
+
+  bool operator==(const BitcoinAddressSyncState& other) const {
+    return newest_txid == other.newest_txid &&
+           oldest_txid == other.oldest_txid;
+  }
+};
+
+// Changes to the UTXO set of a network, applied in a single transaction.
+struct BitcoinUtxoChanges {
+  BitcoinUtxoChanges();
+  ~BitcoinUtxoChanges();
+  BitcoinUtxoChanges(BitcoinUtxoChanges&&);
+  BitcoinUtxoChanges& operator=(BitcoinUtxoChanges&&);
+
+  bool empty() const {
+    return added_outputs.empty() && spent_outpoints.empty() &&
+           sync_states.empty();
+  }
+
+  std::vector<bitcoin::Output> added_outputs;
+  // Spent outpoints are kept even if their output is not known yet, since
+  // history is fetched newest first.
+  std::vector<bitcoin::Outpoint> spent_outpoints;
+  // <address, sync state>
+  std::map<std::string, BitcoinAddressSyncState> sync_states;
+};
+
+// SQLite backed storage of the unspent outputs, spent outpoints and address
+// sync state of every bitcoin network. All methods block and must be called
+// on the same sequence, see BitcoinTransactionDatabase for the in-memory
+// front end.
+class BitcoinUtxoStore {
+ public:
+  explicit BitcoinUtxoStore(const base::FilePath& db_file_path);
+  ~BitcoinUtxoStore();
+  BitcoinUtxoStore(const BitcoinUtxoStore&) = delete;
+  BitcoinUtxoStore& operator=(const BitcoinUtxoStore&) = delete;
+
+  bool Init();
+
+  // Everything stored for |network_id|, as changes to apply to an empty set.
+  BitcoinUtxoChanges Load(const std::string& network_id);
+  bool Apply(const std::string& network_id, BitcoinUtxoChanges changes);
+  bool DeleteAll();
+
+ private:
+  bool InitSchema();
+  bool CreateTables();
+
+  sql::Database database_;
+  sql::MetaTable meta_table_;
+  const base::FilePath db_file_path_;
+
+  SEQUENCE_CHECKER(sequence_checker_);
+};
+
+}  // namespace brave_wallet
+
+#endif  // BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_BITCOIN_BITCOIN_UTXO_STORE_H_
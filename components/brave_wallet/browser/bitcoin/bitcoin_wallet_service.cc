@@ -15,6 +15,7 @@
 #include "base/notreached.h"
 #include "base/ranges/algorithm.h"
 #include "base/sys_byteorder.h"
+#include "base/task/thread_pool.h"
 #include "base/types/expected.h"
 #include "brave/components/brave_wallet/browser/bitcoin/bitcoin_database_synchronizer.h"
 #include "brave/components/brave_wallet/browser/bitcoin/bitcoin_transaction_database.h"
@@ -31,6 +32,9 @@ namespace {
 constexpr uint32_t kTransactionsVersion = 2;
 constexpr uint32_t kSigHashAll = 1;
 
+constexpr base::FilePath::CharType kUtxoDatabaseFilename[] =
+    FILE_PATH_LITERAL("Brave Wallet Bitcoin UTXOs");
+
 std::vector<brave_wallet::mojom::KeyringId> BitcoinKeyringsForNetwork(
     const std::string& network_id) {
   DCHECK(brave_wallet::IsBitcoinNetwork(network_id));
@@ -156,20 +160,25 @@ struct SendToContext {
 
 BitcoinWalletService::BitcoinWalletService(
     KeyringService* keyring_service,
-    scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory)
+    scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory,
+    const base::FilePath& wallet_base_directory)
     : keyring_service_(keyring_service),
       bitcoin_rpc_(std::make_unique<BitcoinRpc>(url_loader_factory)) {
-  for (auto* network_id : {
-           // TODO(apaymyshev): support mainnet mojom::kBitcoinMainnet,
-           mojom::kBitcoinTestnet,
-       }) {
-    transaction_database_[network_id] =
-        std::make_unique<BitcoinTransactionDatabase>();
-    database_synchronizer_[network_id] =
-        std::make_unique<BitcoinDatabaseSynchronizer>(
-            network_id, bitcoin_rpc_.get(),
-            transaction_database_[network_id].get());
+  if (!wallet_base_directory.empty()) {
+    utxo_store_ = base::SequenceBound<BitcoinUtxoStore>(
+        base::ThreadPool::CreateSequencedTaskRunner(
+            {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
+             base::TaskShutdownBehavior::BLOCK_SHUTDOWN}),
+        wallet_base_directory.Append(kUtxoDatabaseFilename));
+    utxo_store_.AsyncCall(&BitcoinUtxoStore::Init);
+  }
+
+  keyring_service_->AddObserver(
+      keyring_observer_receiver_.BindNewPipeAndPassRemote());
 
+  CreateTransactionDatabases();
+
+  for (const auto& [network_id, database] : transaction_database_) {
     for (auto& keyring_id : BitcoinKeyringsForNetwork(network_id)) {
       DCHECK(IsValidBitcoinNetworkKeyringPair(network_id, keyring_id));
       // TODO(apaymyshev): support many accounts.
@@ -611,7 +620,6 @@ void BitcoinWalletService::StartDatabaseSynchronizer(
     mojom::KeyringId keyring_id,
     uint32_t account_index) {
   CHECK(IsValidBitcoinNetworkKeyringPair(network_id, keyring_id));
-  // TODO(apaymyshev): init address history from persistent storage.
 
   auto addresses =
       keyring_service_->GetBitcoinAddresses(keyring_id, account_index);
@@ -637,6 +645,34 @@ absl::optional<std::string> BitcoinWalletService::GetUnusedChangeAddress(
       keyring_id, mojom::BitcoinKeyId(account_index, 1, 0));
 }
 
+void BitcoinWalletService::CreateTransactionDatabases() {
+  for (auto* network_id : {
+           // TODO(apaymyshev): support mainnet mojom::kBitcoinMainnet,
+           mojom::kBitcoinTestnet,
+       }) {
+    transaction_database_[network_id] =
+        std::make_unique<BitcoinTransactionDatabase>(
+            network_id, utxo_store_.is_null() ? nullptr : &utxo_store_);
+    database_synchronizer_[network_id] =
+        std::make_unique<BitcoinDatabaseSynchronizer>(
+            network_id, bitcoin_rpc_.get(),
+            transaction_database_[network_id].get());
+  }
+}
+
+void BitcoinWalletService::KeyringReset() {
+  // Outputs of the addresses of the reset wallet have no matching keys, so
+  // they must never be picked as inputs again.
+  database_synchronizer_.clear();
+  transaction_database_.clear();
+  if (!utxo_store_.is_null()) {
+    // Runs before the new databases load, on the store's sequence.
+    utxo_store_.AsyncCall(&BitcoinUtxoStore::DeleteAll);
+  }
+
+  CreateTransactionDatabases();
+}
+
 void BitcoinWalletService::AccountsAdded(
     std::vector<mojom::AccountInfoPtr> accounts) {
   // TODO(apaymyshev): need keyring_id here.
@@ -13,15 +13,19 @@
 #include <utility>
 #include <vector>
 
+#include "base/files/file_path.h"
 #include "base/memory/weak_ptr.h"
+#include "base/threading/sequence_bound.h"
 #include "base/types/expected.h"
 #include "brave/components/api_request_helper/api_request_helper.h"
 #include "brave/components/brave_wallet/browser/bitcoin/bitcoin_rpc.h"
 #include "brave/components/brave_wallet/browser/bitcoin/bitcoin_transaction.h"
+#include "brave/components/brave_wallet/browser/bitcoin/bitcoin_utxo_store.h"
 #include "brave/components/brave_wallet/browser/keyring_service.h"
 #include "brave/components/brave_wallet/browser/keyring_service_observer_base.h"
 #include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
 #include "components/keyed_service/core/keyed_service.h"
+#include "mojo/public/cpp/bindings/receiver.h"
 #include "mojo/public/cpp/bindings/receiver_set.h"
 
 namespace brave_wallet {
@@ -33,9 +37,12 @@ class BitcoinWalletService : public KeyedService,
                              public mojom::BitcoinWalletService,
                              KeyringServiceObserverBase {
  public:
+  // Unspent outputs are kept in memory only if |wallet_base_directory| is
+  // empty.
   BitcoinWalletService(
       KeyringService* keyring_service,
-      scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory);
+      scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory,
+      const base::FilePath& wallet_base_directory);
   ~BitcoinWalletService() override;
 
   mojo::PendingRemote<mojom::BitcoinWalletService> MakeRemote();
@@ -62,8 +69,11 @@ class BitcoinWalletService : public KeyedService,
 
  private:
   // KeyringServiceObserverBase:
+  void KeyringReset() override;
   void AccountsAdded(std::vector<mojom::AccountInfoPtr> accounts) override;
 
+  void CreateTransactionDatabases();
+
   void StartDatabaseSynchronizer(const std::string& network_id,
                                  mojom::KeyringId keyring_id,
                                  uint32_t account_index);
@@ -88,12 +98,17 @@ class BitcoinWalletService : public KeyedService,
   void WorkOnSendTo(std::unique_ptr<SendToContext> context);
 
   raw_ptr<KeyringService> keyring_service_;
+  // Shared by the transaction databases of all networks, not bound if
+  // unspent outputs are kept in memory only.
+  base::SequenceBound<BitcoinUtxoStore> utxo_store_;
   std::map<std::string, std::unique_ptr<BitcoinTransactionDatabase>>
       transaction_database_;
   std::map<std::string, std::unique_ptr<BitcoinDatabaseSynchronizer>>
       database_synchronizer_;
   scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory_;
   mojo::ReceiverSet<mojom::BitcoinWalletService> receivers_;
+  mojo::Receiver<mojom::KeyringServiceObserver> keyring_observer_receiver_{
+      this};
   std::unique_ptr<BitcoinRpc> bitcoin_rpc_;
   base::WeakPtrFactory<BitcoinWalletService> weak_ptr_factory_{this};
 };
@@ -5,7 +5,10 @@
 
 #include "brave/components/brave_wallet/browser/block_tracker.h"
 
+#include <utility>
+
 #include "base/containers/contains.h"
+#include "base/functional/bind.h"
 #include "brave/components/brave_wallet/browser/json_rpc_service.h"
 
 namespace brave_wallet {
@@ -15,23 +18,51 @@ BlockTracker::BlockTracker(JsonRpcService* json_rpc_service)
   DCHECK(json_rpc_service_);
 }
 
-BlockTracker::~BlockTracker() = default;
+BlockTracker::~BlockTracker() {
+  Stop();
+}
 
 void BlockTracker::Stop(const std::string& chain_id) {
-  if (base::Contains(timers_, chain_id)) {
-    timers_.erase(chain_id);
+  auto iter = tasks_.find(chain_id);
+  if (iter == tasks_.end()) {
+    return;
   }
+  json_rpc_service_->polling_scheduler()->RemoveTask(iter->second);
+  tasks_.erase(iter);
 }
 
 void BlockTracker::Stop() {
-  timers_.clear();
+  for (const auto& [chain_id, task_id] : tasks_) {
+    json_rpc_service_->polling_scheduler()->RemoveTask(task_id);
+  }
+  tasks_.clear();
 }
 
 bool BlockTracker::IsRunning(const std::string& chain_id) const {
-  if (!base::Contains(timers_, chain_id)) {
+  if (!base::Contains(tasks_, chain_id)) {
     return false;
   }
-  return timers_.at(chain_id)->IsRunning();
+  return json_rpc_service_->polling_scheduler()->HasTask(tasks_.at(chain_id));
+}
+
+void BlockTracker::StartPolling(const std::string& chain_id,
+                                base::TimeDelta interval,
+                                base::RepeatingClosure poll) {
+  Stop(chain_id);
+  // Unretained is safe, the task is removed when this tracker is destroyed.
+  tasks_[chain_id] = json_rpc_service_->polling_scheduler()->AddTask(
+      interval, std::move(poll),
+      base::BindRepeating(&BlockTracker::HasObservers,
+                          base::Unretained(this)));
+}
+
+void BlockTracker::ReportPollResult(const std::string& chain_id,
+                                    bool new_block) {
+  auto iter = tasks_.find(chain_id);
+  if (iter != tasks_.end()) {
+    json_rpc_service_->polling_scheduler()->ReportProgress(iter->second,
+                                                           new_block);
+  }
 }
 
 }  // namespace brave_wallet
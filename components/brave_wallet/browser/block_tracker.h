@@ -7,12 +7,12 @@
 #define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_BLOCK_TRACKER_H_
 
 #include <map>
-#include <memory>
 #include <string>
 
+#include "base/functional/callback.h"
 #include "base/memory/raw_ptr.h"
 #include "base/time/time.h"
-#include "base/timer/timer.h"
+#include "brave/components/brave_wallet/browser/polling_scheduler.h"
 
 namespace brave_wallet {
 
@@ -29,8 +29,18 @@ class BlockTracker {
   bool IsRunning(const std::string& chain_id) const;
 
  protected:
-  // <chain_id, timer>
-  std::map<std::string, std::unique_ptr<base::RepeatingTimer>> timers_;
+  // Polls |chain_id| with |poll| from the PollingScheduler shared by all
+  // trackers of the profile, replacing any previous interval.
+  void StartPolling(const std::string& chain_id,
+                    base::TimeDelta interval,
+                    base::RepeatingClosure poll);
+  // Lets polling back off while the block height of |chain_id| is unchanged.
+  void ReportPollResult(const std::string& chain_id, bool new_block);
+  // Polls are skipped while nobody observes the tracker.
+  virtual bool HasObservers() const = 0;
+
+  // <chain_id, task id>
+  std::map<std::string, PollingScheduler::TaskId> tasks_;
   raw_ptr<JsonRpcService> json_rpc_service_ = nullptr;
 };
 
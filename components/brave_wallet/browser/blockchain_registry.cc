@@ -10,8 +10,7 @@
 
 #include "base/containers/flat_set.h"
 #include "base/no_destructor.h"
-#include "base/ranges/algorithm.h"
-#include "base/strings/stringprintf.h"
+#include "base/strings/string_util.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_constants.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_utils.h"
 #include "brave/components/brave_wallet/common/brave_wallet.mojom-shared.h"
@@ -19,6 +18,63 @@
 
 namespace brave_wallet {
 
+namespace {
+
+// <chain id, tokens of a static on/off-ramp token list on that chain>
+using TokensByChainId =
+    base::flat_map<std::string, std::vector<const mojom::BlockchainToken*>>;
+
+TokensByChainId IndexTokensByChainId(
+    const std::vector<mojom::BlockchainToken>& tokens) {
+  TokensByChainId result;
+  for (const auto& token : tokens) {
+    result[token.chain_id].push_back(&token);
+  }
+  return result;
+}
+
+const TokensByChainId* GetBuyTokensByChainId(mojom::OnRampProvider provider) {
+  if (provider == mojom::OnRampProvider::kRamp) {
+    static const base::NoDestructor<TokensByChainId> ramp_tokens(
+        IndexTokensByChainId(GetRampBuyTokens()));
+    return ramp_tokens.get();
+  } else if (provider == mojom::OnRampProvider::kSardine) {
+    static const base::NoDestructor<TokensByChainId> sardine_tokens(
+        IndexTokensByChainId(GetSardineBuyTokens()));
+    return sardine_tokens.get();
+  } else if (provider == mojom::OnRampProvider::kTransak) {
+    static const base::NoDestructor<TokensByChainId> transak_tokens(
+        IndexTokensByChainId(GetTransakBuyTokens()));
+    return transak_tokens.get();
+  }
+  return nullptr;
+}
+
+const TokensByChainId* GetSellTokensByChainId(
+    mojom::OffRampProvider provider) {
+  if (provider == mojom::OffRampProvider::kRamp) {
+    static const base::NoDestructor<TokensByChainId> ramp_tokens(
+        IndexTokensByChainId(GetRampSellTokens()));
+    return ramp_tokens.get();
+  }
+  return nullptr;
+}
+
+std::string NormalizeContractAddress(mojom::CoinType coin,
+                                     const std::string& address) {
+  // Ethereum addresses may or may not be checksummed, other chains use case
+  // sensitive encodings.
+  return coin == mojom::CoinType::ETH ? base::ToLowerASCII(address) : address;
+}
+
+}  // namespace
+
+BlockchainRegistry::TokenListIndex::TokenListIndex() = default;
+BlockchainRegistry::TokenListIndex::~TokenListIndex() = default;
+BlockchainRegistry::TokenListIndex::TokenListIndex(TokenListIndex&&) = default;
+BlockchainRegistry::TokenListIndex&
+BlockchainRegistry::TokenListIndex::operator=(TokenListIndex&&) = default;
+
 BlockchainRegistry::BlockchainRegistry() = default;
 BlockchainRegistry::~BlockchainRegistry() = default;
 
@@ -41,12 +97,31 @@ void BlockchainRegistry::Bind(
 
 void BlockchainRegistry::UpdateTokenList(TokenListMap token_list_map) {
   token_list_map_ = std::move(token_list_map);
+  token_list_indexes_.clear();
+  for (const auto& [key, list] : token_list_map_) {
+    BuildTokenListIndex(key);
+  }
 }
 
 void BlockchainRegistry::UpdateTokenList(
     const std::string key,
     std::vector<mojom::BlockchainTokenPtr> list) {
   token_list_map_[key] = std::move(list);
+  BuildTokenListIndex(key);
+}
+
+void BlockchainRegistry::BuildTokenListIndex(const std::string& key) {
+  const auto& tokens = token_list_map_[key];
+  TokenListIndex index;
+  index.by_address.reserve(tokens.size());
+  index.by_symbol.reserve(tokens.size());
+  for (size_t i = 0; i < tokens.size(); ++i) {
+    index.by_address.emplace(
+        NormalizeContractAddress(tokens[i]->coin, tokens[i]->contract_address),
+        i);
+    index.by_symbol.emplace(tokens[i]->symbol, i);
+  }
+  token_list_indexes_[key] = std::move(index);
 }
 
 void BlockchainRegistry::UpdateChainList(ChainList chains) {
@@ -68,51 +143,70 @@ mojom::BlockchainTokenPtr BlockchainRegistry::GetTokenByAddress(
     const std::string& chain_id,
     mojom::CoinType coin,
     const std::string& address) {
+  const auto* token = FindTokenByAddress(chain_id, coin, address);
+  return token ? token->Clone() : nullptr;
+}
+
+const mojom::BlockchainToken* BlockchainRegistry::FindTokenByAddress(
+    const std::string& chain_id,
+    mojom::CoinType coin,
+    const std::string& address) const {
   const auto key = GetTokenListKey(coin, chain_id);
-  if (!token_list_map_.contains(key)) {
+  auto index_it = token_list_indexes_.find(key);
+  if (index_it == token_list_indexes_.end()) {
     return nullptr;
   }
 
-  const auto& tokens = token_list_map_[key];
-  auto token_it = base::ranges::find_if(
-      tokens, [&](const mojom::BlockchainTokenPtr& current_token) {
-        return current_token->contract_address == address;
-      });
-  return token_it == tokens.end() ? nullptr : token_it->Clone();
+  const auto& by_address = index_it->second.by_address;
+  auto it = by_address.find(NormalizeContractAddress(coin, address));
+  if (it == by_address.end()) {
+    return nullptr;
+  }
+  return token_list_map_.at(key)[it->second].get();
 }
 
-void BlockchainRegistry::GetTokenBySymbol(const std::string& chain_id,
-                                          mojom::CoinType coin,
-                                          const std::string& symbol,
-                                          GetTokenBySymbolCallback callback) {
+const mojom::BlockchainToken* BlockchainRegistry::FindTokenBySymbol(
+    const std::string& chain_id,
+    mojom::CoinType coin,
+    const std::string& symbol) const {
   const auto key = GetTokenListKey(coin, chain_id);
-  if (!token_list_map_.contains(key)) {
-    std::move(callback).Run(nullptr);
-    return;
+  auto index_it = token_list_indexes_.find(key);
+  if (index_it == token_list_indexes_.end()) {
+    return nullptr;
   }
-  const auto& tokens = token_list_map_[key];
-  auto token_it = base::ranges::find_if(
-      tokens, [&](const mojom::BlockchainTokenPtr& current_token) {
-        return current_token->symbol == symbol;
-      });
 
-  if (token_it == tokens.end()) {
-    std::move(callback).Run(nullptr);
-    return;
+  const auto& by_symbol = index_it->second.by_symbol;
+  auto it = by_symbol.find(symbol);
+  if (it == by_symbol.end()) {
+    return nullptr;
   }
+  return token_list_map_.at(key)[it->second].get();
+}
 
-  std::move(callback).Run(token_it->Clone());
+const std::vector<mojom::BlockchainTokenPtr>* BlockchainRegistry::GetTokenList(
+    const std::string& chain_id,
+    mojom::CoinType coin) const {
+  auto it = token_list_map_.find(GetTokenListKey(coin, chain_id));
+  return it == token_list_map_.end() ? nullptr : &it->second;
+}
+
+void BlockchainRegistry::GetTokenBySymbol(const std::string& chain_id,
+                                          mojom::CoinType coin,
+                                          const std::string& symbol,
+                                          GetTokenBySymbolCallback callback) {
+  const auto* token = FindTokenBySymbol(chain_id, coin, symbol);
+  std::move(callback).Run(token ? token->Clone() : nullptr);
 }
 
 void BlockchainRegistry::GetAllTokens(const std::string& chain_id,
                                       mojom::CoinType coin,
                                       GetAllTokensCallback callback) {
-  const auto key = GetTokenListKey(coin, chain_id);
-  if (!token_list_map_.contains(key)) {
+  const auto* token_list = GetTokenList(chain_id, coin);
+  if (!token_list) {
     std::move(callback).Run(std::vector<mojom::BlockchainTokenPtr>());
     return;
   }
-  const auto& tokens = token_list_map_[key];
+  const auto& tokens = *token_list;
   std::vector<mojom::BlockchainTokenPtr> tokens_copy(tokens.size());
   std::transform(
       tokens.begin(), tokens.end(), tokens_copy.begin(),
@@ -129,21 +223,17 @@ std::vector<mojom::BlockchainTokenPtr> BlockchainRegistry::GetBuyTokens(
                                                      providers.end());
 
   for (const auto& provider : provider_set) {
-    const std::vector<mojom::BlockchainToken>* buy_tokens = nullptr;
-    if (provider == mojom::OnRampProvider::kRamp) {
-      buy_tokens = &GetRampBuyTokens();
-    } else if (provider == mojom::OnRampProvider::kSardine) {
-      buy_tokens = &GetSardineBuyTokens();
-    } else if (provider == mojom::OnRampProvider::kTransak) {
-      buy_tokens = &GetTransakBuyTokens();
-    } else {
+    const auto* buy_tokens = GetBuyTokensByChainId(provider);
+    if (!buy_tokens) {
       continue;
     }
 
-    for (const auto& token : *buy_tokens) {
-      if (token.chain_id == chain_id) {
-        blockchain_buy_tokens.push_back(mojom::BlockchainToken::New(token));
-      }
+    auto it = buy_tokens->find(chain_id);
+    if (it == buy_tokens->end()) {
+      continue;
+    }
+    for (const auto* token : it->second) {
+      blockchain_buy_tokens.push_back(token->Clone());
     }
   }
 
@@ -155,14 +245,14 @@ TokenListMap BlockchainRegistry::GetEthTokenListMap(
   // Create a copy of token_list_map with only the chain_ids we want
   TokenListMap token_list_map_copy;
   for (const auto& chain_id : chain_ids) {
-    const auto key = GetTokenListKey(mojom::CoinType::ETH, chain_id);
     // Skip if the key is not in the map.
-    if (!token_list_map_.contains(key)) {
+    const auto* token_list = GetTokenList(chain_id, mojom::CoinType::ETH);
+    if (!token_list) {
       continue;
     }
 
     // Otherwise, clone the vector of tokens.
-    const auto& tokens = token_list_map_[key];
+    const auto& tokens = *token_list;
     std::vector<brave_wallet::mojom::BlockchainTokenPtr> tokens_copy(
         tokens.size());
     std::transform(
@@ -194,22 +284,17 @@ void BlockchainRegistry::GetSellTokens(mojom::OffRampProvider provider,
                                        const std::string& chain_id,
                                        GetSellTokensCallback callback) {
   std::vector<mojom::BlockchainTokenPtr> blockchain_sell_tokens;
-  const std::vector<mojom::BlockchainToken>* sell_tokens = nullptr;
-  if (provider == mojom::OffRampProvider::kRamp) {
-    sell_tokens = &GetRampSellTokens();
-  }
-
+  const auto* sell_tokens = GetSellTokensByChainId(provider);
   if (sell_tokens == nullptr) {
     std::move(callback).Run(std::move(blockchain_sell_tokens));
     return;
   }
 
-  for (const auto& token : *sell_tokens) {
-    if (token.chain_id != chain_id) {
-      continue;
+  auto it = sell_tokens->find(chain_id);
+  if (it != sell_tokens->end()) {
+    for (const auto* token : it->second) {
+      blockchain_sell_tokens.push_back(token->Clone());
     }
-
-    blockchain_sell_tokens.push_back(mojom::BlockchainToken::New(token));
   }
   std::move(callback).Run(std::move(blockchain_sell_tokens));
 }
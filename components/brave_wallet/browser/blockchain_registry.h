@@ -7,6 +7,7 @@
 #define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_BLOCKCHAIN_REGISTRY_H_
 
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "brave/components/brave_wallet/browser/blockchain_list_parser.h"
@@ -42,6 +43,21 @@ class BlockchainRegistry : public mojom::BlockchainRegistry {
   mojom::BlockchainTokenPtr GetTokenByAddress(const std::string& chain_id,
                                               mojom::CoinType coin,
                                               const std::string& address);
+
+  // Lookups without copies for internal callers. Returned pointers are owned
+  // by the registry and only valid until the token list is next updated.
+  // Ethereum contract addresses are matched case-insensitively.
+  const mojom::BlockchainToken* FindTokenByAddress(
+      const std::string& chain_id,
+      mojom::CoinType coin,
+      const std::string& address) const;
+  const mojom::BlockchainToken* FindTokenBySymbol(
+      const std::string& chain_id,
+      mojom::CoinType coin,
+      const std::string& symbol) const;
+  const std::vector<mojom::BlockchainTokenPtr>* GetTokenList(
+      const std::string& chain_id,
+      mojom::CoinType coin) const;
   std::vector<mojom::NetworkInfoPtr> GetPrepopulatedNetworks();
 
   // BlockchainRegistry interface methods
@@ -76,10 +92,25 @@ class BlockchainRegistry : public mojom::BlockchainRegistry {
                    GetTopDappsCallback callback) override;
 
  protected:
-  std::vector<mojom::BlockchainTokenPtr>* GetTokenListFromChainId(
-      const std::string& chain_id);
+  // Positions of the tokens of one token list, the first token wins when
+  // several share a key.
+  struct TokenListIndex {
+    TokenListIndex();
+    ~TokenListIndex();
+    TokenListIndex(TokenListIndex&&);
+    TokenListIndex& operator=(TokenListIndex&&);
+
+    // <normalized contract address, index in the token list>
+    std::unordered_map<std::string, size_t> by_address;
+    // <symbol, index in the token list>
+    std::unordered_map<std::string, size_t> by_symbol;
+  };
+
+  void BuildTokenListIndex(const std::string& key);
 
   TokenListMap token_list_map_;
+  // Keyed like |token_list_map_|, rebuilt whenever it is updated.
+  base::flat_map<std::string, TokenListIndex> token_list_indexes_;
   ChainList chain_list_;
   DappListMap dapp_lists_;
   friend base::NoDestructor<BlockchainRegistry>;
@@ -4,9 +4,12 @@
  * You can obtain one at https://mozilla.org/MPL/2.0/. */
 
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
+#include "base/strings/string_util.h"
+#include "base/strings/stringprintf.h"
 #include "base/test/bind.h"
 #include "base/test/task_environment.h"
 #include "brave/components/brave_wallet/browser/blockchain_list_parser.h"
@@ -736,4 +739,98 @@ TEST(BlockchainRegistryUnitTest, GetEthTokenListMap) {
   }
 }
 
+TEST(BlockchainRegistryUnitTest, FindToken) {
+  base::test::TaskEnvironment task_environment;
+  auto* registry = BlockchainRegistry::GetInstance();
+  TokenListMap token_list_map;
+  ASSERT_TRUE(
+      ParseTokenList(token_list_json, &token_list_map, mojom::CoinType::ETH));
+  ASSERT_TRUE(ParseTokenList(solana_token_list_json, &token_list_map,
+                             mojom::CoinType::SOL));
+  registry->UpdateTokenList(std::move(token_list_map));
+
+  // Ethereum addresses are matched whatever their case.
+  for (const auto* address : {"0x0D8775F648430679A709E98d2b0Cb6250d2887EF",
+                              "0x0d8775f648430679a709e98d2b0cb6250d2887ef"}) {
+    const auto* token = registry->FindTokenByAddress(
+        mojom::kMainnetChainId, mojom::CoinType::ETH, address);
+    ASSERT_TRUE(token);
+    EXPECT_EQ(token->symbol, "BAT");
+    EXPECT_EQ(token->contract_address,
+              "0x0D8775F648430679A709E98d2b0Cb6250d2887EF");
+  }
+
+  // Solana addresses are case sensitive.
+  EXPECT_TRUE(registry->FindTokenByAddress(
+      mojom::kSolanaMainnet, mojom::CoinType::SOL,
+      "EPjFWdd5AufqSSqeM2qN1xzybapC8G4wEGGkZwyTDt1v"));
+  EXPECT_FALSE(registry->FindTokenByAddress(
+      mojom::kSolanaMainnet, mojom::CoinType::SOL,
+      "epjfwdd5aufqssqem2qn1xzybapc8g4wegkzwytdt1v"));
+
+  const auto* token = registry->FindTokenBySymbol(
+      mojom::kGoerliChainId, mojom::CoinType::ETH, "UNI");
+  ASSERT_TRUE(token);
+  EXPECT_EQ(token->contract_address,
+            "0x1f9840a85d5aF5bf1D1762F925BDADdC4201F984");
+  EXPECT_FALSE(registry->FindTokenBySymbol(mojom::kGoerliChainId,
+                                           mojom::CoinType::ETH, "BAT"));
+
+  const auto* tokens =
+      registry->GetTokenList(mojom::kMainnetChainId, mojom::CoinType::ETH);
+  ASSERT_TRUE(tokens);
+  EXPECT_EQ(tokens->size(), 2u);
+  EXPECT_FALSE(
+      registry->GetTokenList(mojom::kPolygonMainnetChainId,
+                             mojom::CoinType::ETH));
+
+  // Updating a single list reindexes it.
+  std::vector<mojom::BlockchainTokenPtr> list;
+  list.push_back(mojom::BlockchainToken::New(*token));
+  list.back()->symbol = "NEWUNI";
+  registry->UpdateTokenList(
+      GetTokenListKey(mojom::CoinType::ETH, mojom::kGoerliChainId),
+      std::move(list));
+  EXPECT_FALSE(registry->FindTokenBySymbol(mojom::kGoerliChainId,
+                                           mojom::CoinType::ETH, "UNI"));
+  EXPECT_TRUE(registry->FindTokenBySymbol(mojom::kGoerliChainId,
+                                          mojom::CoinType::ETH, "NEWUNI"));
+}
+
+TEST(BlockchainRegistryUnitTest, FindTokenInGeneratedList) {
+  constexpr size_t kTokenCount = 100;
+
+  base::test::TaskEnvironment task_environment;
+  auto* registry = BlockchainRegistry::GetInstance();
+
+  std::vector<std::string> addresses;
+  std::vector<mojom::BlockchainTokenPtr> list;
+  for (size_t i = 0; i < kTokenCount; ++i) {
+    addresses.push_back(base::StringPrintf("0x%040zX", i));
+    list.push_back(mojom::BlockchainToken::New(
+        addresses.back(), base::StringPrintf("Token %zu", i), "", true, false,
+        false, false, base::StringPrintf("TKN%zu", i), 18, true, "", "",
+        mojom::kMainnetChainId, mojom::CoinType::ETH));
+  }
+
+  TokenListMap token_list_map;
+  token_list_map[GetTokenListKey(mojom::CoinType::ETH,
+                                 mojom::kMainnetChainId)] = std::move(list);
+  registry->UpdateTokenList(std::move(token_list_map));
+
+  for (size_t i = 0; i < kTokenCount; ++i) {
+    const auto* token = registry->FindTokenByAddress(
+        mojom::kMainnetChainId, mojom::CoinType::ETH,
+        base::ToLowerASCII(addresses[i]));
+    ASSERT_TRUE(token);
+    EXPECT_EQ(token->contract_address, addresses[i]);
+
+    token = registry->FindTokenBySymbol(mojom::kMainnetChainId,
+                                        mojom::CoinType::ETH,
+                                        base::StringPrintf("TKN%zu", i));
+    ASSERT_TRUE(token);
+    EXPECT_EQ(token->contract_address, addresses[i]);
+  }
+}
+
 }  // namespace brave_wallet
@@ -111,6 +111,8 @@ void RegisterProfilePrefs(user_prefs::PrefRegistrySyncable* registry) {
       kBraveWalletSelectedCoin,
       static_cast<int>(brave_wallet::mojom::CoinType::ETH));
   registry->RegisterDictionaryPref(kBraveWalletTransactions);
+  registry->RegisterBooleanPref(kBraveWalletTransactionsFromPrefsToDBMigrated,
+                                false);
   registry->RegisterDictionaryPref(kBraveWalletP3AActiveWalletDict);
   registry->RegisterDictionaryPref(kBraveWalletKeyrings);
   registry->RegisterBooleanPref(kBraveWalletKeyringEncryptionKeysMigrated,
@@ -372,62 +372,78 @@ std::vector<mojom::BlockchainTokenPtr> BraveWalletService::GetUserAssets(
 // static
 bool BraveWalletService::AddUserAsset(mojom::BlockchainTokenPtr token,
                                       PrefService* profile_prefs) {
-  absl::optional<std::string> address = GetUserAssetAddress(
-      token->contract_address, token->coin, token->chain_id);
-  if (!address) {
-    return false;
-  }
+  std::vector<mojom::BlockchainTokenPtr> tokens;
+  tokens.push_back(std::move(token));
+  return !AddUserAssets(std::move(tokens), profile_prefs).empty();
+}
 
-  const std::string network_id =
-      GetNetworkId(profile_prefs, token->coin, token->chain_id);
-  if (network_id.empty()) {
-    return false;
-  }
+// static
+std::vector<mojom::BlockchainTokenPtr> BraveWalletService::AddUserAssets(
+    std::vector<mojom::BlockchainTokenPtr> tokens,
+    PrefService* profile_prefs) {
+  std::vector<mojom::BlockchainTokenPtr> added_tokens;
 
-  bool check_token_id = ShouldCheckTokenId(token);
-  if (check_token_id) {
-    uint256_t token_id_uint = 0;
-    if (!HexValueToUint256(token->token_id, &token_id_uint)) {
-      return false;
+  // Observers are only notified once, when |update| goes out of scope, and
+  // not at all if no token was valid.
+  ScopedDictPrefUpdate update(profile_prefs, kBraveWalletUserAssets);
+  for (auto& token : tokens) {
+    absl::optional<std::string> address = GetUserAssetAddress(
+        token->contract_address, token->coin, token->chain_id);
+    if (!address) {
+      continue;
     }
-  }
 
-  ScopedDictPrefUpdate update(profile_prefs, kBraveWalletUserAssets);
-  base::Value::Dict& user_assets_pref = update.Get();
+    const std::string network_id =
+        GetNetworkId(profile_prefs, token->coin, token->chain_id);
+    if (network_id.empty()) {
+      continue;
+    }
 
-  const auto path =
-      base::StrCat({GetPrefKeyForCoinType(token->coin), ".", network_id});
-  auto* user_assets_list = user_assets_pref.FindListByDottedPath(path);
-  if (!user_assets_list) {
-    user_assets_list =
-        user_assets_pref.SetByDottedPath(path, base::Value::List())
-            ->GetIfList();
-  }
-  DCHECK(user_assets_list);
+    bool check_token_id = ShouldCheckTokenId(token);
+    if (check_token_id) {
+      uint256_t token_id_uint = 0;
+      if (!HexValueToUint256(token->token_id, &token_id_uint)) {
+        continue;
+      }
+    }
 
-  auto it =
-      FindAsset(user_assets_list, *address, token->token_id, check_token_id);
-  if (it != user_assets_list->end()) {
-    return false;
-  }
+    base::Value::Dict& user_assets_pref = update.Get();
 
-  base::Value::Dict value;
-  value.Set("address", *address);
-  value.Set("name", token->name);
-  value.Set("symbol", token->symbol);
-  value.Set("logo", token->logo);
-  value.Set("is_erc20", token->is_erc20);
-  value.Set("is_erc721", token->is_erc721);
-  value.Set("is_erc1155", token->is_erc1155);
-  value.Set("is_nft", token->is_nft);
-  value.Set("decimals", token->decimals);
-  value.Set("visible", true);
-  value.Set("token_id", token->token_id);
-  value.Set("coingecko_id", token->coingecko_id);
+    const auto path =
+        base::StrCat({GetPrefKeyForCoinType(token->coin), ".", network_id});
+    auto* user_assets_list = user_assets_pref.FindListByDottedPath(path);
+    if (!user_assets_list) {
+      user_assets_list =
+          user_assets_pref.SetByDottedPath(path, base::Value::List())
+              ->GetIfList();
+    }
+    DCHECK(user_assets_list);
 
-  user_assets_list->Append(std::move(value));
+    auto it =
+        FindAsset(user_assets_list, *address, token->token_id, check_token_id);
+    if (it != user_assets_list->end()) {
+      continue;
+    }
 
-  return true;
+    base::Value::Dict value;
+    value.Set("address", *address);
+    value.Set("name", token->name);
+    value.Set("symbol", token->symbol);
+    value.Set("logo", token->logo);
+    value.Set("is_erc20", token->is_erc20);
+    value.Set("is_erc721", token->is_erc721);
+    value.Set("is_erc1155", token->is_erc1155);
+    value.Set("is_nft", token->is_nft);
+    value.Set("decimals", token->decimals);
+    value.Set("visible", true);
+    value.Set("token_id", token->token_id);
+    value.Set("coingecko_id", token->coingecko_id);
+
+    user_assets_list->Append(std::move(value));
+    added_tokens.push_back(std::move(token));
+  }
+
+  return added_tokens;
 }
 
 void BraveWalletService::GetUserAssets(const std::string& chain_id,
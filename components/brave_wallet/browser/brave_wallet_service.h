@@ -92,6 +92,11 @@ class BraveWalletService : public KeyedService,
 
   static bool AddUserAsset(mojom::BlockchainTokenPtr token,
                            PrefService* profile_prefs);
+  // Adds all of |tokens| in a single pref update and returns the ones that
+  // were not already user assets.
+  static std::vector<mojom::BlockchainTokenPtr> AddUserAssets(
+      std::vector<mojom::BlockchainTokenPtr> tokens,
+      PrefService* profile_prefs);
   static std::vector<mojom::BlockchainTokenPtr> GetUserAssets(
       const std::string& chain_id,
       mojom::CoinType coin,
@@ -5,12 +5,12 @@
 
 #include "brave/components/brave_wallet/browser/eth_abi_decoder.h"
 
-#include <limits>
-#include <map>
-#include <tuple>
+#include <utility>
 
+#include "base/check_op.h"
+#include "base/notreached.h"
+#include "base/ranges/algorithm.h"
 #include "base/strings/strcat.h"
-#include "base/strings/string_number_conversions.h"
 #include "base/strings/string_util.h"
 #include "brave/components/brave_wallet/common/hex_utils.h"
 
@@ -31,165 +31,214 @@
 // Function selector (first 4 bytes) should NOT be part of the calldata being
 // parsed.
 //
+// Arguments are decoded in place into ABIValue views over the calldata, and
+// only validated against their type. Formatting them as strings is left to
+// the callers which need it.
+//
 // References:
 //   https://docs.soliditylang.org/en/latest/abi-spec.html
 
 namespace brave_wallet {
 
 namespace {
-// GetArgFromData extracts a 32-byte wide hex string from the calldata at the
-// specified offset. The parsed value is NOT prefixed by "0x".
-absl::optional<std::string> GetArgFromData(const std::vector<uint8_t>& input,
-                                           size_t offset) {
-  if (offset > input.size() || input.size() - offset < 32) {
-    return absl::nullopt;
-  }
 
-  return HexEncodeLower(input.data() + offset, 32);
-}
+constexpr size_t kWordSize = 32;
+constexpr size_t kAddressSize = 20;
 
-// GetAddressFromData extracts an Ethereum address from the calldata at the
-// specified index. The address type is static and 32-bytes wide, but we
-// only consider the last 20 bytes, discarding the leading 12 bytes of
-// 0-padded chars.
-//
-// In the future, addresses in Ethereum may become 32 bytes long:
-// https://ethereum-magicians.org/t/increasing-address-size-from-20-to-32-bytes
-//
-// The parsed address value is prefixed by "0x".
-absl::optional<std::string> GetAddressFromData(
-    const std::vector<uint8_t>& input,
+// GetWordFromData returns the 32-byte word of the calldata at the specified
+// offset.
+absl::optional<base::span<const uint8_t>> GetWordFromData(
+    base::span<const uint8_t> input,
     size_t offset) {
-  if (offset > input.size() || input.size() - offset < 32) {
+  if (offset > input.size() || input.size() - offset < kWordSize) {
     return absl::nullopt;
   }
 
-  return "0x" + HexEncodeLower(input.data() + offset + 12, 20);
+  return input.subspan(offset, kWordSize);
 }
 
-// GetUintFromData extracts a 32-byte wide integral value of type M from the
-// calldata bytes at the specified offset.
-//
-// Using this function to extract an integer outside the range of M is
-// considered an error.
-template <typename M>
-absl::optional<M> GetUintFromData(const std::vector<uint8_t>& input,
-                                  size_t offset) {
-  static_assert(std::is_integral<M>::value, "M must be an integer type");
+// Whether the big endian integer in |word| fits in |size| bytes.
+bool WordFitsInBytes(base::span<const uint8_t> word, size_t size) {
+  DCHECK_EQ(word.size(), kWordSize);
+  DCHECK_LE(size, kWordSize);
+  return base::ranges::all_of(word.first(kWordSize - size),
+                              [](uint8_t byte) { return byte == 0; });
+}
 
-  auto arg = GetArgFromData(input, offset);
-  if (!arg) {
-    return absl::nullopt;
+uint256_t WordToUint256(base::span<const uint8_t> word) {
+  uint256_t value = 0;
+  for (uint8_t byte : word) {
+    value = (value << 8) | byte;
   }
+  return value;
+}
 
-  uint256_t value;
-  if (!HexValueToUint256("0x" + *arg, &value)) {
+// GetSizeFromData extracts a 32-byte wide length or calldata reference from
+// the calldata at the specified offset. Values which do not fit in size_t are
+// considered an error.
+absl::optional<size_t> GetSizeFromData(base::span<const uint8_t> input,
+                                       size_t offset) {
+  auto word = GetWordFromData(input, offset);
+  if (!word || !WordFitsInBytes(*word, sizeof(size_t))) {
     return absl::nullopt;
   }
 
-  // To prevent runtime errors, we make sure the value is within safe
-  // limits of M.
-  if (value > std::numeric_limits<M>::max()) {
+  return static_cast<size_t>(WordToUint256(*word));
+}
+
+// GetAddressFromData extracts an Ethereum address from the calldata at the
+// specified index. The address type is static and 32-bytes wide, but we
+// only consider the last 20 bytes, discarding the leading 12 bytes of
+// 0-padded chars.
+//
+// In the future, addresses in Ethereum may become 32 bytes long:
+// https://ethereum-magicians.org/t/increasing-address-size-from-20-to-32-bytes
+absl::optional<ABIValue> GetAddressFromData(base::span<const uint8_t> input,
+                                            size_t offset) {
+  auto word = GetWordFromData(input, offset);
+  if (!word) {
     return absl::nullopt;
   }
 
-  return static_cast<M>(value);
+  return ABIValue(ABIValue::Kind::kAddress, word->last(kAddressSize));
 }
 
-// GetUintHexFromData encodes the return value of GetUintFromData as a compact
-// hex string (without leading 0s), and prefixed by "0x".
-template <typename M>
-absl::optional<std::string> GetUintHexFromData(
-    const std::vector<uint8_t>& input,
-    size_t offset) {
-  auto value = GetUintFromData<M>(input, offset);
-  if (!value) {
+// GetUintFromData extracts a 32-byte wide unsigned integer of |size| bytes
+// from the calldata at the specified offset. Values outside of that range are
+// considered an error.
+absl::optional<ABIValue> GetUintFromData(base::span<const uint8_t> input,
+                                         size_t offset,
+                                         size_t size) {
+  auto word = GetWordFromData(input, offset);
+  if (!word || !WordFitsInBytes(*word, size)) {
     return absl::nullopt;
   }
 
-  return Uint256ValueToHex(*value);
+  return ABIValue(ABIValue::Kind::kUint, *word);
 }
 
 // GetBoolFromData extracts a 32-byte wide boolean value from the
-// calldata at the specified offset.
-//
-// The parsed bool value is serialized as "true" or "false" strings.
-absl::optional<std::string> GetBoolFromData(const std::vector<uint8_t>& input,
-                                            size_t offset) {
-  auto value = GetUintFromData<uint8_t>(input, offset);
-  if (!value) {
+// calldata at the specified offset, which must be 0 or 1.
+absl::optional<ABIValue> GetBoolFromData(base::span<const uint8_t> input,
+                                         size_t offset) {
+  auto word = GetWordFromData(input, offset);
+  if (!word || !WordFitsInBytes(*word, 1) || word->back() > 1) {
     return absl::nullopt;
   }
 
-  if (value == static_cast<uint8_t>(0)) {
-    return "false";
-  } else if (value == static_cast<uint8_t>(1)) {
-    return "true";
-  }
-
-  return absl::nullopt;
+  return ABIValue(ABIValue::Kind::kBool, *word);
 }
 
-// GetBytesHexFromData extracts a bytes value from the calldata at the
+// GetBytesFromData extracts a bytes value from the calldata at the
 // specified offset using head-tail encoding mechanism. bytes are packed
 // tightly in chunks of 32 bytes, with the first 32 bytes encoding the length,
 // followed by the actual content.
-//
-// The parsed bytearray is serialized as a hex string prefixed by "0x".
-absl::optional<std::string> GetBytesHexFromData(
-    const std::vector<uint8_t>& input,
-    size_t offset) {
-  auto pointer = GetUintFromData<size_t>(input, offset);
+absl::optional<ABIValue> GetBytesFromData(base::span<const uint8_t> input,
+                                          size_t offset) {
+  auto pointer = GetSizeFromData(input, offset);
   if (!pointer) {
     return absl::nullopt;
   }
 
-  auto bytes_len = GetUintFromData<size_t>(input, *pointer);
+  auto bytes_len = GetSizeFromData(input, *pointer);
   if (!bytes_len) {
     return absl::nullopt;
   }
 
-  if (input.size() < static_cast<uint256_t>(*pointer) + 32 + *bytes_len) {
+  // |pointer| is followed by at least one word, this can't overflow.
+  const size_t bytes_offset = *pointer + kWordSize;
+  if (input.size() - bytes_offset < *bytes_len) {
     return absl::nullopt;
   }
-  return "0x" + HexEncodeLower(input.data() + *pointer + 32, *bytes_len);
+
+  return ABIValue(ABIValue::Kind::kBytes,
+                  input.subspan(bytes_offset, *bytes_len));
 }
 
 // GetAddressArrayFromData parses a calldata sequence to extract a dynamic
 // array of addresses at the specified offset using head-tail encoding
 // mechanism. The encoding is similar to bytes, with the first 32 bytes
 // representing the number of elements in the array, followed by each element.
-//
-// The parsed data is joined together into a hex string prefixed by "0x".
-absl::optional<std::string> GetAddressArrayFromData(
-    const std::vector<uint8_t>& input,
+absl::optional<ABIValue> GetAddressArrayFromData(
+    base::span<const uint8_t> input,
     size_t offset) {
-  auto pointer = GetUintFromData<size_t>(input, offset);
+  auto pointer = GetSizeFromData(input, offset);
   if (!pointer) {
     return absl::nullopt;
   }
 
-  auto array_len = GetUintFromData<size_t>(input, *pointer);
+  auto array_len = GetSizeFromData(input, *pointer);
   if (!array_len) {
     return absl::nullopt;
   }
 
-  size_t array_offset = *pointer + 32;
-  std::string arg = "0x";
-  for (size_t i = 0; i < *array_len; i++) {
-    auto value = GetAddressFromData(input, array_offset);
-    if (!value) {
-      return absl::nullopt;
-    }
-    base::StrAppend(&arg, {value->substr(2)});
-    array_offset += 32;
+  const size_t array_offset = *pointer + kWordSize;
+  if ((input.size() - array_offset) / kWordSize < *array_len) {
+    return absl::nullopt;
   }
 
-  return arg;
+  return ABIValue(ABIValue::Kind::kAddressArray,
+                  input.subspan(array_offset, *array_len * kWordSize));
+}
+
+// Size in bytes of the unsigned integer types of M bits, where 0 < M <= 256
+// and M % 8 == 0, which are handled.
+absl::optional<size_t> GetUintTypeSize(const std::string& type) {
+  static constexpr std::pair<const char*, size_t> kUintTypes[] = {
+      {"uint8", 1},   {"uint16", 2},   {"uint32", 4},
+      {"uint64", 8},  {"uint128", 16}, {"uint256", 32}};
+  for (const auto& [name, size] : kUintTypes) {
+    if (type == name) {
+      return size;
+    }
+  }
+  return absl::nullopt;
 }
 
 }  // namespace
 
+ABIValue::ABIValue(Kind kind, base::span<const uint8_t> bytes)
+    : kind_(kind), bytes_(bytes) {}
+
+uint256_t ABIValue::GetUint() const {
+  DCHECK(kind_ == Kind::kUint || kind_ == Kind::kBool);
+  return WordToUint256(bytes_);
+}
+
+size_t ABIValue::GetArraySize() const {
+  DCHECK(kind_ == Kind::kAddressArray);
+  return bytes_.size() / kWordSize;
+}
+
+base::span<const uint8_t> ABIValue::GetAddressAt(size_t index) const {
+  DCHECK(kind_ == Kind::kAddressArray);
+  return bytes_.subspan(index * kWordSize, kWordSize).last(kAddressSize);
+}
+
+std::string ABIValue::ToString() const {
+  switch (kind_) {
+    case Kind::kAddress:
+    case Kind::kBytes:
+      return "0x" + HexEncodeLower(bytes_);
+    case Kind::kUint:
+      return Uint256ValueToHex(GetUint());
+    case Kind::kBool:
+      return GetUint() ? "true" : "false";
+    case Kind::kAddressArray: {
+      std::string result = "0x";
+      result.reserve(2 + GetArraySize() * kAddressSize * 2);
+      for (size_t i = 0; i < GetArraySize(); i++) {
+        base::StrAppend(&result, {HexEncodeLower(GetAddressAt(i))});
+      }
+      return result;
+    }
+    case Kind::kRaw:
+      // The 32-byte word is NOT prefixed by "0x".
+      return HexEncodeLower(bytes_);
+  }
+  NOTREACHED_NORETURN();
+}
+
 // UniswapEncodedPathDecode parses a Uniswap-encoded path and return a vector
 // of addresses representing each hop involved in the swap.
 //
@@ -210,6 +259,11 @@ absl::optional<std::vector<std::string>> UniswapEncodedPathDecode(
   if (!PrefixedHexStringToBytes(encoded_path, &data)) {
     return absl::nullopt;
   }
+  return UniswapEncodedPathDecode(data);
+}
+
+absl::optional<std::vector<std::string>> UniswapEncodedPathDecode(
+    base::span<const uint8_t> data) {
   size_t offset = 0;
   std::vector<std::string> path;
 
@@ -220,8 +274,8 @@ absl::optional<std::vector<std::string>> UniswapEncodedPathDecode(
   }
 
   // Parse first hop address.
-  path.push_back("0x" + HexEncodeLower(data.data(), 20));
-  offset += 20;
+  path.push_back("0x" + HexEncodeLower(data.first(kAddressSize)));
+  offset += kAddressSize;
 
   while (true) {
     if (offset == data.size()) {
@@ -236,11 +290,11 @@ absl::optional<std::vector<std::string>> UniswapEncodedPathDecode(
     offset += 3;
 
     // Parse next hop.
-    if (data.size() - offset < 20) {
+    if (data.size() - offset < kAddressSize) {
       return absl::nullopt;
     }
-    path.push_back("0x" + HexEncodeLower(data.data() + offset, 20));
-    offset += 20;
+    path.push_back("0x" + HexEncodeLower(data.subspan(offset, kAddressSize)));
+    offset += kAddressSize;
   }
 
   // Require a minimum of 2 addresses for a single-hop swap.
@@ -251,69 +305,73 @@ absl::optional<std::vector<std::string>> UniswapEncodedPathDecode(
   return path;
 }
 
-absl::optional<std::tuple<std::vector<std::string>,   // params
-                          std::vector<std::string>>>  // args
-ABIDecode(const std::vector<std::string>& types,
-          const std::vector<uint8_t>& data) {
+absl::optional<std::vector<ABIValue>> ABIDecodeValues(
+    const std::vector<std::string>& types,
+    base::span<const uint8_t> data) {
   size_t offset = 0;
-  size_t calldata_tail = 0;
-  std::vector<std::string> params;
-  std::vector<std::string> args;
+  bool found_dynamic_type = false;
+  std::vector<ABIValue> values;
+  values.reserve(types.size());
 
   for (const auto& type : types) {
-    absl::optional<std::string> value;
+    absl::optional<ABIValue> value;
     if (type == "address") {
       value = GetAddressFromData(data, offset);
-    } else if (type == "uint8") {  // Handle all unsigned integers of M bits,
-                                   // where 0 < M <= 256 and M % 8 == 0.
-      value = GetUintHexFromData<uint8_t>(data, offset);
-    } else if (type == "uint16") {
-      value = GetUintHexFromData<uint16_t>(data, offset);
-    } else if (type == "uint32") {
-      value = GetUintHexFromData<uint32_t>(data, offset);
-    } else if (type == "uint64") {
-      value = GetUintHexFromData<uint64_t>(data, offset);
-    } else if (type == "uint128") {
-      value = GetUintHexFromData<uint128_t>(data, offset);
-    } else if (type == "uint256") {
-      value = GetUintHexFromData<uint256_t>(data, offset);
+    } else if (auto uint_size = GetUintTypeSize(type)) {
+      value = GetUintFromData(data, offset, *uint_size);
     } else if (type == "bool") {
       value = GetBoolFromData(data, offset);
     } else if (type == "bytes") {
-      value = GetBytesHexFromData(data, offset);
+      value = GetBytesFromData(data, offset);
     } else if (type == "address[]") {
       value = GetAddressArrayFromData(data, offset);
-    } else {
+    } else if (auto word = GetWordFromData(data, offset)) {
       // For unknown/unsupported types, we only extract 32-bytes. In case of
       // dynamic types, this value is a calldata reference.
-      value = GetArgFromData(data, offset);
+      value = ABIValue(ABIValue::Kind::kRaw, *word);
     }
 
     if (!value) {
       return absl::nullopt;
     }
 
-    // On encountering a dynamic type, we extract the reference to the start
-    // of the tail section of the calldata.
+    // On encountering a dynamic type, the reference to the start of the tail
+    // section of the calldata must be valid.
     if ((type == "bytes" || type == "string" || base::EndsWith(type, "[]")) &&
-        calldata_tail == 0) {
-      auto pointer = GetUintFromData<size_t>(data, offset);
-      if (!pointer) {
+        !found_dynamic_type) {
+      if (!GetSizeFromData(data, offset)) {
         return absl::nullopt;
       }
 
-      calldata_tail = *pointer;
+      found_dynamic_type = true;
     }
 
-    offset += 32;
+    offset += kWordSize;
 
-    args.push_back(*value);
-    params.push_back(type);
+    values.push_back(std::move(*value));
   }
 
   // Extra calldata bytes are ignored.
 
-  return std::make_tuple(params, args);
+  return values;
+}
+
+absl::optional<std::tuple<std::vector<std::string>,   // params
+                          std::vector<std::string>>>  // args
+ABIDecode(const std::vector<std::string>& types,
+          base::span<const uint8_t> data) {
+  auto values = ABIDecodeValues(types, data);
+  if (!values) {
+    return absl::nullopt;
+  }
+
+  std::vector<std::string> args;
+  args.reserve(values->size());
+  for (const auto& value : *values) {
+    args.push_back(value.ToString());
+  }
+
+  return std::make_tuple(types, std::move(args));
 }
 
 }  // namespace brave_wallet
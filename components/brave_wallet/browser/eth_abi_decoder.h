@@ -9,17 +9,59 @@
 #include <string>
 #include <tuple>
 #include <vector>
-#include "base/values.h"
+
+#include "base/containers/span.h"
+#include "brave/components/brave_wallet/common/brave_wallet_types.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
 
 namespace brave_wallet {
 
+// A decoded calldata argument. It points into the calldata it was decoded
+// from, which must outlive it, and is only formatted as a string on demand.
+class ABIValue {
+ public:
+  enum class Kind {
+    kAddress,       // 20 bytes
+    kUint,          // 32-byte big endian word
+    kBool,          // 32-byte word
+    kBytes,         // Content of a dynamic bytes value
+    kAddressArray,  // 32-byte words of the elements
+    kRaw,           // 32-byte word of an unsupported type
+  };
+
+  ABIValue(Kind kind, base::span<const uint8_t> bytes);
+
+  Kind kind() const { return kind_; }
+  base::span<const uint8_t> bytes() const { return bytes_; }
+
+  // Only valid for kUint and kBool values.
+  uint256_t GetUint() const;
+  // Only valid for kAddressArray values.
+  size_t GetArraySize() const;
+  base::span<const uint8_t> GetAddressAt(size_t index) const;
+
+  // Same representation as the args returned by ABIDecode.
+  std::string ToString() const;
+
+ private:
+  Kind kind_;
+  base::span<const uint8_t> bytes_;
+};
+
 absl::optional<std::vector<std::string>> UniswapEncodedPathDecode(
     const std::string& encoded_path);
+absl::optional<std::vector<std::string>> UniswapEncodedPathDecode(
+    base::span<const uint8_t> encoded_path);
+
+// Decodes |data| in place, without copying it or formatting any value.
+absl::optional<std::vector<ABIValue>> ABIDecodeValues(
+    const std::vector<std::string>& types,
+    base::span<const uint8_t> data);
 
 absl::optional<std::tuple<std::vector<std::string>,   // tx_params
                           std::vector<std::string>>>  // tx_args
 ABIDecode(const std::vector<std::string>& types,
-          const std::vector<uint8_t>& data);
+          base::span<const uint8_t> data);
 
 }  // namespace brave_wallet
 
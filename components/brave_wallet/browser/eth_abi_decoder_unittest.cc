@@ -546,4 +546,126 @@ TEST(EthABIDecoderTest, UniswapEncodedPathDecodeInvalid) {
       "deadbeef"));                                 // Bogus data
 }
 
+TEST(EthABIDecoderTest, ABIDecodeValues) {
+  // Permit2 permit(address owner,
+  //                ((address token,
+  //                  uint160 amount,
+  //                  uint48 expiration,
+  //                  uint48 nonce),
+  //                 address spender,
+  //                 uint256 sigDeadline),
+  //                bytes signature)
+  // with the static tuple flattened.
+  std::vector<uint8_t> data;
+  ASSERT_TRUE(PrefixedHexStringToBytes(
+      "0x000000000000000000000000bfb30a082f650c2a15d0632f0e87be4f8e64460f"
+      "000000000000000000000000a0b86991c6218b36c1d19d4a2e9eb0ce3606eb48"
+      "000000000000000000000000ffffffffffffffffffffffffffffffffffffffff"
+      "0000000000000000000000000000000000000000000000000000000064f0a0b0"
+      "0000000000000000000000000000000000000000000000000000000000000003"
+      "000000000000000000000000ef1c6e67703c7bd7107eed8303fbe6ec2554bf6b"
+      "0000000000000000000000000000000000000000000000000000000064c91ab8"
+      "0000000000000000000000000000000000000000000000000000000000000100"
+      "0000000000000000000000000000000000000000000000000000000000000041"
+      "1111111111111111111111111111111111111111111111111111111111111111"
+      "2222222222222222222222222222222222222222222222222222222222222222"
+      "1b00000000000000000000000000000000000000000000000000000000000000",
+      &data));
+  auto values = ABIDecodeValues({"address", "address", "uint160", "uint48",
+                                 "uint48", "address", "uint256", "bytes"},
+                                data);
+  ASSERT_TRUE(values);
+  ASSERT_EQ(values->size(), 8u);
+
+  EXPECT_EQ(values->at(0).kind(), ABIValue::Kind::kAddress);
+  EXPECT_EQ(values->at(0).ToString(),
+            "0xbfb30a082f650c2a15d0632f0e87be4f8e64460f");
+  // Values point into the calldata.
+  EXPECT_EQ(values->at(0).bytes().data(), data.data() + 12);
+  EXPECT_EQ(values->at(0).bytes().size(), 20u);
+
+  // Unsupported integer sizes are kept as raw words.
+  EXPECT_EQ(values->at(2).kind(), ABIValue::Kind::kRaw);
+  EXPECT_EQ(values->at(2).ToString(),
+            "000000000000000000000000ffffffffffffffffffffffffffffffffffffffff");
+
+  EXPECT_EQ(values->at(6).kind(), ABIValue::Kind::kUint);
+  EXPECT_EQ(values->at(6).GetUint(), uint256_t(0x64c91ab8));
+  EXPECT_EQ(values->at(6).ToString(), "0x64c91ab8");
+
+  EXPECT_EQ(values->at(7).kind(), ABIValue::Kind::kBytes);
+  EXPECT_EQ(values->at(7).bytes().data(), data.data() + 9 * 32);
+  EXPECT_EQ(values->at(7).bytes().size(), 65u);
+  EXPECT_EQ(values->at(7).bytes().back(), 0x1b);
+
+  // Same args as ABIDecode.
+  auto decoded = ABIDecode({"address", "address", "uint160", "uint48",
+                            "uint48", "address", "uint256", "bytes"},
+                           data);
+  ASSERT_TRUE(decoded);
+  const auto& tx_args = std::get<1>(*decoded);
+  ASSERT_EQ(tx_args.size(), values->size());
+  for (size_t i = 0; i < tx_args.size(); i++) {
+    EXPECT_EQ(tx_args[i], values->at(i).ToString());
+  }
+
+  // Address arrays are views over their elements.
+  ASSERT_TRUE(PrefixedHexStringToBytes(
+      "0x0000000000000000000000000000000000000000000000000000000000000020"
+      "0000000000000000000000000000000000000000000000000000000000000002"
+      "000000000000000000000000bfb30a082f650c2a15d0632f0e87be4f8e64460f"
+      "000000000000000000000000a0b86991c6218b36c1d19d4a2e9eb0ce3606eb48",
+      &data));
+  values = ABIDecodeValues({"address[]"}, data);
+  ASSERT_TRUE(values);
+  const auto& array = values->at(0);
+  EXPECT_EQ(array.kind(), ABIValue::Kind::kAddressArray);
+  ASSERT_EQ(array.GetArraySize(), 2u);
+  EXPECT_EQ(HexEncodeLower(array.GetAddressAt(1)),
+            "a0b86991c6218b36c1d19d4a2e9eb0ce3606eb48");
+  EXPECT_EQ(array.ToString(),
+            "0xbfb30a082f650c2a15d0632f0e87be4f8e64460f"
+            "a0b86991c6218b36c1d19d4a2e9eb0ce3606eb48");
+}
+
+// Decodes a dynamic bytes value followed by a dynamic address array, as in
+// multicall batches and swap routes.
+TEST(EthABIDecoderTest, ABIDecodeBytesAndAddressArray) {
+  constexpr size_t kBytesSize = 3 * 32;
+  constexpr size_t kAddressCount = 4;
+
+  auto append_word = [](std::vector<uint8_t>& data, uint64_t value) {
+    for (int i = 31; i >= 0; i--) {
+      data.push_back(i < 8 ? static_cast<uint8_t>(value >> (i * 8)) : 0);
+    }
+  };
+
+  // bytes data, address[] tokens
+  std::vector<uint8_t> data;
+  append_word(data, 2 * 32);
+  append_word(data, 3 * 32 + kBytesSize);
+  append_word(data, kBytesSize);
+  data.insert(data.end(), kBytesSize, 0xab);
+  append_word(data, kAddressCount);
+  for (size_t i = 0; i < kAddressCount; i++) {
+    append_word(data, i);
+  }
+
+  auto values = ABIDecodeValues({"bytes", "address[]"}, data);
+  ASSERT_TRUE(values);
+  EXPECT_EQ(values->at(0).bytes().size(), kBytesSize);
+  ASSERT_EQ(values->at(1).GetArraySize(), kAddressCount);
+  EXPECT_EQ(HexEncodeLower(values->at(1).GetAddressAt(3)),
+            "0000000000000000000000000000000000000003");
+
+  std::string bytes_hex = "0x";
+  for (size_t i = 0; i < kBytesSize; i++) {
+    bytes_hex += "ab";
+  }
+  auto decoded = ABIDecode({"bytes", "address[]"}, data);
+  ASSERT_TRUE(decoded);
+  EXPECT_EQ(std::get<1>(*decoded)[0], bytes_hex);
+  EXPECT_EQ(std::get<1>(*decoded)[1].size(), 2 + kAddressCount * 40);
+}
+
 }  // namespace brave_wallet
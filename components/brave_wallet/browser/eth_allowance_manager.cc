@@ -130,13 +130,16 @@ void EthAllowanceManager::DiscoverEthAllowancesOnAllSupportedChains(
   allowance_discovery_tasks_.clear();
   get_block_tasks_ = 0;
 
-  const auto token_list_map =
-      BlockchainRegistry::GetInstance()->GetEthTokenListMap(
-          GetChainIdsForAlowanceDiscovering());
+  const auto* registry = BlockchainRegistry::GetInstance();
+  for (const auto& chain_id : GetChainIdsForAlowanceDiscovering()) {
+    const auto* token_list =
+        registry->GetTokenList(chain_id, mojom::CoinType::ETH);
+    if (!token_list) {
+      continue;
+    }
 
-  for (const auto& [chain_id, token_list] : token_list_map) {
     base::Value::List contract_addresses;
-    for (const auto& token : token_list) {
+    for (const auto& token : *token_list) {
       contract_addresses.Append(token->contract_address);
     }
 
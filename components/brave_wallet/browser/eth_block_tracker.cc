@@ -5,7 +5,6 @@
 
 #include "brave/components/brave_wallet/browser/eth_block_tracker.h"
 
-#include <memory>
 #include <utility>
 
 #include "base/containers/contains.h"
@@ -22,13 +21,13 @@ EthBlockTracker::~EthBlockTracker() = default;
 
 void EthBlockTracker::Start(const std::string& chain_id,
                             base::TimeDelta interval) {
-  if (!base::Contains(timers_, chain_id)) {
-    timers_[chain_id] = std::make_unique<base::RepeatingTimer>();
-  }
-  timers_[chain_id]->Start(
-      FROM_HERE, interval,
-      base::BindRepeating(&EthBlockTracker::GetBlockNumber,
-                          weak_factory_.GetWeakPtr(), chain_id));
+  StartPolling(chain_id, interval,
+               base::BindRepeating(&EthBlockTracker::GetBlockNumber,
+                                   weak_factory_.GetWeakPtr(), chain_id));
+}
+
+bool EthBlockTracker::HasObservers() const {
+  return !observers_.empty();
 }
 
 void EthBlockTracker::AddObserver(EthBlockTracker::Observer* observer) {
@@ -73,7 +72,9 @@ void EthBlockTracker::OnGetBlockNumber(const std::string& chain_id,
                                        mojom::ProviderError error,
                                        const std::string& error_message) {
   if (error == mojom::ProviderError::kSuccess) {
-    if (GetCurrentBlock(chain_id) != block_num) {
+    const bool new_block = GetCurrentBlock(chain_id) != block_num;
+    ReportPollResult(chain_id, new_block);
+    if (new_block) {
       current_block_map_[chain_id] = block_num;
       for (auto& observer : observers_) {
         observer.OnNewBlock(chain_id, block_num);
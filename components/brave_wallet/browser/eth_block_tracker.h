@@ -58,6 +58,7 @@ class EthBlockTracker : public BlockTracker {
       base::OnceCallback<void(uint256_t block_num,
                               mojom::ProviderError error,
                               const std::string& error_message)>);
+  bool HasObservers() const override;
   void GetBlockNumber(const std::string& chain_id);
   void OnGetBlockNumber(const std::string& chain_id,
                         uint256_t block_num,
@@ -78,6 +78,13 @@ TEST_F(EthBlockTrackerUnitTest, Timer) {
       [&](const network::ResourceRequest& request) { request_sent = true; }));
   EXPECT_FALSE(tracker.IsRunning(mojom::kMainnetChainId));
   tracker.Start(mojom::kMainnetChainId, base::Seconds(5));
+  // Nobody observes the tracker, polls are skipped.
+  task_environment_.FastForwardBy(base::Seconds(5));
+  EXPECT_TRUE(tracker.IsRunning(mojom::kMainnetChainId));
+  EXPECT_FALSE(request_sent);
+
+  MockTrackerObserver observer(&tracker);
+  tracker.Start(mojom::kMainnetChainId, base::Seconds(5));
   task_environment_.FastForwardBy(base::Seconds(1));
   EXPECT_TRUE(tracker.IsRunning(mojom::kMainnetChainId));
   EXPECT_FALSE(request_sent);
@@ -143,9 +150,9 @@ TEST_F(EthBlockTrackerUnitTest, GetBlockNumber) {
   EXPECT_EQ(tracker.GetCurrentBlock(mojom::kGoerliChainId), uint256_t(3));
   EXPECT_TRUE(testing::Mock::VerifyAndClearExpectations(&observer));
 
-  // Still response_block_num_ 3
+  // Still response_block_num_ 3, polling backs off to every 8s on goerli.
   EXPECT_CALL(observer, OnLatestBlock(mojom::kMainnetChainId, 3)).Times(1);
-  EXPECT_CALL(observer, OnLatestBlock(mojom::kGoerliChainId, 3)).Times(3);
+  EXPECT_CALL(observer, OnLatestBlock(mojom::kGoerliChainId, 3)).Times(1);
   EXPECT_CALL(observer, OnNewBlock(_, _)).Times(0);
   task_environment_.FastForwardBy(base::Seconds(5));
   EXPECT_EQ(tracker.GetCurrentBlock(mojom::kMainnetChainId), uint256_t(3));
@@ -8,7 +8,9 @@
 #include <map>
 #include <tuple>
 
+#include "base/containers/span.h"
 #include "base/strings/strcat.h"
+#include "base/strings/string_piece.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_constants.h"
 #include "brave/components/brave_wallet/browser/eth_abi_decoder.h"
 #include "brave/components/brave_wallet/common/brave_wallet_types.h"
@@ -38,6 +40,21 @@ constexpr char kFillOtcOrderSelector[] = "0xdac748d4";
 constexpr char kFilForwarderTransferSelector[] =
     "0xd948d468";  // forward(bytes)
 
+// Joins the hops of a Uniswap-encoded path into a hex string prefixed by "0x".
+absl::optional<std::string> GetUniswapFillPath(
+    base::span<const uint8_t> encoded_path) {
+  auto decoded_path = UniswapEncodedPathDecode(encoded_path);
+  if (!decoded_path) {
+    return absl::nullopt;
+  }
+
+  std::string fill_path = "0x";
+  for (const auto& path : *decoded_path) {
+    base::StrAppend(&fill_path, {base::StringPiece(path).substr(2)});
+  }
+  return fill_path;
+}
+
 }  // namespace
 
 absl::optional<std::tuple<mojom::TransactionType,     // tx_type
@@ -57,7 +74,7 @@ GetTransactionInfoFromData(const std::vector<uint8_t>& data) {
   }
 
   std::string selector = "0x" + HexEncodeLower(data.data(), 4);
-  std::vector<uint8_t> calldata(data.begin() + 4, data.end());
+  auto calldata = base::make_span(data).subspan(4);
   if (selector == kFilForwarderTransferSelector) {
     auto decoded = ABIDecode({"bytes"}, calldata);
     if (!decoded) {
@@ -113,30 +130,25 @@ GetTransactionInfoFromData(const std::vector<uint8_t>& data) {
     // Ref:
     // https://github.com/0xProject/protocol/blob/b46eeadc64485288add5940a210e1a7d0bcb5481/contracts/zero-ex/contracts/src/features/interfaces/IUniswapV3Feature.sol#L29-L41
     auto decoded_calldata =
-        ABIDecode({"bytes", "uint256", "address"}, calldata);
+        ABIDecodeValues({"bytes", "uint256", "address"}, calldata);
     if (!decoded_calldata) {
       return absl::nullopt;
     }
 
-    const auto& tx_args = std::get<1>(*decoded_calldata);
-    auto decoded_path = UniswapEncodedPathDecode(tx_args.at(0));
-    if (!decoded_path) {
+    const auto& values = *decoded_calldata;
+    auto fill_path = GetUniswapFillPath(values.at(0).bytes());
+    if (!fill_path) {
       return absl::nullopt;
     }
 
-    std::string fill_path = "0x";
-    for (const auto& path : *decoded_path) {
-      base::StrAppend(&fill_path, {path.substr(2)});
-    }
-
     return std::make_tuple(
         mojom::TransactionType::ETHSwap,
         std::vector<std::string>{"bytes",     // fill path,
                                  "uint256",   // maker amount
                                  "uint256"},  // taker amount
-        std::vector<std::string>{fill_path,
+        std::vector<std::string>{*fill_path,
                                  "",  // maker asset is ETH, amount is txn value
-                                 tx_args.at(1)});
+                                 values.at(1).ToString()});
   } else if (selector == kSellTokenForEthToUniswapV3Selector ||
              selector == kSellTokenForTokenToUniswapV3Selector) {
     // Function: 0x803ba26d
@@ -158,27 +170,24 @@ GetTransactionInfoFromData(const std::vector<uint8_t>& data) {
     // Ref:
     // https://github.com/0xProject/protocol/blob/b46eeadc64485288add5940a210e1a7d0bcb5481/contracts/zero-ex/contracts/src/features/interfaces/IUniswapV3Feature.sol#L58-L71
     auto decoded_calldata =
-        ABIDecode({"bytes", "uint256", "uint256", "address"}, calldata);
+        ABIDecodeValues({"bytes", "uint256", "uint256", "address"}, calldata);
     if (!decoded_calldata) {
       return absl::nullopt;
     }
 
-    const auto& tx_args = std::get<1>(*decoded_calldata);
-    auto decoded_path = UniswapEncodedPathDecode(tx_args.at(0));
-    if (!decoded_path) {
+    const auto& values = *decoded_calldata;
+    auto fill_path = GetUniswapFillPath(values.at(0).bytes());
+    if (!fill_path) {
       return absl::nullopt;
     }
-    std::string fill_path = "0x";
-    for (const auto& path : *decoded_path) {
-      base::StrAppend(&fill_path, {path.substr(2)});
-    }
 
     return std::make_tuple(
         mojom::TransactionType::ETHSwap,
         std::vector<std::string>{"bytes",     // fill path,
                                  "uint256",   // maker amount
                                  "uint256"},  // taker amount
-        std::vector<std::string>{fill_path, tx_args.at(1), tx_args.at(2)});
+        std::vector<std::string>{*fill_path, values.at(1).ToString(),
+                                 values.at(2).ToString()});
   } else if (selector == kSellToUniswapSelector) {
     // Function:
     // sellToUniswap(address[] tokens,
@@ -15,21 +15,35 @@ EthLogsTracker::EthLogsTracker(JsonRpcService* json_rpc_service)
   DCHECK(json_rpc_service_);
 }
 
-EthLogsTracker::~EthLogsTracker() = default;
+EthLogsTracker::~EthLogsTracker() {
+  Stop();
+}
 
 void EthLogsTracker::Start(const std::string& chain_id,
                            base::TimeDelta interval) {
-  timer_.Start(FROM_HERE, interval,
-               base::BindRepeating(&EthLogsTracker::GetLogs,
-                                   weak_factory_.GetWeakPtr(), chain_id));
+  Stop();
+  // Unretained is safe, the task is removed when this tracker is destroyed.
+  task_id_ = json_rpc_service_->polling_scheduler()->AddTask(
+      interval,
+      base::BindRepeating(&EthLogsTracker::GetLogs, weak_factory_.GetWeakPtr(),
+                          chain_id),
+      base::BindRepeating(&EthLogsTracker::HasSubscribers,
+                          base::Unretained(this)));
 }
 
 void EthLogsTracker::Stop() {
-  timer_.Stop();
+  if (task_id_) {
+    json_rpc_service_->polling_scheduler()->RemoveTask(*task_id_);
+    task_id_.reset();
+  }
 }
 
 bool EthLogsTracker::IsRunning() const {
-  return timer_.IsRunning();
+  return task_id_ && json_rpc_service_->polling_scheduler()->HasTask(*task_id_);
+}
+
+bool EthLogsTracker::HasSubscribers() const {
+  return !eth_logs_subscription_info_.empty() && !observers_.empty();
 }
 
 void EthLogsTracker::AddSubscriber(const std::string& subscription_id,
@@ -14,10 +14,11 @@
 #include "base/observer_list.h"
 #include "base/observer_list_types.h"
 #include "base/time/time.h"
-#include "base/timer/timer.h"
 #include "brave/components/brave_wallet/browser/json_rpc_service.h"
+#include "brave/components/brave_wallet/browser/polling_scheduler.h"
 #include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
 #include "brave/components/brave_wallet/common/brave_wallet_types.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
 
 namespace brave_wallet {
 
@@ -52,6 +53,7 @@ class EthLogsTracker {
   void RemoveObserver(Observer* observer);
 
  private:
+  bool HasSubscribers() const;
   void GetLogs(const std::string& chain_id);
   void OnGetLogs(const std::string& subscription,
                  const std::vector<Log>& logs,
@@ -59,7 +61,7 @@ class EthLogsTracker {
                  mojom::ProviderError error,
                  const std::string& error_message);
 
-  base::RepeatingTimer timer_;
+  absl::optional<PollingScheduler::TaskId> task_id_;
   raw_ptr<JsonRpcService> json_rpc_service_ = nullptr;
 
   std::map<std::string, base::Value::Dict> eth_logs_subscription_info_;
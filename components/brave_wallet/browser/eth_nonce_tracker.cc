@@ -25,6 +25,14 @@ EthNonceTracker::~EthNonceTracker() = default;
 void EthNonceTracker::GetNextNonce(const std::string& chain_id,
                                    const std::string& from,
                                    GetNextNonceCallback callback) {
+  RunWhenTxsLoaded(base::BindOnce(&EthNonceTracker::GetNetworkNonce,
+                                  weak_factory_.GetWeakPtr(), chain_id, from,
+                                  std::move(callback)));
+}
+
+void EthNonceTracker::GetNetworkNonce(const std::string& chain_id,
+                                      const std::string& from,
+                                      GetNextNonceCallback callback) {
   json_rpc_service_->GetEthTransactionCount(
       chain_id, from,
       base::BindOnce(&EthNonceTracker::OnGetNetworkNonce,
@@ -40,6 +40,9 @@ class EthNonceTracker : public NonceTracker {
       uint256_t start) override;
 
  private:
+  void GetNetworkNonce(const std::string& chain_id,
+                       const std::string& from,
+                       GetNextNonceCallback callback);
   void OnGetNetworkNonce(const std::string& chain_id,
                          const std::string& from,
                          GetNextNonceCallback callback,
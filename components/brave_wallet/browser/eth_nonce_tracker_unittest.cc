@@ -9,6 +9,8 @@
 #include <string>
 #include <utility>
 
+#include "base/files/file_path.h"
+#include "base/files/scoped_temp_dir.h"
 #include "base/test/bind.h"
 #include "base/test/task_environment.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_constants.h"
@@ -18,7 +20,9 @@
 #include "brave/components/brave_wallet/browser/eth_tx_meta.h"
 #include "brave/components/brave_wallet/browser/eth_tx_state_manager.h"
 #include "brave/components/brave_wallet/browser/json_rpc_service.h"
+#include "brave/components/brave_wallet/browser/pref_names.h"
 #include "brave/components/brave_wallet/browser/tx_meta.h"
+#include "brave/components/brave_wallet/browser/tx_storage.h"
 #include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
 #include "brave/components/brave_wallet/common/brave_wallet_types.h"
 #include "brave/components/brave_wallet/common/eth_address.h"
@@ -104,7 +108,8 @@ class EthNonceTrackerUnitTest : public testing::Test {
 TEST_F(EthNonceTrackerUnitTest, GetNonce) {
   JsonRpcService service(shared_url_loader_factory(), GetPrefs());
 
-  EthTxStateManager tx_state_manager(GetPrefs());
+  TxStorage tx_storage(GetPrefs(), base::FilePath());
+  EthTxStateManager tx_state_manager(GetPrefs(), &tx_storage);
   EthNonceTracker nonce_tracker(&tx_state_manager, &service);
 
   SetTransactionCount(2);
@@ -153,9 +158,43 @@ TEST_F(EthNonceTrackerUnitTest, GetNonce) {
   GetNextNonce(&nonce_tracker, mojom::kMainnetChainId, address, true, 2);
 }
 
+TEST_F(EthNonceTrackerUnitTest, GetNonceBeforeTxsLoaded) {
+  JsonRpcService service(shared_url_loader_factory(), GetPrefs());
+  GetPrefs()->SetBoolean(kBraveWalletTransactionsFromPrefsToDBMigrated, true);
+  base::ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+  const base::FilePath db_path =
+      temp_dir.GetPath().Append(FILE_PATH_LITERAL("transactions"));
+
+  SetTransactionCount(2);
+  const std::string address("0x2f015c60e0be116b1f0cd534704db9c92118fb6a");
+  {
+    TxStorage tx_storage(GetPrefs(), db_path);
+    EthTxStateManager tx_state_manager(GetPrefs(), &tx_storage);
+    EthTxMeta meta;
+    meta.set_id(TxMeta::GenerateMetaID());
+    meta.set_chain_id(mojom::kLocalhostChainId);
+    meta.set_from(EthAddress::FromHex(address).ToChecksumAddress());
+    meta.set_status(mojom::TransactionStatus::Submitted);
+    meta.tx()->set_nonce(uint256_t(2));
+    tx_state_manager.AddOrUpdateTx(meta);
+    WaitForResponse();
+  }
+  WaitForResponse();
+
+  // The pending nonce stored by the previous session is skipped even though
+  // the nonce is requested before the transactions are loaded.
+  TxStorage tx_storage(GetPrefs(), db_path);
+  EthTxStateManager tx_state_manager(GetPrefs(), &tx_storage);
+  EthNonceTracker nonce_tracker(&tx_state_manager, &service);
+  ASSERT_FALSE(tx_state_manager.IsLoaded());
+  GetNextNonce(&nonce_tracker, mojom::kLocalhostChainId, address, true, 3);
+}
+
 TEST_F(EthNonceTrackerUnitTest, NonceLock) {
   JsonRpcService service(shared_url_loader_factory(), GetPrefs());
-  EthTxStateManager tx_state_manager(GetPrefs());
+  TxStorage tx_storage(GetPrefs(), base::FilePath());
+  EthTxStateManager tx_state_manager(GetPrefs(), &tx_storage);
   EthNonceTracker nonce_tracker(&tx_state_manager, &service);
 
   SetTransactionCount(4);
@@ -8,7 +8,6 @@
 #include <utility>
 
 #include "base/logging.h"
-#include "base/strings/strcat.h"
 #include "base/values.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_constants.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_utils.h"
@@ -20,8 +19,8 @@
 
 namespace brave_wallet {
 
-EthTxStateManager::EthTxStateManager(PrefService* prefs)
-    : TxStateManager(prefs) {}
+EthTxStateManager::EthTxStateManager(PrefService* prefs, TxStorage* tx_storage)
+    : TxStateManager(prefs, tx_storage) {}
 
 EthTxStateManager::~EthTxStateManager() = default;
 
@@ -123,14 +122,4 @@ std::unique_ptr<TxMeta> EthTxStateManager::ValueToTxMeta(
   return meta;
 }
 
-std::string EthTxStateManager::GetTxPrefPathPrefix(
-    const absl::optional<std::string>& chain_id) {
-  if (chain_id.has_value()) {
-    return base::StrCat(
-        {kEthereumPrefKey, ".",
-         GetNetworkId(prefs_, mojom::CoinType::ETH, *chain_id)});
-  }
-  return kEthereumPrefKey;
-}
-
 }  // namespace brave_wallet
@@ -11,7 +11,6 @@
 #include <utility>
 #include <vector>
 
-#include "base/gtest_prod_util.h"
 #include "brave/components/brave_wallet/browser/tx_state_manager.h"
 #include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
 #include "brave/components/brave_wallet/common/eth_address.h"
@@ -26,11 +25,12 @@ class Value;
 namespace brave_wallet {
 
 class TxMeta;
+class TxStorage;
 class EthTxMeta;
 
 class EthTxStateManager : public TxStateManager {
  public:
-  explicit EthTxStateManager(PrefService* prefs);
+  EthTxStateManager(PrefService* prefs, TxStorage* tx_storage);
   ~EthTxStateManager() override;
   EthTxStateManager(const EthTxStateManager&) = delete;
   EthTxStateManager operator=(const EthTxStateManager&) = delete;
@@ -45,14 +45,10 @@ class EthTxStateManager : public TxStateManager {
   std::unique_ptr<EthTxMeta> ValueToEthTxMeta(const base::Value::Dict& value);
 
  private:
-  FRIEND_TEST_ALL_PREFIXES(EthTxStateManagerUnitTest, GetTxPrefPathPrefix);
-
   mojom::CoinType GetCoinType() const override;
 
   std::unique_ptr<TxMeta> ValueToTxMeta(
       const base::Value::Dict& value) override;
-  std::string GetTxPrefPathPrefix(
-      const absl::optional<std::string>& chain_id) override;
 };
 
 }  // namespace brave_wallet
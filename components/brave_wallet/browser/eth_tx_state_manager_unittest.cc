@@ -9,6 +9,7 @@
 #include <utility>
 
 #include "base/run_loop.h"
+#include "base/files/file_path.h"
 #include "base/test/bind.h"
 #include "base/test/task_environment.h"
 #include "base/time/time.h"
@@ -18,6 +19,7 @@
 #include "brave/components/brave_wallet/browser/eip1559_transaction.h"
 #include "brave/components/brave_wallet/browser/eip2930_transaction.h"
 #include "brave/components/brave_wallet/browser/eth_tx_meta.h"
+#include "brave/components/brave_wallet/browser/tx_storage.h"
 #include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
 #include "brave/components/brave_wallet/common/eth_address.h"
 #include "components/prefs/pref_service.h"
@@ -36,13 +38,16 @@ class EthTxStateManagerUnitTest : public testing::Test {
  protected:
   void SetUp() override {
     brave_wallet::RegisterProfilePrefs(prefs_.registry());
-    eth_tx_state_manager_ = std::make_unique<EthTxStateManager>(GetPrefs());
+    tx_storage_ = std::make_unique<TxStorage>(GetPrefs(), base::FilePath());
+    eth_tx_state_manager_ =
+        std::make_unique<EthTxStateManager>(GetPrefs(), tx_storage_.get());
   }
 
   PrefService* GetPrefs() { return &prefs_; }
 
   base::test::TaskEnvironment task_environment_;
   sync_preferences::TestingPrefServiceSyncable prefs_;
+  std::unique_ptr<TxStorage> tx_storage_;
   std::unique_ptr<EthTxStateManager> eth_tx_state_manager_;
 };
 
@@ -174,18 +179,4 @@ TEST_F(EthTxStateManagerUnitTest, TxMetaAndValue) {
   EXPECT_FALSE(meta_from_value3->sign_only());
 }
 
-TEST_F(EthTxStateManagerUnitTest, GetTxPrefPathPrefix) {
-  EXPECT_EQ("ethereum.mainnet",
-            eth_tx_state_manager_->GetTxPrefPathPrefix(mojom::kMainnetChainId));
-  EXPECT_EQ("ethereum.goerli",
-            eth_tx_state_manager_->GetTxPrefPathPrefix(mojom::kGoerliChainId));
-  EXPECT_EQ("ethereum.sepolia",
-            eth_tx_state_manager_->GetTxPrefPathPrefix(mojom::kSepoliaChainId));
-  EXPECT_EQ(
-      "ethereum.http://localhost:7545/",
-      eth_tx_state_manager_->GetTxPrefPathPrefix(mojom::kLocalhostChainId));
-  EXPECT_EQ("ethereum",
-            eth_tx_state_manager_->GetTxPrefPathPrefix(absl::nullopt));
-}
-
 }  // namespace brave_wallet
@@ -84,6 +84,46 @@ TEST(EthereumKeyringUnitTest, Accounts) {
   EXPECT_TRUE(keyring2.GetAddress(0).empty());
 }
 
+TEST(EthereumKeyringUnitTest, DiscoveryAddresses) {
+  EthereumKeyring keyring;
+  std::vector<uint8_t> seed;
+  EXPECT_TRUE(base::HexStringToBytes(
+      "13ca6c28d26812f82db27908de0b0b7b18940cc4e9d96ebd7de190f706741489907ef65b"
+      "8f9e36c31dc46e81472b6a5e40a4487e725ace445b8203f243fb8958",
+      &seed));
+  keyring.ConstructRootHDKey(seed, "m/44'/60'/0'/0");
+  keyring.AddAccounts(1);
+
+  EXPECT_EQ(keyring.GetDiscoveryAddress(0),
+            "0x2166fB4e11D44100112B1124ac593081519cA1ec");
+  EXPECT_EQ(keyring.GetDiscoveryAddress(2),
+            "0x02e77f0e2fa06F95BDEa79Fad158477723145838");
+  // Cached addresses are returned again.
+  EXPECT_EQ(keyring.GetDiscoveryAddress(2),
+            "0x02e77f0e2fa06F95BDEa79Fad158477723145838");
+  EXPECT_FALSE(
+      keyring.HasAddress("0x02e77f0e2fa06F95BDEa79Fad158477723145838"));
+
+  // Accounts added after discovery get the same addresses and keys.
+  auto added = keyring.AddAccounts(2);
+  ASSERT_EQ(added.size(), 2u);
+  EXPECT_EQ(added[0].address, "0x2A22ad45446E8b34Da4da1f4ADd7B1571Ab4e4E7");
+  EXPECT_EQ(added[1].address, "0x02e77f0e2fa06F95BDEa79Fad158477723145838");
+  EXPECT_TRUE(
+      keyring.HasAddress("0x02e77f0e2fa06F95BDEa79Fad158477723145838"));
+  EXPECT_FALSE(keyring
+                   .EncodePrivateKeyForExport(
+                       "0x02e77f0e2fa06F95BDEa79Fad158477723145838")
+                   .empty());
+
+  keyring.RemoveAccount();
+  EXPECT_FALSE(
+      keyring.HasAddress("0x02e77f0e2fa06F95BDEa79Fad158477723145838"));
+  EXPECT_EQ(keyring.GetAccounts().size(), 2u);
+  EXPECT_EQ(keyring.GetDiscoveryAddress(2),
+            "0x02e77f0e2fa06F95BDEa79Fad158477723145838");
+}
+
 TEST(EthereumKeyringUnitTest, SignTransaction) {
   // Specific signature check is in eth_transaction_unittest.cc
   EthereumKeyring keyring;
@@ -5,7 +5,6 @@
 
 #include "brave/components/brave_wallet/browser/fil_block_tracker.h"
 
-#include <memory>
 #include <utility>
 
 #include "base/containers/contains.h"
@@ -21,14 +20,14 @@ FilBlockTracker::~FilBlockTracker() = default;
 
 void FilBlockTracker::Start(const std::string& chain_id,
                             base::TimeDelta interval) {
-  if (!base::Contains(timers_, chain_id)) {
-    timers_[chain_id] = std::make_unique<base::RepeatingTimer>();
-  }
-  timers_[chain_id]->Start(
-      FROM_HERE, interval,
-      base::BindRepeating(&FilBlockTracker::GetFilBlockHeight,
-                          weak_ptr_factory_.GetWeakPtr(), chain_id,
-                          base::NullCallback()));
+  StartPolling(chain_id, interval,
+               base::BindRepeating(&FilBlockTracker::GetFilBlockHeight,
+                                   weak_ptr_factory_.GetWeakPtr(), chain_id,
+                                   base::NullCallback()));
+}
+
+bool FilBlockTracker::HasObservers() const {
+  return !observers_.empty();
 }
 
 void FilBlockTracker::GetFilBlockHeight(const std::string& chain_id,
@@ -61,8 +60,10 @@ void FilBlockTracker::OnGetFilBlockHeight(const std::string& chain_id,
     return;
   }
   if (GetLatestHeight(chain_id) == latest_height) {
+    ReportPollResult(chain_id, false);
     return;
   }
+  ReportPollResult(chain_id, true);
   latest_height_map_[chain_id] = latest_height;
   for (auto& observer : observers_) {
     observer.OnLatestHeightUpdated(chain_id, latest_height);
@@ -45,6 +45,7 @@ class FilBlockTracker : public BlockTracker {
   void Start(const std::string& chain_id, base::TimeDelta interval) override;
 
  private:
+  bool HasObservers() const override;
   void OnGetFilBlockHeight(const std::string& chain_id,
                            GetFilBlockHeightCallback callback,
                            uint64_t latest_height,
@@ -8,6 +8,7 @@
 #include <algorithm>
 #include <utility>
 
+#include "base/functional/bind.h"
 #include "brave/components/brave_wallet/browser/fil_tx_meta.h"
 #include "brave/components/brave_wallet/browser/json_rpc_service.h"
 #include "brave/components/brave_wallet/browser/tx_state_manager.h"
@@ -23,6 +24,14 @@ FilNonceTracker::~FilNonceTracker() = default;
 void FilNonceTracker::GetNextNonce(const std::string& chain_id,
                                    const std::string& from,
                                    GetNextNonceCallback callback) {
+  RunWhenTxsLoaded(base::BindOnce(&FilNonceTracker::GetNetworkNonce,
+                                  weak_factory_.GetWeakPtr(), chain_id, from,
+                                  std::move(callback)));
+}
+
+void FilNonceTracker::GetNetworkNonce(const std::string& chain_id,
+                                      const std::string& from,
+                                      GetNextNonceCallback callback) {
   json_rpc_service_->GetFilTransactionCount(
       chain_id, from,
       base::BindOnce(&FilNonceTracker::OnGetNetworkNonce,
@@ -46,6 +46,10 @@ class FilNonceTracker : public NonceTracker {
                          const std::string& error_message);
 
  private:
+  void GetNetworkNonce(const std::string& chain_id,
+                       const std::string& from,
+                       GetNextNonceCallback callback);
+
   base::WeakPtrFactory<FilNonceTracker> weak_factory_;
 };
 
@@ -5,6 +5,7 @@
 
 #include "brave/components/brave_wallet/browser/fil_requests.h"
 
+#include <iterator>
 #include <utility>
 
 #include "base/json/json_reader.h"
@@ -62,12 +63,12 @@ std::string getEstimateGas(const std::string& from_address,
   dict.Set("id", 1);
   std::string json;
   base::JSONWriter::Write(dict, &json);
-  json = std::string(json::convert_string_value_to_int64("/params/0/GasLimit",
-                                                         json.c_str(), false)
-                         .c_str());
-  return std::string(json::convert_string_value_to_uint64("/params/0/Nonce",
-                                                          json.c_str(), false)
-                         .c_str());
+  const json::ValueConversion conversions[] = {
+      {"/params/0/GasLimit", json::ConversionKind::StringToInt64, false},
+      {"/params/0/Nonce", json::ConversionKind::StringToUint64, false}};
+  return std::string(json::convert_values(
+      json, rust::Slice<const json::ValueConversion>(conversions,
+                                                     std::size(conversions))));
 }
 
 std::string getChainHead() {
@@ -31,8 +31,9 @@ namespace brave_wallet {
 FilTxManager::FilTxManager(TxService* tx_service,
                            JsonRpcService* json_rpc_service,
                            KeyringService* keyring_service,
-                           PrefService* prefs)
-    : TxManager(std::make_unique<FilTxStateManager>(prefs),
+                           PrefService* prefs,
+                           TxStorage* tx_storage)
+    : TxManager(std::make_unique<FilTxStateManager>(prefs, tx_storage),
                 std::make_unique<FilBlockTracker>(json_rpc_service),
                 tx_service,
                 json_rpc_service,
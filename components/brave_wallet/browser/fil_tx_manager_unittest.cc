@@ -80,8 +80,10 @@ class FilTxManagerUnitTest : public testing::Test {
         std::make_unique<JsonRpcService>(shared_url_loader_factory_, &prefs_);
     keyring_service_ = std::make_unique<KeyringService>(json_rpc_service_.get(),
                                                         &prefs_, &local_state_);
-    tx_service_ = std::make_unique<TxService>(json_rpc_service_.get(), nullptr,
-                                              keyring_service_.get(), &prefs_);
+    tx_service_ =
+        std::make_unique<TxService>(json_rpc_service_.get(), nullptr,
+                                    keyring_service_.get(), &prefs_,
+                                    /*wallet_base_directory=*/base::FilePath());
 
     keyring_service_->CreateWallet("testing123", base::DoNothing());
     base::RunLoop().RunUntilIdle();
@@ -7,7 +7,6 @@
 
 #include <utility>
 
-#include "base/strings/strcat.h"
 #include "base/values.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_constants.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_utils.h"
@@ -18,8 +17,8 @@
 
 namespace brave_wallet {
 
-FilTxStateManager::FilTxStateManager(PrefService* prefs)
-    : TxStateManager(prefs) {}
+FilTxStateManager::FilTxStateManager(PrefService* prefs, TxStorage* tx_storage)
+    : TxStateManager(prefs, tx_storage) {}
 
 FilTxStateManager::~FilTxStateManager() = default;
 
@@ -30,16 +29,6 @@ std::unique_ptr<FilTxMeta> FilTxStateManager::GetFilTx(
       static_cast<FilTxMeta*>(TxStateManager::GetTx(chain_id, id).release())};
 }
 
-std::string FilTxStateManager::GetTxPrefPathPrefix(
-    const absl::optional<std::string>& chain_id) {
-  if (chain_id.has_value()) {
-    return base::StrCat(
-        {kFilecoinPrefKey, ".",
-         GetNetworkId(prefs_, mojom::CoinType::FIL, *chain_id)});
-  }
-  return kFilecoinPrefKey;
-}
-
 mojom::CoinType FilTxStateManager::GetCoinType() const {
   return mojom::CoinType::FIL;
 }
@@ -10,7 +10,6 @@
 #include <string>
 #include <utility>
 
-#include "base/gtest_prod_util.h"
 #include "brave/components/brave_wallet/browser/tx_state_manager.h"
 
 class PrefService;
@@ -22,11 +21,12 @@ class Value;
 namespace brave_wallet {
 
 class TxMeta;
+class TxStorage;
 class FilTxMeta;
 
 class FilTxStateManager : public TxStateManager {
  public:
-  explicit FilTxStateManager(PrefService* prefs);
+  FilTxStateManager(PrefService* prefs, TxStorage* tx_storage);
   ~FilTxStateManager() override;
   FilTxStateManager(const FilTxStateManager&) = delete;
   FilTxStateManager operator=(const FilTxStateManager&) = delete;
@@ -36,14 +36,10 @@ class FilTxStateManager : public TxStateManager {
   std::unique_ptr<FilTxMeta> ValueToFilTxMeta(const base::Value::Dict& value);
 
  private:
-  FRIEND_TEST_ALL_PREFIXES(FilTxStateManagerUnitTest, GetTxPrefPathPrefix);
-
   mojom::CoinType GetCoinType() const override;
 
   std::unique_ptr<TxMeta> ValueToTxMeta(
       const base::Value::Dict& value) override;
-  std::string GetTxPrefPathPrefix(
-      const absl::optional<std::string>& chain_id) override;
 };
 
 }  // namespace brave_wallet
@@ -9,11 +9,13 @@
 #include <utility>
 #include <vector>
 
+#include "base/files/file_path.h"
 #include "base/test/bind.h"
 #include "base/test/task_environment.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_prefs.h"
 #include "brave/components/brave_wallet/browser/fil_transaction.h"
 #include "brave/components/brave_wallet/browser/fil_tx_meta.h"
+#include "brave/components/brave_wallet/browser/tx_storage.h"
 #include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
 #include "components/sync_preferences/testing_pref_service_syncable.h"
 #include "testing/gtest/include/gtest/gtest.h"
@@ -29,13 +31,16 @@ class FilTxStateManagerUnitTest : public testing::Test {
  protected:
   void SetUp() override {
     brave_wallet::RegisterProfilePrefs(prefs_.registry());
-    fil_tx_state_manager_ = std::make_unique<FilTxStateManager>(GetPrefs());
+    tx_storage_ = std::make_unique<TxStorage>(GetPrefs(), base::FilePath());
+    fil_tx_state_manager_ =
+        std::make_unique<FilTxStateManager>(GetPrefs(), tx_storage_.get());
   }
 
   PrefService* GetPrefs() { return &prefs_; }
 
   base::test::TaskEnvironment task_environment_;
   sync_preferences::TestingPrefServiceSyncable prefs_;
+  std::unique_ptr<TxStorage> tx_storage_;
   std::unique_ptr<FilTxStateManager> fil_tx_state_manager_;
 };
 
@@ -68,16 +73,4 @@ TEST_F(FilTxStateManagerUnitTest, FilTxMetaAndValue) {
   EXPECT_EQ(*meta_from_value, meta);
 }
 
-TEST_F(FilTxStateManagerUnitTest, GetTxPrefPathPrefix) {
-  EXPECT_EQ("filecoin.mainnet", fil_tx_state_manager_->GetTxPrefPathPrefix(
-                                    mojom::kFilecoinMainnet));
-  EXPECT_EQ("filecoin.testnet", fil_tx_state_manager_->GetTxPrefPathPrefix(
-                                    mojom::kFilecoinTestnet));
-  EXPECT_EQ(
-      "filecoin.http://localhost:1234/rpc/v0",
-      fil_tx_state_manager_->GetTxPrefPathPrefix(mojom::kLocalhostChainId));
-  EXPECT_EQ("filecoin",
-            fil_tx_state_manager_->GetTxPrefPathPrefix(absl::nullopt));
-}
-
 }  // namespace brave_wallet
@@ -7,6 +7,9 @@
 
 #include <utility>
 
+#include "base/containers/contains.h"
+#include "base/ranges/algorithm.h"
+
 namespace brave_wallet {
 
 HDKeyring::HDKeyring() = default;
@@ -27,26 +30,45 @@ std::vector<AddedAcountInfo> HDKeyring::AddAccounts(size_t number) {
     return result;
   }
 
+  // Bring the cache up to date so addresses of new accounts can be appended.
+  GetAccountAddresses();
+
   size_t cur_accounts_number = accounts_.size();
+  result.reserve(number);
   for (size_t i = cur_accounts_number; i < cur_accounts_number + number; ++i) {
     auto& added_account = accounts_.emplace_back(DeriveAccount(i));
-    result.push_back(
-        {added_account->GetPath(), GetAddressInternal(added_account.get())});
+
+    std::string address;
+    auto discovered = discovery_addresses_.find(i);
+    if (discovered != discovery_addresses_.end()) {
+      address = std::move(discovered->second);
+      discovery_addresses_.erase(discovered);
+    } else {
+      address = GetAddressInternal(added_account.get());
+    }
+    account_addresses_.push_back(address);
+    result.push_back({added_account->GetPath(), std::move(address)});
   }
 
   return result;
 }
 
 std::vector<std::string> HDKeyring::GetAccounts() const {
-  std::vector<std::string> addresses;
-  for (size_t i = 0; i < accounts_.size(); ++i) {
-    addresses.push_back(GetAddress(i));
-  }
-  return addresses;
+  return GetAccountAddresses();
 }
 
 void HDKeyring::RemoveAccount() {
   accounts_.pop_back();
+  if (account_addresses_.size() > accounts_.size()) {
+    account_addresses_.resize(accounts_.size());
+  }
+}
+
+const std::vector<std::string>& HDKeyring::GetAccountAddresses() const {
+  for (size_t i = account_addresses_.size(); i < accounts_.size(); ++i) {
+    account_addresses_.push_back(GetAddressInternal(accounts_[i].get()));
+  }
+  return account_addresses_;
 }
 
 bool HDKeyring::AddImportedAddress(const std::string& address,
@@ -56,10 +78,8 @@ bool HDKeyring::AddImportedAddress(const std::string& address,
     return false;
   }
   // Check if it is duplicate in derived accounts
-  for (size_t i = 0; i < accounts_.size(); ++i) {
-    if (GetAddress(i) == address) {
-      return false;
-    }
+  if (HasAddress(address)) {
+    return false;
   }
 
   imported_accounts_[address] = std::move(hd_key);
@@ -92,14 +112,26 @@ std::string HDKeyring::GetAddress(size_t index) const {
   if (accounts_.empty() || index >= accounts_.size()) {
     return std::string();
   }
-  return GetAddressInternal(accounts_[index].get());
+  return GetAccountAddresses()[index];
 }
 
 std::string HDKeyring::GetDiscoveryAddress(size_t index) const {
-  if (auto key = DeriveAccount(index)) {
-    return GetAddressInternal(key.get());
+  if (index < accounts_.size()) {
+    return GetAddress(index);
+  }
+
+  auto it = discovery_addresses_.find(index);
+  if (it != discovery_addresses_.end()) {
+    return it->second;
+  }
+
+  auto key = DeriveAccount(index);
+  if (!key) {
+    return std::string();
   }
-  return std::string();
+  std::string address = GetAddressInternal(key.get());
+  discovery_addresses_[index] = address;
+  return address;
 }
 
 std::string HDKeyring::EncodePrivateKeyForExport(const std::string& address) {
@@ -116,21 +148,16 @@ HDKeyBase* HDKeyring::GetHDKeyFromAddress(const std::string& address) {
   if (imported_accounts_iter != imported_accounts_.end()) {
     return imported_accounts_iter->second.get();
   }
-  for (size_t i = 0; i < accounts_.size(); ++i) {
-    if (GetAddress(i) == address) {
-      return accounts_[i].get();
-    }
+  const auto& addresses = GetAccountAddresses();
+  auto it = base::ranges::find(addresses, address);
+  if (it == addresses.end()) {
+    return nullptr;
   }
-  return nullptr;
+  return accounts_[it - addresses.begin()].get();
 }
 
 bool HDKeyring::HasAddress(const std::string& address) {
-  for (size_t i = 0; i < accounts_.size(); ++i) {
-    if (GetAddress(i) == address) {
-      return true;
-    }
-  }
-  return false;
+  return base::Contains(GetAccountAddresses(), address);
 }
 
 bool HDKeyring::HasImportedAddress(const std::string& address) {
@@ -46,6 +46,9 @@ class HDKeyring {
   bool RemoveImportedAccount(const std::string& address);
 
   std::string GetAddress(size_t index) const;
+  // Address of the account at |index| whether or not it was added. Addresses
+  // are cached so repeated discovery and a later AddAccounts don't derive
+  // them again.
   std::string GetDiscoveryAddress(size_t index) const;
   // Find private key by address and encode for export (it would be hex or
   // base58 depends on underlying hd key)
@@ -72,6 +75,16 @@ class HDKeyring {
   base::flat_map<std::string, std::unique_ptr<HDKeyBase>> imported_accounts_;
 
  private:
+  // Addresses of |accounts_|, computed for accounts added since the last
+  // call.
+  const std::vector<std::string>& GetAccountAddresses() const;
+
+  // Only public addresses are cached, derived keys of accounts that are not
+  // added are dropped right away.
+  mutable std::vector<std::string> account_addresses_;
+  // <account index, address> of accounts derived for discovery only.
+  mutable base::flat_map<size_t, std::string> discovery_addresses_;
+
   FRIEND_TEST_ALL_PREFIXES(EthereumKeyringUnitTest, ConstructRootHDKey);
   FRIEND_TEST_ALL_PREFIXES(EthereumKeyringUnitTest, SignMessage);
   FRIEND_TEST_ALL_PREFIXES(SolanaKeyringUnitTest, ConstructRootHDKey);
@@ -0,0 +1,192 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_wallet/browser/json_rpc_batcher.h"
+
+#include "base/check.h"
+#include "base/containers/contains.h"
+#include "base/functional/bind.h"
+#include "base/json/json_reader.h"
+#include "brave/components/brave_wallet/browser/json_rpc_requests_helper.h"
+#include "net/http/http_status_code.h"
+
+namespace brave_wallet {
+
+namespace {
+
+api_request_helper::APIRequestResult MakeResult(
+    const api_request_helper::APIRequestResult& batch_result,
+    base::Value value_body) {
+  return api_request_helper::APIRequestResult(
+      batch_result.response_code(), GetJSON(value_body), std::move(value_body),
+      batch_result.headers(), batch_result.error_code(),
+      batch_result.final_url());
+}
+
+}  // namespace
+
+JsonRpcBatcher::PendingCall::PendingCall(std::string json_payload,
+                                         base::Value::Dict request,
+                                         ResultCallback callback)
+    : json_payload(std::move(json_payload)),
+      request(std::move(request)),
+      callback(std::move(callback)) {}
+
+JsonRpcBatcher::PendingCall::~PendingCall() = default;
+JsonRpcBatcher::PendingCall::PendingCall(PendingCall&&) = default;
+JsonRpcBatcher::PendingCall& JsonRpcBatcher::PendingCall::operator=(
+    PendingCall&&) = default;
+
+JsonRpcBatcher::PendingBatch::PendingBatch() = default;
+JsonRpcBatcher::PendingBatch::~PendingBatch() = default;
+
+JsonRpcBatcher::JsonRpcBatcher(SendCallback send_callback,
+                               base::TimeDelta batch_window,
+                               size_t max_batch_size)
+    : send_callback_(std::move(send_callback)),
+      batch_window_(batch_window),
+      max_batch_size_(max_batch_size) {
+  DCHECK(send_callback_);
+}
+
+JsonRpcBatcher::~JsonRpcBatcher() = default;
+
+void JsonRpcBatcher::Request(const std::string& json_payload,
+                             bool auto_retry_on_network_change,
+                             const GURL& network_url,
+                             ResultCallback callback) {
+  if (!SupportsBatching(network_url) || max_batch_size_ < 2) {
+    send_callback_.Run(json_payload, auto_retry_on_network_change, network_url,
+                       std::move(callback));
+    return;
+  }
+
+  // Only batch calls which serialize back to the same payload, so values the
+  // parser cannot represent exactly (e.g. uint64 converted for Solana) are
+  // never altered.
+  absl::optional<base::Value> request =
+      base::JSONReader::Read(json_payload, base::JSON_PARSE_RFC);
+  if (!request || !request->is_dict() || !request->GetDict().Find("id") ||
+      !request->GetDict().FindString("method") ||
+      GetJSON(*request) != json_payload) {
+    send_callback_.Run(json_payload, auto_retry_on_network_change, network_url,
+                       std::move(callback));
+    return;
+  }
+
+  const BatchKey key(network_url, auto_retry_on_network_change);
+  auto& batch = pending_batches_[key];
+  if (!batch) {
+    batch = std::make_unique<PendingBatch>();
+  }
+
+  batch->calls.emplace_back(json_payload, std::move(*request).TakeDict(),
+                            std::move(callback));
+  if (batch->calls.size() >= max_batch_size_) {
+    Flush(key);
+    return;
+  }
+
+  if (!batch->timer.IsRunning()) {
+    batch->timer.Start(FROM_HERE, batch_window_,
+                       base::BindOnce(&JsonRpcBatcher::Flush,
+                                      base::Unretained(this), key));
+  }
+}
+
+bool JsonRpcBatcher::SupportsBatching(const GURL& network_url) const {
+  return !base::Contains(batch_unsupported_urls_, network_url);
+}
+
+void JsonRpcBatcher::Flush(const BatchKey& key) {
+  auto iter = pending_batches_.find(key);
+  if (iter == pending_batches_.end()) {
+    return;
+  }
+
+  std::vector<PendingCall> calls = std::move(iter->second->calls);
+  pending_batches_.erase(iter);
+
+  if (calls.size() == 1) {
+    SendIndividually(key, std::move(calls.front()));
+    return;
+  }
+
+  // Batch ids are the index of each call, the original ids are restored on
+  // the responses.
+  base::Value::List batch;
+  for (size_t i = 0; i < calls.size(); ++i) {
+    base::Value::Dict request = calls[i].request.Clone();
+    request.Set("id", static_cast<int>(i));
+    batch.Append(std::move(request));
+  }
+
+  send_callback_.Run(
+      GetJSON(batch), key.second, key.first,
+      base::BindOnce(&JsonRpcBatcher::OnBatchResponse,
+                     weak_ptr_factory_.GetWeakPtr(), key, std::move(calls)));
+}
+
+void JsonRpcBatcher::SendIndividually(const BatchKey& key, PendingCall call) {
+  send_callback_.Run(call.json_payload, key.second, key.first,
+                     std::move(call.callback));
+}
+
+void JsonRpcBatcher::OnBatchResponse(const BatchKey& key,
+                                     std::vector<PendingCall> calls,
+                                     APIRequestResult api_request_result) {
+  // Network errors and overloaded servers are not a rejected batch, each call
+  // fails the way it would have on its own.
+  if (!api_request_result.IsResponseCodeValid() ||
+      api_request_result.response_code() >=
+          net::HTTP_INTERNAL_SERVER_ERROR ||
+      api_request_result.response_code() == net::HTTP_TOO_MANY_REQUESTS) {
+    for (auto& call : calls) {
+      std::move(call.callback)
+          .Run(MakeResult(api_request_result,
+                          api_request_result.value_body().Clone()));
+    }
+    return;
+  }
+
+  const base::Value::List* responses =
+      api_request_result.value_body().GetIfList();
+  if (!api_request_result.Is2XXResponseCode() || !responses) {
+    batch_unsupported_urls_.insert(key.first);
+    for (auto& call : calls) {
+      SendIndividually(key, std::move(call));
+    }
+    return;
+  }
+
+  std::vector<const base::Value::Dict*> responses_by_id(calls.size(), nullptr);
+  for (const auto& response : *responses) {
+    const base::Value::Dict* response_dict = response.GetIfDict();
+    if (!response_dict) {
+      continue;
+    }
+    const absl::optional<int> id = response_dict->FindInt("id");
+    if (id && *id >= 0 && static_cast<size_t>(*id) < calls.size()) {
+      responses_by_id[*id] = response_dict;
+    }
+  }
+
+  for (size_t i = 0; i < calls.size(); ++i) {
+    if (!responses_by_id[i]) {
+      // Some endpoints drop calls from a batch, e.g. over a size limit.
+      SendIndividually(key, std::move(calls[i]));
+      continue;
+    }
+
+    base::Value::Dict response = responses_by_id[i]->Clone();
+    if (const base::Value* id = calls[i].request.Find("id")) {
+      response.Set("id", id->Clone());
+    }
+    std::move(calls[i].callback)
+        .Run(MakeResult(api_request_result, base::Value(std::move(response))));
+  }
+}
+
+}  // namespace brave_wallet
@@ -0,0 +1,100 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_JSON_RPC_BATCHER_H_
+#define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_JSON_RPC_BATCHER_H_
+
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/functional/callback.h"
+#include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
+#include "base/timer/timer.h"
+#include "base/values.h"
+#include "brave/components/api_request_helper/api_request_helper.h"
+#include "url/gurl.h"
+
+namespace brave_wallet {
+
+// Collects JSON-RPC calls sent to the same RPC URL while a batch window is
+// open and sends them as a single JSON-RPC 2.0 batch request, then hands each
+// caller its own response matched by id. Endpoints which reject batches are
+// remembered and get individual requests from then on.
+class JsonRpcBatcher {
+ public:
+  using APIRequestResult = api_request_helper::APIRequestResult;
+  using ResultCallback = base::OnceCallback<void(APIRequestResult)>;
+  // Sends |json_payload| to |network_url| as a single HTTP request.
+  using SendCallback =
+      base::RepeatingCallback<void(const std::string& json_payload,
+                                   bool auto_retry_on_network_change,
+                                   const GURL& network_url,
+                                   ResultCallback callback)>;
+
+  JsonRpcBatcher(SendCallback send_callback,
+                 base::TimeDelta batch_window,
+                 size_t max_batch_size);
+  ~JsonRpcBatcher();
+  JsonRpcBatcher(const JsonRpcBatcher&) = delete;
+  JsonRpcBatcher& operator=(const JsonRpcBatcher&) = delete;
+
+  // |callback| receives the same result it would for an individual request.
+  // Payloads which are not a single JSON-RPC call are sent as is.
+  void Request(const std::string& json_payload,
+               bool auto_retry_on_network_change,
+               const GURL& network_url,
+               ResultCallback callback);
+
+  bool SupportsBatching(const GURL& network_url) const;
+
+ private:
+  struct PendingCall {
+    PendingCall(std::string json_payload,
+                base::Value::Dict request,
+                ResultCallback callback);
+    ~PendingCall();
+    PendingCall(PendingCall&&);
+    PendingCall& operator=(PendingCall&&);
+
+    std::string json_payload;
+    base::Value::Dict request;
+    ResultCallback callback;
+  };
+
+  struct PendingBatch {
+    PendingBatch();
+    ~PendingBatch();
+
+    std::vector<PendingCall> calls;
+    base::OneShotTimer timer;
+  };
+
+  // <network_url, auto_retry_on_network_change>
+  using BatchKey = std::pair<GURL, bool>;
+
+  void Flush(const BatchKey& key);
+  void SendIndividually(const BatchKey& key, PendingCall call);
+  void OnBatchResponse(const BatchKey& key,
+                       std::vector<PendingCall> calls,
+                       APIRequestResult api_request_result);
+
+  SendCallback send_callback_;
+  const base::TimeDelta batch_window_;
+  const size_t max_batch_size_;
+
+  std::map<BatchKey, std::unique_ptr<PendingBatch>> pending_batches_;
+  std::set<GURL> batch_unsupported_urls_;
+
+  base::WeakPtrFactory<JsonRpcBatcher> weak_ptr_factory_{this};
+};
+
+}  // namespace brave_wallet
+
+#endif  // BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_JSON_RPC_BATCHER_H_
@@ -0,0 +1,329 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_wallet/browser/json_rpc_batcher.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/functional/callback_helpers.h"
+#include "base/json/json_reader.h"
+#include "base/json/json_writer.h"
+#include "base/memory/raw_ptr.h"
+#include "base/strings/string_piece.h"
+#include "base/test/bind.h"
+#include "base/test/task_environment.h"
+#include "base/values.h"
+#include "brave/components/api_request_helper/api_request_helper.h"
+#include "net/http/http_status_code.h"
+#include "net/traffic_annotation/network_traffic_annotation_test_helper.h"
+#include "services/data_decoder/public/cpp/test_support/in_process_data_decoder.h"
+#include "services/network/public/cpp/weak_wrapper_shared_url_loader_factory.h"
+#include "services/network/test/test_url_loader_factory.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace brave_wallet {
+
+namespace {
+
+constexpr char kRpcUrl[] = "https://rpc.example.com/";
+constexpr char kOtherRpcUrl[] = "https://other-rpc.example.com/";
+
+std::string MakeCall(const std::string& method) {
+  return R"({"id":1,"jsonrpc":"2.0","method":")" + method +
+         R"(","params":[]})";
+}
+
+// A local JSON-RPC endpoint which answers every call with its method name as
+// the result. Batch responses are returned in reverse order to exercise
+// matching by id.
+class FakeJsonRpcServer {
+ public:
+  explicit FakeJsonRpcServer(network::TestURLLoaderFactory* url_loader_factory)
+      : url_loader_factory_(url_loader_factory) {
+    url_loader_factory_->SetInterceptor(base::BindRepeating(
+        &FakeJsonRpcServer::HandleRequest, base::Unretained(this)));
+  }
+
+  void set_rejects_batches(bool rejects_batches) {
+    rejects_batches_ = rejects_batches;
+  }
+  void set_dropped_method(const std::string& method) {
+    dropped_method_ = method;
+  }
+  void set_status_code(net::HttpStatusCode status_code) {
+    status_code_ = status_code;
+  }
+
+  size_t request_count() const { return request_count_; }
+  size_t batch_request_count() const { return batch_request_count_; }
+  const std::vector<std::string>& payloads() const { return payloads_; }
+
+ private:
+  void HandleRequest(const network::ResourceRequest& request) {
+    base::StringPiece payload(request.request_body->elements()
+                                  ->at(0)
+                                  .As<network::DataElementBytes>()
+                                  .AsStringPiece());
+    ++request_count_;
+    payloads_.emplace_back(payload);
+
+    url_loader_factory_->ClearResponses();
+    if (status_code_ != net::HTTP_OK) {
+      url_loader_factory_->AddResponse(request.url.spec(), "{}", status_code_);
+      return;
+    }
+
+    absl::optional<base::Value> value =
+        base::JSONReader::Read(payload, base::JSON_PARSE_RFC);
+    ASSERT_TRUE(value);
+    if (value->is_dict()) {
+      url_loader_factory_->AddResponse(request.url.spec(),
+                                       ToJson(Respond(value->GetDict())));
+      return;
+    }
+
+    ++batch_request_count_;
+    if (rejects_batches_) {
+      url_loader_factory_->AddResponse(
+          request.url.spec(),
+          R"({"jsonrpc":"2.0","id":null,"error":{"code":-32600,)"
+          R"("message":"Batch requests are not supported"}})",
+          net::HTTP_BAD_REQUEST);
+      return;
+    }
+
+    base::Value::List responses;
+    for (const auto& call : value->GetList()) {
+      const std::string* method = call.GetDict().FindString("method");
+      if (method && *method == dropped_method_) {
+        continue;
+      }
+      responses.Insert(responses.begin(),
+                       base::Value(Respond(call.GetDict())));
+    }
+    url_loader_factory_->AddResponse(request.url.spec(), ToJson(responses));
+  }
+
+  static base::Value::Dict Respond(const base::Value::Dict& call) {
+    base::Value::Dict response;
+    response.Set("jsonrpc", "2.0");
+    response.Set("id", call.Find("id")->Clone());
+    response.Set("result", *call.FindString("method"));
+    return response;
+  }
+
+  static std::string ToJson(base::ValueView value) {
+    std::string json;
+    base::JSONWriter::Write(value, &json);
+    return json;
+  }
+
+  raw_ptr<network::TestURLLoaderFactory> url_loader_factory_;
+  bool rejects_batches_ = false;
+  std::string dropped_method_;
+  net::HttpStatusCode status_code_ = net::HTTP_OK;
+  size_t request_count_ = 0;
+  size_t batch_request_count_ = 0;
+  std::vector<std::string> payloads_;
+};
+
+}  // namespace
+
+class JsonRpcBatcherUnitTest : public testing::Test {
+ public:
+  JsonRpcBatcherUnitTest()
+      : task_environment_(base::test::TaskEnvironment::TimeSource::MOCK_TIME),
+        shared_url_loader_factory_(
+            base::MakeRefCounted<network::WeakWrapperSharedURLLoaderFactory>(
+                &url_loader_factory_)),
+        api_request_helper_(TRAFFIC_ANNOTATION_FOR_TESTS,
+                            shared_url_loader_factory_),
+        server_(&url_loader_factory_) {}
+
+ protected:
+  void CreateBatcher(base::TimeDelta batch_window, size_t max_batch_size) {
+    batcher_ = std::make_unique<JsonRpcBatcher>(
+        base::BindLambdaForTesting(
+            [&](const std::string& json_payload,
+                bool auto_retry_on_network_change, const GURL& network_url,
+                JsonRpcBatcher::ResultCallback callback) {
+              api_request_helper_.Request(
+                  "POST", network_url, json_payload, "application/json",
+                  std::move(callback), {},
+                  {.auto_retry_on_network_change =
+                       auto_retry_on_network_change});
+            }),
+        batch_window, max_batch_size);
+  }
+
+  // Sends |method| and records the result once it arrives.
+  void Call(const std::string& method, const char* url = kRpcUrl) {
+    batcher_->Request(
+        MakeCall(method), true, GURL(url),
+        base::BindLambdaForTesting(
+            [this, method](api_request_helper::APIRequestResult result) {
+              results_.emplace_back(method, std::move(result));
+            }));
+  }
+
+  // Expects every call to have received its own response with the original
+  // id.
+  void ExpectResultsMatchCalls(size_t expected_count) {
+    ASSERT_EQ(results_.size(), expected_count);
+    for (const auto& [method, result] : results_) {
+      SCOPED_TRACE(method);
+      EXPECT_TRUE(result.Is2XXResponseCode());
+      const base::Value::Dict* response = result.value_body().GetIfDict();
+      ASSERT_TRUE(response);
+      EXPECT_EQ(response->FindInt("id"), 1);
+      ASSERT_TRUE(response->FindString("result"));
+      EXPECT_EQ(*response->FindString("result"), method);
+    }
+  }
+
+  base::test::TaskEnvironment task_environment_;
+  data_decoder::test::InProcessDataDecoder in_process_data_decoder_;
+  network::TestURLLoaderFactory url_loader_factory_;
+  scoped_refptr<network::SharedURLLoaderFactory> shared_url_loader_factory_;
+  api_request_helper::APIRequestHelper api_request_helper_;
+  FakeJsonRpcServer server_;
+  std::unique_ptr<JsonRpcBatcher> batcher_;
+  std::vector<std::pair<std::string, api_request_helper::APIRequestResult>>
+      results_;
+};
+
+TEST_F(JsonRpcBatcherUnitTest, BatchesCallsToSameUrl) {
+  CreateBatcher(base::TimeDelta(), 20);
+
+  Call("eth_getTransactionReceipt");
+  Call("eth_getBalance");
+  Call("eth_blockNumber");
+  Call("eth_chainId", kOtherRpcUrl);
+  task_environment_.RunUntilIdle();
+
+  EXPECT_EQ(server_.request_count(), 2u);
+  EXPECT_EQ(server_.batch_request_count(), 1u);
+  ExpectResultsMatchCalls(4u);
+}
+
+TEST_F(JsonRpcBatcherUnitTest, SingleCallIsSentAsIs) {
+  CreateBatcher(base::TimeDelta(), 20);
+
+  Call("eth_blockNumber");
+  task_environment_.RunUntilIdle();
+
+  ASSERT_EQ(server_.request_count(), 1u);
+  EXPECT_EQ(server_.batch_request_count(), 0u);
+  EXPECT_EQ(server_.payloads()[0], MakeCall("eth_blockNumber"));
+  ExpectResultsMatchCalls(1u);
+}
+
+TEST_F(JsonRpcBatcherUnitTest, BatchWindow) {
+  CreateBatcher(base::Milliseconds(100), 20);
+
+  Call("eth_getBalance");
+  task_environment_.FastForwardBy(base::Milliseconds(50));
+  Call("eth_blockNumber");
+  EXPECT_EQ(server_.request_count(), 0u);
+
+  task_environment_.FastForwardBy(base::Milliseconds(50));
+  task_environment_.RunUntilIdle();
+  EXPECT_EQ(server_.request_count(), 1u);
+  EXPECT_EQ(server_.batch_request_count(), 1u);
+  ExpectResultsMatchCalls(2u);
+}
+
+TEST_F(JsonRpcBatcherUnitTest, MaxBatchSize) {
+  CreateBatcher(base::TimeDelta(), 2);
+
+  Call("eth_getBalance");
+  Call("eth_blockNumber");
+  Call("eth_chainId");
+  task_environment_.RunUntilIdle();
+
+  EXPECT_EQ(server_.request_count(), 2u);
+  EXPECT_EQ(server_.batch_request_count(), 1u);
+  ExpectResultsMatchCalls(3u);
+}
+
+TEST_F(JsonRpcBatcherUnitTest, FallbackWhenBatchesRejected) {
+  CreateBatcher(base::TimeDelta(), 20);
+  server_.set_rejects_batches(true);
+
+  Call("eth_getBalance");
+  Call("eth_blockNumber");
+  Call("eth_chainId");
+  task_environment_.RunUntilIdle();
+
+  // The batch is rejected and each call is retried on its own.
+  EXPECT_EQ(server_.request_count(), 4u);
+  EXPECT_EQ(server_.batch_request_count(), 1u);
+  ExpectResultsMatchCalls(3u);
+  EXPECT_FALSE(batcher_->SupportsBatching(GURL(kRpcUrl)));
+  EXPECT_TRUE(batcher_->SupportsBatching(GURL(kOtherRpcUrl)));
+
+  // Later calls go straight to individual requests.
+  Call("eth_gasPrice");
+  Call("eth_feeHistory");
+  task_environment_.RunUntilIdle();
+  EXPECT_EQ(server_.request_count(), 6u);
+  EXPECT_EQ(server_.batch_request_count(), 1u);
+  ExpectResultsMatchCalls(5u);
+}
+
+TEST_F(JsonRpcBatcherUnitTest, MissingResponseIsRetriedIndividually) {
+  CreateBatcher(base::TimeDelta(), 20);
+  server_.set_dropped_method("eth_blockNumber");
+
+  Call("eth_getBalance");
+  Call("eth_blockNumber");
+  task_environment_.RunUntilIdle();
+
+  EXPECT_EQ(server_.request_count(), 2u);
+  EXPECT_EQ(server_.batch_request_count(), 1u);
+  ExpectResultsMatchCalls(2u);
+  EXPECT_TRUE(batcher_->SupportsBatching(GURL(kRpcUrl)));
+}
+
+TEST_F(JsonRpcBatcherUnitTest, ServerErrorFailsEveryCall) {
+  CreateBatcher(base::TimeDelta(), 20);
+  server_.set_status_code(net::HTTP_SERVICE_UNAVAILABLE);
+
+  Call("eth_getBalance");
+  Call("eth_blockNumber");
+  task_environment_.RunUntilIdle();
+
+  EXPECT_EQ(server_.request_count(), 1u);
+  ASSERT_EQ(results_.size(), 2u);
+  for (const auto& [method, result] : results_) {
+    EXPECT_EQ(result.response_code(), net::HTTP_SERVICE_UNAVAILABLE);
+  }
+  EXPECT_TRUE(batcher_->SupportsBatching(GURL(kRpcUrl)));
+}
+
+TEST_F(JsonRpcBatcherUnitTest, NonRoundTripPayloadIsNotBatched) {
+  CreateBatcher(base::TimeDelta(), 20);
+
+  // uint64 values lose precision when parsed, so the payload must be sent
+  // unchanged.
+  const std::string payload =
+      R"({"id":1,"jsonrpc":"2.0","method":"sendTransaction",)"
+      R"("params":[18446744073709551615]})";
+  batcher_->Request(payload, true, GURL(kRpcUrl), base::DoNothing());
+  Call("eth_getBalance");
+  Call("eth_blockNumber");
+  task_environment_.RunUntilIdle();
+
+  EXPECT_EQ(server_.request_count(), 2u);
+  EXPECT_EQ(server_.batch_request_count(), 1u);
+  ASSERT_FALSE(server_.payloads().empty());
+  EXPECT_EQ(server_.payloads()[0], payload);
+  ExpectResultsMatchCalls(2u);
+}
+
+}  // namespace brave_wallet
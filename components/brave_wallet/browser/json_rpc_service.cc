@@ -5,6 +5,7 @@
 
 #include "brave/components/brave_wallet/browser/json_rpc_service.h"
 
+#include <algorithm>
 #include <memory>
 #include <unordered_set>
 #include <utility>
@@ -12,6 +13,7 @@
 #include "base/base64.h"
 #include "base/check.h"
 #include "base/feature_list.h"
+#include "base/files/file_path.h"
 #include "base/functional/bind.h"
 #include "base/no_destructor.h"
 #include "base/notreached.h"
@@ -25,6 +27,7 @@
 #include "brave/components/brave_wallet/browser/eth_response_parser.h"
 #include "brave/components/brave_wallet/browser/fil_requests.h"
 #include "brave/components/brave_wallet/browser/fil_response_parser.h"
+#include "brave/components/brave_wallet/browser/json_rpc_batcher.h"
 #include "brave/components/brave_wallet/browser/json_rpc_requests_helper.h"
 #include "brave/components/brave_wallet/browser/json_rpc_response_parser.h"
 #include "brave/components/brave_wallet/browser/nft_metadata_fetcher.h"
@@ -61,6 +64,9 @@ using brave_wallet::mojom::ResolveMethod;
 using decentralized_dns::EnsOffchainResolveMethod;
 using decentralized_dns::ResolveMethodTypes;
 
+constexpr base::FilePath::CharType kNftMetadataDatabaseFilename[] =
+    FILE_PATH_LITERAL("Brave Wallet NFT Metadata");
+
 // The domain name should be a-z | A-Z | 0-9 and hyphen(-).
 // The domain name should not start or end with hyphen (-).
 // The domain name can be a subdomain.
@@ -262,6 +268,16 @@ JsonRpcService::JsonRpcService(
         GetENSOffchainNetworkTrafficAnnotationTag(), url_loader_factory);
   }
 
+  if (base::FeatureList::IsEnabled(
+          features::kBraveWalletJsonRpcBatchingFeature)) {
+    json_rpc_batcher_ = std::make_unique<JsonRpcBatcher>(
+        base::BindRepeating(&JsonRpcService::SendRequest,
+                            base::Unretained(this)),
+        features::kJsonRpcBatchWindow.Get(),
+        static_cast<size_t>(
+            std::max(features::kJsonRpcMaxBatchSize.Get(), 1)));
+  }
+
   nft_metadata_fetcher_ =
       std::make_unique<NftMetadataFetcher>(url_loader_factory, this, prefs_);
 }
@@ -284,6 +300,12 @@ void JsonRpcService::SetAPIRequestHelperForTesting(
   }
 }
 
+void JsonRpcService::EnableNftMetadataCache(
+    const base::FilePath& wallet_base_directory) {
+  nft_metadata_fetcher_->EnableCache(
+      wallet_base_directory.Append(kNftMetadataDatabaseFilename));
+}
+
 JsonRpcService::~JsonRpcService() = default;
 
 // static
@@ -397,6 +419,14 @@ void JsonRpcService::RequestInternal(
     return;
   }
 
+  // Responses which need a conversion before parsing can't be split out of a
+  // batch response, so those calls are always sent on their own.
+  if (json_rpc_batcher_ && !conversion_callback) {
+    json_rpc_batcher_->Request(json_payload, auto_retry_on_network_change,
+                               network_url, std::move(callback));
+    return;
+  }
+
   api_request_helper_->Request(
       "POST", network_url, json_payload, "application/json",
       std::move(callback), MakeCommonJsonRpcHeaders(json_payload),
@@ -404,6 +434,16 @@ void JsonRpcService::RequestInternal(
       std::move(conversion_callback));
 }
 
+void JsonRpcService::SendRequest(const std::string& json_payload,
+                                 bool auto_retry_on_network_change,
+                                 const GURL& network_url,
+                                 RequestIntermediateCallback callback) {
+  api_request_helper_->Request(
+      "POST", network_url, json_payload, "application/json",
+      std::move(callback), MakeCommonJsonRpcHeaders(json_payload),
+      {.auto_retry_on_network_change = auto_retry_on_network_change});
+}
+
 void JsonRpcService::Request(const std::string& chain_id,
                              const std::string& json_payload,
                              bool auto_retry_on_network_change,
@@ -2823,6 +2863,10 @@ void JsonRpcService::Reset() {
   }
   switch_chain_callbacks_.clear();
   switch_chain_ids_.clear();
+
+  if (nft_metadata_fetcher_) {
+    nft_metadata_fetcher_->ClearCache();
+  }
 }
 
 void JsonRpcService::GetSolanaBalance(const std::string& pubkey,
@@ -22,6 +22,7 @@
 #include "brave/components/api_request_helper/api_request_helper.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_constants.h"
 #include "brave/components/brave_wallet/browser/ens_resolver_task.h"
+#include "brave/components/brave_wallet/browser/polling_scheduler.h"
 #include "brave/components/brave_wallet/browser/sns_resolver_task.h"
 #include "brave/components/brave_wallet/browser/solana_transaction.h"
 #include "brave/components/brave_wallet/browser/unstoppable_domains_multichain_calls.h"
@@ -35,6 +36,10 @@
 #include "url/gurl.h"
 #include "url/origin.h"
 
+namespace base {
+class FilePath;
+}  // namespace base
+
 namespace network {
 class SharedURLLoaderFactory;
 class SimpleURLLoader;
@@ -45,6 +50,7 @@ class PrefService;
 namespace brave_wallet {
 
 class EnsResolverTask;
+class JsonRpcBatcher;
 class NftMetadataFetcher;
 
 class JsonRpcService : public KeyedService, public mojom::JsonRpcService {
@@ -430,6 +436,12 @@ class JsonRpcService : public KeyedService, public mojom::JsonRpcService {
   void SetAPIRequestHelperForTesting(
       scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory);
 
+  // Caches NFT metadata on disk in |wallet_base_directory|.
+  void EnableNftMetadataCache(const base::FilePath& wallet_base_directory);
+
+  // Shared by all block and logs trackers so their polling is aligned.
+  PollingScheduler* polling_scheduler() { return &polling_scheduler_; }
+
   void SetSkipEthChainIdValidationForTesting(bool skipped) {
     skip_eth_chain_id_validation_for_testing_ = skipped;
   }
@@ -613,6 +625,11 @@ class JsonRpcService : public KeyedService, public mojom::JsonRpcService {
       const GURL& network_url,
       RequestIntermediateCallback callback,
       APIRequestHelper::ResponseConversionCallback conversion_callback);
+  // Sends |json_payload| as its own HTTP request, used by the batcher.
+  void SendRequest(const std::string& json_payload,
+                   bool auto_retry_on_network_change,
+                   const GURL& network_url,
+                   RequestIntermediateCallback callback);
   void OnEthChainIdValidatedForOrigin(const std::string& chain_id,
                                       const GURL& rpc_url,
                                       APIRequestResult api_request_result);
@@ -679,6 +696,9 @@ class JsonRpcService : public KeyedService, public mojom::JsonRpcService {
   scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory_;
   std::unique_ptr<APIRequestHelper> api_request_helper_;
   std::unique_ptr<APIRequestHelper> api_request_helper_ens_offchain_;
+  // Only set if kBraveWalletJsonRpcBatchingFeature is enabled.
+  std::unique_ptr<JsonRpcBatcher> json_rpc_batcher_;
+  PollingScheduler polling_scheduler_;
   // <chain_id, mojom::AddChainRequest>
   base::flat_map<std::string, mojom::AddChainRequestPtr>
       add_chain_pending_requests_;
@@ -0,0 +1,209 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_wallet/browser/nft_metadata_cache.h"
+
+#include <vector>
+
+#include "base/check.h"
+#include "base/functional/bind.h"
+#include "base/logging.h"
+#include "base/strings/strcat.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/string_util.h"
+#include "brave/components/sql_utils/database_error_callback.h"
+#include "sql/statement.h"
+#include "sql/transaction.h"
+
+namespace brave_wallet {
+
+namespace {
+
+constexpr char kTokenKeyPrefix[] = "token:";
+constexpr char kIpfsUriPrefix[] = "ipfs://";
+
+// Version 1: nft_metadata table.
+constexpr int kCurrentVersionNumber = 1;
+constexpr int kCompatibleVersionNumber = 1;
+
+}  // namespace
+
+NftMetadataCache::NftMetadataCache(const base::FilePath& db_file_path,
+                                   size_t max_size)
+    : database_({.exclusive_locking = true, .page_size = 4096}),
+      db_file_path_(db_file_path),
+      max_size_(max_size) {
+  DETACH_FROM_SEQUENCE(sequence_checker_);
+}
+
+NftMetadataCache::~NftMetadataCache() = default;
+
+// static
+std::string NftMetadataCache::GetTokenKey(mojom::CoinType coin,
+                                          const std::string& chain_id,
+                                          const std::string& contract_address,
+                                          const std::string& token_id) {
+  // Solana mint addresses are case sensitive.
+  const std::string address = coin == mojom::CoinType::ETH
+                                  ? base::ToLowerASCII(contract_address)
+                                  : contract_address;
+  return base::StrCat({kTokenKeyPrefix,
+                       base::NumberToString(static_cast<int>(coin)), ":",
+                       chain_id, ":", address, ":", token_id});
+}
+
+// static
+bool NftMetadataCache::IsFresh(const std::string& key,
+                               const NftMetadataCacheEntry& entry,
+                               base::Time now) {
+  if (base::StartsWith(key, kIpfsUriPrefix)) {
+    return true;
+  }
+
+  const base::TimeDelta age = now - entry.fetched_time;
+  if (age.is_negative()) {
+    return false;
+  }
+  return age < (base::StartsWith(key, kTokenKeyPrefix) ? kTokenTtl : kUriTtl);
+}
+
+bool NftMetadataCache::Init() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  database_.set_histogram_tag("BraveWalletNftMetadata");
+
+  // To recover from corruption.
+  database_.set_error_callback(base::BindRepeating(
+      &sql_utils::DatabaseErrorCallback, &database_, db_file_path_));
+
+  return database_.Open(db_file_path_) && InitSchema();
+}
+
+absl::optional<NftMetadataCacheEntry> NftMetadataCache::Get(
+    const std::string& key) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  if (!database_.is_open()) {
+    return absl::nullopt;
+  }
+
+  sql::Statement statement(database_.GetCachedStatement(
+      SQL_FROM_HERE,
+      "SELECT uri, metadata, etag, fetched_time FROM nft_metadata "
+      "WHERE key = ?"));
+  statement.BindString(0, key);
+  if (!statement.Step()) {
+    return absl::nullopt;
+  }
+
+  NftMetadataCacheEntry entry;
+  entry.uri = statement.ColumnString(0);
+  entry.metadata = statement.ColumnString(1);
+  entry.etag = statement.ColumnString(2);
+  entry.fetched_time = statement.ColumnTime(3);
+
+  sql::Statement touch(database_.GetCachedStatement(
+      SQL_FROM_HERE,
+      "UPDATE nft_metadata SET last_used_time = ? WHERE key = ?"));
+  touch.BindTime(0, base::Time::Now());
+  touch.BindString(1, key);
+  std::ignore = touch.Run();
+
+  return entry;
+}
+
+bool NftMetadataCache::Put(const std::string& key,
+                           const NftMetadataCacheEntry& entry) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  if (!database_.is_open()) {
+    return false;
+  }
+
+  sql::Statement statement(database_.GetCachedStatement(
+      SQL_FROM_HERE,
+      "INSERT OR REPLACE INTO nft_metadata (key, uri, metadata, etag, "
+      "fetched_time, last_used_time, size) VALUES (?,?,?,?,?,?,?)"));
+  statement.BindString(0, key);
+  statement.BindString(1, entry.uri);
+  statement.BindString(2, entry.metadata);
+  statement.BindString(3, entry.etag);
+  statement.BindTime(4, entry.fetched_time);
+  statement.BindTime(5, base::Time::Now());
+  statement.BindInt64(6, static_cast<int64_t>(key.size() + entry.uri.size() +
+                                              entry.metadata.size() +
+                                              entry.etag.size()));
+  return statement.Run() && EvictIfNeeded();
+}
+
+bool NftMetadataCache::DeleteAll() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  return database_.Execute("DELETE FROM nft_metadata");
+}
+
+bool NftMetadataCache::EvictIfNeeded() {
+  sql::Statement total(database_.GetCachedStatement(
+      SQL_FROM_HERE, "SELECT COALESCE(SUM(size), 0) FROM nft_metadata"));
+  if (!total.Step()) {
+    return false;
+  }
+  int64_t size = total.ColumnInt64(0);
+  if (size <= static_cast<int64_t>(max_size_)) {
+    return true;
+  }
+
+  std::vector<std::string> evicted_keys;
+  sql::Statement oldest(database_.GetUniqueStatement(
+      "SELECT key, size FROM nft_metadata ORDER BY last_used_time ASC"));
+  while (size > static_cast<int64_t>(max_size_) && oldest.Step()) {
+    evicted_keys.push_back(oldest.ColumnString(0));
+    size -= oldest.ColumnInt64(1);
+  }
+
+  sql::Transaction transaction(&database_);
+  if (!transaction.Begin()) {
+    return false;
+  }
+  sql::Statement evict(
+      database_.GetUniqueStatement("DELETE FROM nft_metadata WHERE key = ?"));
+  for (const auto& key : evicted_keys) {
+    evict.Reset(/*clear_bound_vars=*/true);
+    evict.BindString(0, key);
+    if (!evict.Run()) {
+      return false;
+    }
+  }
+  return transaction.Commit();
+}
+
+bool NftMetadataCache::InitSchema() {
+  sql::Transaction transaction(&database_);
+  if (!transaction.Begin() ||
+      !meta_table_.Init(&database_, kCurrentVersionNumber,
+                        kCompatibleVersionNumber)) {
+    return false;
+  }
+
+  if (meta_table_.GetCompatibleVersionNumber() > kCurrentVersionNumber) {
+    LOG(WARNING) << "NFT metadata database is too new";
+    return false;
+  }
+
+  if (!database_.DoesTableExist("nft_metadata") && !CreateTables()) {
+    return false;
+  }
+
+  return transaction.Commit();
+}
+
+bool NftMetadataCache::CreateTables() {
+  return database_.Execute(
+             "CREATE TABLE nft_metadata (key TEXT PRIMARY KEY NOT NULL, "
+             "uri TEXT NOT NULL, metadata TEXT NOT NULL, etag TEXT NOT NULL, "
+             "fetched_time INTEGER NOT NULL, "
+             "last_used_time INTEGER NOT NULL, size INTEGER NOT NULL)") &&
+         database_.Execute(
+             "CREATE INDEX nft_metadata_last_used_time_index ON nft_metadata "
+             "(last_used_time)");
+}
+
+}  // namespace brave_wallet
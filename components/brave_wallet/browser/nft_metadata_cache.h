@@ -0,0 +1,83 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_NFT_METADATA_CACHE_H_
+#define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_NFT_METADATA_CACHE_H_
+
+#include <string>
+
+#include "base/files/file_path.h"
+#include "base/sequence_checker.h"
+#include "base/time/time.h"
+#include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
+#include "sql/database.h"
+#include "sql/meta_table.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+
+namespace brave_wallet {
+
+struct NftMetadataCacheEntry {
+  // Metadata URI of the token, or the URI itself for URI entries.
+  std::string uri;
+  // Sanitized metadata JSON.
+  std::string metadata;
+  // ETag of the metadata response, used to revalidate it.
+  std::string etag;
+  base::Time fetched_time;
+};
+
+// Bounded SQLite backed cache of NFT metadata. Entries are keyed either by
+// token, see GetTokenKey, or by metadata URI. IPFS URIs address their content
+// so those entries never go stale. Least recently used entries are evicted
+// once the total size exceeds the limit. All methods block and must be called
+// on the same sequence.
+//
+// Token images are not cached here. The untrusted NFT display frame loads
+// them directly from the image URL in the metadata, so serving them locally
+// needs a data source for that frame and frontend changes. That is left as
+// separate work.
+class NftMetadataCache {
+ public:
+  static constexpr size_t kDefaultMaxSize = 10 * 1024 * 1024;
+  static constexpr base::TimeDelta kTokenTtl = base::Days(1);
+  static constexpr base::TimeDelta kUriTtl = base::Hours(1);
+
+  explicit NftMetadataCache(const base::FilePath& db_file_path,
+                            size_t max_size = kDefaultMaxSize);
+  ~NftMetadataCache();
+  NftMetadataCache(const NftMetadataCache&) = delete;
+  NftMetadataCache& operator=(const NftMetadataCache&) = delete;
+
+  static std::string GetTokenKey(mojom::CoinType coin,
+                                 const std::string& chain_id,
+                                 const std::string& contract_address,
+                                 const std::string& token_id);
+  // Whether |entry| stored under |key| can be used without revalidating it.
+  static bool IsFresh(const std::string& key,
+                      const NftMetadataCacheEntry& entry,
+                      base::Time now);
+
+  bool Init();
+
+  absl::optional<NftMetadataCacheEntry> Get(const std::string& key);
+  bool Put(const std::string& key, const NftMetadataCacheEntry& entry);
+  bool DeleteAll();
+
+ private:
+  bool InitSchema();
+  bool CreateTables();
+  bool EvictIfNeeded();
+
+  sql::Database database_;
+  sql::MetaTable meta_table_;
+  const base::FilePath db_file_path_;
+  const size_t max_size_;
+
+  SEQUENCE_CHECKER(sequence_checker_);
+};
+
+}  // namespace brave_wallet
+
+#endif  // BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_NFT_METADATA_CACHE_H_
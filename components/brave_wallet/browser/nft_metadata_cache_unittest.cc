@@ -0,0 +1,139 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_wallet/browser/nft_metadata_cache.h"
+
+#include <string>
+
+#include "base/files/scoped_temp_dir.h"
+#include "base/test/task_environment.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace brave_wallet {
+
+namespace {
+
+NftMetadataCacheEntry MakeEntry(const std::string& metadata,
+                                base::Time fetched_time) {
+  NftMetadataCacheEntry entry;
+  entry.uri = "https://example.com/1";
+  entry.metadata = metadata;
+  entry.etag = "\"etag\"";
+  entry.fetched_time = fetched_time;
+  return entry;
+}
+
+}  // namespace
+
+class NftMetadataCacheUnitTest : public testing::Test {
+ protected:
+  void SetUp() override { ASSERT_TRUE(temp_dir_.CreateUniqueTempDir()); }
+
+  base::FilePath GetDbPath() const {
+    return temp_dir_.GetPath().Append(FILE_PATH_LITERAL("nft_metadata"));
+  }
+
+  base::test::TaskEnvironment task_environment_{
+      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
+  base::ScopedTempDir temp_dir_;
+};
+
+TEST_F(NftMetadataCacheUnitTest, GetTokenKey) {
+  EXPECT_EQ(NftMetadataCache::GetTokenKey(mojom::CoinType::ETH, "0x1",
+                                          "0xABCdef", "0x1"),
+            NftMetadataCache::GetTokenKey(mojom::CoinType::ETH, "0x1",
+                                          "0xabcdef", "0x1"));
+  // Solana addresses are case sensitive.
+  EXPECT_NE(NftMetadataCache::GetTokenKey(mojom::CoinType::SOL, "0x65",
+                                          "ABCdef", ""),
+            NftMetadataCache::GetTokenKey(mojom::CoinType::SOL, "0x65",
+                                          "abcdef", ""));
+  EXPECT_NE(NftMetadataCache::GetTokenKey(mojom::CoinType::ETH, "0x1",
+                                          "0xabcdef", "0x1"),
+            NftMetadataCache::GetTokenKey(mojom::CoinType::ETH, "0x5",
+                                          "0xabcdef", "0x1"));
+}
+
+TEST_F(NftMetadataCacheUnitTest, IsFresh) {
+  const base::Time now = base::Time::Now();
+  const std::string token_key = NftMetadataCache::GetTokenKey(
+      mojom::CoinType::ETH, "0x1", "0xabcdef", "0x1");
+
+  auto entry = MakeEntry("{}", now - base::Days(365));
+  EXPECT_TRUE(NftMetadataCache::IsFresh("ipfs://bafy/1", entry, now));
+  EXPECT_FALSE(NftMetadataCache::IsFresh(token_key, entry, now));
+  EXPECT_FALSE(
+      NftMetadataCache::IsFresh("https://example.com/1", entry, now));
+
+  entry.fetched_time = now - base::Hours(2);
+  EXPECT_TRUE(NftMetadataCache::IsFresh(token_key, entry, now));
+  EXPECT_FALSE(
+      NftMetadataCache::IsFresh("https://example.com/1", entry, now));
+
+  entry.fetched_time = now - base::Minutes(10);
+  EXPECT_TRUE(NftMetadataCache::IsFresh("https://example.com/1", entry, now));
+
+  // Entries fetched in the future, e.g. after a clock change, are stale.
+  entry.fetched_time = now + base::Minutes(10);
+  EXPECT_FALSE(NftMetadataCache::IsFresh(token_key, entry, now));
+}
+
+TEST_F(NftMetadataCacheUnitTest, PutAndGet) {
+  const base::Time fetched_time = base::Time::Now();
+  {
+    NftMetadataCache cache(GetDbPath());
+    ASSERT_TRUE(cache.Init());
+    EXPECT_FALSE(cache.Get("https://example.com/1"));
+
+    ASSERT_TRUE(cache.Put("https://example.com/1",
+                          MakeEntry(R"({"name":"1"})", fetched_time)));
+    auto entry = cache.Get("https://example.com/1");
+    ASSERT_TRUE(entry);
+    EXPECT_EQ(entry->uri, "https://example.com/1");
+    EXPECT_EQ(entry->metadata, R"({"name":"1"})");
+    EXPECT_EQ(entry->etag, "\"etag\"");
+    EXPECT_EQ(entry->fetched_time, fetched_time);
+
+    // Putting the same key replaces the entry.
+    ASSERT_TRUE(cache.Put("https://example.com/1",
+                          MakeEntry(R"({"name":"2"})", fetched_time)));
+    EXPECT_EQ(cache.Get("https://example.com/1")->metadata, R"({"name":"2"})");
+  }
+
+  // Entries are persisted.
+  NftMetadataCache cache(GetDbPath());
+  ASSERT_TRUE(cache.Init());
+  auto entry = cache.Get("https://example.com/1");
+  ASSERT_TRUE(entry);
+  EXPECT_EQ(entry->metadata, R"({"name":"2"})");
+
+  ASSERT_TRUE(cache.DeleteAll());
+  EXPECT_FALSE(cache.Get("https://example.com/1"));
+}
+
+TEST_F(NftMetadataCacheUnitTest, EvictLeastRecentlyUsed) {
+  const std::string metadata(100, 'a');
+  NftMetadataCache cache(GetDbPath(), /*max_size=*/500);
+  ASSERT_TRUE(cache.Init());
+
+  ASSERT_TRUE(cache.Put("1", MakeEntry(metadata, base::Time::Now())));
+  task_environment_.FastForwardBy(base::Seconds(1));
+  ASSERT_TRUE(cache.Put("2", MakeEntry(metadata, base::Time::Now())));
+  task_environment_.FastForwardBy(base::Seconds(1));
+  ASSERT_TRUE(cache.Put("3", MakeEntry(metadata, base::Time::Now())));
+  task_environment_.FastForwardBy(base::Seconds(1));
+
+  // Reading "1" makes "2" the least recently used entry.
+  EXPECT_TRUE(cache.Get("1"));
+  task_environment_.FastForwardBy(base::Seconds(1));
+  ASSERT_TRUE(cache.Put("4", MakeEntry(metadata, base::Time::Now())));
+
+  EXPECT_TRUE(cache.Get("1"));
+  EXPECT_FALSE(cache.Get("2"));
+  EXPECT_TRUE(cache.Get("3"));
+  EXPECT_TRUE(cache.Get("4"));
+}
+
+}  // namespace brave_wallet
@@ -9,6 +9,9 @@
 #include <vector>
 
 #include "base/base64.h"
+#include "base/files/file_path.h"
+#include "base/strings/strcat.h"
+#include "base/task/thread_pool.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_utils.h"
 #include "brave/components/brave_wallet/browser/eth_data_builder.h"
 #include "brave/components/brave_wallet/browser/eth_response_parser.h"
@@ -85,6 +88,21 @@ NftMetadataFetcher::NftMetadataFetcher(
 
 NftMetadataFetcher::~NftMetadataFetcher() = default;
 
+void NftMetadataFetcher::EnableCache(const base::FilePath& db_file_path) {
+  cache_ = base::SequenceBound<NftMetadataCache>(
+      base::ThreadPool::CreateSequencedTaskRunner(
+          {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
+           base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN}),
+      db_file_path);
+  cache_.AsyncCall(&NftMetadataCache::Init);
+}
+
+void NftMetadataFetcher::ClearCache() {
+  if (!cache_.is_null()) {
+    cache_.AsyncCall(&NftMetadataCache::DeleteAll);
+  }
+}
+
 void NftMetadataFetcher::GetEthTokenMetadata(
     const std::string& contract_address,
     const std::string& token_id,
@@ -106,6 +124,76 @@ void NftMetadataFetcher::GetEthTokenMetadata(
     return;
   }
 
+  if (cache_.is_null()) {
+    RequestEthTokenMetadata(contract_address, token_id, chain_id, interface_id,
+                            std::move(callback));
+    return;
+  }
+
+  // The interface decides how the token URI is read, so it is part of the key.
+  const std::string cache_key = NftMetadataCache::GetTokenKey(
+      mojom::CoinType::ETH, chain_id, contract_address,
+      base::StrCat({token_id, ":", interface_id}));
+  cache_.AsyncCall(&NftMetadataCache::Get)
+      .WithArgs(cache_key)
+      .Then(base::BindOnce(&NftMetadataFetcher::OnGetCachedEthTokenMetadata,
+                           weak_ptr_factory_.GetWeakPtr(), contract_address,
+                           token_id, chain_id, interface_id, cache_key,
+                           std::move(callback)));
+}
+
+void NftMetadataFetcher::OnGetCachedEthTokenMetadata(
+    const std::string& contract_address,
+    const std::string& token_id,
+    const std::string& chain_id,
+    const std::string& interface_id,
+    const std::string& cache_key,
+    GetEthTokenMetadataCallback callback,
+    absl::optional<NftMetadataCacheEntry> entry) {
+  if (entry &&
+      NftMetadataCache::IsFresh(cache_key, *entry, base::Time::Now())) {
+    std::move(callback).Run(entry->uri, entry->metadata,
+                            mojom::ProviderError::kSuccess, "");
+    return;
+  }
+
+  RequestEthTokenMetadata(
+      contract_address, token_id, chain_id, interface_id,
+      base::BindOnce(&NftMetadataFetcher::OnRequestEthTokenMetadata,
+                     weak_ptr_factory_.GetWeakPtr(), cache_key,
+                     std::move(callback)));
+}
+
+void NftMetadataFetcher::OnRequestEthTokenMetadata(
+    const std::string& cache_key,
+    GetEthTokenMetadataCallback callback,
+    const std::string& token_url,
+    const std::string& result,
+    mojom::ProviderError error,
+    const std::string& error_message) {
+  if (error == mojom::ProviderError::kSuccess) {
+    CacheTokenMetadata(cache_key, token_url, result);
+  }
+  std::move(callback).Run(token_url, result, error, error_message);
+}
+
+void NftMetadataFetcher::CacheTokenMetadata(const std::string& cache_key,
+                                            const std::string& token_url,
+                                            const std::string& result) {
+  NftMetadataCacheEntry entry;
+  entry.uri = token_url;
+  entry.metadata = result;
+  entry.fetched_time = base::Time::Now();
+  cache_.AsyncCall(&NftMetadataCache::Put)
+      .WithArgs(cache_key, std::move(entry));
+}
+
+void NftMetadataFetcher::RequestEthTokenMetadata(
+    const std::string& contract_address,
+    const std::string& token_id,
+    const std::string& chain_id,
+    const std::string& interface_id,
+    GetEthTokenMetadataCallback callback) {
   auto internal_callback =
       base::BindOnce(&NftMetadataFetcher::OnGetSupportsInterface,
                      weak_ptr_factory_.GetWeakPtr(), contract_address,
@@ -186,6 +274,17 @@ void NftMetadataFetcher::FetchMetadata(
     return;
   }
 
+  // Only remote metadata is cached, data URIs are parsed locally.
+  if (scheme != url::kDataScheme && !cache_.is_null()) {
+    const std::string cache_key = url.spec();
+    cache_.AsyncCall(&NftMetadataCache::Get)
+        .WithArgs(cache_key)
+        .Then(base::BindOnce(&NftMetadataFetcher::OnGetCachedMetadata,
+                             weak_ptr_factory_.GetWeakPtr(), std::move(url),
+                             std::move(callback)));
+    return;
+  }
+
   if (scheme == url::kDataScheme) {
     if (!eth::ParseDataURIAndExtractJSON(url, &metadata_json)) {
       std::move(callback).Run(
@@ -202,8 +301,31 @@ void NftMetadataFetcher::FetchMetadata(
     return;
   }
 
+  RequestMetadata(std::move(url), absl::nullopt, std::move(callback));
+}
+
+void NftMetadataFetcher::OnGetCachedMetadata(
+    GURL url,
+    GetTokenMetadataIntermediateCallback callback,
+    absl::optional<NftMetadataCacheEntry> entry) {
+  if (entry &&
+      NftMetadataCache::IsFresh(url.spec(), *entry, base::Time::Now())) {
+    std::move(callback).Run(entry->metadata, 0, "");  // 0 is kSuccess
+    return;
+  }
+
+  RequestMetadata(std::move(url), std::move(entry), std::move(callback));
+}
+
+void NftMetadataFetcher::RequestMetadata(
+    GURL url,
+    absl::optional<NftMetadataCacheEntry> cached_entry,
+    GetTokenMetadataIntermediateCallback callback) {
+  // IPFS metadata is cached by its ipfs:// URI rather than by the gateway URL
+  // it is fetched from.
+  const std::string cache_key = url.spec();
 #if BUILDFLAG(ENABLE_IPFS)
-  if (scheme == ipfs::kIPFSScheme &&
+  if (url.SchemeIs(ipfs::kIPFSScheme) &&
       !ipfs::TranslateIPFSURI(url, &url, ipfs::GetDefaultNFTIPFSGateway(prefs_),
                               false)) {
     std::move(callback).Run(
@@ -213,11 +335,18 @@ void NftMetadataFetcher::FetchMetadata(
   }
 #endif
 
-  auto internal_callback =
-      base::BindOnce(&NftMetadataFetcher::OnGetTokenMetadataPayload,
-                     weak_ptr_factory_.GetWeakPtr(), std::move(callback));
+  base::flat_map<std::string, std::string> request_headers;
+  if (cached_entry && !cached_entry->etag.empty()) {
+    request_headers["If-None-Match"] = cached_entry->etag;
+  }
+
+  auto internal_callback = base::BindOnce(
+      &NftMetadataFetcher::OnGetTokenMetadataPayload,
+      weak_ptr_factory_.GetWeakPtr(), cache_key, std::move(cached_entry),
+      std::move(callback));
   api_request_helper_->Request(
-      "GET", url, "", "", std::move(internal_callback), {},
+      "GET", url, "", "", std::move(internal_callback),
+      std::move(request_headers),
       {.auto_retry_on_network_change = true, .enable_cache = true});
 }
 
@@ -236,9 +365,20 @@ void NftMetadataFetcher::OnSanitizeTokenMetadata(
 }
 
 void NftMetadataFetcher::OnGetTokenMetadataPayload(
+    const std::string& cache_key,
+    absl::optional<NftMetadataCacheEntry> cached_entry,
     GetTokenMetadataIntermediateCallback callback,
     APIRequestResult api_request_result) {
-  mojom::ProviderErrorUnionPtr error;
+  // Not modified, the cached metadata is fresh again.
+  if (api_request_result.response_code() == 304 && cached_entry) {
+    cached_entry->fetched_time = base::Time::Now();
+    std::string metadata = cached_entry->metadata;
+    cache_.AsyncCall(&NftMetadataCache::Put)
+        .WithArgs(cache_key, std::move(*cached_entry));
+    std::move(callback).Run(metadata, 0, "");  // 0 is kSuccess
+    return;
+  }
+
   if (!api_request_result.Is2XXResponseCode()) {
     std::move(callback).Run(
         "", static_cast<int>(mojom::JsonRpcError::kInternalError),
@@ -254,6 +394,19 @@ void NftMetadataFetcher::OnGetTokenMetadataPayload(
     return;
   }
 
+  if (!cache_.is_null()) {
+    NftMetadataCacheEntry entry;
+    entry.uri = cache_key;
+    entry.metadata = api_request_result.body();
+    auto etag = api_request_result.headers().find("etag");
+    if (etag != api_request_result.headers().end()) {
+      entry.etag = etag->second;
+    }
+    entry.fetched_time = base::Time::Now();
+    cache_.AsyncCall(&NftMetadataCache::Put)
+        .WithArgs(cache_key, std::move(entry));
+  }
+
   std::move(callback).Run(api_request_result.body(), 0, "");  // 0 is kSuccess
 }
 
@@ -274,6 +427,58 @@ void NftMetadataFetcher::GetSolTokenMetadata(
     const std::string& chain_id,
     const std::string& token_mint_address,
     GetSolTokenMetadataCallback callback) {
+  if (cache_.is_null()) {
+    RequestSolTokenMetadata(chain_id, token_mint_address, std::move(callback));
+    return;
+  }
+
+  const std::string cache_key = NftMetadataCache::GetTokenKey(
+      mojom::CoinType::SOL, chain_id, token_mint_address, "");
+  cache_.AsyncCall(&NftMetadataCache::Get)
+      .WithArgs(cache_key)
+      .Then(base::BindOnce(&NftMetadataFetcher::OnGetCachedSolTokenMetadata,
+                           weak_ptr_factory_.GetWeakPtr(), chain_id,
+                           token_mint_address, cache_key,
+                           std::move(callback)));
+}
+
+void NftMetadataFetcher::OnGetCachedSolTokenMetadata(
+    const std::string& chain_id,
+    const std::string& token_mint_address,
+    const std::string& cache_key,
+    GetSolTokenMetadataCallback callback,
+    absl::optional<NftMetadataCacheEntry> entry) {
+  if (entry &&
+      NftMetadataCache::IsFresh(cache_key, *entry, base::Time::Now())) {
+    std::move(callback).Run(entry->uri, entry->metadata,
+                            mojom::SolanaProviderError::kSuccess, "");
+    return;
+  }
+
+  RequestSolTokenMetadata(
+      chain_id, token_mint_address,
+      base::BindOnce(&NftMetadataFetcher::OnRequestSolTokenMetadata,
+                     weak_ptr_factory_.GetWeakPtr(), cache_key,
+                     std::move(callback)));
+}
+
+void NftMetadataFetcher::OnRequestSolTokenMetadata(
+    const std::string& cache_key,
+    GetSolTokenMetadataCallback callback,
+    const std::string& token_url,
+    const std::string& result,
+    mojom::SolanaProviderError error,
+    const std::string& error_message) {
+  if (error == mojom::SolanaProviderError::kSuccess) {
+    CacheTokenMetadata(cache_key, token_url, result);
+  }
+  std::move(callback).Run(token_url, result, error, error_message);
+}
+
+void NftMetadataFetcher::RequestSolTokenMetadata(
+    const std::string& chain_id,
+    const std::string& token_mint_address,
+    GetSolTokenMetadataCallback callback) {
   // Derive metadata PDA for the NFT accounts
   absl::optional<std::string> associated_metadata_account =
       SolanaKeyring::GetAssociatedMetadataAccount(token_mint_address);
@@ -13,12 +13,18 @@
 #include "base/gtest_prod_util.h"
 #include "base/memory/raw_ptr.h"
 #include "base/memory/weak_ptr.h"
+#include "base/threading/sequence_bound.h"
 #include "brave/components/api_request_helper/api_request_helper.h"
 #include "brave/components/brave_wallet/browser/json_rpc_service.h"
+#include "brave/components/brave_wallet/browser/nft_metadata_cache.h"
 #include "services/data_decoder/public/cpp/json_sanitizer.h"
 
 class PrefService;
 
+namespace base {
+class FilePath;
+}  // namespace base
+
 namespace brave_wallet {
 
 class JsonRpcService;
@@ -34,6 +40,11 @@ class NftMetadataFetcher {
   NftMetadataFetcher& operator=(NftMetadataFetcher&) = delete;
   ~NftMetadataFetcher();
 
+  // Keeps fetched metadata in an NftMetadataCache at |db_file_path|, so it is
+  // served locally until it goes stale.
+  void EnableCache(const base::FilePath& db_file_path);
+  void ClearCache();
+
   using APIRequestHelper = api_request_helper::APIRequestHelper;
   using APIRequestResult = api_request_helper::APIRequestResult;
   using GetEthTokenMetadataCallback =
@@ -56,6 +67,44 @@ class NftMetadataFetcher {
                            GetSolTokenMetadataCallback callback);
 
  private:
+  void RequestEthTokenMetadata(const std::string& contract_address,
+                               const std::string& token_id,
+                               const std::string& chain_id,
+                               const std::string& interface_id,
+                               GetEthTokenMetadataCallback callback);
+  void OnGetCachedEthTokenMetadata(
+      const std::string& contract_address,
+      const std::string& token_id,
+      const std::string& chain_id,
+      const std::string& interface_id,
+      const std::string& cache_key,
+      GetEthTokenMetadataCallback callback,
+      absl::optional<NftMetadataCacheEntry> entry);
+  void OnRequestEthTokenMetadata(const std::string& cache_key,
+                                 GetEthTokenMetadataCallback callback,
+                                 const std::string& token_url,
+                                 const std::string& result,
+                                 mojom::ProviderError error,
+                                 const std::string& error_message);
+  void RequestSolTokenMetadata(const std::string& chain_id,
+                               const std::string& token_mint_address,
+                               GetSolTokenMetadataCallback callback);
+  void OnGetCachedSolTokenMetadata(
+      const std::string& chain_id,
+      const std::string& token_mint_address,
+      const std::string& cache_key,
+      GetSolTokenMetadataCallback callback,
+      absl::optional<NftMetadataCacheEntry> entry);
+  void OnRequestSolTokenMetadata(const std::string& cache_key,
+                                 GetSolTokenMetadataCallback callback,
+                                 const std::string& token_url,
+                                 const std::string& result,
+                                 mojom::SolanaProviderError error,
+                                 const std::string& error_message);
+  void CacheTokenMetadata(const std::string& cache_key,
+                          const std::string& token_url,
+                          const std::string& result);
+
   void OnGetSupportsInterface(const std::string& contract_address,
                               const std::string& interface_id,
                               const std::string& token_id,
@@ -77,10 +126,20 @@ class NftMetadataFetcher {
                               int error,
                               const std::string& error_message)>;
   void FetchMetadata(GURL url, GetTokenMetadataIntermediateCallback callback);
+  void OnGetCachedMetadata(GURL url,
+                           GetTokenMetadataIntermediateCallback callback,
+                           absl::optional<NftMetadataCacheEntry> entry);
+  // Revalidates |cached_entry| if it has an ETag.
+  void RequestMetadata(GURL url,
+                       absl::optional<NftMetadataCacheEntry> cached_entry,
+                       GetTokenMetadataIntermediateCallback callback);
   void OnSanitizeTokenMetadata(GetTokenMetadataIntermediateCallback callback,
                                data_decoder::JsonSanitizer::Result result);
-  void OnGetTokenMetadataPayload(GetTokenMetadataIntermediateCallback callback,
-                                 APIRequestResult api_request_result);
+  void OnGetTokenMetadataPayload(
+      const std::string& cache_key,
+      absl::optional<NftMetadataCacheEntry> cached_entry,
+      GetTokenMetadataIntermediateCallback callback,
+      APIRequestResult api_request_result);
   void OnGetSolanaAccountInfoTokenMetadata(
       GetSolTokenMetadataCallback callback,
       absl::optional<SolanaAccountInfo> account_info,
@@ -107,6 +166,7 @@ class NftMetadataFetcher {
   std::unique_ptr<APIRequestHelper> api_request_helper_;
   raw_ptr<JsonRpcService> json_rpc_service_ = nullptr;
   raw_ptr<PrefService> prefs_ = nullptr;
+  base::SequenceBound<NftMetadataCache> cache_;
   base::WeakPtrFactory<NftMetadataFetcher> weak_ptr_factory_;
 };
 
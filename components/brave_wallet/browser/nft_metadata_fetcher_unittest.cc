@@ -8,12 +8,14 @@
 #include <memory>
 
 #include "base/base64.h"
+#include "base/files/scoped_temp_dir.h"
 #include "base/json/json_reader.h"
 #include "base/test/bind.h"
 #include "base/test/task_environment.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_prefs.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_utils.h"
 #include "brave/components/brave_wallet/browser/json_rpc_service.h"
+#include "brave/components/brave_wallet/browser/nft_metadata_cache.h"
 #include "brave/components/brave_wallet/common/hash_utils.h"
 #include "brave/components/ipfs/ipfs_service.h"
 #include "components/sync_preferences/testing_pref_service_syncable.h"
@@ -21,6 +23,7 @@
 #include "services/network/public/cpp/weak_wrapper_shared_url_loader_factory.h"
 #include "services/network/test/test_url_loader_factory.h"
 #include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
 #include "ui/base/l10n/l10n_util.h"
 
 namespace brave_wallet {
@@ -262,6 +265,22 @@ class NftMetadataFetcherUnitTest : public testing::Test {
         }));
   }
 
+  // Responds with |status| after checking the ETag the request revalidates.
+  void SetRevalidateInterceptor(const absl::optional<std::string>& etag,
+                                net::HttpStatusCode status) {
+    url_loader_factory_.SetInterceptor(base::BindLambdaForTesting(
+        [&, etag, status](const network::ResourceRequest& request) {
+          std::string if_none_match;
+          EXPECT_EQ(request.headers.GetHeader("If-None-Match", &if_none_match),
+                    etag.has_value());
+          if (etag) {
+            EXPECT_EQ(if_none_match, *etag);
+          }
+          url_loader_factory_.ClearResponses();
+          url_loader_factory_.AddResponse(request.url.spec(), "", status);
+        }));
+  }
+
   void SetSolTokenMetadataInterceptor(
       const GURL& expected_rpc_url,
       const std::string& get_account_info_response,
@@ -329,6 +348,96 @@ TEST_F(NftMetadataFetcherUnitTest, FetchMetadata) {
                     static_cast<int>(mojom::ProviderError::kSuccess), "");
 }
 
+TEST_F(NftMetadataFetcherUnitTest, FetchMetadataFromCache) {
+  base::ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+  nft_metadata_fetcher_->EnableCache(
+      temp_dir.GetPath().Append(FILE_PATH_LITERAL("nft_metadata")));
+
+  GURL url = GURL("https://example.com");
+  SetInterceptor(url, https_metadata_response);
+  TestFetchMetadata(url, https_metadata_response,
+                    static_cast<int>(mojom::ProviderError::kSuccess), "");
+
+  // Fresh entries are returned without a request.
+  SetHTTPRequestTimeoutInterceptor();
+  TestFetchMetadata(url, https_metadata_response,
+                    static_cast<int>(mojom::ProviderError::kSuccess), "");
+
+  // Other URLs are still fetched.
+  TestFetchMetadata(GURL("https://example.com/other"), "",
+                    static_cast<int>(mojom::JsonRpcError::kInternalError),
+                    l10n_util::GetStringUTF8(IDS_WALLET_INTERNAL_ERROR));
+
+  nft_metadata_fetcher_->ClearCache();
+  TestFetchMetadata(url, "",
+                    static_cast<int>(mojom::JsonRpcError::kInternalError),
+                    l10n_util::GetStringUTF8(IDS_WALLET_INTERNAL_ERROR));
+
+  // Let the cache close before the directory is deleted.
+  nft_metadata_fetcher_.reset();
+  task_environment_.RunUntilIdle();
+}
+
+TEST_F(NftMetadataFetcherUnitTest, FetchMetadataRevalidatesStaleCacheEntry) {
+  base::ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+  const base::FilePath db_file_path =
+      temp_dir.GetPath().Append(FILE_PATH_LITERAL("nft_metadata"));
+
+  GURL url = GURL("https://example.com");
+  {
+    NftMetadataCache cache(db_file_path);
+    ASSERT_TRUE(cache.Init());
+    NftMetadataCacheEntry entry;
+    entry.uri = url.spec();
+    entry.metadata = https_metadata_response;
+    entry.etag = "\"etag\"";
+    entry.fetched_time =
+        base::Time::Now() - NftMetadataCache::kUriTtl - base::Minutes(1);
+    ASSERT_FALSE(NftMetadataCache::IsFresh(url.spec(), entry,
+                                           base::Time::Now()));
+    ASSERT_TRUE(cache.Put(url.spec(), entry));
+  }
+
+  nft_metadata_fetcher_->EnableCache(db_file_path);
+
+  // Not modified yields the cached metadata.
+  SetRevalidateInterceptor("\"etag\"", net::HTTP_NOT_MODIFIED);
+  TestFetchMetadata(url, https_metadata_response,
+                    static_cast<int>(mojom::ProviderError::kSuccess), "");
+
+  // Let the cache close before reading the entry back.
+  nft_metadata_fetcher_.reset();
+  task_environment_.RunUntilIdle();
+
+  NftMetadataCache cache(db_file_path);
+  ASSERT_TRUE(cache.Init());
+  absl::optional<NftMetadataCacheEntry> entry = cache.Get(url.spec());
+  ASSERT_TRUE(entry);
+  EXPECT_EQ(entry->metadata, https_metadata_response);
+  EXPECT_EQ(entry->etag, "\"etag\"");
+  EXPECT_TRUE(
+      NftMetadataCache::IsFresh(url.spec(), *entry, base::Time::Now()));
+}
+
+TEST_F(NftMetadataFetcherUnitTest, FetchMetadataNotModifiedWithoutCacheEntry) {
+  base::ScopedTempDir temp_dir;
+  ASSERT_TRUE(temp_dir.CreateUniqueTempDir());
+  nft_metadata_fetcher_->EnableCache(
+      temp_dir.GetPath().Append(FILE_PATH_LITERAL("nft_metadata")));
+
+  // Nothing is cached to revalidate, so not modified is an error.
+  SetRevalidateInterceptor(absl::nullopt, net::HTTP_NOT_MODIFIED);
+  TestFetchMetadata(GURL("https://example.com"), "",
+                    static_cast<int>(mojom::JsonRpcError::kInternalError),
+                    l10n_util::GetStringUTF8(IDS_WALLET_INTERNAL_ERROR));
+
+  // Let the cache close before the directory is deleted.
+  nft_metadata_fetcher_.reset();
+  task_environment_.RunUntilIdle();
+}
+
 TEST_F(NftMetadataFetcherUnitTest, GetEthTokenMetadata) {
   // Decoded result is `https://invisiblefriends.io/api/1817`
   const std::string https_token_uri_response = R"({
@@ -6,6 +6,7 @@
 #include "brave/components/brave_wallet/browser/nonce_tracker.h"
 
 #include <algorithm>
+#include <utility>
 
 #include "brave/components/brave_wallet/browser/json_rpc_service.h"
 #include "brave/components/brave_wallet/browser/tx_meta.h"
@@ -22,6 +23,10 @@ NonceTracker::NonceTracker(TxStateManager* tx_state_manager,
 
 NonceTracker::~NonceTracker() = default;
 
+void NonceTracker::RunWhenTxsLoaded(base::OnceClosure callback) {
+  tx_state_manager_->RunWhenLoaded(std::move(callback));
+}
+
 absl::optional<uint256_t> NonceTracker::GetFinalNonce(
     const std::string& chain_id,
     const std::string& from,
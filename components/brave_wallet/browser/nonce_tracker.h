@@ -43,6 +43,10 @@ class NonceTracker {
   base::Lock* GetLock() { return &nonce_lock_; }
 
  protected:
+  // Runs |callback| once stored transactions are loaded, so the nonces of
+  // pending transactions from earlier sessions are not handed out again.
+  void RunWhenTxsLoaded(base::OnceClosure callback);
+
   absl::optional<uint256_t> GetFinalNonce(const std::string& chain_id,
                                           const std::string& from,
                                           uint256_t result);
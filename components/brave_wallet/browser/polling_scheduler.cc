@@ -0,0 +1,120 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_wallet/browser/polling_scheduler.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "base/check.h"
+#include "base/containers/contains.h"
+#include "base/functional/bind.h"
+
+namespace brave_wallet {
+
+PollingScheduler::Task::Task() = default;
+PollingScheduler::Task::~Task() = default;
+PollingScheduler::Task::Task(Task&&) = default;
+PollingScheduler::Task& PollingScheduler::Task::operator=(Task&&) = default;
+
+PollingScheduler::PollingScheduler() = default;
+PollingScheduler::~PollingScheduler() = default;
+
+PollingScheduler::TaskId PollingScheduler::AddTask(
+    base::TimeDelta interval,
+    base::RepeatingClosure task,
+    ShouldRunCallback should_run) {
+  DCHECK(task);
+  DCHECK(interval.is_positive());
+  const TaskId id = next_task_id_++;
+  Task& entry = tasks_[id];
+  entry.interval = interval;
+  entry.current_interval = interval;
+  entry.last_run = base::TimeTicks::Now();
+  entry.next_run = entry.last_run + interval;
+  entry.task = std::move(task);
+  entry.should_run = std::move(should_run);
+  ScheduleNextTick();
+  return id;
+}
+
+void PollingScheduler::RemoveTask(TaskId id) {
+  if (tasks_.erase(id)) {
+    ScheduleNextTick();
+  }
+}
+
+bool PollingScheduler::HasTask(TaskId id) const {
+  return base::Contains(tasks_, id);
+}
+
+void PollingScheduler::ReportProgress(TaskId id, bool progressed) {
+  auto iter = tasks_.find(id);
+  if (iter == tasks_.end()) {
+    return;
+  }
+  Task& entry = iter->second;
+  const base::TimeDelta current_interval =
+      progressed ? entry.interval
+                 : std::min(entry.current_interval * 2,
+                            entry.interval * kMaxBackoffFactor);
+  if (current_interval == entry.current_interval) {
+    return;
+  }
+  entry.current_interval = current_interval;
+  entry.next_run = entry.last_run + current_interval;
+  ScheduleNextTick();
+}
+
+base::TimeDelta PollingScheduler::GetCurrentIntervalForTesting(
+    TaskId id) const {
+  auto iter = tasks_.find(id);
+  return iter == tasks_.end() ? base::TimeDelta()
+                              : iter->second.current_interval;
+}
+
+void PollingScheduler::ScheduleNextTick() {
+  if (tasks_.empty()) {
+    timer_.Stop();
+    return;
+  }
+
+  base::TimeTicks next_tick = base::TimeTicks::Max();
+  for (const auto& [id, entry] : tasks_) {
+    next_tick = std::min(next_tick, entry.next_run);
+  }
+  timer_.Start(FROM_HERE,
+               std::max(next_tick - base::TimeTicks::Now(), base::TimeDelta()),
+               base::BindOnce(&PollingScheduler::OnTick,
+                              base::Unretained(this)));
+}
+
+void PollingScheduler::OnTick() {
+  const base::TimeTicks now = base::TimeTicks::Now();
+  std::vector<TaskId> due;
+  for (auto& [id, entry] : tasks_) {
+    if (entry.next_run > now + kTickAlignment) {
+      continue;
+    }
+    entry.last_run = now;
+    entry.next_run = now + entry.current_interval;
+    if (!entry.should_run || entry.should_run.Run()) {
+      due.push_back(id);
+    }
+  }
+  ScheduleNextTick();
+
+  // Tasks may add or remove tasks while running.
+  for (TaskId id : due) {
+    auto iter = tasks_.find(id);
+    if (iter != tasks_.end()) {
+      base::RepeatingClosure task = iter->second.task;
+      task.Run();
+    }
+  }
+}
+
+}  // namespace brave_wallet
@@ -0,0 +1,75 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_POLLING_SCHEDULER_H_
+#define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_POLLING_SCHEDULER_H_
+
+#include <map>
+
+#include "base/functional/callback.h"
+#include "base/time/time.h"
+#include "base/timer/timer.h"
+
+namespace brave_wallet {
+
+// Drives all periodic wallet polling (block trackers, logs tracker) from a
+// single timer. Tasks due within kTickAlignment of each other run in the same
+// tick, so the JSON-RPC calls they make to the same RPC URL can be batched.
+// Tasks nobody currently needs are skipped, and tasks which keep reporting no
+// progress (e.g. an unchanged block height) are polled less often, up to
+// kMaxBackoffFactor times their interval.
+class PollingScheduler {
+ public:
+  using TaskId = int;
+  // Returns false while nobody needs the task to run, e.g. no observers.
+  using ShouldRunCallback = base::RepeatingCallback<bool()>;
+
+  static constexpr base::TimeDelta kTickAlignment = base::Seconds(1);
+  static constexpr int kMaxBackoffFactor = 4;
+
+  PollingScheduler();
+  ~PollingScheduler();
+  PollingScheduler(const PollingScheduler&) = delete;
+  PollingScheduler& operator=(const PollingScheduler&) = delete;
+
+  // Runs |task| every |interval|, first one |interval| from now.
+  TaskId AddTask(base::TimeDelta interval,
+                 base::RepeatingClosure task,
+                 ShouldRunCallback should_run = ShouldRunCallback());
+  void RemoveTask(TaskId id);
+  bool HasTask(TaskId id) const;
+
+  // Reports whether the last run of |id| found anything new. No progress
+  // doubles the current interval of the task, progress resets it.
+  void ReportProgress(TaskId id, bool progressed);
+
+  base::TimeDelta GetCurrentIntervalForTesting(TaskId id) const;
+
+ private:
+  struct Task {
+    Task();
+    ~Task();
+    Task(Task&&);
+    Task& operator=(Task&&);
+
+    base::TimeDelta interval;
+    base::TimeDelta current_interval;
+    base::TimeTicks last_run;
+    base::TimeTicks next_run;
+    base::RepeatingClosure task;
+    ShouldRunCallback should_run;
+  };
+
+  void ScheduleNextTick();
+  void OnTick();
+
+  std::map<TaskId, Task> tasks_;
+  TaskId next_task_id_ = 1;
+  base::OneShotTimer timer_;
+};
+
+}  // namespace brave_wallet
+
+#endif  // BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_POLLING_SCHEDULER_H_
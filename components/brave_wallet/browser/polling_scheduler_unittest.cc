@@ -0,0 +1,121 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_wallet/browser/polling_scheduler.h"
+
+#include <string>
+#include <vector>
+
+#include "base/test/bind.h"
+#include "base/test/task_environment.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace brave_wallet {
+
+class PollingSchedulerUnitTest : public testing::Test {
+ public:
+  PollingSchedulerUnitTest()
+      : task_environment_(base::test::TaskEnvironment::TimeSource::MOCK_TIME) {}
+
+ protected:
+  base::test::TaskEnvironment task_environment_;
+  PollingScheduler scheduler_;
+};
+
+TEST_F(PollingSchedulerUnitTest, RunsTasksAtInterval) {
+  int runs = 0;
+  auto id = scheduler_.AddTask(
+      base::Seconds(5), base::BindLambdaForTesting([&]() { runs++; }));
+  EXPECT_TRUE(scheduler_.HasTask(id));
+
+  task_environment_.FastForwardBy(base::Seconds(4));
+  EXPECT_EQ(runs, 0);
+  task_environment_.FastForwardBy(base::Seconds(1));
+  EXPECT_EQ(runs, 1);
+  task_environment_.FastForwardBy(base::Seconds(10));
+  EXPECT_EQ(runs, 3);
+
+  scheduler_.RemoveTask(id);
+  EXPECT_FALSE(scheduler_.HasTask(id));
+  task_environment_.FastForwardBy(base::Seconds(10));
+  EXPECT_EQ(runs, 3);
+}
+
+TEST_F(PollingSchedulerUnitTest, AlignsTicks) {
+  std::vector<std::string> runs;
+  scheduler_.AddTask(base::Seconds(10), base::BindLambdaForTesting([&]() {
+                       runs.push_back("a");
+                     }));
+  task_environment_.FastForwardBy(base::Milliseconds(500));
+  scheduler_.AddTask(base::Seconds(10), base::BindLambdaForTesting([&]() {
+                       runs.push_back("b");
+                     }));
+
+  // "b" is due within kTickAlignment of "a" and runs in the same tick.
+  task_environment_.FastForwardBy(base::Milliseconds(9500));
+  EXPECT_EQ(runs, (std::vector<std::string>{"a", "b"}));
+
+  // Both stay aligned from then on.
+  runs.clear();
+  task_environment_.FastForwardBy(base::Seconds(10));
+  EXPECT_EQ(runs, (std::vector<std::string>{"a", "b"}));
+}
+
+TEST_F(PollingSchedulerUnitTest, SkipsTasksNobodyNeeds) {
+  int runs = 0;
+  bool needed = false;
+  scheduler_.AddTask(base::Seconds(5),
+                     base::BindLambdaForTesting([&]() { runs++; }),
+                     base::BindLambdaForTesting([&]() { return needed; }));
+
+  task_environment_.FastForwardBy(base::Seconds(10));
+  EXPECT_EQ(runs, 0);
+
+  needed = true;
+  task_environment_.FastForwardBy(base::Seconds(5));
+  EXPECT_EQ(runs, 1);
+}
+
+TEST_F(PollingSchedulerUnitTest, BacksOffWithoutProgress) {
+  int runs = 0;
+  PollingScheduler::TaskId id = 0;
+  bool progressed = false;
+  id = scheduler_.AddTask(base::Seconds(5), base::BindLambdaForTesting([&]() {
+                            runs++;
+                            scheduler_.ReportProgress(id, progressed);
+                          }));
+
+  task_environment_.FastForwardBy(base::Seconds(5));
+  EXPECT_EQ(runs, 1);
+  EXPECT_EQ(scheduler_.GetCurrentIntervalForTesting(id), base::Seconds(10));
+  task_environment_.FastForwardBy(base::Seconds(10));
+  EXPECT_EQ(runs, 2);
+  EXPECT_EQ(scheduler_.GetCurrentIntervalForTesting(id), base::Seconds(20));
+  task_environment_.FastForwardBy(base::Seconds(20));
+  EXPECT_EQ(runs, 3);
+  // Capped at kMaxBackoffFactor times the interval.
+  EXPECT_EQ(scheduler_.GetCurrentIntervalForTesting(id), base::Seconds(20));
+
+  progressed = true;
+  task_environment_.FastForwardBy(base::Seconds(20));
+  EXPECT_EQ(runs, 4);
+  EXPECT_EQ(scheduler_.GetCurrentIntervalForTesting(id), base::Seconds(5));
+  task_environment_.FastForwardBy(base::Seconds(5));
+  EXPECT_EQ(runs, 5);
+}
+
+TEST_F(PollingSchedulerUnitTest, TaskRemovesItself) {
+  int runs = 0;
+  PollingScheduler::TaskId id = 0;
+  id = scheduler_.AddTask(base::Seconds(5), base::BindLambdaForTesting([&]() {
+                            runs++;
+                            scheduler_.RemoveTask(id);
+                          }));
+  task_environment_.FastForwardBy(base::Seconds(20));
+  EXPECT_EQ(runs, 1);
+  EXPECT_FALSE(scheduler_.HasTask(id));
+}
+
+}  // namespace brave_wallet
@@ -5,7 +5,6 @@
 
 #include "brave/components/brave_wallet/browser/solana_block_tracker.h"
 
-#include <memory>
 #include <utility>
 
 #include "base/containers/contains.h"
@@ -30,14 +29,14 @@ SolanaBlockTracker::~SolanaBlockTracker() = default;
 
 void SolanaBlockTracker::Start(const std::string& chain_id,
                                base::TimeDelta interval) {
-  if (!base::Contains(timers_, chain_id)) {
-    timers_[chain_id] = std::make_unique<base::RepeatingTimer>();
-  }
-  timers_[chain_id]->Start(
-      FROM_HERE, interval,
-      base::BindRepeating(&SolanaBlockTracker::GetLatestBlockhash,
-                          weak_ptr_factory_.GetWeakPtr(), chain_id,
-                          base::NullCallback(), false));
+  StartPolling(chain_id, interval,
+               base::BindRepeating(&SolanaBlockTracker::GetLatestBlockhash,
+                                   weak_ptr_factory_.GetWeakPtr(), chain_id,
+                                   base::NullCallback(), false));
+}
+
+bool SolanaBlockTracker::HasObservers() const {
+  return !observers_.empty();
 }
 
 void SolanaBlockTracker::GetLatestBlockhash(const std::string& chain_id,
@@ -80,8 +79,10 @@ void SolanaBlockTracker::OnGetLatestBlockhash(
 
   if (base::Contains(latest_blockhash_map_, chain_id) &&
       latest_blockhash_map_[chain_id] == latest_blockhash) {
+    ReportPollResult(chain_id, false);
     return;
   }
+  ReportPollResult(chain_id, true);
 
   latest_blockhash_map_[chain_id] = latest_blockhash;
   last_valid_block_height_map_[chain_id] = last_valid_block_height;
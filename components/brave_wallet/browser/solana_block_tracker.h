@@ -49,6 +49,7 @@ class SolanaBlockTracker : public BlockTracker {
                           bool try_cached_value);
 
  private:
+  bool HasObservers() const override;
   void OnGetLatestBlockhash(const std::string& chain_id,
                             GetLatestBlockhashCallback callback,
                             const std::string& latest_blockhash,
@@ -605,7 +605,7 @@ GetTokenInstructionAccountParams() {
   return *params;
 }
 
-absl::optional<uint8_t> DecodeUint8(const std::vector<uint8_t>& input,
+absl::optional<uint8_t> DecodeUint8(base::span<const uint8_t> input,
                                     size_t& offset) {
   if (offset >= input.size() || input.size() - offset < sizeof(uint8_t)) {
     return absl::nullopt;
@@ -615,7 +615,7 @@ absl::optional<uint8_t> DecodeUint8(const std::vector<uint8_t>& input,
   return input[offset - sizeof(uint8_t)];
 }
 
-absl::optional<std::string> DecodeUint8String(const std::vector<uint8_t>& input,
+absl::optional<std::string> DecodeUint8String(base::span<const uint8_t> input,
                                               size_t& offset) {
   auto ret = DecodeUint8(input, offset);
   if (!ret) {
@@ -625,7 +625,7 @@ absl::optional<std::string> DecodeUint8String(const std::vector<uint8_t>& input,
 }
 
 absl::optional<std::string> DecodeAuthorityTypeString(
-    const std::vector<uint8_t>& input,
+    base::span<const uint8_t> input,
     size_t& offset) {
   auto ret = DecodeUint8(input, offset);
   if (ret && *ret <= kAuthorityTypeMax) {
@@ -634,15 +634,14 @@ absl::optional<std::string> DecodeAuthorityTypeString(
   return absl::nullopt;
 }
 
-absl::optional<uint32_t> DecodeUint32(const std::vector<uint8_t>& input,
+absl::optional<uint32_t> DecodeUint32(base::span<const uint8_t> input,
                                       size_t& offset) {
   if (offset >= input.size() || input.size() - offset < sizeof(uint32_t)) {
     return absl::nullopt;
   }
 
   // Read bytes in little endian order.
-  base::span<const uint8_t> s =
-      base::make_span(input.begin() + offset, sizeof(uint32_t));
+  base::span<const uint8_t> s = input.subspan(offset, sizeof(uint32_t));
   uint32_t uint32_le = *reinterpret_cast<const uint32_t*>(s.data());
 
   offset += sizeof(uint32_t);
@@ -655,7 +654,7 @@ absl::optional<uint32_t> DecodeUint32(const std::vector<uint8_t>& input,
 }
 
 absl::optional<std::string> DecodeUint32String(
-    const std::vector<uint8_t>& input,
+    base::span<const uint8_t> input,
     size_t& offset) {
   auto ret = DecodeUint32(input, offset);
   if (!ret) {
@@ -664,15 +663,14 @@ absl::optional<std::string> DecodeUint32String(
   return base::NumberToString(*ret);
 }
 
-absl::optional<uint64_t> DecodeUint64(const std::vector<uint8_t>& input,
+absl::optional<uint64_t> DecodeUint64(base::span<const uint8_t> input,
                                       size_t& offset) {
   if (offset >= input.size() || input.size() - offset < sizeof(uint64_t)) {
     return absl::nullopt;
   }
 
   // Read bytes in little endian order.
-  base::span<const uint8_t> s =
-      base::make_span(input.begin() + offset, sizeof(uint64_t));
+  base::span<const uint8_t> s = input.subspan(offset, sizeof(uint64_t));
   uint64_t uint64_le = *reinterpret_cast<const uint64_t*>(s.data());
 
   offset += sizeof(uint64_t);
@@ -685,7 +683,7 @@ absl::optional<uint64_t> DecodeUint64(const std::vector<uint8_t>& input,
 }
 
 absl::optional<std::string> DecodeUint64String(
-    const std::vector<uint8_t>& input,
+    base::span<const uint8_t> input,
     size_t& offset) {
   auto ret = DecodeUint64(input, offset);
   if (!ret) {
@@ -694,19 +692,19 @@ absl::optional<std::string> DecodeUint64String(
   return base::NumberToString(*ret);
 }
 
-absl::optional<std::string> DecodePublicKey(const std::vector<uint8_t>& input,
+absl::optional<std::string> DecodePublicKey(base::span<const uint8_t> input,
                                             size_t& offset) {
   if (offset >= input.size() || input.size() - offset < kSolanaPubkeySize) {
     return absl::nullopt;
   }
 
   offset += kSolanaPubkeySize;
-  return Base58Encode(std::vector<uint8_t>(
-      input.begin() + offset - kSolanaPubkeySize, input.begin() + offset));
+  return Base58Encode(
+      input.subspan(offset - kSolanaPubkeySize, kSolanaPubkeySize));
 }
 
 absl::optional<std::string> DecodeOptionalPublicKey(
-    const std::vector<uint8_t>& input,
+    base::span<const uint8_t> input,
     size_t& offset) {
   if (offset == input.size()) {
     return absl::nullopt;
@@ -732,7 +730,7 @@ absl::optional<std::string> DecodeOptionalPublicKey(
 // We currently cap the length here to be the max size of std::string
 // on 32 bit systems, it's safe to do so because currently we don't expect any
 // valid cases would have strings larger than it.
-absl::optional<std::string> DecodeString(const std::vector<uint8_t>& input,
+absl::optional<std::string> DecodeString(base::span<const uint8_t> input,
                                          size_t& offset) {
   auto len_lower = DecodeUint32(input, offset);
   if (!len_lower || *len_lower > kMaxStringSize32Bit) {
@@ -747,13 +745,14 @@ absl::optional<std::string> DecodeString(const std::vector<uint8_t>& input,
     return absl::nullopt;
   }
 
+  auto bytes = input.subspan(offset, *len_lower);
   offset += *len_lower;
-  return std::string(reinterpret_cast<const char*>(&input[offset - *len_lower]),
-                     *len_lower);
+  return std::string(reinterpret_cast<const char*>(bytes.data()),
+                     bytes.size());
 }
 
 bool DecodeParamType(const ParamNameTypeTuple& name_type_tuple,
-                     const std::vector<std::uint8_t> data,
+                     base::span<const uint8_t> data,
                      size_t& offset,
                      std::vector<InsParamTuple>& ins_param_tuple) {
   absl::optional<std::string> value;
@@ -804,7 +803,7 @@ bool DecodeParamType(const ParamNameTypeTuple& name_type_tuple,
 }
 
 absl::optional<mojom::SolanaSystemInstruction> DecodeSystemInstructionType(
-    const std::vector<uint8_t>& data,
+    base::span<const uint8_t> data,
     size_t& offset) {
   auto ins_type = DecodeUint32(data, offset);
   if (!ins_type || *ins_type > static_cast<uint32_t>(
@@ -815,7 +814,7 @@ absl::optional<mojom::SolanaSystemInstruction> DecodeSystemInstructionType(
 }
 
 absl::optional<mojom::SolanaTokenInstruction> DecodeTokenInstructionType(
-    const std::vector<uint8_t>& data,
+    base::span<const uint8_t> data,
     size_t& offset) {
   auto ins_type = DecodeUint8(data, offset);
   if (!ins_type || *ins_type > static_cast<uint8_t>(
@@ -827,7 +826,7 @@ absl::optional<mojom::SolanaTokenInstruction> DecodeTokenInstructionType(
 
 const std::vector<ParamNameTypeTuple>* DecodeInstructionType(
     const std::string& program_id,
-    const std::vector<uint8_t>& data,
+    base::span<const uint8_t> data,
     size_t& offset,
     SolanaInstructionDecodedData& decoded_data) {
   if (program_id == mojom::kSolanaSystemProgramId) {
@@ -23,6 +23,7 @@ namespace brave_wallet {
 class TxService;
 class JsonRpcService;
 class KeyringService;
+class TxStorage;
 class SolanaTxMeta;
 class SolanaTxStateManager;
 struct SolanaSignatureStatus;
@@ -33,7 +34,8 @@ class SolanaTxManager : public TxManager, public SolanaBlockTracker::Observer {
   SolanaTxManager(TxService* tx_service,
                   JsonRpcService* json_rpc_service,
                   KeyringService* keyring_service,
-                  PrefService* prefs);
+                  PrefService* prefs,
+                  TxStorage* tx_storage);
   ~SolanaTxManager() override;
 
   using ProcessSolanaHardwareSignatureCallback =
@@ -7,7 +7,6 @@
 
 #include <utility>
 
-#include "base/strings/strcat.h"
 #include "base/values.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_constants.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_utils.h"
@@ -15,8 +14,9 @@
 
 namespace brave_wallet {
 
-SolanaTxStateManager::SolanaTxStateManager(PrefService* prefs)
-    : TxStateManager(prefs) {}
+SolanaTxStateManager::SolanaTxStateManager(PrefService* prefs,
+                                           TxStorage* tx_storage)
+    : TxStateManager(prefs, tx_storage) {}
 
 SolanaTxStateManager::~SolanaTxStateManager() = default;
 
@@ -63,16 +63,6 @@ std::unique_ptr<TxMeta> SolanaTxStateManager::ValueToTxMeta(
   return meta;
 }
 
-std::string SolanaTxStateManager::GetTxPrefPathPrefix(
-    const absl::optional<std::string>& chain_id) {
-  if (chain_id.has_value()) {
-    return base::StrCat(
-        {kSolanaPrefKey, ".",
-         GetNetworkId(prefs_, mojom::CoinType::SOL, *chain_id)});
-  }
-  return kSolanaPrefKey;
-}
-
 std::unique_ptr<SolanaTxMeta> SolanaTxStateManager::GetSolanaTx(
     const std::string& chain_id,
     const std::string& id) {
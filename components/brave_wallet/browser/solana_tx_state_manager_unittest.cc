@@ -9,6 +9,7 @@
 #include <utility>
 #include <vector>
 
+#include "base/files/file_path.h"
 #include "base/test/bind.h"
 #include "base/test/task_environment.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_prefs.h"
@@ -16,6 +17,7 @@
 #include "brave/components/brave_wallet/browser/solana_instruction.h"
 #include "brave/components/brave_wallet/browser/solana_transaction.h"
 #include "brave/components/brave_wallet/browser/solana_tx_meta.h"
+#include "brave/components/brave_wallet/browser/tx_storage.h"
 #include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
 #include "brave/components/brave_wallet/common/brave_wallet_constants.h"
 #include "brave/components/brave_wallet/common/brave_wallet_types.h"
@@ -33,14 +35,16 @@ class SolanaTxStateManagerUnitTest : public testing::Test {
  protected:
   void SetUp() override {
     brave_wallet::RegisterProfilePrefs(prefs_.registry());
+    tx_storage_ = std::make_unique<TxStorage>(GetPrefs(), base::FilePath());
     solana_tx_state_manager_ =
-        std::make_unique<SolanaTxStateManager>(GetPrefs());
+        std::make_unique<SolanaTxStateManager>(GetPrefs(), tx_storage_.get());
   }
 
   PrefService* GetPrefs() { return &prefs_; }
 
   base::test::TaskEnvironment task_environment_;
   sync_preferences::TestingPrefServiceSyncable prefs_;
+  std::unique_ptr<TxStorage> tx_storage_;
   std::unique_ptr<SolanaTxStateManager> solana_tx_state_manager_;
 };
 
@@ -86,18 +90,4 @@ TEST_F(SolanaTxStateManagerUnitTest, SolanaTxMetaAndValue) {
   EXPECT_EQ(*meta_from_value, meta);
 }
 
-TEST_F(SolanaTxStateManagerUnitTest, GetTxPrefPathPrefix) {
-  EXPECT_EQ("solana.mainnet", solana_tx_state_manager_->GetTxPrefPathPrefix(
-                                  mojom::kSolanaMainnet));
-  EXPECT_EQ("solana.testnet", solana_tx_state_manager_->GetTxPrefPathPrefix(
-                                  mojom::kSolanaTestnet));
-  EXPECT_EQ("solana.devnet", solana_tx_state_manager_->GetTxPrefPathPrefix(
-                                 mojom::kSolanaDevnet));
-  EXPECT_EQ(
-      "solana.http://localhost:8899/",
-      solana_tx_state_manager_->GetTxPrefPathPrefix(mojom::kLocalhostChainId));
-  EXPECT_EQ("solana",
-            solana_tx_state_manager_->GetTxPrefPathPrefix(absl::nullopt));
-}
-
 }  // namespace brave_wallet
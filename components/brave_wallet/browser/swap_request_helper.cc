@@ -6,6 +6,7 @@
 #include "brave/components/brave_wallet/browser/swap_request_helper.h"
 
 #include <utility>
+#include <vector>
 
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/stringprintf.h"
@@ -89,36 +90,27 @@ absl::optional<std::string> EncodeJupiterTransactionParams(
   route.Set("marketInfos", std::move(market_infos_value));
   tx_params.Set("route", std::move(route));
 
-  // FIXME - GetJSON should be refactored to accept a base::Value::Dict
-  std::string result = GetJSON(base::Value(std::move(tx_params)));
-  result = std::string(
-      json::convert_string_value_to_uint64("/route/inAmount", result, false));
-  result = std::string(
-      json::convert_string_value_to_uint64("/route/outAmount", result, false));
-  result = std::string(
-      json::convert_string_value_to_uint64("/route/amount", result, false));
-  result = std::string(json::convert_string_value_to_uint64(
-      "/route/otherAmountThreshold", result, false));
-  result = std::string(json::convert_string_value_to_uint64(
-      "/route/slippageBps", result, false));
-
-  for (int i = 0; i < static_cast<int>(params->route->market_infos.size());
-       i++) {
-    result = std::string(json::convert_string_value_to_uint64(
-        base::StringPrintf("/route/marketInfos/%d/inAmount", i), result,
-        false));
-    result = std::string(json::convert_string_value_to_uint64(
-        base::StringPrintf("/route/marketInfos/%d/outAmount", i), result,
-        false));
-    result = std::string(json::convert_string_value_to_uint64(
-        base::StringPrintf("/route/marketInfos/%d/lpFee/amount", i), result,
-        false));
-    result = std::string(json::convert_string_value_to_uint64(
-        base::StringPrintf("/route/marketInfos/%d/platformFee/amount", i),
-        result, false));
+  // Amounts are encoded as strings above, the API expects numbers.
+  std::vector<json::ValueConversion> conversions;
+  for (const char* path : {"/route/inAmount", "/route/outAmount",
+                           "/route/amount", "/route/otherAmountThreshold",
+                           "/route/slippageBps"}) {
+    conversions.push_back({path, json::ConversionKind::StringToUint64, false});
+  }
+  for (size_t i = 0; i < params->route->market_infos.size(); i++) {
+    for (const char* key :
+         {"inAmount", "outAmount", "lpFee/amount", "platformFee/amount"}) {
+      conversions.push_back(
+          {base::StringPrintf("/route/marketInfos/%zu/%s", i, key),
+           json::ConversionKind::StringToUint64, false});
+    }
   }
 
-  return result;
+  // FIXME - GetJSON should be refactored to accept a base::Value::Dict
+  std::string result = GetJSON(base::Value(std::move(tx_params)));
+  return std::string(json::convert_values(
+      result, rust::Slice<const json::ValueConversion>(conversions.data(),
+                                                       conversions.size())));
 }
 
 }  // namespace brave_wallet
@@ -163,4 +163,39 @@ TEST(SwapRequestHelperUnitTest, EncodeJupiterTransactionParams) {
   encoded_params = EncodeJupiterTransactionParams(params.Clone());
   ASSERT_EQ(encoded_params, absl::nullopt);
 }
+
+// Encodes a route with several hops, as returned for most quotes.
+TEST(SwapRequestHelperUnitTest, EncodeJupiterTransactionParamsMultiHop) {
+  constexpr size_t kHops = 3;
+
+  std::string json =
+      base::StringPrintf(GetJupiterQuoteTemplate(), "10000", "30");
+  mojom::JupiterQuotePtr swap_quote = ParseJupiterQuote(ParseJson(json));
+  ASSERT_TRUE(swap_quote);
+
+  mojom::JupiterSwapParams params;
+  params.route = swap_quote->routes.at(0).Clone();
+  params.user_public_key = "mockPubKey";
+  params.output_mint = "EPjFWdd5AufqSSqeM2qN1xzybapC8G4wEGGkZwyTDt1v";  // USDC
+  while (params.route->market_infos.size() < kHops) {
+    params.route->market_infos.push_back(
+        params.route->market_infos.front().Clone());
+  }
+
+  auto encoded_params = EncodeJupiterTransactionParams(params.Clone());
+  ASSERT_TRUE(encoded_params);
+  auto encoded_value = ParseJson(*encoded_params);
+  const auto* market_infos =
+      encoded_value.GetDict().FindListByDottedPath("route.marketInfos");
+  ASSERT_TRUE(market_infos);
+  ASSERT_EQ(market_infos->size(), kHops);
+  for (const auto& market_info : *market_infos) {
+    const auto& dict = market_info.GetDict();
+    EXPECT_EQ(dict.FindInt("inAmount"), 10000);
+    EXPECT_EQ(dict.FindInt("outAmount"), 117001203);
+    EXPECT_EQ(dict.FindIntByDottedPath("lpFee.amount"), 30);
+    EXPECT_EQ(dict.FindIntByDottedPath("platformFee.amount"), 0);
+  }
+}
+
 }  // namespace brave_wallet
@@ -0,0 +1,200 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_wallet/browser/tx_database.h"
+
+#include <utility>
+
+#include "base/check.h"
+#include "base/functional/bind.h"
+#include "base/json/json_reader.h"
+#include "base/json/json_writer.h"
+#include "base/logging.h"
+#include "brave/components/sql_utils/database_error_callback.h"
+#include "sql/statement.h"
+#include "sql/transaction.h"
+
+namespace brave_wallet {
+
+namespace {
+
+constexpr char kAddOrUpdateSql[] =
+    "INSERT OR REPLACE INTO transactions (coin, chain_id, id, status, "
+    "from_address, value) VALUES (?,?,?,?,?,?)";
+constexpr char kAddIfMissingSql[] =
+    "INSERT OR IGNORE INTO transactions (coin, chain_id, id, status, "
+    "from_address, value) VALUES (?,?,?,?,?,?)";
+
+// Version 1: the transactions table, indexed by coin, chain_id, status and
+// from_address.
+constexpr int kCurrentVersionNumber = 1;
+constexpr int kCompatibleVersionNumber = 1;
+
+}  // namespace
+
+TxRecord::TxRecord() = default;
+
+TxRecord::TxRecord(mojom::CoinType coin,
+                   std::string chain_id,
+                   std::string id,
+                   mojom::TransactionStatus status,
+                   std::string from,
+                   base::Value::Dict value)
+    : coin(coin),
+      chain_id(std::move(chain_id)),
+      id(std::move(id)),
+      status(status),
+      from(std::move(from)),
+      value(std::move(value)) {}
+
+TxRecord::~TxRecord() = default;
+TxRecord::TxRecord(TxRecord&&) = default;
+TxRecord& TxRecord::operator=(TxRecord&&) = default;
+
+TxRecord TxRecord::Clone() const {
+  return TxRecord(coin, chain_id, id, status, from, value.Clone());
+}
+
+TxDatabase::TxDatabase(const base::FilePath& db_file_path)
+    : database_({.exclusive_locking = true, .page_size = 4096}),
+      db_file_path_(db_file_path) {
+  DETACH_FROM_SEQUENCE(sequence_checker_);
+}
+
+TxDatabase::~TxDatabase() = default;
+
+bool TxDatabase::Init() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  database_.set_histogram_tag("BraveWalletTransactions");
+
+  // To recover from corruption.
+  database_.set_error_callback(base::BindRepeating(
+      &sql_utils::DatabaseErrorCallback, &database_, db_file_path_));
+
+  return database_.Open(db_file_path_) && InitSchema();
+}
+
+std::vector<TxRecord> TxDatabase::GetAll() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  std::vector<TxRecord> records;
+  sql::Statement statement(database_.GetUniqueStatement(
+      "SELECT coin, chain_id, id, status, from_address, value "
+      "FROM transactions"));
+  while (statement.Step()) {
+    absl::optional<base::Value> value =
+        base::JSONReader::Read(statement.ColumnString(5));
+    if (!value || !value->is_dict()) {
+      continue;
+    }
+
+    records.emplace_back(
+        static_cast<mojom::CoinType>(statement.ColumnInt(0)),
+        statement.ColumnString(1), statement.ColumnString(2),
+        static_cast<mojom::TransactionStatus>(statement.ColumnInt(3)),
+        statement.ColumnString(4), std::move(*value).TakeDict());
+  }
+
+  return records;
+}
+
+bool TxDatabase::AddOrUpdate(std::vector<TxRecord> records) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  return Insert(kAddOrUpdateSql, std::move(records));
+}
+
+bool TxDatabase::AddIfMissing(std::vector<TxRecord> records) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  return Insert(kAddIfMissingSql, std::move(records));
+}
+
+bool TxDatabase::Delete(mojom::CoinType coin,
+                        const std::string& chain_id,
+                        const std::string& id) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  sql::Statement statement(database_.GetUniqueStatement(
+      "DELETE FROM transactions WHERE coin = ? AND chain_id = ? AND id = ?"));
+  statement.BindInt(0, static_cast<int>(coin));
+  statement.BindString(1, chain_id);
+  statement.BindString(2, id);
+  return statement.Run();
+}
+
+bool TxDatabase::DeleteAll(absl::optional<mojom::CoinType> coin) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  if (!coin) {
+    return database_.Execute("DELETE FROM transactions");
+  }
+
+  sql::Statement statement(
+      database_.GetUniqueStatement("DELETE FROM transactions WHERE coin = ?"));
+  statement.BindInt(0, static_cast<int>(*coin));
+  return statement.Run();
+}
+
+bool TxDatabase::Insert(const char* sql, std::vector<TxRecord> records) {
+  sql::Transaction transaction(&database_);
+  if (!transaction.Begin()) {
+    return false;
+  }
+
+  sql::Statement statement(database_.GetUniqueStatement(sql));
+  for (const auto& record : records) {
+    std::string value;
+    if (!base::JSONWriter::Write(record.value, &value)) {
+      continue;
+    }
+
+    statement.Reset(/*clear_bound_vars=*/true);
+    statement.BindInt(0, static_cast<int>(record.coin));
+    statement.BindString(1, record.chain_id);
+    statement.BindString(2, record.id);
+    statement.BindInt(3, static_cast<int>(record.status));
+    statement.BindString(4, record.from);
+    statement.BindString(5, value);
+    if (!statement.Run()) {
+      return false;
+    }
+  }
+
+  return transaction.Commit();
+}
+
+bool TxDatabase::InitSchema() {
+  sql::Transaction transaction(&database_);
+  if (!transaction.Begin() ||
+      !meta_table_.Init(&database_, kCurrentVersionNumber,
+                        kCompatibleVersionNumber)) {
+    return false;
+  }
+
+  if (meta_table_.GetCompatibleVersionNumber() > kCurrentVersionNumber) {
+    LOG(WARNING) << "Transaction database is too new";
+    return false;
+  }
+
+  if (!database_.DoesTableExist("transactions") && !CreateTables()) {
+    return false;
+  }
+
+  return transaction.Commit();
+}
+
+bool TxDatabase::CreateTables() {
+  return database_.Execute(
+             "CREATE TABLE transactions (coin INTEGER NOT NULL, "
+             "chain_id TEXT NOT NULL, id TEXT NOT NULL, "
+             "status INTEGER NOT NULL, from_address TEXT NOT NULL, "
+             "value TEXT NOT NULL, PRIMARY KEY (coin, chain_id, id))") &&
+         database_.Execute(
+             "CREATE INDEX transactions_status_from_index ON transactions "
+             "(coin, chain_id, status, from_address)");
+}
+
+}  // namespace brave_wallet
@@ -0,0 +1,91 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_TX_DATABASE_H_
+#define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_TX_DATABASE_H_
+
+#include <string>
+#include <vector>
+
+#include "base/files/file_path.h"
+#include "base/sequence_checker.h"
+#include "base/values.h"
+#include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
+#include "sql/database.h"
+#include "sql/meta_table.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+
+namespace brave_wallet {
+
+// A transaction as persisted in the transaction database. |value| is the
+// serialized TxMeta, the remaining fields are the columns it is indexed by.
+struct TxRecord {
+  TxRecord();
+  TxRecord(mojom::CoinType coin,
+           std::string chain_id,
+           std::string id,
+           mojom::TransactionStatus status,
+           std::string from,
+           base::Value::Dict value);
+  ~TxRecord();
+  TxRecord(const TxRecord&) = delete;
+  TxRecord& operator=(const TxRecord&) = delete;
+  TxRecord(TxRecord&&);
+  TxRecord& operator=(TxRecord&&);
+
+  TxRecord Clone() const;
+
+  mojom::CoinType coin = mojom::CoinType::ETH;
+  std::string chain_id;
+  std::string id;
+  mojom::TransactionStatus status = mojom::TransactionStatus::Unapproved;
+  std::string from;
+  base::Value::Dict value;
+};
+
+// SQLite backed storage of wallet transactions, indexed by
+// (coin, chain_id, status, from). All methods block and must be called on the
+// same sequence, see TxStorage for the asynchronous front end.
+class TxDatabase {
+ public:
+  explicit TxDatabase(const base::FilePath& db_file_path);
+  ~TxDatabase();
+  TxDatabase(const TxDatabase&) = delete;
+  TxDatabase& operator=(const TxDatabase&) = delete;
+
+  bool Init();
+
+  std::vector<TxRecord> GetAll();
+
+  // Inserts |records|, replacing any existing record with the same
+  // (coin, chain_id, id), in a single transaction.
+  bool AddOrUpdate(std::vector<TxRecord> records);
+  // Inserts |records| in a single transaction, keeping any existing record
+  // with the same (coin, chain_id, id). Used to import transactions from
+  // prefs without overwriting newer state.
+  bool AddIfMissing(std::vector<TxRecord> records);
+
+  bool Delete(mojom::CoinType coin,
+              const std::string& chain_id,
+              const std::string& id);
+  // Deletes all transactions for |coin|, or every transaction if |coin| is
+  // not set.
+  bool DeleteAll(absl::optional<mojom::CoinType> coin);
+
+ private:
+  bool Insert(const char* sql, std::vector<TxRecord> records);
+  bool InitSchema();
+  bool CreateTables();
+
+  sql::Database database_;
+  sql::MetaTable meta_table_;
+  const base::FilePath db_file_path_;
+
+  SEQUENCE_CHECKER(sequence_checker_);
+};
+
+}  // namespace brave_wallet
+
+#endif  // BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_TX_DATABASE_H_
@@ -0,0 +1,165 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_wallet/browser/tx_database.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/files/scoped_temp_dir.h"
+#include "base/test/task_environment.h"
+#include "base/values.h"
+#include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
+#include "sql/database.h"
+#include "sql/meta_table.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace brave_wallet {
+
+namespace {
+
+TxRecord MakeRecord(mojom::CoinType coin,
+                    const std::string& chain_id,
+                    const std::string& id,
+                    mojom::TransactionStatus status,
+                    const std::string& tx_hash) {
+  base::Value::Dict value;
+  value.Set("id", id);
+  value.Set("tx_hash", tx_hash);
+  return TxRecord(coin, chain_id, id, status, "0xfrom", std::move(value));
+}
+
+}  // namespace
+
+class TxDatabaseUnitTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
+    database_ = std::make_unique<TxDatabase>(GetDatabasePath());
+    ASSERT_TRUE(database_->Init());
+  }
+
+  base::FilePath GetDatabasePath() const {
+    return temp_dir_.GetPath().Append(FILE_PATH_LITERAL("transactions"));
+  }
+
+  base::test::TaskEnvironment task_environment_;
+  base::ScopedTempDir temp_dir_;
+  std::unique_ptr<TxDatabase> database_;
+};
+
+TEST_F(TxDatabaseUnitTest, AddOrUpdate) {
+  EXPECT_TRUE(database_->GetAll().empty());
+
+  std::vector<TxRecord> records;
+  records.push_back(MakeRecord(mojom::CoinType::ETH, mojom::kMainnetChainId,
+                               "001", mojom::TransactionStatus::Submitted,
+                               "0x1"));
+  records.push_back(MakeRecord(mojom::CoinType::SOL, mojom::kSolanaMainnet,
+                               "001", mojom::TransactionStatus::Confirmed,
+                               "sig"));
+  ASSERT_TRUE(database_->AddOrUpdate(std::move(records)));
+
+  auto all = database_->GetAll();
+  ASSERT_EQ(all.size(), 2u);
+
+  // Same (coin, chain_id, id) replaces the existing record.
+  records.clear();
+  records.push_back(MakeRecord(mojom::CoinType::ETH, mojom::kMainnetChainId,
+                               "001", mojom::TransactionStatus::Confirmed,
+                               "0x2"));
+  ASSERT_TRUE(database_->AddOrUpdate(std::move(records)));
+
+  all = database_->GetAll();
+  ASSERT_EQ(all.size(), 2u);
+  for (const auto& record : all) {
+    EXPECT_EQ(record.status, mojom::TransactionStatus::Confirmed);
+    if (record.coin == mojom::CoinType::ETH) {
+      EXPECT_EQ(record.chain_id, mojom::kMainnetChainId);
+      EXPECT_EQ(record.from, "0xfrom");
+      EXPECT_EQ(*record.value.FindString("tx_hash"), "0x2");
+    }
+  }
+}
+
+TEST_F(TxDatabaseUnitTest, AddIfMissing) {
+  std::vector<TxRecord> records;
+  records.push_back(MakeRecord(mojom::CoinType::ETH, mojom::kMainnetChainId,
+                               "001", mojom::TransactionStatus::Confirmed,
+                               "0x2"));
+  ASSERT_TRUE(database_->AddOrUpdate(std::move(records)));
+
+  records.clear();
+  records.push_back(MakeRecord(mojom::CoinType::ETH, mojom::kMainnetChainId,
+                               "001", mojom::TransactionStatus::Submitted,
+                               "0x1"));
+  records.push_back(MakeRecord(mojom::CoinType::ETH, mojom::kMainnetChainId,
+                               "002", mojom::TransactionStatus::Submitted,
+                               "0x3"));
+  ASSERT_TRUE(database_->AddIfMissing(std::move(records)));
+
+  auto all = database_->GetAll();
+  ASSERT_EQ(all.size(), 2u);
+  for (const auto& record : all) {
+    if (record.id == "001") {
+      EXPECT_EQ(record.status, mojom::TransactionStatus::Confirmed);
+      EXPECT_EQ(*record.value.FindString("tx_hash"), "0x2");
+    } else {
+      EXPECT_EQ(record.status, mojom::TransactionStatus::Submitted);
+    }
+  }
+}
+
+TEST_F(TxDatabaseUnitTest, Delete) {
+  std::vector<TxRecord> records;
+  records.push_back(MakeRecord(mojom::CoinType::ETH, mojom::kMainnetChainId,
+                               "001", mojom::TransactionStatus::Submitted,
+                               "0x1"));
+  records.push_back(MakeRecord(mojom::CoinType::ETH, mojom::kGoerliChainId,
+                               "001", mojom::TransactionStatus::Submitted,
+                               "0x1"));
+  records.push_back(MakeRecord(mojom::CoinType::FIL, mojom::kFilecoinMainnet,
+                               "001", mojom::TransactionStatus::Submitted,
+                               "cid"));
+  records.push_back(MakeRecord(mojom::CoinType::SOL, mojom::kSolanaMainnet,
+                               "001", mojom::TransactionStatus::Submitted,
+                               "sig"));
+  ASSERT_TRUE(database_->AddOrUpdate(std::move(records)));
+
+  ASSERT_TRUE(database_->Delete(mojom::CoinType::ETH, mojom::kGoerliChainId,
+                                "001"));
+  auto all = database_->GetAll();
+  ASSERT_EQ(all.size(), 3u);
+
+  ASSERT_TRUE(database_->DeleteAll(mojom::CoinType::ETH));
+  all = database_->GetAll();
+  ASSERT_EQ(all.size(), 2u);
+  for (const auto& record : all) {
+    EXPECT_NE(record.coin, mojom::CoinType::ETH);
+  }
+
+  ASSERT_TRUE(database_->DeleteAll(absl::nullopt));
+  EXPECT_TRUE(database_->GetAll().empty());
+}
+
+TEST_F(TxDatabaseUnitTest, DoNotOpenNewerSchema) {
+  database_.reset();
+
+  {
+    sql::Database db;
+    ASSERT_TRUE(db.Open(GetDatabasePath()));
+    sql::MetaTable meta_table;
+    ASSERT_TRUE(meta_table.Init(&db, 1, 1));
+    ASSERT_TRUE(meta_table.SetVersionNumber(2));
+    ASSERT_TRUE(meta_table.SetCompatibleVersionNumber(2));
+  }
+
+  TxDatabase database(GetDatabasePath());
+  EXPECT_FALSE(database.Init());
+}
+
+}  // namespace brave_wallet
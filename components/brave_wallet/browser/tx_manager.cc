@@ -11,6 +11,7 @@
 
 #include "base/check.h"
 #include "base/containers/contains.h"
+#include "base/functional/bind.h"
 #include "base/logging.h"
 #include "brave/components/brave_wallet/browser/block_tracker.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_constants.h"
@@ -41,6 +42,13 @@ TxManager::TxManager(std::unique_ptr<TxStateManager> tx_state_manager,
   tx_state_manager_->AddObserver(this);
   keyring_service_->AddObserver(
       keyring_observer_receiver_.BindNewPipeAndPassRemote());
+
+  // Pending transactions from earlier sessions are only known, and polled,
+  // once they are loaded.
+  if (!tx_state_manager_->IsLoaded()) {
+    tx_state_manager_->RunWhenLoaded(base::BindOnce(
+        &TxManager::OnTxsLoaded, weak_factory_.GetWeakPtr()));
+  }
 }
 
 TxManager::~TxManager() {
@@ -131,6 +139,15 @@ void TxManager::OnNewUnapprovedTx(mojom::TransactionInfoPtr tx_info) {
   tx_service_->OnNewUnapprovedTx(tx_info->Clone());
 }
 
+void TxManager::OnTxsLoaded() {
+  if (keyring_service_->IsLockedSync()) {
+    // Polling starts on unlock.
+    return;
+  }
+
+  UpdatePendingTransactions(absl::nullopt);
+}
+
 void TxManager::Locked() {
   block_tracker_->Stop();
 }
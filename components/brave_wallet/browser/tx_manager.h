@@ -11,6 +11,7 @@
 #include <string>
 #include <vector>
 
+#include "base/memory/weak_ptr.h"
 #include "brave/components/brave_wallet/browser/keyring_service_observer_base.h"
 #include "brave/components/brave_wallet/browser/tx_state_manager.h"
 #include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
@@ -105,6 +106,8 @@ class TxManager : public TxStateManager::Observer,
  private:
   virtual mojom::CoinType GetCoinType() const = 0;
 
+  void OnTxsLoaded();
+
   // TxStateManager::Observer
   void OnTransactionStatusChanged(mojom::TransactionInfoPtr tx_info) override;
   void OnNewUnapprovedTx(mojom::TransactionInfoPtr tx_info) override;
@@ -116,6 +119,8 @@ class TxManager : public TxStateManager::Observer,
 
   mojo::Receiver<brave_wallet::mojom::KeyringServiceObserver>
       keyring_observer_receiver_{this};
+
+  base::WeakPtrFactory<TxManager> weak_factory_{this};
 };
 
 }  // namespace brave_wallet
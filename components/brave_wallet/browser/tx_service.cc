@@ -15,6 +15,7 @@
 #include "brave/components/brave_wallet/browser/json_rpc_service.h"
 #include "brave/components/brave_wallet/browser/solana_tx_manager.h"
 #include "brave/components/brave_wallet/browser/tx_manager.h"
+#include "brave/components/brave_wallet/browser/tx_storage.h"
 #include "brave/components/brave_wallet/common/fil_address.h"
 #include "url/origin.h"
 
@@ -22,6 +23,9 @@ namespace brave_wallet {
 
 namespace {
 
+constexpr base::FilePath::CharType kTxDatabaseFilename[] =
+    FILE_PATH_LITERAL("Brave Wallet Transactions");
+
 mojom::CoinType GetCoinTypeFromTxDataUnion(
     const mojom::TxDataUnion& tx_data_union) {
   if (tx_data_union.is_solana_tx_data()) {
@@ -51,18 +55,27 @@ size_t CalculatePendingTxCount(
 TxService::TxService(JsonRpcService* json_rpc_service,
                      BitcoinWalletService* bitcoin_wallet_service,
                      KeyringService* keyring_service,
-                     PrefService* prefs)
-    : prefs_(prefs), json_rpc_service_(json_rpc_service), weak_factory_(this) {
+                     PrefService* prefs,
+                     const base::FilePath& wallet_base_directory)
+    : prefs_(prefs),
+      json_rpc_service_(json_rpc_service),
+      tx_storage_(std::make_unique<TxStorage>(
+          prefs,
+          wallet_base_directory.empty()
+              ? base::FilePath()
+              : wallet_base_directory.Append(kTxDatabaseFilename))),
+      weak_factory_(this) {
   tx_manager_map_[mojom::CoinType::ETH] = std::make_unique<EthTxManager>(
-      this, json_rpc_service, keyring_service, prefs);
+      this, json_rpc_service, keyring_service, prefs, tx_storage_.get());
   tx_manager_map_[mojom::CoinType::SOL] = std::make_unique<SolanaTxManager>(
-      this, json_rpc_service, keyring_service, prefs);
+      this, json_rpc_service, keyring_service, prefs, tx_storage_.get());
   tx_manager_map_[mojom::CoinType::FIL] = std::make_unique<FilTxManager>(
-      this, json_rpc_service, keyring_service, prefs);
+      this, json_rpc_service, keyring_service, prefs, tx_storage_.get());
   if (IsBitcoinEnabled()) {
     CHECK(bitcoin_wallet_service);
     tx_manager_map_[mojom::CoinType::BTC] = std::make_unique<BitcoinTxManager>(
-        this, json_rpc_service, bitcoin_wallet_service, keyring_service, prefs);
+        this, json_rpc_service, bitcoin_wallet_service, keyring_service, prefs,
+        tx_storage_.get());
   }
 }
 
@@ -270,6 +283,7 @@ void TxService::OnUnapprovedTxUpdated(mojom::TransactionInfoPtr tx_info) {
 
 void TxService::Reset() {
   ClearTxServiceProfilePrefs(prefs_);
+  tx_storage_->DeleteAll(absl::nullopt);
   for (auto const& service : tx_manager_map_) {
     service.second->Reset();
   }
@@ -7,6 +7,7 @@
 
 #include <utility>
 
+#include "base/containers/flat_map.h"
 #include "base/json/values_util.h"
 #include "base/values.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_constants.h"
@@ -14,6 +15,7 @@
 #include "brave/components/brave_wallet/browser/pref_names.h"
 #include "brave/components/brave_wallet/browser/solana_message.h"
 #include "brave/components/brave_wallet/browser/tx_meta.h"
+#include "brave/components/brave_wallet/browser/tx_storage.h"
 #include "components/prefs/pref_service.h"
 #include "components/prefs/scoped_user_pref_update.h"
 #include "url/origin.h"
@@ -107,19 +109,17 @@ bool TxStateManager::ValueToTxMeta(const base::Value::Dict& value,
   return true;
 }
 
-TxStateManager::TxStateManager(PrefService* prefs)
-    : prefs_(prefs), weak_factory_(this) {}
+TxStateManager::TxStateManager(PrefService* prefs, TxStorage* tx_storage)
+    : prefs_(prefs), tx_storage_(tx_storage), weak_factory_(this) {
+  DCHECK(tx_storage_);
+}
 
 TxStateManager::~TxStateManager() = default;
 
 void TxStateManager::AddOrUpdateTx(const TxMeta& meta) {
-  ScopedDictPrefUpdate update(prefs_, kBraveWalletTransactions);
-  base::Value::Dict& dict = update.Get();
-  const std::string path =
-      base::JoinString({GetTxPrefPathPrefix(meta.chain_id()), meta.id()}, ".");
-
-  bool is_add = dict.FindByDottedPath(path) == nullptr;
-  dict.SetByDottedPath(path, meta.ToValue());
+  const bool is_add = tx_storage_->AddOrUpdate(
+      TxRecord(GetCoinType(), meta.chain_id(), meta.id(), meta.status(),
+               meta.from(), meta.ToValue()));
   if (!is_add) {
     for (auto& observer : observers_) {
       observer.OnTransactionStatusChanged(meta.ToTransactionInfo());
@@ -140,9 +140,8 @@ void TxStateManager::AddOrUpdateTx(const TxMeta& meta) {
 
 std::unique_ptr<TxMeta> TxStateManager::GetTx(const std::string& chain_id,
                                               const std::string& id) {
-  const auto& dict = prefs_->GetDict(kBraveWalletTransactions);
-  const base::Value::Dict* value = dict.FindDictByDottedPath(
-      base::JoinString({GetTxPrefPathPrefix(chain_id), id}, "."));
+  const base::Value::Dict* value =
+      tx_storage_->Get(GetCoinType(), chain_id, id);
   if (!value) {
     return nullptr;
   }
@@ -152,50 +151,50 @@ std::unique_ptr<TxMeta> TxStateManager::GetTx(const std::string& chain_id,
 
 void TxStateManager::DeleteTx(const std::string& chain_id,
                               const std::string& id) {
-  ScopedDictPrefUpdate update(prefs_, kBraveWalletTransactions);
-  update->RemoveByDottedPath(
-      base::JoinString({GetTxPrefPathPrefix(chain_id), id}, "."));
+  tx_storage_->Delete(GetCoinType(), chain_id, id);
 }
 
 void TxStateManager::WipeTxs() {
-  ScopedDictPrefUpdate update(prefs_, kBraveWalletTransactions);
-  update->RemoveByDottedPath(GetTxPrefPathPrefix(absl::nullopt));
+  tx_storage_->DeleteAll(GetCoinType());
+}
+
+bool TxStateManager::IsLoaded() const {
+  return tx_storage_->IsLoaded();
+}
+
+void TxStateManager::RunWhenLoaded(base::OnceClosure callback) {
+  tx_storage_->RunWhenLoaded(std::move(callback));
 }
 
 std::vector<std::unique_ptr<TxMeta>> TxStateManager::GetTransactionsByStatus(
     const absl::optional<std::string>& chain_id,
     const absl::optional<mojom::TransactionStatus>& status,
     const absl::optional<std::string>& from) {
+  // Transactions of networks which are no longer known, e.g. removed custom
+  // networks, are not returned.
+  base::flat_map<std::string, bool> is_known_network;
+  auto is_known_chain_id = [&](const std::string& tx_chain_id) {
+    auto [iter, inserted] = is_known_network.try_emplace(tx_chain_id, false);
+    if (inserted) {
+      iter->second =
+          !GetNetworkId(prefs_, GetCoinType(), tx_chain_id).empty();
+    }
+    return iter->second;
+  };
+
   std::vector<std::unique_ptr<TxMeta>> result;
-  const auto& dict = prefs_->GetDict(kBraveWalletTransactions);
-  const base::Value::Dict* network_dict =
-      dict.FindDictByDottedPath(GetTxPrefPathPrefix(chain_id));
-  if (!network_dict) {
-    return result;
-  }
+  for (const base::Value::Dict* value :
+       tx_storage_->Find(GetCoinType(), chain_id, status, from)) {
+    const std::string* tx_chain_id = value->FindString("chain_id");
+    if (!tx_chain_id || !is_known_chain_id(*tx_chain_id)) {
+      continue;
+    }
 
-  for (const auto it : *network_dict) {
-    if (chain_id.has_value()) {
-      std::unique_ptr<TxMeta> meta = ValueToTxMeta(it.second.GetDict());
-      if (!meta) {
-        continue;
-      }
-      if (!status.has_value() || meta->status() == *status) {
-        if (from.has_value() && meta->from() != *from) {
-          continue;
-        }
-        result.push_back(std::move(meta));
-      }
-    } else {
-      auto chain_id_from_pref =
-          GetChainIdByNetworkId(prefs_, GetCoinType(), it.first);
-      if (!chain_id_from_pref) {
-        continue;
-      }
-      auto metas = GetTransactionsByStatus(chain_id_from_pref, status, from);
-      result.insert(result.end(), std::make_move_iterator(metas.begin()),
-                    std::make_move_iterator(metas.end()));
+    std::unique_ptr<TxMeta> meta = ValueToTxMeta(*value);
+    if (!meta) {
+      continue;
     }
+    result.push_back(std::move(meta));
   }
   return result;
 }
@@ -10,6 +10,7 @@
 #include <string>
 #include <vector>
 
+#include "base/functional/callback.h"
 #include "base/gtest_prod_util.h"
 #include "base/memory/raw_ptr.h"
 #include "base/memory/weak_ptr.h"
@@ -27,10 +28,11 @@ class Value;
 namespace brave_wallet {
 
 class TxMeta;
+class TxStorage;
 
 class TxStateManager {
  public:
-  explicit TxStateManager(PrefService* prefs);
+  TxStateManager(PrefService* prefs, TxStorage* tx_storage);
   virtual ~TxStateManager();
   TxStateManager(const TxStateManager&) = delete;
 
@@ -40,6 +42,11 @@ class TxStateManager {
   void DeleteTx(const std::string& chain_id, const std::string& id);
   void WipeTxs();
 
+  // Transactions stored by earlier sessions are loaded asynchronously, until
+  // then only transactions added in this session are returned.
+  bool IsLoaded() const;
+  void RunWhenLoaded(base::OnceClosure callback);
+
   static void MigrateAddChainIdToTransactionInfo(PrefService* prefs);
   static void MigrateSolanaTransactionsForV0TransactionsSupport(
       PrefService* prefs);
@@ -64,6 +71,7 @@ class TxStateManager {
   static bool ValueToTxMeta(const base::Value::Dict& value, TxMeta* tx_meta);
 
   raw_ptr<PrefService> prefs_ = nullptr;
+  raw_ptr<TxStorage> tx_storage_ = nullptr;
 
  private:
   FRIEND_TEST_ALL_PREFIXES(TxStateManagerUnitTest, TxOperations);
@@ -79,15 +87,6 @@ class TxStateManager {
   virtual std::unique_ptr<TxMeta> ValueToTxMeta(
       const base::Value::Dict& value) = 0;
 
-  // Each derived class should provide transaction pref path prefix as
-  // coin_type.network_id. For example, ethereum.mainnet or solana.testnet.
-  // This will be used to get/set the transaction pref for a specific
-  // coin_type. When chain_id is not provided, prefix will be just coin_type,
-  // ex. ethereum and solana and it will be used to acess all the transactions
-  // across different network for the coin.
-  virtual std::string GetTxPrefPathPrefix(
-      const absl::optional<std::string>& chain_id) = 0;
-
   base::ObserverList<Observer> observers_;
 
   base::WeakPtrFactory<TxStateManager> weak_factory_;
@@ -8,6 +8,7 @@
 
 #include "brave/components/brave_wallet/browser/tx_state_manager.h"
 
+#include "base/files/file_path.h"
 #include "base/run_loop.h"
 #include "base/scoped_observation.h"
 #include "base/test/bind.h"
@@ -20,6 +21,7 @@
 #include "brave/components/brave_wallet/browser/eth_tx_meta.h"
 #include "brave/components/brave_wallet/browser/eth_tx_state_manager.h"
 #include "brave/components/brave_wallet/browser/pref_names.h"
+#include "brave/components/brave_wallet/browser/tx_storage.h"
 #include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
 #include "brave/components/brave_wallet/common/test_utils.h"
 #include "brave/components/brave_wallet/common/value_conversion_utils.h"
@@ -60,7 +62,9 @@ class TxStateManagerUnitTest : public testing::Test {
     // The only different between each coin type's tx state manager in these
     // base functions are their pref paths, so here we just use
     // EthTxStateManager to test common methods in TxStateManager.
-    tx_state_manager_ = std::make_unique<EthTxStateManager>(&prefs_);
+    tx_storage_ = std::make_unique<TxStorage>(&prefs_, base::FilePath());
+    tx_state_manager_ =
+        std::make_unique<EthTxStateManager>(&prefs_, tx_storage_.get());
   }
 
   void UpdateCustomNetworks(PrefService* prefs,
@@ -76,68 +80,46 @@ class TxStateManagerUnitTest : public testing::Test {
 
   base::test::TaskEnvironment task_environment_;
   sync_preferences::TestingPrefServiceSyncable prefs_;
+  std::unique_ptr<TxStorage> tx_storage_;
   std::unique_ptr<TxStateManager> tx_state_manager_;
 };
 
 TEST_F(TxStateManagerUnitTest, TxOperations) {
-  prefs_.ClearPref(kBraveWalletTransactions);
-
   EthTxMeta meta;
   meta.set_id("001");
   meta.set_chain_id(mojom::kMainnetChainId);
-  EXPECT_FALSE(prefs_.HasPrefPath(kBraveWalletTransactions));
+  EXPECT_TRUE(tx_state_manager_
+                  ->GetTransactionsByStatus(absl::nullopt, absl::nullopt,
+                                            absl::nullopt)
+                  .empty());
   // Add
   tx_state_manager_->AddOrUpdateTx(meta);
-  EXPECT_TRUE(prefs_.HasPrefPath(kBraveWalletTransactions));
   {
-    const auto& dict = prefs_.GetDict(kBraveWalletTransactions);
-    EXPECT_EQ(dict.size(), 1u);
-    const auto* ethereum_dict = dict.FindDict("ethereum");
-    ASSERT_TRUE(ethereum_dict);
-    EXPECT_EQ(ethereum_dict->size(), 1u);
-    const auto* network_dict = ethereum_dict->FindDict("mainnet");
-    ASSERT_TRUE(network_dict);
-    EXPECT_EQ(network_dict->size(), 1u);
-    const base::Value::Dict* value = network_dict->FindDict("001");
-    ASSERT_TRUE(value);
-    auto meta_from_value = tx_state_manager_->ValueToTxMeta(*value);
-    ASSERT_NE(meta_from_value, nullptr);
-    EXPECT_EQ(*static_cast<EthTxMeta*>(meta_from_value.get()), meta);
+    auto txs = tx_state_manager_->GetTransactionsByStatus(
+        mojom::kMainnetChainId, absl::nullopt, absl::nullopt);
+    ASSERT_EQ(txs.size(), 1u);
+    EXPECT_EQ(*static_cast<EthTxMeta*>(txs[0].get()), meta);
   }
 
   meta.set_tx_hash("0xabcd");
   // Update
   tx_state_manager_->AddOrUpdateTx(meta);
   {
-    const auto& dict = prefs_.GetDict(kBraveWalletTransactions);
-    EXPECT_EQ(dict.size(), 1u);
-    const auto* ethereum_dict = dict.FindDict("ethereum");
-    ASSERT_TRUE(ethereum_dict);
-    EXPECT_EQ(ethereum_dict->size(), 1u);
-    const auto* network_dict = ethereum_dict->FindDict("mainnet");
-    ASSERT_TRUE(network_dict);
-    EXPECT_EQ(network_dict->size(), 1u);
-    const base::Value::Dict* value = network_dict->FindDict("001");
-    ASSERT_TRUE(value);
-    auto meta_from_value = tx_state_manager_->ValueToTxMeta(*value);
-    ASSERT_NE(meta_from_value, nullptr);
-    EXPECT_EQ(meta_from_value->tx_hash(), meta.tx_hash());
+    auto txs = tx_state_manager_->GetTransactionsByStatus(
+        mojom::kMainnetChainId, absl::nullopt, absl::nullopt);
+    ASSERT_EQ(txs.size(), 1u);
+    EXPECT_EQ(txs[0]->tx_hash(), meta.tx_hash());
   }
 
   meta.set_id("002");
   meta.set_tx_hash("0xabff");
   // Add another one
   tx_state_manager_->AddOrUpdateTx(meta);
-  {
-    const auto& dict = prefs_.GetDict(kBraveWalletTransactions);
-    EXPECT_EQ(dict.size(), 1u);
-    const auto* ethereum_dict = dict.FindDict("ethereum");
-    ASSERT_TRUE(ethereum_dict);
-    EXPECT_EQ(ethereum_dict->size(), 1u);
-    const auto* network_dict = ethereum_dict->FindDict("mainnet");
-    ASSERT_TRUE(network_dict);
-    EXPECT_EQ(network_dict->size(), 2u);
-  }
+  EXPECT_EQ(tx_state_manager_
+                ->GetTransactionsByStatus(mojom::kMainnetChainId,
+                                          absl::nullopt, absl::nullopt)
+                .size(),
+            2u);
 
   // Get
   {
@@ -160,22 +142,21 @@ TEST_F(TxStateManagerUnitTest, TxOperations) {
 
   // Delete
   tx_state_manager_->DeleteTx(mojom::kMainnetChainId, "001");
-  {
-    const auto& dict = prefs_.GetDict(kBraveWalletTransactions);
-    EXPECT_EQ(dict.size(), 1u);
-    const auto* ethereum_dict = dict.FindDict("ethereum");
-    ASSERT_TRUE(ethereum_dict);
-    EXPECT_EQ(ethereum_dict->size(), 1u);
-    const auto* network_dict = ethereum_dict->FindDict("mainnet");
-    ASSERT_TRUE(network_dict);
-    EXPECT_EQ(network_dict->size(), 1u);
-  }
+  EXPECT_EQ(tx_state_manager_->GetTx(mojom::kMainnetChainId, "001"), nullptr);
+  EXPECT_EQ(tx_state_manager_
+                ->GetTransactionsByStatus(mojom::kMainnetChainId,
+                                          absl::nullopt, absl::nullopt)
+                .size(),
+            1u);
 
   // Purge
   tx_state_manager_->WipeTxs();
-  EXPECT_TRUE(prefs_.HasPrefPath(kBraveWalletTransactions));
-  EXPECT_FALSE(
-      prefs_.HasPrefPath(std::string(kBraveWalletTransactions) + ".ethereum"));
+  EXPECT_TRUE(tx_state_manager_
+                  ->GetTransactionsByStatus(absl::nullopt, absl::nullopt,
+                                            absl::nullopt)
+                  .empty());
+  // Transactions are no longer stored in prefs.
+  EXPECT_FALSE(prefs_.HasPrefPath(kBraveWalletTransactions));
 }
 
 TEST_F(TxStateManagerUnitTest, GetTransactionsByStatus) {
@@ -387,27 +368,20 @@ TEST_F(TxStateManagerUnitTest, MultiChainId) {
   meta.set_chain_id(mojom::kLocalhostChainId);
   tx_state_manager_->AddOrUpdateTx(meta);
 
-  const auto& dict = prefs_.GetDict(kBraveWalletTransactions);
-  EXPECT_EQ(dict.size(), 1u);
-  const auto* ethereum_dict = dict.FindDict("ethereum");
-  ASSERT_TRUE(ethereum_dict);
-  EXPECT_EQ(ethereum_dict->size(), 3u);
-  const auto* mainnet_dict = ethereum_dict->FindDict("mainnet");
-  ASSERT_TRUE(mainnet_dict);
-  EXPECT_EQ(mainnet_dict->size(), 1u);
-  EXPECT_TRUE(mainnet_dict->FindDict("001"));
-  const auto* goerli_dict = ethereum_dict->FindDict("goerli");
-  ASSERT_TRUE(goerli_dict);
-  EXPECT_EQ(goerli_dict->size(), 1u);
-  EXPECT_TRUE(goerli_dict->FindDict("001"));
-  auto localhost_url_spec =
-      brave_wallet::GetNetworkURL(&prefs_, mojom::kLocalhostChainId,
-                                  mojom::CoinType::ETH)
-          .spec();
-  const auto* localhost_dict = ethereum_dict->FindDict(localhost_url_spec);
-  ASSERT_TRUE(localhost_dict);
-  EXPECT_EQ(localhost_dict->size(), 1u);
-  EXPECT_TRUE(localhost_dict->FindDict("001"));
+  EXPECT_EQ(tx_state_manager_
+                ->GetTransactionsByStatus(absl::nullopt, absl::nullopt,
+                                          absl::nullopt)
+                .size(),
+            3u);
+  for (const auto* chain_id : {mojom::kMainnetChainId, mojom::kGoerliChainId,
+                               mojom::kLocalhostChainId}) {
+    SCOPED_TRACE(chain_id);
+    auto txs = tx_state_manager_->GetTransactionsByStatus(
+        chain_id, absl::nullopt, absl::nullopt);
+    ASSERT_EQ(txs.size(), 1u);
+    EXPECT_EQ(txs[0]->id(), "001");
+    EXPECT_NE(tx_state_manager_->GetTx(chain_id, "001"), nullptr);
+  }
 }
 
 TEST_F(TxStateManagerUnitTest, RetireOldTxMeta) {
@@ -0,0 +1,282 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_wallet/browser/tx_storage.h"
+
+#include <utility>
+
+#include "base/containers/contains.h"
+#include "base/functional/bind.h"
+#include "base/task/thread_pool.h"
+#include "brave/components/brave_wallet/browser/brave_wallet_utils.h"
+#include "brave/components/brave_wallet/browser/pref_names.h"
+#include "components/prefs/pref_service.h"
+
+namespace brave_wallet {
+
+TxStorage::TxStorage(PrefService* prefs, const base::FilePath& db_file_path)
+    : prefs_(prefs) {
+  DCHECK(prefs_);
+
+  if (!db_file_path.empty()) {
+    database_ = base::SequenceBound<TxDatabase>(
+        base::ThreadPool::CreateSequencedTaskRunner(
+            {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
+             base::TaskShutdownBehavior::BLOCK_SHUTDOWN}),
+        db_file_path);
+    database_.AsyncCall(&TxDatabase::Init);
+  }
+
+  if (!prefs_->GetBoolean(kBraveWalletTransactionsFromPrefsToDBMigrated)) {
+    MigrateFromPrefs();
+  }
+
+  if (database_.is_null()) {
+    is_loaded_ = true;
+    return;
+  }
+
+  database_.AsyncCall(&TxDatabase::GetAll)
+      .Then(base::BindOnce(&TxStorage::OnLoaded,
+                           weak_ptr_factory_.GetWeakPtr()));
+}
+
+TxStorage::~TxStorage() = default;
+
+void TxStorage::RunWhenLoaded(base::OnceClosure callback) {
+  if (is_loaded_) {
+    return std::move(callback).Run();
+  }
+
+  on_loaded_callbacks_.push_back(std::move(callback));
+}
+
+const base::Value::Dict* TxStorage::Get(mojom::CoinType coin,
+                                        const std::string& chain_id,
+                                        const std::string& id) const {
+  const auto iter = records_.find(TxKey(coin, chain_id, id));
+  if (iter == records_.cend()) {
+    return nullptr;
+  }
+
+  return &iter->second.value;
+}
+
+std::vector<const base::Value::Dict*> TxStorage::Find(
+    mojom::CoinType coin,
+    const absl::optional<std::string>& chain_id,
+    const absl::optional<mojom::TransactionStatus>& status,
+    const absl::optional<std::string>& from) const {
+  // Only the leading filters form a prefix of the index key, the remaining
+  // filters are applied to each entry within that prefix.
+  const bool is_status_prefix = chain_id && status;
+  const bool is_from_prefix = is_status_prefix && from;
+
+  TxIndexKey lower_bound(coin, chain_id.value_or(""),
+                         mojom::TransactionStatus::kMinValue, "", "");
+  if (is_status_prefix) {
+    std::get<2>(lower_bound) = *status;
+  }
+  if (is_from_prefix) {
+    std::get<3>(lower_bound) = *from;
+  }
+
+  std::vector<const base::Value::Dict*> result;
+  for (auto iter = index_.lower_bound(lower_bound); iter != index_.cend();
+       ++iter) {
+    const auto& [index_coin, index_chain_id, index_status, index_from, id] =
+        *iter;
+    if (index_coin != coin || (chain_id && index_chain_id != *chain_id) ||
+        (is_status_prefix && index_status != *status) ||
+        (is_from_prefix && index_from != *from)) {
+      break;
+    }
+
+    if ((status && index_status != *status) ||
+        (from && index_from != *from)) {
+      continue;
+    }
+
+    const base::Value::Dict* value = Get(coin, index_chain_id, id);
+    DCHECK(value);
+    result.push_back(value);
+  }
+
+  return result;
+}
+
+bool TxStorage::AddOrUpdate(TxRecord record) {
+  const TxKey key(record.coin, record.chain_id, record.id);
+  const bool is_add = !base::Contains(records_, key);
+  Erase(key);
+
+  if (!is_loaded_) {
+    changed_before_load_.insert(key);
+  }
+
+  if (!database_.is_null()) {
+    std::vector<TxRecord> records;
+    records.push_back(record.Clone());
+    database_.AsyncCall(&TxDatabase::AddOrUpdate).WithArgs(std::move(records));
+  }
+
+  Insert(std::move(record));
+
+  return is_add;
+}
+
+void TxStorage::Delete(mojom::CoinType coin,
+                       const std::string& chain_id,
+                       const std::string& id) {
+  const TxKey key(coin, chain_id, id);
+  Erase(key);
+
+  if (!is_loaded_) {
+    changed_before_load_.insert(key);
+  }
+
+  if (!database_.is_null()) {
+    database_.AsyncCall(&TxDatabase::Delete).WithArgs(coin, chain_id, id);
+  }
+}
+
+void TxStorage::DeleteAll(absl::optional<mojom::CoinType> coin) {
+  for (auto iter = records_.begin(); iter != records_.end();) {
+    if (coin && iter->second.coin != *coin) {
+      ++iter;
+      continue;
+    }
+
+    index_.erase(GetIndexKey(iter->second));
+    iter = records_.erase(iter);
+  }
+
+  if (!is_loaded_) {
+    if (coin) {
+      wiped_before_load_.insert(*coin);
+    } else {
+      all_wiped_before_load_ = true;
+    }
+  }
+
+  if (!database_.is_null()) {
+    database_.AsyncCall(&TxDatabase::DeleteAll).WithArgs(coin);
+  }
+}
+
+// static
+TxStorage::TxIndexKey TxStorage::GetIndexKey(const TxRecord& record) {
+  return TxIndexKey(record.coin, record.chain_id, record.status, record.from,
+                    record.id);
+}
+
+void TxStorage::Insert(TxRecord record) {
+  index_.insert(GetIndexKey(record));
+  TxKey key(record.coin, record.chain_id, record.id);
+  records_.emplace(std::move(key), std::move(record));
+}
+
+void TxStorage::Erase(const TxKey& key) {
+  const auto iter = records_.find(key);
+  if (iter == records_.cend()) {
+    return;
+  }
+
+  index_.erase(GetIndexKey(iter->second));
+  records_.erase(iter);
+}
+
+void TxStorage::MigrateFromPrefs() {
+  // Transactions are stored in prefs as coin.network_id.tx_id, each with its
+  // chain_id since MigrateAddChainIdToTransactionInfo.
+  std::vector<TxRecord> records;
+  for (const auto [coin_key, coin_value] :
+       prefs_->GetDict(kBraveWalletTransactions)) {
+    const absl::optional<mojom::CoinType> coin =
+        GetCoinTypeFromPrefKey(coin_key);
+    const base::Value::Dict* txs_by_network_ids = coin_value.GetIfDict();
+    if (!coin || !txs_by_network_ids) {
+      continue;
+    }
+
+    for (const auto [network_id, txs_value] : *txs_by_network_ids) {
+      const base::Value::Dict* txs = txs_value.GetIfDict();
+      if (!txs) {
+        continue;
+      }
+
+      for (const auto [id, tx_value] : *txs) {
+        const base::Value::Dict* tx = tx_value.GetIfDict();
+        if (!tx) {
+          continue;
+        }
+
+        const std::string* chain_id = tx->FindString("chain_id");
+        const absl::optional<int> status = tx->FindInt("status");
+        const std::string* from = tx->FindString("from");
+        if (!chain_id || !status || !from) {
+          continue;
+        }
+
+        TxRecord record(*coin, *chain_id, id,
+                        static_cast<mojom::TransactionStatus>(*status), *from,
+                        tx->Clone());
+        Erase(TxKey(record.coin, record.chain_id, record.id));
+        if (!database_.is_null()) {
+          records.push_back(record.Clone());
+        }
+        Insert(std::move(record));
+      }
+    }
+  }
+
+  if (database_.is_null()) {
+    return OnMigratedFromPrefs(/*success*/ true);
+  }
+
+  // Keep any transaction already in the database, in case a previous
+  // migration was interrupted before the pref was cleared.
+  database_.AsyncCall(&TxDatabase::AddIfMissing)
+      .WithArgs(std::move(records))
+      .Then(base::BindOnce(&TxStorage::OnMigratedFromPrefs,
+                           weak_ptr_factory_.GetWeakPtr()));
+}
+
+void TxStorage::OnMigratedFromPrefs(bool success) {
+  if (!success) {
+    // Migration is retried on next startup.
+    return;
+  }
+
+  prefs_->ClearPref(kBraveWalletTransactions);
+  prefs_->SetBoolean(kBraveWalletTransactionsFromPrefsToDBMigrated, true);
+}
+
+void TxStorage::OnLoaded(std::vector<TxRecord> records) {
+  for (auto& record : records) {
+    const TxKey key(record.coin, record.chain_id, record.id);
+    if (all_wiped_before_load_ ||
+        base::Contains(wiped_before_load_, record.coin) ||
+        base::Contains(changed_before_load_, key)) {
+      continue;
+    }
+
+    Erase(key);
+    Insert(std::move(record));
+  }
+
+  is_loaded_ = true;
+  changed_before_load_.clear();
+  wiped_before_load_.clear();
+  all_wiped_before_load_ = false;
+
+  std::vector<base::OnceClosure> callbacks;
+  callbacks.swap(on_loaded_callbacks_);
+  for (auto& callback : callbacks) {
+    std::move(callback).Run();
+  }
+}
+
+}  // namespace brave_wallet
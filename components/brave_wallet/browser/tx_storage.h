@@ -0,0 +1,105 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_TX_STORAGE_H_
+#define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_TX_STORAGE_H_
+
+#include <map>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "base/files/file_path.h"
+#include "base/functional/callback.h"
+#include "base/memory/raw_ptr.h"
+#include "base/memory/weak_ptr.h"
+#include "base/threading/sequence_bound.h"
+#include "base/values.h"
+#include "brave/components/brave_wallet/browser/tx_database.h"
+#include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+
+class PrefService;
+
+namespace brave_wallet {
+
+// Holds the wallet transactions of all coins in memory, indexed by
+// (coin, chain_id, status, from), and persists every change to a TxDatabase
+// on a background sequence. Transactions are loaded from the database
+// asynchronously on construction; changes made before loading completes take
+// precedence over the loaded state. Transactions still stored in the
+// kBraveWalletTransactions pref are moved into the database once.
+class TxStorage {
+ public:
+  // Transactions are kept in memory only if |db_file_path| is empty.
+  TxStorage(PrefService* prefs, const base::FilePath& db_file_path);
+  ~TxStorage();
+  TxStorage(const TxStorage&) = delete;
+  TxStorage& operator=(const TxStorage&) = delete;
+
+  bool IsLoaded() const { return is_loaded_; }
+  // Runs |callback| once transactions are loaded from the database, right away
+  // if they already are.
+  void RunWhenLoaded(base::OnceClosure callback);
+
+  const base::Value::Dict* Get(mojom::CoinType coin,
+                               const std::string& chain_id,
+                               const std::string& id) const;
+  std::vector<const base::Value::Dict*> Find(
+      mojom::CoinType coin,
+      const absl::optional<std::string>& chain_id,
+      const absl::optional<mojom::TransactionStatus>& status,
+      const absl::optional<std::string>& from) const;
+
+  // Returns true if |record| was added, false if it replaced an existing
+  // transaction.
+  bool AddOrUpdate(TxRecord record);
+  void Delete(mojom::CoinType coin,
+              const std::string& chain_id,
+              const std::string& id);
+  // Deletes all transactions for |coin|, or every transaction if |coin| is
+  // not set.
+  void DeleteAll(absl::optional<mojom::CoinType> coin);
+
+ private:
+  using TxKey = std::tuple<mojom::CoinType, std::string, std::string>;
+  using TxIndexKey = std::tuple<mojom::CoinType,
+                                std::string,
+                                mojom::TransactionStatus,
+                                std::string,
+                                std::string>;
+
+  static TxIndexKey GetIndexKey(const TxRecord& record);
+
+  void Insert(TxRecord record);
+  void Erase(const TxKey& key);
+
+  void MigrateFromPrefs();
+  void OnMigratedFromPrefs(bool success);
+  void OnLoaded(std::vector<TxRecord> records);
+
+  raw_ptr<PrefService> prefs_ = nullptr;
+
+  std::map<TxKey, TxRecord> records_;
+  std::set<TxIndexKey> index_;
+
+  bool is_loaded_ = false;
+  // Transactions changed, and coins wiped, before loading completed. Loaded
+  // records for these are stale and dropped.
+  std::set<TxKey> changed_before_load_;
+  std::set<mojom::CoinType> wiped_before_load_;
+  bool all_wiped_before_load_ = false;
+  std::vector<base::OnceClosure> on_loaded_callbacks_;
+
+  // Not bound if transactions are kept in memory only.
+  base::SequenceBound<TxDatabase> database_;
+
+  base::WeakPtrFactory<TxStorage> weak_ptr_factory_{this};
+};
+
+}  // namespace brave_wallet
+
+#endif  // BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_TX_STORAGE_H_
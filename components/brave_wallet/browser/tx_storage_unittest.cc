@@ -0,0 +1,269 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_wallet/browser/tx_storage.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "base/files/file_path.h"
+#include "base/files/scoped_temp_dir.h"
+#include "base/test/bind.h"
+#include "base/test/task_environment.h"
+#include "base/values.h"
+#include "brave/components/brave_wallet/browser/brave_wallet_prefs.h"
+#include "brave/components/brave_wallet/browser/pref_names.h"
+#include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
+#include "components/prefs/scoped_user_pref_update.h"
+#include "components/sync_preferences/testing_pref_service_syncable.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace brave_wallet {
+
+namespace {
+
+base::Value::Dict MakeTx(const std::string& id,
+                         const std::string& chain_id,
+                         mojom::TransactionStatus status,
+                         const std::string& from) {
+  base::Value::Dict tx;
+  tx.Set("id", id);
+  tx.Set("chain_id", chain_id);
+  tx.Set("status", static_cast<int>(status));
+  tx.Set("from", from);
+  return tx;
+}
+
+TxRecord MakeRecord(mojom::CoinType coin,
+                    const std::string& id,
+                    const std::string& chain_id,
+                    mojom::TransactionStatus status,
+                    const std::string& from) {
+  return TxRecord(coin, chain_id, id, status, from,
+                  MakeTx(id, chain_id, status, from));
+}
+
+}  // namespace
+
+class TxStorageUnitTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    RegisterProfilePrefs(prefs_.registry());
+    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
+  }
+
+  base::FilePath GetDatabasePath() const {
+    return temp_dir_.GetPath().Append(FILE_PATH_LITERAL("transactions"));
+  }
+
+  base::test::TaskEnvironment task_environment_;
+  base::ScopedTempDir temp_dir_;
+  sync_preferences::TestingPrefServiceSyncable prefs_;
+};
+
+TEST_F(TxStorageUnitTest, Find) {
+  TxStorage storage(&prefs_, base::FilePath());
+  EXPECT_TRUE(storage.IsLoaded());
+
+  EXPECT_TRUE(storage.AddOrUpdate(
+      MakeRecord(mojom::CoinType::ETH, "001", mojom::kMainnetChainId,
+                 mojom::TransactionStatus::Submitted, "0x1")));
+  EXPECT_TRUE(storage.AddOrUpdate(
+      MakeRecord(mojom::CoinType::ETH, "002", mojom::kMainnetChainId,
+                 mojom::TransactionStatus::Confirmed, "0x1")));
+  EXPECT_TRUE(storage.AddOrUpdate(
+      MakeRecord(mojom::CoinType::ETH, "003", mojom::kMainnetChainId,
+                 mojom::TransactionStatus::Submitted, "0x2")));
+  EXPECT_TRUE(storage.AddOrUpdate(
+      MakeRecord(mojom::CoinType::ETH, "004", mojom::kGoerliChainId,
+                 mojom::TransactionStatus::Submitted, "0x1")));
+  EXPECT_TRUE(storage.AddOrUpdate(
+      MakeRecord(mojom::CoinType::SOL, "005", mojom::kSolanaMainnet,
+                 mojom::TransactionStatus::Submitted, "0x1")));
+
+  EXPECT_EQ(storage.Find(mojom::CoinType::ETH, absl::nullopt, absl::nullopt,
+                         absl::nullopt)
+                .size(),
+            4u);
+  EXPECT_EQ(storage.Find(mojom::CoinType::ETH, mojom::kMainnetChainId,
+                         absl::nullopt, absl::nullopt)
+                .size(),
+            3u);
+  EXPECT_EQ(storage.Find(mojom::CoinType::ETH, mojom::kMainnetChainId,
+                         mojom::TransactionStatus::Submitted, absl::nullopt)
+                .size(),
+            2u);
+  EXPECT_EQ(storage.Find(mojom::CoinType::ETH, mojom::kMainnetChainId,
+                         mojom::TransactionStatus::Submitted, "0x1")
+                .size(),
+            1u);
+  EXPECT_EQ(storage.Find(mojom::CoinType::ETH, absl::nullopt,
+                         mojom::TransactionStatus::Submitted, "0x1")
+                .size(),
+            2u);
+  EXPECT_EQ(storage.Find(mojom::CoinType::ETH, mojom::kMainnetChainId,
+                         absl::nullopt, "0x2")
+                .size(),
+            1u);
+  EXPECT_TRUE(storage
+                  .Find(mojom::CoinType::FIL, absl::nullopt, absl::nullopt,
+                        absl::nullopt)
+                  .empty());
+
+  // Status changes move the transaction within the index.
+  EXPECT_FALSE(storage.AddOrUpdate(
+      MakeRecord(mojom::CoinType::ETH, "001", mojom::kMainnetChainId,
+                 mojom::TransactionStatus::Confirmed, "0x1")));
+  EXPECT_EQ(storage.Find(mojom::CoinType::ETH, mojom::kMainnetChainId,
+                         mojom::TransactionStatus::Submitted, "0x1")
+                .size(),
+            0u);
+  EXPECT_EQ(storage.Find(mojom::CoinType::ETH, mojom::kMainnetChainId,
+                         mojom::TransactionStatus::Confirmed, "0x1")
+                .size(),
+            2u);
+
+  storage.Delete(mojom::CoinType::ETH, mojom::kMainnetChainId, "001");
+  EXPECT_FALSE(
+      storage.Get(mojom::CoinType::ETH, mojom::kMainnetChainId, "001"));
+  EXPECT_EQ(storage.Find(mojom::CoinType::ETH, mojom::kMainnetChainId,
+                         mojom::TransactionStatus::Confirmed, absl::nullopt)
+                .size(),
+            1u);
+
+  storage.DeleteAll(mojom::CoinType::ETH);
+  EXPECT_TRUE(storage
+                  .Find(mojom::CoinType::ETH, absl::nullopt, absl::nullopt,
+                        absl::nullopt)
+                  .empty());
+  EXPECT_TRUE(storage.Get(mojom::CoinType::SOL, mojom::kSolanaMainnet, "005"));
+}
+
+TEST_F(TxStorageUnitTest, MigrateFromPrefs) {
+  {
+    ScopedDictPrefUpdate update(&prefs_, kBraveWalletTransactions);
+    update->SetByDottedPath(
+        "ethereum.mainnet.001",
+        MakeTx("001", mojom::kMainnetChainId,
+               mojom::TransactionStatus::Submitted, "0x1"));
+    update->SetByDottedPath(
+        "solana.mainnet.002",
+        MakeTx("002", mojom::kSolanaMainnet,
+               mojom::TransactionStatus::Confirmed, "0x2"));
+    // Missing chain_id, dropped.
+    base::Value::Dict invalid = MakeTx("003", mojom::kMainnetChainId,
+                                       mojom::TransactionStatus::Submitted,
+                                       "0x1");
+    invalid.Remove("chain_id");
+    update->SetByDottedPath("ethereum.mainnet.003", std::move(invalid));
+  }
+
+  {
+    TxStorage storage(&prefs_, GetDatabasePath());
+    // Migrated transactions are available before loading completes.
+    EXPECT_TRUE(storage.Get(mojom::CoinType::ETH, mojom::kMainnetChainId,
+                            "001"));
+    task_environment_.RunUntilIdle();
+    EXPECT_TRUE(storage.IsLoaded());
+  }
+  // Let the database close before reopening it.
+  task_environment_.RunUntilIdle();
+
+  EXPECT_TRUE(prefs_.GetBoolean(kBraveWalletTransactionsFromPrefsToDBMigrated));
+  EXPECT_FALSE(prefs_.HasPrefPath(kBraveWalletTransactions));
+
+  TxStorage storage(&prefs_, GetDatabasePath());
+  task_environment_.RunUntilIdle();
+  ASSERT_TRUE(storage.IsLoaded());
+  const base::Value::Dict* tx =
+      storage.Get(mojom::CoinType::ETH, mojom::kMainnetChainId, "001");
+  ASSERT_TRUE(tx);
+  EXPECT_EQ(*tx, MakeTx("001", mojom::kMainnetChainId,
+                        mojom::TransactionStatus::Submitted, "0x1"));
+  EXPECT_TRUE(storage.Get(mojom::CoinType::SOL, mojom::kSolanaMainnet, "002"));
+  EXPECT_FALSE(
+      storage.Get(mojom::CoinType::ETH, mojom::kMainnetChainId, "003"));
+}
+
+TEST_F(TxStorageUnitTest, PersistChanges) {
+  prefs_.SetBoolean(kBraveWalletTransactionsFromPrefsToDBMigrated, true);
+  {
+    TxStorage storage(&prefs_, GetDatabasePath());
+    storage.AddOrUpdate(MakeRecord(mojom::CoinType::ETH, "001",
+                                   mojom::kMainnetChainId,
+                                   mojom::TransactionStatus::Submitted, "0x1"));
+    storage.AddOrUpdate(MakeRecord(mojom::CoinType::FIL, "002",
+                                   mojom::kFilecoinMainnet,
+                                   mojom::TransactionStatus::Submitted, "0x1"));
+    task_environment_.RunUntilIdle();
+  }
+  task_environment_.RunUntilIdle();
+
+  {
+    TxStorage storage(&prefs_, GetDatabasePath());
+    // Changes made before loading completes take precedence.
+    storage.AddOrUpdate(MakeRecord(mojom::CoinType::ETH, "001",
+                                   mojom::kMainnetChainId,
+                                   mojom::TransactionStatus::Confirmed, "0x1"));
+    storage.DeleteAll(mojom::CoinType::FIL);
+    task_environment_.RunUntilIdle();
+    ASSERT_TRUE(storage.IsLoaded());
+
+    EXPECT_EQ(storage.Find(mojom::CoinType::ETH, mojom::kMainnetChainId,
+                           mojom::TransactionStatus::Confirmed, "0x1")
+                  .size(),
+              1u);
+    EXPECT_FALSE(
+        storage.Get(mojom::CoinType::FIL, mojom::kFilecoinMainnet, "002"));
+  }
+  task_environment_.RunUntilIdle();
+
+  TxStorage storage(&prefs_, GetDatabasePath());
+  task_environment_.RunUntilIdle();
+  ASSERT_TRUE(storage.IsLoaded());
+  EXPECT_EQ(storage.Find(mojom::CoinType::ETH, absl::nullopt,
+                         mojom::TransactionStatus::Confirmed, absl::nullopt)
+                .size(),
+            1u);
+  EXPECT_TRUE(storage
+                  .Find(mojom::CoinType::FIL, absl::nullopt, absl::nullopt,
+                        absl::nullopt)
+                  .empty());
+}
+
+TEST_F(TxStorageUnitTest, RunWhenLoaded) {
+  prefs_.SetBoolean(kBraveWalletTransactionsFromPrefsToDBMigrated, true);
+  {
+    TxStorage storage(&prefs_, GetDatabasePath());
+    storage.AddOrUpdate(MakeRecord(mojom::CoinType::ETH, "001",
+                                   mojom::kMainnetChainId,
+                                   mojom::TransactionStatus::Submitted, "0x1"));
+    task_environment_.RunUntilIdle();
+  }
+  task_environment_.RunUntilIdle();
+
+  TxStorage storage(&prefs_, GetDatabasePath());
+  ASSERT_FALSE(storage.IsLoaded());
+  // Stored transactions are not known until loaded.
+  EXPECT_FALSE(
+      storage.Get(mojom::CoinType::ETH, mojom::kMainnetChainId, "001"));
+
+  bool found_when_loaded = false;
+  storage.RunWhenLoaded(base::BindLambdaForTesting([&] {
+    found_when_loaded = !!storage.Get(mojom::CoinType::ETH,
+                                      mojom::kMainnetChainId, "001");
+  }));
+  task_environment_.RunUntilIdle();
+  ASSERT_TRUE(storage.IsLoaded());
+  EXPECT_TRUE(found_when_loaded);
+
+  // Runs right away once loaded.
+  bool ran = false;
+  storage.RunWhenLoaded(base::BindLambdaForTesting([&] { ran = true; }));
+  EXPECT_TRUE(ran);
+}
+
+}  // namespace brave_wallet
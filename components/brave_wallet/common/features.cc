@@ -65,5 +65,15 @@ BASE_FEATURE(kBraveWalletBitcoinFeature,
              "BraveWalletBitcoin",
              base::FEATURE_DISABLED_BY_DEFAULT);
 
+BASE_FEATURE(kBraveWalletJsonRpcBatchingFeature,
+             "BraveWalletJsonRpcBatching",
+             base::FEATURE_DISABLED_BY_DEFAULT);
+// Calls to the same RPC URL issued within this window are sent as one batch.
+// A zero window batches the calls issued within the same task.
+const base::FeatureParam<base::TimeDelta> kJsonRpcBatchWindow{
+    &kBraveWalletJsonRpcBatchingFeature, "batch_window", base::TimeDelta()};
+const base::FeatureParam<int> kJsonRpcMaxBatchSize{
+    &kBraveWalletJsonRpcBatchingFeature, "max_batch_size", 20};
+
 }  // namespace features
 }  // namespace brave_wallet
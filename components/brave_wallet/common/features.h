@@ -24,6 +24,9 @@ BASE_DECLARE_FEATURE(kBraveWalletDappsSupportFeature);
 BASE_DECLARE_FEATURE(kBraveWalletENSL2Feature);
 BASE_DECLARE_FEATURE(kBraveWalletSnsFeature);
 BASE_DECLARE_FEATURE(kBraveWalletBitcoinFeature);
+BASE_DECLARE_FEATURE(kBraveWalletJsonRpcBatchingFeature);
+extern const base::FeatureParam<base::TimeDelta> kJsonRpcBatchWindow;
+extern const base::FeatureParam<int> kJsonRpcMaxBatchSize;
 
 }  // namespace features
 }  // namespace brave_wallet
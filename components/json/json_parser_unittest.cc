@@ -3,6 +3,9 @@
  * License, v. 2.0. If a copy of the MPL was not distributed with this file,
  * You can obtain one at http://mozilla.org/MPL/2.0/. */
 
+#include <string>
+#include <vector>
+
 #include "brave/components/json/rs/src/lib.rs.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -612,4 +615,60 @@ TEST(JsonParser, ConvertAllNumbersToString) {
   }
 }
 
+TEST(JsonParser, ConvertValues) {
+  // OK: all conversions are applied
+  std::string json(R"({"a":"1","b":[-2,"-3"],"c":{"d":18446744073709551615}})");
+  std::vector<json::ValueConversion> conversions = {
+      {"/a", json::ConversionKind::StringToUint64, false},
+      {"/b/0", json::ConversionKind::Int64ToString, false},
+      {"/b/1", json::ConversionKind::StringToInt64, false},
+      {"/c/d", json::ConversionKind::Uint64ToString, false},
+      {"/e", json::ConversionKind::StringToUint64, true}};
+  auto convert = [&](const std::string& json) {
+    return std::string(json::convert_values(
+        json, rust::Slice<const json::ValueConversion>(conversions.data(),
+                                                       conversions.size())));
+  };
+  EXPECT_EQ(convert(json),
+            R"({"a":1,"b":["-2",-3],"c":{"d":"18446744073709551615"}})");
+
+  // OK: same result as chaining single conversions
+  std::string chained = json;
+  chained = std::string(json::convert_string_value_to_uint64("/a", chained,
+                                                             false));
+  chained = std::string(json::convert_int64_value_to_string("/b/0", chained,
+                                                            false));
+  chained = std::string(json::convert_string_value_to_int64("/b/1", chained,
+                                                            false));
+  chained = std::string(json::convert_uint64_value_to_string("/c/d", chained,
+                                                             false));
+  chained = std::string(json::convert_string_value_to_uint64("/e", chained,
+                                                             true));
+  EXPECT_EQ(convert(json), chained);
+
+  // OK: optional values which are null or not found are unchanged, the
+  // original string is returned if nothing was converted
+  json = R"({"a": null, "b": [-2, "-3"]})";
+  conversions = {{"/a", json::ConversionKind::StringToUint64, true},
+                 {"/c", json::ConversionKind::Uint64ToString, true}};
+  EXPECT_EQ(convert(json), json);
+  conversions.clear();
+  EXPECT_EQ(convert(json), json);
+
+  // KO: any conversion which is not possible fails the whole batch
+  json = R"({"a":"1","b":-2})";
+  conversions = {{"/a", json::ConversionKind::StringToUint64, false},
+                 {"/b", json::ConversionKind::StringToInt64, false}};
+  EXPECT_EQ(convert(json), "");
+  conversions = {{"/a", json::ConversionKind::StringToUint64, false},
+                 {"/c", json::ConversionKind::StringToUint64, false}};
+  EXPECT_EQ(convert(json), "");
+  conversions = {{"/b", json::ConversionKind::Uint64ToString, false}};
+  EXPECT_EQ(convert(json), "");
+
+  // KO: invalid json
+  conversions = {{"/a", json::ConversionKind::StringToUint64, true}};
+  EXPECT_EQ(convert(R"({"a": hello})"), "");
+}
+
 }  // namespace brave_wallet
@@ -3,8 +3,25 @@
 // License, v. 2.0. If a copy of the MPL was not distributed with this file,
 // You can obtain one at https://mozilla.org/MPL/2.0/.
 
+use serde_json::Value;
+
 #[cxx::bridge(namespace = json)]
 mod ffi {
+    enum ConversionKind {
+        Uint64ToString,
+        Int64ToString,
+        StringToUint64,
+        StringToInt64,
+    }
+
+    // A conversion of the value at path, with the same meaning of optional as
+    // in the convert_*_value_to_* functions.
+    struct ValueConversion {
+        path: String,
+        kind: ConversionKind,
+        optional: bool,
+    }
+
     extern "Rust" {
         fn convert_uint64_value_to_string(path: &str, json: &str, optional: bool) -> String;
         fn convert_int64_value_to_string(path: &str, json: &str, optional: bool) -> String;
@@ -17,7 +34,71 @@ mod ffi {
             json: &str,
         ) -> String;
         fn convert_all_numbers_to_string(json: &str, path: &str) -> String;
+        fn convert_values(json: &str, conversions: &[ValueConversion]) -> String;
+    }
+}
+
+use ffi::ConversionKind;
+
+// Converts the value at path in place. Returns Ok(false) when the value is
+// left as is because it is optional and not found or null, and Err(()) when
+// the conversion is not possible.
+fn convert_value(
+    root: &mut Value,
+    path: &str,
+    kind: ConversionKind,
+    optional: bool,
+) -> Result<bool, ()> {
+    let value = match root.pointer_mut(path) {
+        Some(value) => value,
+        None if optional => return Ok(false),
+        None => return Err(()),
+    };
+    if value.is_null() && optional {
+        return Ok(false);
+    }
+
+    let converted = match kind {
+        ConversionKind::Uint64ToString if value.is_u64() => Value::String(value.to_string()),
+        ConversionKind::Int64ToString if value.is_i64() => Value::String(value.to_string()),
+        ConversionKind::StringToUint64 => match value.as_str().map(str::parse::<u64>) {
+            Some(Ok(uint64)) => Value::from(uint64),
+            _ => return Err(()),
+        },
+        ConversionKind::StringToInt64 => match value.as_str().map(str::parse::<i64>) {
+            Some(Ok(int64)) => Value::from(int64),
+            _ => return Err(()),
+        },
+        _ => return Err(()),
+    };
+    *value = converted;
+    Ok(true)
+}
+
+// Parses json once, applies every conversion in order and re-serializes it.
+// Returns an empty String if any conversion is not possible, and the original
+// string if no value was converted.
+fn apply_conversions<'a>(
+    json: &str,
+    conversions: impl IntoIterator<Item = (&'a str, ConversionKind, bool)>,
+) -> String {
+    let mut root: Value = match serde_json::from_str(json) {
+        Ok(value) => value,
+        Err(_) => return String::new(),
+    };
+
+    let mut converted = false;
+    for (path, kind, optional) in conversions {
+        match convert_value(&mut root, path, kind, optional) {
+            Ok(value_converted) => converted |= value_converted,
+            Err(()) => return String::new(),
+        }
+    }
+
+    if !converted {
+        return json.to_string();
     }
+    serde_json::to_string(&root).unwrap_or_else(|_| "".into())
 }
 
 // Parses and re-serializes json with the value at path converted from a uint64
@@ -43,27 +124,7 @@ mod ffi {
 //   input: { a : null }
 //   convert_uint64_value_to_string("/a", json, true)
 pub fn convert_uint64_value_to_string(path: &str, json: &str, optional: bool) -> String {
-    let result_value = serde_json::from_str(&json);
-    if result_value.is_err() {
-        return String::new();
-    }
-    let mut unwrapped_value: serde_json::Value = result_value.unwrap();
-    let mutable_pointer = unwrapped_value.pointer_mut(path);
-    if mutable_pointer.is_none() {
-        if optional {
-            return json.to_string();
-        }
-        return String::new();
-    }
-    let value = mutable_pointer.unwrap();
-    if value.is_null() && optional {
-        return json.to_string();
-    }
-    if !value.is_u64() {
-        return String::new();
-    }
-    *value = serde_json::Value::String(value.to_string());
-    serde_json::to_string(&unwrapped_value).unwrap_or_else(|_| "".into())
+    apply_conversions(json, [(path, ConversionKind::Uint64ToString, optional)])
 }
 
 // Parses and re-serializes json with the value at path converted from a int64
@@ -89,28 +150,7 @@ pub fn convert_uint64_value_to_string(path: &str, json: &str, optional: bool) ->
 //   json: { a : null }
 //   convert_int64_value_to_string("/a", json, true)
 pub fn convert_int64_value_to_string(path: &str, json: &str, optional: bool) -> String {
-    let result_value = serde_json::from_str(&json);
-    if result_value.is_err() {
-        return String::new();
-    }
-    let mut unwrapped_value: serde_json::Value = result_value.unwrap();
-
-    let mutable_pointer = unwrapped_value.pointer_mut(path);
-    if mutable_pointer.is_none() {
-        if optional {
-            return json.to_string();
-        }
-        return String::new();
-    }
-    let value = mutable_pointer.unwrap();
-    if value.is_null() && optional {
-        return json.to_string();
-    }
-    if !value.is_i64() {
-        return String::new();
-    }
-    *value = serde_json::Value::String(value.to_string());
-    serde_json::to_string(&unwrapped_value).unwrap_or_else(|_| "".into())
+    apply_conversions(json, [(path, ConversionKind::Int64ToString, optional)])
 }
 
 // Parses and re-serializes json with the value at path converted from a string
@@ -136,32 +176,7 @@ pub fn convert_int64_value_to_string(path: &str, json: &str, optional: bool) ->
 //   json: { a : null }
 //   convert_string_value_to_uint64("/a", json, true)
 pub fn convert_string_value_to_uint64(path: &str, json: &str, optional: bool) -> String {
-    let result_value = serde_json::from_str(&json);
-    if result_value.is_err() {
-        return String::new();
-    }
-    let mut unwrapped_value: serde_json::Value = result_value.unwrap();
-    let mutable_pointer = unwrapped_value.pointer_mut(path);
-    if mutable_pointer.is_none() {
-        if optional {
-            return json.to_string();
-        }
-        return String::new();
-    }
-    let value = mutable_pointer.unwrap();
-    if value.is_null() && optional {
-        return json.to_string();
-    }
-    if !value.is_string() {
-        return String::new();
-    }
-    let unwrapped_number = value.as_str().unwrap();
-    let uint64 = unwrapped_number.parse::<u64>();
-    if let Ok(uint64) = uint64 {
-        *value = serde_json::Value::from(uint64);
-        return serde_json::to_string(&unwrapped_value).unwrap_or_else(|_| "".into());
-    }
-    String::new()
+    apply_conversions(json, [(path, ConversionKind::StringToUint64, optional)])
 }
 
 // Parses and re-serializes json with the value at path converted from a string
@@ -187,33 +202,7 @@ pub fn convert_string_value_to_uint64(path: &str, json: &str, optional: bool) ->
 //   json: { a : null }
 //   convert_string_value_to_uint64("/a", json, true)
 pub fn convert_string_value_to_int64(path: &str, json: &str, optional: bool) -> String {
-    let result_value = serde_json::from_str(&json);
-    if result_value.is_err() {
-        return String::new();
-    }
-    let mut unwrapped_value: serde_json::Value = result_value.unwrap();
-    let mutable_pointer = unwrapped_value.pointer_mut(path);
-    if mutable_pointer.is_none() {
-        if optional {
-            return json.to_string();
-        }
-        return String::new();
-    }
-    let value = mutable_pointer.unwrap();
-    if value.is_null() && optional {
-        return json.to_string();
-    }
-    if !value.is_string() {
-        return String::new();
-    }
-    let unwrapped_number = value.as_str().unwrap();
-    let int64 = unwrapped_number.parse::<i64>();
-    if let Ok(int64) = int64 {
-        *value = serde_json::Value::from(int64);
-        return serde_json::to_string(&unwrapped_value).unwrap_or_else(|_| "".into());
-    }
-
-    String::new()
+    apply_conversions(json, [(path, ConversionKind::StringToInt64, optional)])
 }
 
 // Parses and re-serializes json with uint64 values for the given key of the
@@ -308,8 +297,6 @@ pub fn convert_uint64_in_object_array_to_string(
 ///     {"a":1,"outer":{"inner":"2"}}
 /// ```
 pub fn convert_all_numbers_to_string(json: &str, path: &str) -> String {
-    use serde_json::Value;
-
     fn convert_recursively(json: &mut Value) {
         match json {
             Value::Number(n) if n.is_u64() || n.is_i64() || n.is_f64() => {
@@ -328,3 +315,25 @@ pub fn convert_all_numbers_to_string(json: &str, path: &str) -> String {
         })
         .unwrap_or_else(|_| "".into())
 }
+
+// Applies all conversions to json with a single parse and serialization, for
+// callers which would otherwise chain the convert_*_value_to_* functions.
+// Conversions are applied in order. Returns an empty String if any of them is
+// not possible, and the original string if no value was converted.
+// Example:
+//   json: { a : '1', b : [ '-2' ] } -> { a : 1, b : [ -2 ] }
+//   convert_values(json, [{ "/a", StringToUint64, false },
+//                         { "/b/0", StringToInt64, false },
+//                         { "/c", StringToUint64, true }])
+pub fn convert_values(json: &str, conversions: &[ffi::ValueConversion]) -> String {
+    apply_conversions(
+        json,
+        conversions.iter().map(|conversion| {
+            (
+                conversion.path.as_str(),
+                conversion.kind,
+                conversion.optional,
+            )
+        }),
+    )
+}
@@ -9,11 +9,13 @@
 #include <utility>
 #include <vector>
 
+#include "base/barrier_callback.h"
 #include "base/base64.h"
 #include "base/functional/bind.h"
 #include "base/logging.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/string_split.h"
+#include "base/task/thread_pool.h"
 #include "brave/components/p3a/p3a_config.h"
 #include "brave/components/p3a/p3a_message.h"
 #include "components/prefs/pref_registry_simple.h"
@@ -30,22 +32,33 @@ constexpr std::size_t kP3AConstellationCurrentThreshold = 50;
 
 }  // namespace
 
+ConstellationHelper::PreparedMeasurement::PreparedMeasurement(
+    std::string histogram_name,
+    ::rust::Box<constellation::RandomnessRequestStateWrapper> state,
+    rust::Vec<constellation::VecU8> request_points)
+    : histogram_name(std::move(histogram_name)),
+      state(std::move(state)),
+      request_points(std::move(request_points)) {}
+
+ConstellationHelper::PreparedMeasurement::PreparedMeasurement(
+    PreparedMeasurement&&) = default;
+ConstellationHelper::PreparedMeasurement&
+ConstellationHelper::PreparedMeasurement::operator=(PreparedMeasurement&&) =
+    default;
+ConstellationHelper::PreparedMeasurement::~PreparedMeasurement() = default;
+
 ConstellationHelper::ConstellationHelper(
     PrefService* local_state,
     scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory,
-    ConstellationMessageCallback message_callback,
+    ConstellationMessagesCallback messages_callback,
     StarRandomnessMeta::RandomnessServerInfoCallback info_callback,
     const P3AConfig* config)
     : rand_meta_manager_(local_state,
                          url_loader_factory,
                          info_callback,
                          config),
-      rand_points_manager_(
-          url_loader_factory,
-          base::BindRepeating(&ConstellationHelper::HandleRandomnessData,
-                              base::Unretained(this)),
-          config),
-      message_callback_(message_callback),
+      rand_points_manager_(url_loader_factory, config),
+      messages_callback_(messages_callback),
       null_public_key_(constellation::get_ppoprf_null_public_key()) {}
 
 ConstellationHelper::~ConstellationHelper() {}
@@ -58,62 +71,133 @@ void ConstellationHelper::UpdateRandomnessServerInfo() {
   rand_meta_manager_.RequestServerInfo();
 }
 
-bool ConstellationHelper::StartMessagePreparation(std::string histogram_name,
-                                                  std::string serialized_log) {
+bool ConstellationHelper::StartMessagePreparation(
+    base::flat_map<std::string, std::string> serialized_logs) {
+  DCHECK(!serialized_logs.empty());
+  if (batch_in_progress_) {
+    LOG(ERROR) << "ConstellationHelper: measurement preparation is already "
+                  "in progress";
+    return false;
+  }
   auto* rnd_server_info = rand_meta_manager_.GetCachedRandomnessServerInfo();
   if (rnd_server_info == nullptr) {
     LOG(ERROR) << "ConstellationHelper: measurement preparation failed due to "
                   "unavailable server info";
     return false;
   }
+  batch_in_progress_ = true;
+
+  uint8_t epoch = rnd_server_info->current_epoch;
+
+  // Measurements are prepared in parallel, the randomness request is sent
+  // once all of them are ready.
+  auto barrier_callback = base::BarrierCallback<PreparedMeasurement>(
+      serialized_logs.size(),
+      base::BindOnce(&ConstellationHelper::SendRandomnessRequest,
+                     weak_ptr_factory_.GetWeakPtr(), epoch));
+  for (auto& [histogram_name, serialized_log] : serialized_logs) {
+    base::ThreadPool::PostTaskAndReplyWithResult(
+        FROM_HERE, {base::TaskPriority::BEST_EFFORT},
+        base::BindOnce(&ConstellationHelper::PrepareMeasurement, histogram_name,
+                       std::move(serialized_log), epoch),
+        barrier_callback);
+  }
+
+  return true;
+}
+
+// static
+ConstellationHelper::PreparedMeasurement
+ConstellationHelper::PrepareMeasurement(std::string histogram_name,
+                                        std::string serialized_log,
+                                        uint8_t epoch) {
   std::vector<std::string> layers =
       base::SplitString(serialized_log, kP3AMessageConstellationLayerSeparator,
                         base::WhitespaceHandling::TRIM_WHITESPACE,
                         base::SplitResult::SPLIT_WANT_NONEMPTY);
 
-  uint8_t epoch = rnd_server_info->current_epoch;
-
   auto prepare_res = constellation::prepare_measurement(layers, epoch);
   if (!prepare_res.error.empty()) {
     LOG(ERROR) << "ConstellationHelper: measurement preparation failed: "
                << prepare_res.error.c_str();
-    return false;
+    return PreparedMeasurement(std::move(histogram_name),
+                               std::move(prepare_res.state), {});
   }
 
   auto req = constellation::construct_randomness_request(*prepare_res.state);
+  return PreparedMeasurement(std::move(histogram_name),
+                             std::move(prepare_res.state), std::move(req));
+}
 
-  rand_points_manager_.SendRandomnessRequest(
-      histogram_name, &rand_meta_manager_, rnd_server_info->current_epoch,
-      std::move(prepare_res.state), req);
+void ConstellationHelper::SendRandomnessRequest(
+    uint8_t epoch,
+    std::vector<PreparedMeasurement> measurements) {
+  rust::Vec<constellation::VecU8> points;
+  for (const auto& measurement : measurements) {
+    for (const auto& point : measurement.request_points) {
+      points.push_back(point);
+    }
+  }
+  if (points.empty()) {
+    HandleRandomnessData(epoch, std::move(measurements), nullptr, nullptr);
+    return;
+  }
 
-  return true;
+  rand_points_manager_.SendRandomnessRequest(
+      &rand_meta_manager_, epoch, points,
+      base::BindOnce(&ConstellationHelper::HandleRandomnessData,
+                     weak_ptr_factory_.GetWeakPtr(), epoch,
+                     std::move(measurements)));
 }
 
 void ConstellationHelper::HandleRandomnessData(
-    std::string histogram_name,
     uint8_t epoch,
-    ::rust::Box<constellation::RandomnessRequestStateWrapper>
-        randomness_request_state,
+    std::vector<PreparedMeasurement> measurements,
     std::unique_ptr<rust::Vec<constellation::VecU8>> resp_points,
     std::unique_ptr<rust::Vec<constellation::VecU8>> resp_proofs) {
-  if (resp_points == nullptr || resp_proofs == nullptr) {
-    message_callback_.Run(histogram_name, epoch, nullptr);
-    return;
+  batch_in_progress_ = false;
+
+  size_t point_count = 0;
+  for (const auto& measurement : measurements) {
+    point_count += measurement.request_points.size();
   }
-  if (resp_points->empty()) {
-    LOG(ERROR) << "ConstellationHelper: no points for randomness request";
-    message_callback_.Run(histogram_name, epoch, nullptr);
-    return;
+  bool has_randomness = resp_points != nullptr && resp_proofs != nullptr;
+  if (has_randomness && (resp_points->size() != point_count ||
+                         (!resp_proofs->empty() &&
+                          resp_proofs->size() != point_count))) {
+    LOG(ERROR) << "ConstellationHelper: unexpected number of points for "
+                  "randomness request";
+    has_randomness = false;
   }
-  std::string final_msg;
-  if (!ConstructFinalMessage(randomness_request_state, *resp_points,
-                             *resp_proofs, &final_msg)) {
-    message_callback_.Run(histogram_name, epoch, nullptr);
-    return;
+
+  std::vector<std::pair<std::string, std::unique_ptr<std::string>>> messages;
+  messages.reserve(measurements.size());
+  size_t offset = 0;
+  for (auto& measurement : measurements) {
+    const size_t count = measurement.request_points.size();
+    std::unique_ptr<std::string> message;
+    if (has_randomness && count > 0) {
+      // Split this measurement's share of the batched response.
+      rust::Vec<constellation::VecU8> points;
+      rust::Vec<constellation::VecU8> proofs;
+      for (size_t i = offset; i < offset + count; i++) {
+        points.push_back((*resp_points)[i]);
+        if (!resp_proofs->empty()) {
+          proofs.push_back((*resp_proofs)[i]);
+        }
+      }
+      std::string final_msg;
+      if (ConstructFinalMessage(measurement.state, points, proofs,
+                                &final_msg)) {
+        message = std::make_unique<std::string>(std::move(final_msg));
+      }
+    }
+    offset += count;
+    messages.emplace_back(std::move(measurement.histogram_name),
+                          std::move(message));
   }
 
-  message_callback_.Run(histogram_name, epoch,
-                        std::make_unique<std::string>(final_msg));
+  messages_callback_.Run(epoch, ConstellationMessages(std::move(messages)));
 }
 
 bool ConstellationHelper::ConstructFinalMessage(
@@ -8,9 +8,12 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
+#include "base/containers/flat_map.h"
 #include "base/functional/callback.h"
 #include "base/memory/ref_counted.h"
+#include "base/memory/weak_ptr.h"
 #include "base/strings/string_piece_forward.h"
 #include "brave/components/p3a/constellation/rs/cxx/src/lib.rs.h"
 #include "brave/components/p3a/star_randomness_meta.h"
@@ -31,15 +34,18 @@ struct P3AConfig;
 // Constellation encrypted measurements.
 class ConstellationHelper {
  public:
-  using ConstellationMessageCallback = base::RepeatingCallback<void(
-      std::string histogram_name,
-      uint8_t epoch,
-      std::unique_ptr<std::string> serialized_message)>;
+  // <histogram name, serialized message>, messages that could not be
+  // generated are null.
+  using ConstellationMessages =
+      base::flat_map<std::string, std::unique_ptr<std::string>>;
+  using ConstellationMessagesCallback =
+      base::RepeatingCallback<void(uint8_t epoch,
+                                   ConstellationMessages serialized_messages)>;
 
   ConstellationHelper(
       PrefService* local_state,
       scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory,
-      ConstellationMessageCallback message_callback,
+      ConstellationMessagesCallback messages_callback,
       StarRandomnessMeta::RandomnessServerInfoCallback info_callback,
       const P3AConfig* config);
   ~ConstellationHelper();
@@ -51,15 +57,40 @@ class ConstellationHelper {
 
   void UpdateRandomnessServerInfo();
 
-  bool StartMessagePreparation(std::string histogram_name,
-                               std::string serialized_log);
+  // Prepares the measurements of all |serialized_logs|, keyed by histogram
+  // name, in parallel and requests randomness for all of them in a single
+  // round trip. The messages callback runs once for the whole batch.
+  // Returns false if nothing was started.
+  bool StartMessagePreparation(
+      base::flat_map<std::string, std::string> serialized_logs);
 
  private:
+  struct PreparedMeasurement {
+    PreparedMeasurement(
+        std::string histogram_name,
+        ::rust::Box<constellation::RandomnessRequestStateWrapper> state,
+        rust::Vec<constellation::VecU8> request_points);
+    PreparedMeasurement(PreparedMeasurement&&);
+    PreparedMeasurement& operator=(PreparedMeasurement&&);
+    ~PreparedMeasurement();
+
+    std::string histogram_name;
+    ::rust::Box<constellation::RandomnessRequestStateWrapper> state;
+    // Empty if the preparation failed.
+    rust::Vec<constellation::VecU8> request_points;
+  };
+
+  // Runs on the thread pool.
+  static PreparedMeasurement PrepareMeasurement(std::string histogram_name,
+                                                std::string serialized_log,
+                                                uint8_t epoch);
+
+  void SendRandomnessRequest(uint8_t epoch,
+                             std::vector<PreparedMeasurement> measurements);
+
   void HandleRandomnessData(
-      std::string histogram_name,
       uint8_t epoch,
-      ::rust::Box<constellation::RandomnessRequestStateWrapper>
-          randomness_request_state,
+      std::vector<PreparedMeasurement> measurements,
       std::unique_ptr<rust::Vec<constellation::VecU8>> resp_points,
       std::unique_ptr<rust::Vec<constellation::VecU8>> resp_proofs);
 
@@ -73,9 +104,13 @@ class ConstellationHelper {
   StarRandomnessMeta rand_meta_manager_;
   StarRandomnessPoints rand_points_manager_;
 
-  ConstellationMessageCallback message_callback_;
+  ConstellationMessagesCallback messages_callback_;
 
   ::rust::Box<constellation::PPOPRFPublicKeyWrapper> null_public_key_;
+
+  bool batch_in_progress_ = false;
+
+  base::WeakPtrFactory<ConstellationHelper> weak_ptr_factory_{this};
 };
 
 }  // namespace p3a
@@ -6,9 +6,12 @@
 #include "brave/components/p3a/constellation_helper.h"
 
 #include <memory>
+#include <string>
 #include <utility>
 
 #include "base/memory/raw_ptr.h"
+#include "base/containers/flat_map.h"
+#include "base/strings/strcat.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/test/bind.h"
 #include "base/time/time.h"
@@ -61,7 +64,7 @@ class P3AConstellationHelperTest : public testing::Test {
           } else if (request.url ==
                      GURL(std::string(kTestHost) + "/randomness")) {
             response = HandleRandomnessRequest(request, kTestEpoch);
-            points_request_made = true;
+            points_requests_made++;
           }
           if (!response.empty()) {
             if (interceptor_send_bad_response) {
@@ -76,11 +79,10 @@ class P3AConstellationHelperTest : public testing::Test {
     helper = std::make_unique<ConstellationHelper>(
         &local_state, shared_url_loader_factory,
         base::BindLambdaForTesting(
-            [this](std::string histogram_name, uint8_t epoch,
-                   std::unique_ptr<std::string> serialized_message) {
-              histogram_name_from_callback = histogram_name;
+            [this](uint8_t epoch,
+                   ConstellationHelper::ConstellationMessages messages) {
               epoch_from_callback = epoch;
-              serialized_message_from_callback = std::move(serialized_message);
+              messages_from_callback = std::move(messages);
             }),
         base::BindLambdaForTesting([this](RandomnessServerInfo* server_info) {
           server_info_from_callback = server_info;
@@ -98,13 +100,11 @@ class P3AConstellationHelperTest : public testing::Test {
   bool interceptor_send_bad_response = false;
 
   raw_ptr<RandomnessServerInfo> server_info_from_callback = nullptr;
-  std::unique_ptr<std::string> serialized_message_from_callback;
-
-  std::string histogram_name_from_callback;
+  ConstellationHelper::ConstellationMessages messages_from_callback;
   uint8_t epoch_from_callback;
 
   bool info_request_made = false;
-  bool points_request_made = false;
+  size_t points_requests_made = 0;
 };
 
 TEST_F(P3AConstellationHelperTest, CanRetrieveServerInfo) {
@@ -165,18 +165,64 @@ TEST_F(P3AConstellationHelperTest, GenerateBasicMessage) {
   MessageMetainfo meta_info;
   meta_info.Init(&local_state, "release", "2022-01-01");
 
-  helper->StartMessagePreparation(
-      kTestHistogramName, GenerateP3AConstellationMessage(
-                              kTestHistogramName, kTestEpoch, meta_info));
+  ASSERT_TRUE(helper->StartMessagePreparation(
+      {{kTestHistogramName,
+        GenerateP3AConstellationMessage(kTestHistogramName, kTestEpoch,
+                                        meta_info)}}));
   task_environment_.RunUntilIdle();
 
-  ASSERT_TRUE(points_request_made);
+  EXPECT_EQ(points_requests_made, 1U);
 
-  EXPECT_NE(serialized_message_from_callback, nullptr);
-  EXPECT_NE(serialized_message_from_callback->size(), 0U);
+  ASSERT_EQ(messages_from_callback.size(), 1U);
+  const auto& serialized_message = messages_from_callback[kTestHistogramName];
+  ASSERT_NE(serialized_message, nullptr);
+  EXPECT_NE(serialized_message->size(), 0U);
 
-  EXPECT_EQ(histogram_name_from_callback, kTestHistogramName);
   EXPECT_EQ(epoch_from_callback, kTestEpoch);
 }
 
+TEST_F(P3AConstellationHelperTest, GenerateBatchedMessages) {
+  SetUpHelper();
+  helper->UpdateRandomnessServerInfo();
+  task_environment_.RunUntilIdle();
+
+  MessageMetainfo meta_info;
+  meta_info.Init(&local_state, "release", "2022-01-01");
+
+  base::flat_map<std::string, std::string> logs;
+  for (int i = 0; i < 20; i++) {
+    std::string histogram_name =
+        base::StrCat({kTestHistogramName, base::NumberToString(i)});
+    logs[histogram_name] =
+        GenerateP3AConstellationMessage(histogram_name, kTestEpoch, meta_info);
+  }
+
+  ASSERT_TRUE(helper->StartMessagePreparation(logs));
+  // Only one batch can be prepared at a time.
+  EXPECT_FALSE(helper->StartMessagePreparation(logs));
+  task_environment_.RunUntilIdle();
+
+  EXPECT_EQ(points_requests_made, 1U);
+  EXPECT_EQ(epoch_from_callback, kTestEpoch);
+  ASSERT_EQ(messages_from_callback.size(), 20U);
+  for (const auto& [histogram_name, serialized_message] :
+       messages_from_callback) {
+    ASSERT_NE(serialized_message, nullptr) << histogram_name;
+    EXPECT_NE(serialized_message->size(), 0U);
+  }
+
+  // Failed randomness requests fail every measurement of the batch.
+  interceptor_send_bad_response = true;
+  points_requests_made = 0;
+  ASSERT_TRUE(helper->StartMessagePreparation(logs));
+  task_environment_.RunUntilIdle();
+
+  EXPECT_EQ(points_requests_made, 1U);
+  ASSERT_EQ(messages_from_callback.size(), 20U);
+  for (const auto& [histogram_name, serialized_message] :
+       messages_from_callback) {
+    EXPECT_EQ(serialized_message, nullptr);
+  }
+}
+
 }  // namespace p3a
@@ -5,10 +5,13 @@
 
 #include "brave/components/p3a/message_manager.h"
 
+#include <utility>
+
 #include "base/functional/bind.h"
 #include "base/json/json_writer.h"
 #include "base/logging.h"
 #include "base/strings/string_number_conversions.h"
+#include "base/task/thread_pool.h"
 #include "brave/components/p3a/constellation_helper.h"
 #include "brave/components/p3a/constellation_log_store.h"
 #include "brave/components/p3a/features.h"
@@ -29,6 +32,8 @@ namespace {
 
 const size_t kMaxEpochsToRetain = 4;
 constexpr base::TimeDelta kPostRotationUploadDelay = base::Seconds(30);
+constexpr base::FilePath::CharType kLogDatabaseFileName[] =
+    FILE_PATH_LITERAL("P3A Logs");
 
 }  // namespace
 
@@ -36,19 +41,30 @@ MessageManager::MessageManager(PrefService& local_state,
                                const P3AConfig* config,
                                Delegate& delegate,
                                std::string channel,
-                               std::string week_of_install)
+                               std::string week_of_install,
+                               const base::FilePath& user_data_dir)
     : local_state_(local_state), config_(config), delegate_(delegate) {
   message_meta_.Init(&local_state, channel, week_of_install);
 
+  if (!user_data_dir.empty()) {
+    log_database_ = std::make_unique<base::SequenceBound<MetricLogDatabase>>(
+        base::ThreadPool::CreateSequencedTaskRunner(
+            {base::MayBlock(), base::TaskPriority::BEST_EFFORT,
+             base::TaskShutdownBehavior::BLOCK_SHUTDOWN}),
+        user_data_dir.Append(kLogDatabaseFileName));
+    log_database_->AsyncCall(&MetricLogDatabase::Init);
+  }
+
   // Init log stores.
   for (MetricLogType log_type : kAllMetricLogTypes) {
-    json_log_stores_[log_type] =
-        std::make_unique<MetricLogStore>(*this, *local_state_, false, log_type);
+    json_log_stores_[log_type] = std::make_unique<MetricLogStore>(
+        *this, *local_state_, log_database_.get(), false, log_type);
     json_log_stores_[log_type]->LoadPersistedUnsentLogs();
   }
   if (features::IsConstellationEnabled()) {
     constellation_prep_log_store_ = std::make_unique<MetricLogStore>(
-        *this, *local_state_, true, MetricLogType::kTypical);
+        *this, *local_state_, log_database_.get(), true,
+        MetricLogType::kTypical);
     constellation_prep_log_store_->LoadPersistedUnsentLogs();
     constellation_send_log_store_ = std::make_unique<ConstellationLogStore>(
         *local_state_, kMaxEpochsToRetain);
@@ -102,7 +118,7 @@ void MessageManager::Init(
 
     constellation_helper_ = std::make_unique<ConstellationHelper>(
         &*local_state_, url_loader_factory,
-        base::BindRepeating(&MessageManager::OnNewConstellationMessage,
+        base::BindRepeating(&MessageManager::OnNewConstellationMessages,
                             base::Unretained(this)),
         base::BindRepeating(&MessageManager::OnRandomnessServerInfoReady,
                             base::Unretained(this)),
@@ -182,21 +198,24 @@ void MessageManager::OnLogUploadComplete(bool is_ok,
   scheduler->UploadFinished(is_ok);
 }
 
-void MessageManager::OnNewConstellationMessage(
-    std::string histogram_name,
+void MessageManager::OnNewConstellationMessages(
     uint8_t epoch,
-    std::unique_ptr<std::string> serialized_message) {
-  VLOG(2) << "MessageManager::OnNewConstellationMessage: has val? "
-          << (serialized_message != nullptr);
-  if (!serialized_message) {
-    constellation_prep_scheduler_->UploadFinished(false);
-    return;
+    ConstellationHelper::ConstellationMessages serialized_messages) {
+  bool all_prepared = true;
+  for (const auto& [histogram_name, serialized_message] :
+       serialized_messages) {
+    VLOG(2) << "MessageManager::OnNewConstellationMessages: " << histogram_name
+            << " has val? " << (serialized_message != nullptr);
+    if (!serialized_message) {
+      all_prepared = false;
+      continue;
+    }
+    constellation_send_log_store_->UpdateMessage(histogram_name, epoch,
+                                                 *serialized_message);
+    constellation_prep_log_store_->MarkLogAsSent(histogram_name);
+    delegate_->OnMetricCycled(histogram_name, true);
   }
-  constellation_send_log_store_->UpdateMessage(histogram_name, epoch,
-                                               *serialized_message);
-  constellation_prep_log_store_->DiscardStagedLog();
-  constellation_prep_scheduler_->UploadFinished(true);
-  delegate_->OnMetricCycled(histogram_name, true);
+  constellation_prep_scheduler_->UploadFinished(all_prepared);
 }
 
 void MessageManager::OnRandomnessServerInfoReady(
@@ -293,16 +312,14 @@ void MessageManager::StartScheduledConstellationPrep() {
                "stage.";
     return;
   }
-  if (!constellation_prep_log_store_->has_staged_log()) {
-    constellation_prep_log_store_->StageNextLog();
-  }
-
-  const std::string log = constellation_prep_log_store_->staged_log();
-  const std::string log_key = constellation_prep_log_store_->staged_log_key();
+  // Every pending measurement is prepared in one batch, with a single
+  // randomness request.
+  base::flat_map<std::string, std::string> logs =
+      constellation_prep_log_store_->SerializeUnsentLogs();
   VLOG(2) << "MessageManager::StartScheduledConstellationPrep - Requesting "
-             "randomness for histogram: "
-          << log_key;
-  if (!constellation_helper_->StartMessagePreparation(log_key.c_str(), log)) {
+             "randomness for "
+          << logs.size() << " histograms";
+  if (!constellation_helper_->StartMessagePreparation(std::move(logs))) {
     constellation_upload_scheduler_->UploadFinished(false);
   }
 }
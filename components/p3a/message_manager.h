@@ -10,12 +10,16 @@
 #include <string>
 
 #include "base/containers/flat_map.h"
+#include "base/files/file_path.h"
 #include "base/functional/callback.h"
 #include "base/memory/raw_ptr.h"
 #include "base/memory/raw_ref.h"
 #include "base/memory/ref_counted.h"
 #include "base/strings/string_piece_forward.h"
+#include "base/threading/sequence_bound.h"
 #include "base/timer/timer.h"
+#include "brave/components/p3a/constellation_helper.h"
+#include "brave/components/p3a/metric_log_database.h"
 #include "brave/components/p3a/metric_log_store.h"
 #include "brave/components/p3a/metric_log_type.h"
 #include "brave/components/p3a/p3a_message.h"
@@ -35,11 +39,8 @@ class Uploader;
 class ConstellationLogStore;
 class RotationScheduler;
 class Scheduler;
-class ConstellationHelper;
 class Uploader;
 
-struct RandomnessServerInfo;
-
 // The message manager has multiple roles related to handling/reporting metric
 // values. Metric updates received upstream from the Service are stored
 // in their appropriate LogStore instances. The Scheduler calls
@@ -62,11 +63,13 @@ class MessageManager : public MetricLogStore::Delegate {
                                 bool is_constellation) = 0;
     virtual ~Delegate() {}
   };
+  // Metric values are kept in memory only if |user_data_dir| is empty.
   MessageManager(PrefService& local_state,
                  const P3AConfig* config,
                  Delegate& delegate,
                  std::string channel,
-                 std::string week_of_install);
+                 std::string week_of_install,
+                 const base::FilePath& user_data_dir);
   ~MessageManager() override;
 
   MessageManager(const MessageManager&) = delete;
@@ -91,10 +94,9 @@ class MessageManager : public MetricLogStore::Delegate {
                            bool is_constellation,
                            MetricLogType log_type);
 
-  void OnNewConstellationMessage(
-      std::string histogram_name,
+  void OnNewConstellationMessages(
       uint8_t epoch,
-      std::unique_ptr<std::string> serialized_message);
+      ConstellationHelper::ConstellationMessages serialized_messages);
 
   void OnRandomnessServerInfoReady(RandomnessServerInfo* server_info);
 
@@ -118,6 +120,8 @@ class MessageManager : public MetricLogStore::Delegate {
 
   const raw_ptr<const P3AConfig> config_;
 
+  // Must outlive the metric log stores.
+  std::unique_ptr<base::SequenceBound<MetricLogDatabase>> log_database_;
   base::flat_map<MetricLogType, std::unique_ptr<MetricLogStore>>
       json_log_stores_;
   std::unique_ptr<MetricLogStore> constellation_prep_log_store_;
@@ -141,7 +141,8 @@ class P3AMessageManagerTest : public testing::Test,
         }));
 
     message_manager = std::make_unique<MessageManager>(
-        local_state, &p3a_config, *this, "release", "2099-01-01");
+        local_state, &p3a_config, *this, "release", "2099-01-01",
+        base::FilePath());
 
     message_manager->Init(shared_url_loader_factory);
 
@@ -306,7 +307,8 @@ TEST_F(P3AMessageManagerTest, UpdateLogsAndSendConstellation) {
 
   task_environment_.FastForwardBy(base::Seconds(kUploadIntervalSeconds * 100));
 
-  EXPECT_EQ(points_requests_made, 7U);
+  // Randomness for all measurements is requested in a single batch.
+  EXPECT_EQ(points_requests_made, 1U);
   // Should not send metrics, since they are in current epoch
   EXPECT_EQ(p3a_constellation_sent_messages.size(), 0U);
 
@@ -317,7 +319,7 @@ TEST_F(P3AMessageManagerTest, UpdateLogsAndSendConstellation) {
                                   base::Seconds(kUploadIntervalSeconds * 100));
 
   ASSERT_TRUE(info_request_made);
-  EXPECT_EQ(points_requests_made, 7U);
+  EXPECT_EQ(points_requests_made, 1U);
   EXPECT_EQ(p3a_constellation_sent_messages.size(), 7U);
 
   ResetInterceptorStores();
@@ -327,7 +329,7 @@ TEST_F(P3AMessageManagerTest, UpdateLogsAndSendConstellation) {
                                   base::Seconds(kUploadIntervalSeconds * 100));
 
   ASSERT_TRUE(info_request_made);
-  EXPECT_EQ(points_requests_made, 7U);
+  EXPECT_EQ(points_requests_made, 1U);
   EXPECT_EQ(p3a_constellation_sent_messages.size(), 7U);
 }
 
@@ -381,7 +383,7 @@ TEST_F(P3AMessageManagerTest, UpdateLogsAndSendConstellationInvalidResponse) {
   // unavailability. randomness points should be requested for the current
   // epoch. messages from the first epoch should be sent.
   ASSERT_TRUE(info_request_made);
-  EXPECT_EQ(points_requests_made, 7U);
+  EXPECT_EQ(points_requests_made, 1U);
   EXPECT_EQ(p3a_constellation_sent_messages.size(), 7U);
 }
 
@@ -424,7 +426,7 @@ TEST_F(P3AMessageManagerTest,
   // unavailability. randomness points should be requested for the current
   // epoch. messages from the first epoch should be sent.
   ASSERT_TRUE(info_request_made);
-  EXPECT_EQ(points_requests_made, 7U);
+  EXPECT_EQ(points_requests_made, 1U);
   EXPECT_EQ(p3a_constellation_sent_messages.size(), 7U);
 }
 
@@ -466,7 +468,7 @@ TEST_F(P3AMessageManagerTest, UpdateLogsAndSendConstellationUnavailable) {
   // randomness points should be requested for the current epoch.
   // messages from the first epoch should be sent.
   ASSERT_TRUE(info_request_made);
-  EXPECT_EQ(points_requests_made, 7U);
+  EXPECT_EQ(points_requests_made, 1U);
   EXPECT_EQ(p3a_constellation_sent_messages.size(), 7U);
 }
 
@@ -0,0 +1,152 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/p3a/metric_log_database.h"
+
+#include <utility>
+
+#include "base/check.h"
+#include "base/functional/bind.h"
+#include "base/logging.h"
+#include "brave/components/sql_utils/database_error_callback.h"
+#include "sql/statement.h"
+#include "sql/transaction.h"
+
+namespace p3a {
+
+namespace {
+
+// Version 1: metric_logs table.
+constexpr int kCurrentVersionNumber = 1;
+constexpr int kCompatibleVersionNumber = 1;
+
+}  // namespace
+
+MetricLogDatabase::MetricLogDatabase(const base::FilePath& db_file_path)
+    : database_({.exclusive_locking = true, .page_size = 4096}),
+      db_file_path_(db_file_path) {
+  DETACH_FROM_SEQUENCE(sequence_checker_);
+}
+
+MetricLogDatabase::~MetricLogDatabase() = default;
+
+bool MetricLogDatabase::Init() {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  database_.set_histogram_tag("BraveP3ALogs");
+
+  // To recover from corruption.
+  database_.set_error_callback(base::BindRepeating(
+      &sql_utils::DatabaseErrorCallback, &database_, db_file_path_));
+
+  return database_.Open(db_file_path_) && InitSchema();
+}
+
+std::vector<MetricLogDatabaseEntry> MetricLogDatabase::Load(
+    const std::string& log_name,
+    base::Time expiry_time) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  std::vector<MetricLogDatabaseEntry> result;
+  if (!database_.is_open()) {
+    return result;
+  }
+
+  sql::Statement delete_expired(database_.GetUniqueStatement(
+      "DELETE FROM metric_logs WHERE log_name = ? AND update_time < ?"));
+  delete_expired.BindString(0, log_name);
+  delete_expired.BindTime(1, expiry_time);
+  if (!delete_expired.Run()) {
+    return result;
+  }
+
+  sql::Statement select(database_.GetUniqueStatement(
+      "SELECT histogram_name, value, sent, sent_timestamp, update_time "
+      "FROM metric_logs WHERE log_name = ?"));
+  select.BindString(0, log_name);
+  while (select.Step()) {
+    MetricLogDatabaseEntry entry;
+    entry.histogram_name = select.ColumnString(0);
+    entry.value = static_cast<uint64_t>(select.ColumnInt64(1));
+    entry.sent = select.ColumnBool(2);
+    entry.sent_timestamp = select.ColumnTime(3);
+    entry.update_time = select.ColumnTime(4);
+    result.push_back(std::move(entry));
+  }
+
+  return result;
+}
+
+bool MetricLogDatabase::Update(
+    const std::string& log_name,
+    std::vector<MetricLogDatabaseEntry> entries,
+    std::vector<std::string> removed_histogram_names) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+
+  sql::Transaction transaction(&database_);
+  if (!transaction.Begin()) {
+    return false;
+  }
+
+  sql::Statement insert(database_.GetCachedStatement(
+      SQL_FROM_HERE,
+      "INSERT OR REPLACE INTO metric_logs (log_name, histogram_name, value, "
+      "sent, sent_timestamp, update_time) VALUES (?,?,?,?,?,?)"));
+  for (const auto& entry : entries) {
+    insert.Reset(/*clear_bound_vars=*/true);
+    insert.BindString(0, log_name);
+    insert.BindString(1, entry.histogram_name);
+    insert.BindInt64(2, static_cast<int64_t>(entry.value));
+    insert.BindBool(3, entry.sent);
+    insert.BindTime(4, entry.sent_timestamp);
+    insert.BindTime(5, entry.update_time);
+    if (!insert.Run()) {
+      return false;
+    }
+  }
+
+  sql::Statement remove(database_.GetCachedStatement(
+      SQL_FROM_HERE,
+      "DELETE FROM metric_logs WHERE log_name = ? AND histogram_name = ?"));
+  for (const auto& histogram_name : removed_histogram_names) {
+    remove.Reset(/*clear_bound_vars=*/true);
+    remove.BindString(0, log_name);
+    remove.BindString(1, histogram_name);
+    if (!remove.Run()) {
+      return false;
+    }
+  }
+
+  return transaction.Commit();
+}
+
+bool MetricLogDatabase::InitSchema() {
+  sql::Transaction transaction(&database_);
+  if (!transaction.Begin() ||
+      !meta_table_.Init(&database_, kCurrentVersionNumber,
+                        kCompatibleVersionNumber)) {
+    return false;
+  }
+
+  if (meta_table_.GetCompatibleVersionNumber() > kCurrentVersionNumber) {
+    LOG(WARNING) << "P3A log database is too new";
+    return false;
+  }
+
+  if (!database_.DoesTableExist("metric_logs") && !CreateTables()) {
+    return false;
+  }
+
+  return transaction.Commit();
+}
+
+bool MetricLogDatabase::CreateTables() {
+  return database_.Execute(
+      "CREATE TABLE metric_logs (log_name TEXT NOT NULL, "
+      "histogram_name TEXT NOT NULL, value INTEGER NOT NULL, "
+      "sent INTEGER NOT NULL, sent_timestamp INTEGER NOT NULL, "
+      "update_time INTEGER NOT NULL, PRIMARY KEY (log_name, histogram_name))");
+}
+
+}  // namespace p3a
@@ -0,0 +1,64 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_P3A_METRIC_LOG_DATABASE_H_
+#define BRAVE_COMPONENTS_P3A_METRIC_LOG_DATABASE_H_
+
+#include <string>
+#include <vector>
+
+#include "base/files/file_path.h"
+#include "base/sequence_checker.h"
+#include "base/time/time.h"
+#include "sql/database.h"
+#include "sql/meta_table.h"
+
+namespace p3a {
+
+// A metric value of a MetricLogStore, as persisted.
+struct MetricLogDatabaseEntry {
+  std::string histogram_name;
+  uint64_t value = 0u;
+  bool sent = false;
+  base::Time sent_timestamp;
+  // Last time the value was recorded, used for expiry.
+  base::Time update_time;
+};
+
+// SQLite backed storage of the values of every MetricLogStore, keyed by
+// log name. All methods block and must be called on the same sequence.
+class MetricLogDatabase {
+ public:
+  explicit MetricLogDatabase(const base::FilePath& db_file_path);
+  ~MetricLogDatabase();
+  MetricLogDatabase(const MetricLogDatabase&) = delete;
+  MetricLogDatabase& operator=(const MetricLogDatabase&) = delete;
+
+  bool Init();
+
+  // Deletes the values of |log_name| last recorded before |expiry_time| and
+  // returns the remaining ones.
+  std::vector<MetricLogDatabaseEntry> Load(const std::string& log_name,
+                                           base::Time expiry_time);
+  // Inserts or replaces |entries| and deletes |removed_histogram_names| in
+  // a single transaction.
+  bool Update(const std::string& log_name,
+              std::vector<MetricLogDatabaseEntry> entries,
+              std::vector<std::string> removed_histogram_names);
+
+ private:
+  bool InitSchema();
+  bool CreateTables();
+
+  sql::Database database_;
+  sql::MetaTable meta_table_;
+  const base::FilePath db_file_path_;
+
+  SEQUENCE_CHECKER(sequence_checker_);
+};
+
+}  // namespace p3a
+
+#endif  // BRAVE_COMPONENTS_P3A_METRIC_LOG_DATABASE_H_
@@ -5,18 +5,20 @@
 
 #include "brave/components/p3a/metric_log_store.h"
 
+#include <utility>
 #include <vector>
 
 #include "base/check_op.h"
+#include "base/functional/bind.h"
 #include "base/logging.h"
 #include "base/metrics/histogram_macros.h"
 #include "base/rand_util.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/string_util.h"
+#include "brave/components/p3a/metric_log_database.h"
 #include "brave/components/p3a/uploader.h"
 #include "components/prefs/pref_registry_simple.h"
 #include "components/prefs/pref_service.h"
-#include "components/prefs/scoped_user_pref_update.h"
 
 namespace p3a {
 
@@ -29,6 +31,9 @@ constexpr char kLogValueKey[] = "value";
 constexpr char kLogSentKey[] = "sent";
 constexpr char kLogTimestampKey[] = "timestamp";
 
+// Values that were not recorded again for this long are dropped on load.
+constexpr base::TimeDelta kLogEntryMaxAge = base::Days(180);
+
 void RecordSentAnswersCount(uint64_t answers_count) {
   int answer = 0;
   if (1 <= answers_count && answers_count < 5) {
@@ -64,10 +69,12 @@ std::string GetUploadType(const std::string& histogram_name) {
 
 MetricLogStore::MetricLogStore(Delegate& delegate,
                                PrefService& local_state,
+                               base::SequenceBound<MetricLogDatabase>* database,
                                bool is_constellation,
                                MetricLogType type)
     : delegate_(delegate),
       local_state_(local_state),
+      database_(database),
       type_(type),
       is_constellation_(is_constellation) {}
 
@@ -106,25 +113,25 @@ void MetricLogStore::UpdateValue(const std::string& histogram_name,
   }
   LogEntry& entry = log_[histogram_name];
   entry.value = value;
+  entry.update_time = base::Time::Now();
 
   if (!entry.sent) {
     DCHECK(entry.sent_timestamp.is_null());
     unsent_entries_.insert(histogram_name);
   }
+  removed_before_load_.erase(histogram_name);
 
-  // Update the persistent value.
-  ScopedDictPrefUpdate update(&*local_state_, GetPrefName());
-  base::Value::Dict* log_dict = update->EnsureDict(histogram_name);
-  log_dict->Set(kLogValueKey, base::NumberToString(value));
-  log_dict->Set(kLogSentKey, entry.sent);
+  PersistEntries({histogram_name}, {});
 }
 
 void MetricLogStore::RemoveValueIfExists(const std::string& histogram_name) {
   log_.erase(histogram_name);
   unsent_entries_.erase(histogram_name);
+  if (!is_loaded_) {
+    removed_before_load_.insert(histogram_name);
+  }
 
-  // Update the persistent value.
-  ScopedDictPrefUpdate(&*local_state_, GetPrefName())->Remove(histogram_name);
+  PersistEntries({}, {histogram_name});
 
   if (has_staged_log() && staged_entry_key_ == histogram_name) {
     staged_entry_key_.clear();
@@ -133,8 +140,14 @@ void MetricLogStore::RemoveValueIfExists(const std::string& histogram_name) {
 }
 
 void MetricLogStore::ResetUploadStamps() {
+  if (!is_loaded_) {
+    // Values loaded later are reset as well.
+    reset_before_load_ = true;
+  }
+
   // Clear log entries flags.
-  ScopedDictPrefUpdate update(&*local_state_, GetPrefName());
+  std::vector<std::string> updated_names;
+  std::vector<std::string> removed_names;
   for (auto it = log_.begin(); it != log_.end();) {
     if (it->second.sent) {
       DCHECK(!it->second.sent_timestamp.is_null());
@@ -144,20 +157,17 @@ void MetricLogStore::ResetUploadStamps() {
         // Ephemeral metrics should only be sent once.
         // Remove value from log store so it doesn't get
         // sent again (unless another histogram value is recorded)
-        update->Remove(it->first);
+        removed_names.push_back(it->first);
         it = log_.erase(it);
         continue;
       }
 
       it->second.ResetSentState();
-
-      // Update persistent values.
-      base::Value::Dict* log_dict = update->EnsureDict(it->first);
-      log_dict->Set(kLogSentKey, it->second.sent);
-      log_dict->Set(kLogTimestampKey, it->second.sent_timestamp.ToDoubleT());
+      updated_names.push_back(it->first);
     }
     it++;
   }
+  PersistEntries(updated_names, std::move(removed_names));
 
   // Only record the sent answers count metric for weekly metrics
   if (type_ == MetricLogType::kTypical) {
@@ -171,6 +181,33 @@ void MetricLogStore::ResetUploadStamps() {
   }
 }
 
+base::flat_map<std::string, std::string>
+MetricLogStore::SerializeUnsentLogs() {
+  std::vector<std::pair<std::string, std::string>> logs;
+  logs.reserve(unsent_entries_.size());
+  for (const std::string& histogram_name : unsent_entries_) {
+    logs.emplace_back(histogram_name,
+                      delegate_->SerializeLog(
+                          histogram_name, log_[histogram_name].value, type_,
+                          is_constellation_, GetUploadType(histogram_name)));
+  }
+  return base::flat_map<std::string, std::string>(base::sorted_unique,
+                                                  std::move(logs));
+}
+
+void MetricLogStore::MarkLogAsSent(const std::string& histogram_name) {
+  auto log_iter = log_.find(histogram_name);
+  if (log_iter == log_.end()) {
+    // The value was removed while its log was being sent.
+    return;
+  }
+  log_iter->second.MarkAsSent();
+  PersistEntries({histogram_name}, {});
+
+  // Erase the entry from the unsent queue.
+  unsent_entries_.erase(histogram_name);
+}
+
 bool MetricLogStore::has_unsent_logs() const {
   return !unsent_entries_.empty();
 }
@@ -237,20 +274,9 @@ void MetricLogStore::DiscardStagedLog(base::StringPiece reason) {
   }
 
   // Mark previous staged log as sent.
-  auto log_iter = log_.find(staged_entry_key_);
-  DCHECK(log_iter != log_.end());
-  log_iter->second.MarkAsSent();
-
-  // Update the persistent value.
-  ScopedDictPrefUpdate update(&*local_state_, GetPrefName());
-  base::Value::Dict* log_dict = update->EnsureDict(log_iter->first);
-  log_dict->Set(kLogSentKey, log_iter->second.sent);
-  log_dict->Set(kLogTimestampKey, log_iter->second.sent_timestamp.ToDoubleT());
-
-  // Erase the entry from the unsent queue.
-  auto unsent_entries_iter = unsent_entries_.find(staged_entry_key_);
-  DCHECK(unsent_entries_iter != unsent_entries_.end());
-  unsent_entries_.erase(unsent_entries_iter);
+  DCHECK(log_.contains(staged_entry_key_));
+  DCHECK(unsent_entries_.contains(staged_entry_key_));
+  MarkLogAsSent(staged_entry_key_);
 
   staged_entry_key_.clear();
   staged_log_.clear();
@@ -266,34 +292,50 @@ void MetricLogStore::LoadPersistedUnsentLogs() {
   DCHECK(log_.empty());
   DCHECK(unsent_entries_.empty());
 
-  const char* pref_name = GetPrefName();
+  if (!database_) {
+    // Values are only kept in memory.
+    is_loaded_ = true;
+    return;
+  }
 
-  std::vector<std::string> metrics_to_remove;
+  MigrateFromPrefs();
 
+  database_->AsyncCall(&MetricLogDatabase::Load)
+      .WithArgs(std::string(GetPrefName()),
+                base::Time::Now() - kLogEntryMaxAge)
+      .Then(base::BindOnce(&MetricLogStore::OnLoaded,
+                           weak_ptr_factory_.GetWeakPtr()));
+}
+
+void MetricLogStore::MigrateFromPrefs() {
+  const char* pref_name = GetPrefName();
   const base::Value::Dict& log_dict = local_state_->GetDict(pref_name);
+  if (log_dict.empty()) {
+    return;
+  }
+
+  std::vector<std::string> migrated_names;
   for (const auto [name, value] : log_dict) {
     LogEntry entry;
     // Check if the metric is obsolete.
     if (!delegate_->IsActualMetric(name)) {
-      // Drop it from the local state.
-      metrics_to_remove.push_back(name);
       continue;
     }
     // Value.
     const base::Value::Dict& dict = value.GetDict();
     if (const std::string* v = dict.FindString(kLogValueKey)) {
       if (!base::StringToUint64(*v, &entry.value)) {
-        return;
+        continue;
       }
     } else {
-      return;
+      continue;
     }
 
     // Sent flag.
     if (auto v = dict.FindBool(kLogSentKey)) {
       entry.sent = *v;
     } else {
-      return;
+      continue;
     }
 
     // Timestamp.
@@ -301,22 +343,122 @@ void MetricLogStore::LoadPersistedUnsentLogs() {
       entry.sent_timestamp = base::Time::FromDoubleT(*v);
       if ((entry.sent && entry.sent_timestamp.is_null()) ||
           (!entry.sent && !entry.sent_timestamp.is_null())) {
-        return;
+        continue;
       }
     }
 
+    // Prefs don't know when values were recorded, start their expiry now.
+    entry.update_time = base::Time::Now();
+
     log_[name] = entry;
     if (!entry.sent) {
       unsent_entries_.insert(name);
     }
+    migrated_names.push_back(name);
+  }
+
+  if (migrated_names.empty()) {
+    local_state_->ClearPref(pref_name);
+    return;
+  }
+
+  // Keep the prefs until the values are stored, so that they are migrated
+  // again if storing them fails.
+  database_->AsyncCall(&MetricLogDatabase::Update)
+      .WithArgs(std::string(pref_name), BuildDatabaseEntries(migrated_names),
+                std::vector<std::string>())
+      .Then(base::BindOnce(&MetricLogStore::OnMigratedFromPrefs,
+                           weak_ptr_factory_.GetWeakPtr()));
+}
+
+void MetricLogStore::OnMigratedFromPrefs(bool success) {
+  if (!success) {
+    return;
   }
+  local_state_->ClearPref(GetPrefName());
+}
 
-  if (!metrics_to_remove.empty()) {
-    ScopedDictPrefUpdate update(&*local_state_, pref_name);
-    for (const std::string& name : metrics_to_remove) {
-      update->Remove(name);
+void MetricLogStore::OnLoaded(std::vector<MetricLogDatabaseEntry> entries) {
+  std::vector<std::string> updated_names;
+  std::vector<std::string> removed_names;
+  for (auto& loaded : entries) {
+    // Check if the metric is obsolete.
+    if (!delegate_->IsActualMetric(loaded.histogram_name)) {
+      removed_names.push_back(std::move(loaded.histogram_name));
+      continue;
+    }
+    // Values removed since loading started stay removed.
+    if (removed_before_load_.contains(loaded.histogram_name)) {
+      continue;
+    }
+    // Values recorded since loading started are more recent, but should not
+    // be sent again in the current period.
+    auto it = log_.find(loaded.histogram_name);
+    if (it != log_.end()) {
+      if (loaded.sent && !reset_before_load_ && !it->second.sent) {
+        it->second.sent = true;
+        it->second.sent_timestamp = loaded.sent_timestamp;
+        unsent_entries_.erase(loaded.histogram_name);
+        updated_names.push_back(loaded.histogram_name);
+      }
+      continue;
+    }
+
+    LogEntry entry(loaded.value);
+    entry.sent = loaded.sent;
+    entry.sent_timestamp = loaded.sent_timestamp;
+    entry.update_time = loaded.update_time;
+    if (entry.sent && reset_before_load_) {
+      if (delegate_->IsEphemeralMetric(loaded.histogram_name)) {
+        removed_names.push_back(std::move(loaded.histogram_name));
+        continue;
+      }
+      entry.ResetSentState();
+      updated_names.push_back(loaded.histogram_name);
+    }
+
+    if (!entry.sent) {
+      unsent_entries_.insert(loaded.histogram_name);
+    }
+    log_[loaded.histogram_name] = entry;
+  }
+  PersistEntries(updated_names, std::move(removed_names));
+
+  is_loaded_ = true;
+  reset_before_load_ = false;
+  removed_before_load_.clear();
+}
+
+void MetricLogStore::PersistEntries(
+    const std::vector<std::string>& updated_names,
+    std::vector<std::string> removed_names) {
+  if (!database_ || (updated_names.empty() && removed_names.empty())) {
+    return;
+  }
+
+  database_->AsyncCall(&MetricLogDatabase::Update)
+      .WithArgs(std::string(GetPrefName()),
+                BuildDatabaseEntries(updated_names), std::move(removed_names));
+}
+
+std::vector<MetricLogDatabaseEntry> MetricLogStore::BuildDatabaseEntries(
+    const std::vector<std::string>& histogram_names) const {
+  std::vector<MetricLogDatabaseEntry> entries;
+  entries.reserve(histogram_names.size());
+  for (const std::string& histogram_name : histogram_names) {
+    auto it = log_.find(histogram_name);
+    if (it == log_.end()) {
+      continue;
     }
+    MetricLogDatabaseEntry entry;
+    entry.histogram_name = histogram_name;
+    entry.value = it->second.value;
+    entry.sent = it->second.sent;
+    entry.sent_timestamp = it->second.sent_timestamp;
+    entry.update_time = it->second.update_time;
+    entries.push_back(std::move(entry));
   }
+  return entries;
 }
 
 }  // namespace p3a
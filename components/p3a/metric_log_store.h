@@ -7,12 +7,17 @@
 #define BRAVE_COMPONENTS_P3A_METRIC_LOG_STORE_H_
 
 #include <string>
+#include <vector>
 
 #include "base/containers/flat_map.h"
 #include "base/containers/flat_set.h"
+#include "base/memory/raw_ptr.h"
 #include "base/memory/raw_ref.h"
+#include "base/memory/weak_ptr.h"
 #include "base/strings/string_piece.h"
+#include "base/threading/sequence_bound.h"
 #include "base/time/time.h"
+#include "brave/components/p3a/metric_log_database.h"
 #include "brave/components/p3a/metric_log_type.h"
 #include "components/metrics/log_store.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
@@ -22,10 +27,11 @@ class PrefRegistrySimple;
 
 namespace p3a {
 
-// Stores all given values in memory and persists in prefs on the fly.
-// All logs (not only unsent are persistent), and all logs could be loaded
-// using |LoadPersistedUnsentLogs()|. We should fix this at some point since
-// for now persisted entries never expire.
+// Stores all given values in memory and persists them to a
+// MetricLogDatabase on the fly. All logs (not only unsent) are persistent and
+// are loaded asynchronously by |LoadPersistedUnsentLogs()|, along with values
+// migrated from the local state prefs used by older versions. Values that
+// have not been recorded for a long time expire on load.
 class MetricLogStore : public metrics::LogStore {
  public:
   class Delegate {
@@ -42,8 +48,10 @@ class MetricLogStore : public metrics::LogStore {
     virtual ~Delegate() {}
   };
 
+  // Values are kept in memory only if |database| is null.
   MetricLogStore(Delegate& delegate,
                  PrefService& local_state,
+                 base::SequenceBound<MetricLogDatabase>* database,
                  bool is_constellation,
                  MetricLogType type);
   ~MetricLogStore() override;
@@ -51,6 +59,7 @@ class MetricLogStore : public metrics::LogStore {
   MetricLogStore(const MetricLogStore&) = delete;
   MetricLogStore& operator=(const MetricLogStore&) = delete;
 
+  // The prefs are only read to migrate values persisted by older versions.
   static void RegisterPrefs(PrefRegistrySimple* registry);
 
   void UpdateValue(const std::string& histogram_name, uint64_t value);
@@ -59,6 +68,11 @@ class MetricLogStore : public metrics::LogStore {
   // Marks all saved values as unsent.
   void ResetUploadStamps();
 
+  // Serialized logs of all unsent values, keyed by histogram name.
+  base::flat_map<std::string, std::string> SerializeUnsentLogs();
+  // Marks the value of |histogram_name| as sent, if it still exists.
+  void MarkLogAsSent(const std::string& histogram_name);
+
   // metrics::LogStore:
   bool has_unsent_logs() const override;
   bool has_staged_log() const override;
@@ -75,7 +89,7 @@ class MetricLogStore : public metrics::LogStore {
   // |TrimAndPersistUnsentLogs| should not be used, since we persist everything
   // on the fly.
   void TrimAndPersistUnsentLogs(bool overwrite_in_memory_store) override;
-  // Returns early if founds malformed persisted values.
+  // Malformed values in prefs are skipped when migrating.
   void LoadPersistedUnsentLogs() override;
 
  private:
@@ -94,12 +108,29 @@ class MetricLogStore : public metrics::LogStore {
     uint64_t value = 0u;
     bool sent = false;
     base::Time sent_timestamp;  // At the moment only for debugging purposes.
+    base::Time update_time;
   };
 
+  // Also used as the log name in the database.
   const char* GetPrefName() const;
 
+  void MigrateFromPrefs();
+  void OnMigratedFromPrefs(bool success);
+  void OnLoaded(std::vector<MetricLogDatabaseEntry> entries);
+  // Writes the current state of |updated_names| and deletes |removed_names|.
+  void PersistEntries(const std::vector<std::string>& updated_names,
+                      std::vector<std::string> removed_names);
+  std::vector<MetricLogDatabaseEntry> BuildDatabaseEntries(
+      const std::vector<std::string>& histogram_names) const;
+
   const raw_ref<Delegate> delegate_;
   const raw_ref<PrefService> local_state_;
+  const raw_ptr<base::SequenceBound<MetricLogDatabase>> database_;
+
+  bool is_loaded_ = false;
+  // Changes made before loading completed, applied to the loaded values.
+  bool reset_before_load_ = false;
+  base::flat_set<std::string> removed_before_load_;
 
   MetricLogType type_;
 
@@ -115,6 +146,8 @@ class MetricLogStore : public metrics::LogStore {
   std::string staged_log_signature_;
 
   bool is_constellation_;
+
+  base::WeakPtrFactory<MetricLogStore> weak_ptr_factory_{this};
 };
 
 }  // namespace p3a
@@ -7,8 +7,15 @@
 
 #include <memory>
 #include <set>
+#include <string>
 
+#include "base/files/scoped_temp_dir.h"
 #include "base/strings/string_number_conversions.h"
+#include "base/task/thread_pool.h"
+#include "base/test/task_environment.h"
+#include "base/threading/sequence_bound.h"
+#include "base/values.h"
+#include "brave/components/p3a/metric_log_database.h"
 #include "brave/components/p3a/metric_log_type.h"
 #include "brave/components/p3a/metric_names.h"
 #include "components/prefs/testing_pref_service.h"
@@ -41,13 +48,28 @@ class P3AMetricLogStoreTest : public testing::Test,
 
  protected:
   void SetUp() override {
+    ASSERT_TRUE(temp_dir_.CreateUniqueTempDir());
     MetricLogStore::RegisterPrefs(local_state.registry());
     SetUpLogStore();
   }
 
+  // Reopens the database, like on the next browser start.
   void SetUpLogStore() {
-    log_store = std::make_unique<MetricLogStore>(*this, local_state, false,
-                                                 MetricLogType::kTypical);
+    log_store.reset();
+    database_.reset();
+    task_environment_.RunUntilIdle();
+
+    database_ = std::make_unique<base::SequenceBound<MetricLogDatabase>>(
+        base::ThreadPool::CreateSequencedTaskRunner({base::MayBlock()}),
+        temp_dir_.GetPath().Append(FILE_PATH_LITERAL("P3A Logs")));
+    database_->AsyncCall(&MetricLogDatabase::Init);
+    log_store = std::make_unique<MetricLogStore>(
+        *this, local_state, database_.get(), false, MetricLogType::kTypical);
+  }
+
+  void LoadLogStore() {
+    log_store->LoadPersistedUnsentLogs();
+    task_environment_.RunUntilIdle();
   }
 
   void UpdateSomeValues(size_t message_count) {
@@ -81,25 +103,32 @@ class P3AMetricLogStoreTest : public testing::Test,
     ASSERT_FALSE(log_store->has_staged_log());
   }
 
+  base::test::TaskEnvironment task_environment_{
+      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
+  base::ScopedTempDir temp_dir_;
+  std::unique_ptr<base::SequenceBound<MetricLogDatabase>> database_;
   std::unique_ptr<MetricLogStore> log_store;
   TestingPrefServiceSimple local_state;
 };
 
 TEST_F(P3AMetricLogStoreTest, GetAllLogs) {
+  LoadLogStore();
   UpdateSomeValues(9);
   ConsumeMessages(9);
 }
 
 TEST_F(P3AMetricLogStoreTest, GetAllLogsAfterReload) {
+  LoadLogStore();
   UpdateSomeValues(15);
 
   SetUpLogStore();
-  log_store->LoadPersistedUnsentLogs();
+  LoadLogStore();
 
   ConsumeMessages(15);
 }
 
 TEST_F(P3AMetricLogStoreTest, GetAllLogsAfterTimeReset) {
+  LoadLogStore();
   UpdateSomeValues(15);
   ConsumeMessages(15);
 
@@ -107,13 +136,109 @@ TEST_F(P3AMetricLogStoreTest, GetAllLogsAfterTimeReset) {
   ConsumeMessages(15);
 }
 
+TEST_F(P3AMetricLogStoreTest, SerializeUnsentLogs) {
+  LoadLogStore();
+  UpdateSomeValues(5);
+
+  auto logs = log_store->SerializeUnsentLogs();
+  ASSERT_EQ(logs.size(), 5U);
+  const std::string histogram_name = logs.begin()->first;
+  EXPECT_EQ(logs.begin()->second.rfind(histogram_name + "_2_0_", 0), 0U);
+
+  log_store->MarkLogAsSent(histogram_name);
+  EXPECT_EQ(log_store->SerializeUnsentLogs().size(), 4U);
+  // Values removed while being sent are ignored.
+  log_store->RemoveValueIfExists(histogram_name);
+  log_store->MarkLogAsSent(histogram_name);
+
+  // Sent state is persisted.
+  SetUpLogStore();
+  LoadLogStore();
+  logs = log_store->SerializeUnsentLogs();
+  EXPECT_EQ(logs.size(), 4U);
+  EXPECT_FALSE(logs.contains(histogram_name));
+}
+
 TEST_F(P3AMetricLogStoreTest, ShouldNotLoadUnknownMetric) {
+  LoadLogStore();
   log_store->UpdateValue("Brave.UnknownMetric", 3);
 
   SetUpLogStore();
-  log_store->LoadPersistedUnsentLogs();
+  LoadLogStore();
 
   ASSERT_FALSE(log_store->has_unsent_logs());
 }
 
+TEST_F(P3AMetricLogStoreTest, SentStateAfterReload) {
+  LoadLogStore();
+  UpdateSomeValues(5);
+  ConsumeMessages(5);
+
+  SetUpLogStore();
+  LoadLogStore();
+  EXPECT_FALSE(log_store->has_unsent_logs());
+
+  // Values recorded while loading keep the loaded sent state.
+  SetUpLogStore();
+  log_store->LoadPersistedUnsentLogs();
+  UpdateSomeValues(5);
+  EXPECT_TRUE(log_store->has_unsent_logs());
+  task_environment_.RunUntilIdle();
+  EXPECT_FALSE(log_store->has_unsent_logs());
+
+  // Unless the upload stamps were reset meanwhile.
+  SetUpLogStore();
+  log_store->LoadPersistedUnsentLogs();
+  log_store->ResetUploadStamps();
+  task_environment_.RunUntilIdle();
+  ConsumeMessages(5);
+}
+
+TEST_F(P3AMetricLogStoreTest, MigrateFromPrefs) {
+  const std::string histogram_name(*p3a::kCollectedTypicalHistograms.begin());
+  {
+    base::Value::Dict log_dict;
+    log_dict.Set("value", "3");
+    log_dict.Set("sent", false);
+    base::Value::Dict logs;
+    logs.Set(histogram_name, std::move(log_dict));
+    logs.Set("Brave.UnknownMetric", base::Value::Dict());
+    local_state.SetDict("p3a.logs", std::move(logs));
+  }
+
+  // Migrated values are available right away.
+  log_store->LoadPersistedUnsentLogs();
+  auto logs = log_store->SerializeUnsentLogs();
+  ASSERT_EQ(logs.size(), 1U);
+  EXPECT_EQ(logs.begin()->first, histogram_name);
+
+  // The prefs are only cleared once the values are stored.
+  EXPECT_FALSE(local_state.GetDict("p3a.logs").empty());
+  task_environment_.RunUntilIdle();
+  EXPECT_TRUE(local_state.GetDict("p3a.logs").empty());
+
+  // And persisted in the database.
+  SetUpLogStore();
+  LoadLogStore();
+  logs = log_store->SerializeUnsentLogs();
+  ASSERT_EQ(logs.size(), 1U);
+  EXPECT_EQ(logs.begin()->second.rfind(histogram_name + "_3_0_", 0), 0U);
+}
+
+TEST_F(P3AMetricLogStoreTest, ValuesExpire) {
+  LoadLogStore();
+  UpdateSomeValues(2);
+  task_environment_.FastForwardBy(base::Days(100));
+  log_store->UpdateValue(std::string(*p3a::kCollectedTypicalHistograms.begin()),
+                         4);
+  task_environment_.FastForwardBy(base::Days(100));
+
+  // Only the value recorded again is kept.
+  SetUpLogStore();
+  LoadLogStore();
+  auto logs = log_store->SerializeUnsentLogs();
+  ASSERT_EQ(logs.size(), 1U);
+  EXPECT_EQ(logs.begin()->first, *p3a::kCollectedTypicalHistograms.begin());
+}
+
 }  // namespace p3a
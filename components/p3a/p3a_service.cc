@@ -77,10 +77,11 @@ inline void DCheckCurrentlyOnUIThread() {
 P3AService::P3AService(PrefService& local_state,
                        std::string channel,
                        std::string week_of_install,
-                       P3AConfig config)
+                       P3AConfig config,
+                       const base::FilePath& user_data_dir)
     : local_state_(local_state), config_(std::move(config)) {
   message_manager_ = std::make_unique<MessageManager>(
-      local_state, &config_, *this, channel, week_of_install);
+      local_state, &config_, *this, channel, week_of_install, user_data_dir);
 }
 
 P3AService::~P3AService() = default;
@@ -229,10 +230,8 @@ void P3AService::OnHistogramChanged(const char* histogram_name,
   // Shortcut for the special values, see |kSuspendedMetricValue|
   // description for details.
   if (IsSuspendedMetric(histogram_name, sample)) {
-    GetUIThreadTaskRunner()->PostTask(
-        FROM_HERE, base::BindOnce(&P3AService::OnHistogramChangedOnUI, this,
-                                  histogram_name, kSuspendedMetricValue,
-                                  kSuspendedMetricBucket));
+    QueueHistogramChange(histogram_name, kSuspendedMetricValue,
+                         kSuspendedMetricBucket);
     return;
   }
 
@@ -261,9 +260,36 @@ void P3AService::OnHistogramChanged(const char* histogram_name,
     bucket = DirectEncodingProtocol::Perturb(bucket_count, bucket);
   }
 
-  GetUIThreadTaskRunner()->PostTask(
-      FROM_HERE, base::BindOnce(&P3AService::OnHistogramChangedOnUI, this,
-                                histogram_name, sample, bucket));
+  QueueHistogramChange(histogram_name, sample, bucket);
+}
+
+void P3AService::QueueHistogramChange(const char* histogram_name,
+                                      base::HistogramBase::Sample sample,
+                                      size_t bucket) {
+  bool post_drain;
+  {
+    base::AutoLock lock(pending_changes_lock_);
+    // A drain task is pending whenever there are pending changes.
+    post_drain = pending_changes_.empty();
+    pending_changes_[histogram_name] = {sample, bucket};
+  }
+  if (post_drain) {
+    GetUIThreadTaskRunner()->PostTask(
+        FROM_HERE,
+        base::BindOnce(&P3AService::DrainHistogramChangesOnUI, this));
+  }
+}
+
+void P3AService::DrainHistogramChangesOnUI() {
+  base::flat_map<const char*, std::pair<base::HistogramBase::Sample, size_t>>
+      changes;
+  {
+    base::AutoLock lock(pending_changes_lock_);
+    changes.swap(pending_changes_);
+  }
+  for (const auto& [histogram_name, value] : changes) {
+    OnHistogramChangedOnUI(histogram_name, value.first, value.second);
+  }
 }
 
 void P3AService::OnHistogramChangedOnUI(const char* histogram_name,
@@ -8,15 +8,19 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "base/callback_list.h"
 #include "base/containers/flat_map.h"
+#include "base/files/file_path.h"
 #include "base/memory/raw_ref.h"
 #include "base/memory/ref_counted.h"
 #include "base/metrics/histogram_base.h"
 #include "base/metrics/statistics_recorder.h"
 #include "base/strings/string_piece_forward.h"
+#include "base/synchronization/lock.h"
+#include "base/thread_annotations.h"
 #include "brave/components/p3a/message_manager.h"
 #include "brave/components/p3a/metric_log_type.h"
 #include "brave/components/p3a/p3a_config.h"
@@ -42,10 +46,13 @@ struct P3AConfig;
 class P3AService : public base::RefCountedThreadSafe<P3AService>,
                    public MessageManager::Delegate {
  public:
+  // Metric values are persisted in |user_data_dir|, or only kept in memory
+  // if it is empty.
   P3AService(PrefService& local_state,
              std::string channel,
              std::string week_of_install,
-             P3AConfig config);
+             P3AConfig config,
+             const base::FilePath& user_data_dir);
 
   P3AService(const P3AService&) = delete;
   P3AService& operator=(const P3AService&) = delete;
@@ -80,7 +87,8 @@ class P3AService : public base::RefCountedThreadSafe<P3AService>,
   void Init(scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory);
 
   // Invoked by callbacks registered by our service. Since these callbacks
-  // can fire on any thread, this method reposts everything to UI thread.
+  // can fire on any thread, this method records the latest bucket of the
+  // histogram and lets the UI thread pick up all pending buckets at once.
   void OnHistogramChanged(const char* histogram_name,
                           uint64_t name_hash,
                           base::HistogramBase::Sample sample);
@@ -102,6 +110,13 @@ class P3AService : public base::RefCountedThreadSafe<P3AService>,
 
   void LoadDynamicMetrics();
 
+  // Stores the latest bucket of |histogram_name| and posts a drain task to
+  // the UI thread unless one is already pending. Called on any thread.
+  void QueueHistogramChange(const char* histogram_name,
+                            base::HistogramBase::Sample sample,
+                            size_t bucket);
+  void DrainHistogramChangesOnUI();
+
   void OnHistogramChangedOnUI(const char* histogram_name,
                               base::HistogramBase::Sample sample,
                               size_t bucket);
@@ -128,6 +143,14 @@ class P3AService : public base::RefCountedThreadSafe<P3AService>,
   // the service and its initialization.
   base::flat_map<base::StringPiece, size_t> histogram_values_;
 
+  // Latest <sample, bucket> of every histogram changed since the last drain,
+  // so UI thread work depends on the number of changed metrics rather than
+  // on the number of recorded samples. Histogram names are never freed.
+  base::Lock pending_changes_lock_;
+  base::flat_map<const char*,
+                 std::pair<base::HistogramBase::Sample, size_t>>
+      pending_changes_ GUARDED_BY(pending_changes_lock_);
+
   std::vector<
       std::unique_ptr<base::StatisticsRecorder::ScopedHistogramSampleObserver>>
       histogram_sample_callbacks_;
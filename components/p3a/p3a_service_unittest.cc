@@ -80,7 +80,8 @@ class P3AServiceTest : public testing::Test {
 
   void SetUpP3AService() {
     p3a_service_ = scoped_refptr(new P3AService(
-        local_state_, "release", "2049-01-01", P3AConfig(config_)));
+        local_state_, "release", "2049-01-01", P3AConfig(config_),
+        base::FilePath()));
 
     p3a_service_->DisableStarAttestationForTesting();
     p3a_service_->Init(shared_url_loader_factory_);
@@ -388,4 +389,28 @@ TEST_F(P3AServiceTest, EphemeralMetricOnlySentOnce) {
   EXPECT_EQ(p3a_creative_sent_metrics_.size(), 0U);
 }
 
+TEST_F(P3AServiceTest, CoalescesHistogramChanges) {
+  SetUpP3AService();
+
+  const std::string test_histogram = GetTestHistogramNames(1, 0)[0];
+  const size_t pending_task_count =
+      task_environment_.GetPendingMainThreadTaskCount();
+
+  for (int i = 0; i < 100; i++) {
+    base::UmaHistogramExactLinear(test_histogram, i % 4, 8);
+    p3a_service_->OnHistogramChanged(test_histogram.c_str(), 0, i % 4);
+  }
+
+  // Only one drain task is posted for all of the changes.
+  EXPECT_EQ(task_environment_.GetPendingMainThreadTaskCount(),
+            pending_task_count + 1);
+  task_environment_.RunUntilIdle();
+  EXPECT_EQ(task_environment_.GetPendingMainThreadTaskCount(),
+            pending_task_count);
+
+  task_environment_.FastForwardBy(base::Seconds(kUploadIntervalSeconds * 50));
+  EXPECT_EQ(p3a_json_sent_metrics_.size(), 1U);
+  EXPECT_TRUE(p3a_json_sent_metrics_.count(test_histogram));
+}
+
 }  // namespace p3a
@@ -26,7 +26,8 @@ namespace p3a {
 
 namespace {
 
-constexpr std::size_t kMaxRandomnessResponseSize = 131072;
+// Large enough for a batch with the points and proofs of every metric.
+constexpr std::size_t kMaxRandomnessResponseSize = 1048576;
 
 std::unique_ptr<rust::Vec<constellation::VecU8>> DecodeBase64List(
     const base::Value::List& list) {
@@ -56,21 +57,17 @@ std::unique_ptr<rust::Vec<constellation::VecU8>> DecodeBase64List(
 
 StarRandomnessPoints::StarRandomnessPoints(
     scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory,
-    RandomnessDataCallback data_callback,
     const P3AConfig* config)
-    : url_loader_factory_(url_loader_factory),
-      data_callback_(data_callback),
-      config_(config) {}
+    : url_loader_factory_(url_loader_factory), config_(config) {}
 
 StarRandomnessPoints::~StarRandomnessPoints() = default;
 
 void StarRandomnessPoints::SendRandomnessRequest(
-    std::string metric_name,
     StarRandomnessMeta* randomness_meta,
     uint8_t epoch,
-    rust::Box<constellation::RandomnessRequestStateWrapper>
-        randomness_request_state,
-    const rust::Vec<constellation::VecU8>& rand_req_points) {
+    const rust::Vec<constellation::VecU8>& rand_req_points,
+    RandomnessDataCallback callback) {
+  DCHECK(!url_loader_);
   auto resource_request = std::make_unique<network::ResourceRequest>();
   resource_request->url =
       GURL(base::StrCat({config_->star_randomness_host, "/randomness"}));
@@ -91,8 +88,8 @@ void StarRandomnessPoints::SendRandomnessRequest(
   if (!base::JSONWriter::Write(payload_dict, &payload_str)) {
     LOG(ERROR) << "StarRandomnessPoints: failed to serialize "
                   "randomness req payload";
-    data_callback_.Run(metric_name, epoch, std::move(randomness_request_state),
-                       nullptr, nullptr);
+    url_loader_ = nullptr;
+    std::move(callback).Run(nullptr, nullptr);
     return;
   }
 
@@ -103,17 +100,14 @@ void StarRandomnessPoints::SendRandomnessRequest(
   url_loader_->DownloadToString(
       url_loader_factory_.get(),
       base::BindOnce(&StarRandomnessPoints::HandleRandomnessResponse,
-                     base::Unretained(this), metric_name, randomness_meta,
-                     epoch, std::move(randomness_request_state)),
+                     base::Unretained(this), randomness_meta,
+                     std::move(callback)),
       kMaxRandomnessResponseSize);
 }
 
 void StarRandomnessPoints::HandleRandomnessResponse(
-    std::string metric_name,
     StarRandomnessMeta* randomness_meta,
-    uint8_t epoch,
-    rust::Box<constellation::RandomnessRequestStateWrapper>
-        randomness_request_state,
+    RandomnessDataCallback callback,
     std::unique_ptr<std::string> response_body) {
   if (!response_body || response_body->empty()) {
     std::string error_str = net::ErrorToShortString(url_loader_->NetError());
@@ -121,14 +115,12 @@ void StarRandomnessPoints::HandleRandomnessResponse(
     LOG(ERROR) << "StarRandomnessPoints: no response body for "
                   "randomness request, "
                << "net error: " << error_str;
-    data_callback_.Run(metric_name, epoch, std::move(randomness_request_state),
-                       nullptr, nullptr);
+    std::move(callback).Run(nullptr, nullptr);
     return;
   }
   if (!randomness_meta->VerifyRandomnessCert(url_loader_.get())) {
-    data_callback_.Run(metric_name, epoch, std::move(randomness_request_state),
-                       nullptr, nullptr);
     url_loader_ = nullptr;
+    std::move(callback).Run(nullptr, nullptr);
     return;
   }
   url_loader_ = nullptr;
@@ -138,8 +130,7 @@ void StarRandomnessPoints::HandleRandomnessResponse(
     LOG(ERROR) << "StarRandomnessPoints: failed to parse randomness "
                   "response json: "
                << parsed_body.error().message;
-    data_callback_.Run(metric_name, epoch, std::move(randomness_request_state),
-                       nullptr, nullptr);
+    std::move(callback).Run(nullptr, nullptr);
     return;
   }
   const base::Value::Dict& root = parsed_body->GetDict();
@@ -148,30 +139,26 @@ void StarRandomnessPoints::HandleRandomnessResponse(
   if (points == nullptr) {
     LOG(ERROR) << "StarRandomnessPoints: failed to find points list in "
                   "randomness response";
-    data_callback_.Run(metric_name, epoch, std::move(randomness_request_state),
-                       nullptr, nullptr);
+    std::move(callback).Run(nullptr, nullptr);
     return;
   }
   std::unique_ptr<rust::Vec<constellation::VecU8>> points_vec =
       DecodeBase64List(*points);
   if (points_vec == nullptr) {
-    data_callback_.Run(metric_name, epoch, std::move(randomness_request_state),
-                       nullptr, nullptr);
+    std::move(callback).Run(nullptr, nullptr);
     return;
   }
   std::unique_ptr<rust::Vec<constellation::VecU8>> proofs_vec;
   if (proofs != nullptr) {
     proofs_vec = DecodeBase64List(*proofs);
     if (!proofs_vec) {
-      data_callback_.Run(metric_name, epoch,
-                         std::move(randomness_request_state), nullptr, nullptr);
+      std::move(callback).Run(nullptr, nullptr);
       return;
     }
   } else {
     proofs_vec = std::make_unique<rust::Vec<constellation::VecU8>>();
   }
-  data_callback_.Run(metric_name, epoch, std::move(randomness_request_state),
-                     std::move(points_vec), std::move(proofs_vec));
+  std::move(callback).Run(std::move(points_vec), std::move(proofs_vec));
 }
 
 }  // namespace p3a
@@ -28,44 +28,35 @@ struct P3AConfig;
 // server in order to receive randomness point data for STAR measurements.
 class StarRandomnessPoints {
  public:
-  using RandomnessDataCallback = base::RepeatingCallback<void(
-      std::string metric_name,
-      uint8_t epoch,
-      ::rust::Box<constellation::RandomnessRequestStateWrapper>
-          randomness_request_state,
+  // Both lists are null if the request failed.
+  using RandomnessDataCallback = base::OnceCallback<void(
       std::unique_ptr<rust::Vec<constellation::VecU8>> resp_points,
       std::unique_ptr<rust::Vec<constellation::VecU8>> resp_proofs)>;
 
   StarRandomnessPoints(
       scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory,
-      RandomnessDataCallback data_callback,
       const P3AConfig* config);
   ~StarRandomnessPoints();
   StarRandomnessPoints(const StarRandomnessPoints&) = delete;
   StarRandomnessPoints& operator=(const StarRandomnessPoints&) = delete;
 
+  // |rand_req_points| may contain the points of several measurements, the
+  // response points and proofs are in the same order as the request points.
+  // Only one request may be in flight at a time.
   void SendRandomnessRequest(
-      std::string metric_name,
       StarRandomnessMeta* randomness_meta,
       uint8_t epoch,
-      ::rust::Box<constellation::RandomnessRequestStateWrapper>
-          randomness_request_state,
-      const rust::Vec<constellation::VecU8>& rand_req_points);
+      const rust::Vec<constellation::VecU8>& rand_req_points,
+      RandomnessDataCallback callback);
 
  private:
-  void HandleRandomnessResponse(
-      std::string metric_name,
-      StarRandomnessMeta* randomness_meta,
-      uint8_t epoch,
-      ::rust::Box<constellation::RandomnessRequestStateWrapper>
-          randomness_request_state,
-      std::unique_ptr<std::string> response_body);
+  void HandleRandomnessResponse(StarRandomnessMeta* randomness_meta,
+                                RandomnessDataCallback callback,
+                                std::unique_ptr<std::string> response_body);
 
   scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory_;
   std::unique_ptr<network::SimpleURLLoader> url_loader_;
 
-  RandomnessDataCallback data_callback_;
-
   const raw_ptr<const P3AConfig> config_;
 };
 
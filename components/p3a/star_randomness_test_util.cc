@@ -35,7 +35,9 @@ std::string HandleRandomnessRequest(const network::ResourceRequest& request,
   rust::Vec<constellation::VecU8> req_points_rust;
   const base::Value::List* points_list = req_parsed_val.FindList("points");
 
-  EXPECT_EQ(points_list->size(), 8U);
+  // Points of several measurements may be batched, each one has 8 layers.
+  EXPECT_FALSE(points_list->empty());
+  EXPECT_EQ(points_list->size() % 8U, 0U);
 
   std::transform(
       points_list->begin(), points_list->end(),
@@ -50,7 +52,7 @@ std::string HandleRandomnessRequest(const network::ResourceRequest& request,
   auto rand_result =
       constellation::generate_local_randomness(req_points_rust, expected_epoch);
 
-  EXPECT_EQ(rand_result.points.size(), 8U);
+  EXPECT_EQ(rand_result.points.size(), points_list->size());
 
   base::Value::List resp_points_list;
   for (const constellation::VecU8& resp_point_rust : rand_result.points) {
@@ -7,26 +7,81 @@
 
 #include <utility>
 
+#include "base/check.h"
+#include "base/functional/bind.h"
+#include "base/task/thread_pool.h"
 #include "base/time/time.h"
 #include "brave/components/brave_ads/common/interfaces/brave_ads.mojom.h"
 #include "brave/components/brave_ads/core/ads_client_notifier_observer.h"
+#include "brave/components/brave_ads/core/database.h"
 #include "brave/components/brave_ads/core/notification_ad_info.h"
 #include "brave/components/brave_ads/core/notification_ad_value_util.h"
 #include "brave/components/brave_federated/public/interfaces/brave_federated.mojom.h"  // IWYU pragma: keep
+#include "brave/components/services/bat_ads/bat_ads_database_vfs_delegate.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
 
 namespace bat_ads {
 
+namespace {
+
+brave_ads::mojom::DBCommandResponseInfoPtr RunDBTransactionOnDatabaseTaskRunner(
+    brave_ads::mojom::DBTransactionInfoPtr transaction,
+    brave_ads::Database* database) {
+  CHECK(transaction);
+
+  brave_ads::mojom::DBCommandResponseInfoPtr command_response =
+      brave_ads::mojom::DBCommandResponseInfo::New();
+
+  if (!database) {
+    command_response->status =
+        brave_ads::mojom::DBCommandResponseInfo::StatusType::RESPONSE_ERROR;
+  } else {
+    database->RunTransaction(std::move(transaction), command_response.get());
+  }
+
+  return command_response;
+}
+
+}  // namespace
+
 BatAdsClientMojoBridge::BatAdsClientMojoBridge(
     mojo::PendingAssociatedRemote<mojom::BatAdsClient> client_info,
     mojo::PendingReceiver<mojom::BatAdsClientNotifier> client_notifier)
-    : notifier_impl_(std::move(client_notifier)) {
+    : notifier_impl_(std::move(client_notifier)),
+      database_task_runner_(base::ThreadPool::CreateSequencedTaskRunner(
+          {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
+           base::TaskShutdownBehavior::BLOCK_SHUTDOWN})),
+      database_(nullptr, base::OnTaskRunnerDeleter(database_task_runner_)) {
   bat_ads_client_.Bind(std::move(client_info));
   bat_ads_client_.reset_on_disconnect();
 }
 
 BatAdsClientMojoBridge::~BatAdsClientMojoBridge() = default;
 
+void BatAdsClientMojoBridge::InitializeDatabase(
+    mojom::DatabaseFilesPtr database_files) {
+  CHECK(database_files);
+  CHECK(!database_);
+
+  BatAdsDatabaseVfsDelegate::SetDatabaseFiles(std::move(database_files));
+
+  database_ = std::unique_ptr<brave_ads::Database, base::OnTaskRunnerDeleter>(
+      new brave_ads::Database(BatAdsDatabaseVfsDelegate::GetDatabasePath(),
+                              BatAdsDatabaseVfsDelegate::GetVfsName()),
+      base::OnTaskRunnerDeleter(database_task_runner_));
+}
+
+void BatAdsClientMojoBridge::ShutdownDatabase(base::OnceClosure callback) {
+  // Deleting the database is posted to the database task runner, so the file
+  // handles are closed after the database connection.
+  database_.reset();
+
+  database_task_runner_->PostTaskAndReply(
+      FROM_HERE,
+      base::BindOnce(&BatAdsDatabaseVfsDelegate::CloseDatabaseFiles),
+      std::move(callback));
+}
+
 void BatAdsClientMojoBridge::AddObserver(
     brave_ads::AdsClientNotifierObserver* observer) {
   notifier_impl_.AddObserver(observer);
@@ -248,13 +303,13 @@ std::string BatAdsClientMojoBridge::LoadDataResource(const std::string& name) {
 void BatAdsClientMojoBridge::RunDBTransaction(
     brave_ads::mojom::DBTransactionInfoPtr transaction,
     brave_ads::RunDBTransactionCallback callback) {
-  if (!bat_ads_client_.is_bound()) {
-    std::move(callback).Run(brave_ads::mojom::DBCommandResponseInfoPtr());
-    return;
-  }
-
-  bat_ads_client_->RunDBTransaction(std::move(transaction),
-                                    std::move(callback));
+  // The database is owned by this object and deleted on the database task
+  // runner after any pending transactions, so it outlives the posted task.
+  database_task_runner_->PostTaskAndReplyWithResult(
+      FROM_HERE,
+      base::BindOnce(&RunDBTransactionOnDatabaseTaskRunner,
+                     std::move(transaction), database_.get()),
+      std::move(callback));
 }
 
 void BatAdsClientMojoBridge::GetScheduledCaptcha(
@@ -7,9 +7,13 @@
 #define BRAVE_COMPONENTS_SERVICES_BAT_ADS_BAT_ADS_CLIENT_MOJO_BRIDGE_H_
 
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
+#include "base/functional/callback.h"
+#include "base/memory/scoped_refptr.h"
+#include "base/task/sequenced_task_runner.h"
 #include "base/values.h"
 #include "brave/components/brave_ads/common/interfaces/brave_ads.mojom-forward.h"
 #include "brave/components/brave_ads/core/ads_client.h"
@@ -25,6 +29,7 @@ class Time;
 
 namespace brave_ads {
 class AdsClientNotifierObserver;
+class Database;
 struct NotificationAdInfo;
 }  // namespace brave_ads
 
@@ -45,6 +50,15 @@ class BatAdsClientMojoBridge : public brave_ads::AdsClient {
 
   ~BatAdsClientMojoBridge() override;
 
+  // Opens the ads database in-process from the file handles passed in by the
+  // browser process so that transactions do not need to cross the process
+  // boundary.
+  void InitializeDatabase(mojom::DatabaseFilesPtr database_files);
+
+  // Closes the ads database and its file handles after any pending
+  // transactions, then runs |callback|.
+  void ShutdownDatabase(base::OnceClosure callback);
+
   // AdsClient:
   void AddObserver(brave_ads::AdsClientNotifierObserver* observer) override;
   void RemoveObserver(brave_ads::AdsClientNotifierObserver* observer) override;
@@ -137,6 +151,9 @@ class BatAdsClientMojoBridge : public brave_ads::AdsClient {
  private:
   mojo::AssociatedRemote<mojom::BatAdsClient> bat_ads_client_;
   BatAdsClientNotifierImpl notifier_impl_;
+
+  scoped_refptr<base::SequencedTaskRunner> database_task_runner_;
+  std::unique_ptr<brave_ads::Database, base::OnTaskRunnerDeleter> database_;
 };
 
 }  // namespace bat_ads
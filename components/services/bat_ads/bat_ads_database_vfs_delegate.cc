@@ -0,0 +1,161 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/services/bat_ads/bat_ads_database_vfs_delegate.h"
+
+#include <memory>
+#include <utility>
+
+#include "base/check.h"
+#include "brave/components/services/bat_ads/public/interfaces/bat_ads.mojom.h"
+#include "third_party/sqlite/sqlite3.h"
+
+namespace bat_ads {
+
+namespace {
+
+constexpr char kVfsName[] = "bat_ads_vfs";
+
+constexpr base::FilePath::CharType kDatabasePath[] =
+    FILE_PATH_LITERAL("/bat_ads/database.sqlite");
+constexpr base::FilePath::CharType kDatabaseJournalPath[] =
+    FILE_PATH_LITERAL("/bat_ads/database.sqlite-journal");
+
+BatAdsDatabaseVfsDelegate* GetOrRegisterDelegate() {
+  static BatAdsDatabaseVfsDelegate* const delegate = [] {
+    auto vfs_delegate = std::make_unique<BatAdsDatabaseVfsDelegate>();
+    BatAdsDatabaseVfsDelegate* const vfs_delegate_ptr = vfs_delegate.get();
+    // The VFS takes ownership of the delegate and lives for the lifetime of
+    // the process.
+    sql::SandboxedVfs::Register(kVfsName, std::move(vfs_delegate),
+                                /*make_default=*/false);
+    return vfs_delegate_ptr;
+  }();
+
+  return delegate;
+}
+
+}  // namespace
+
+BatAdsDatabaseVfsDelegate::BatAdsDatabaseVfsDelegate() = default;
+
+BatAdsDatabaseVfsDelegate::~BatAdsDatabaseVfsDelegate() = default;
+
+// static
+void BatAdsDatabaseVfsDelegate::SetDatabaseFiles(
+    mojom::DatabaseFilesPtr database_files) {
+  CHECK(database_files);
+
+  BatAdsDatabaseVfsDelegate* const delegate = GetOrRegisterDelegate();
+  CHECK(delegate);
+
+  delegate->SetFiles(std::move(database_files->database),
+                     std::move(database_files->journal));
+}
+
+// static
+void BatAdsDatabaseVfsDelegate::CloseDatabaseFiles() {
+  BatAdsDatabaseVfsDelegate* const delegate = GetOrRegisterDelegate();
+  CHECK(delegate);
+
+  delegate->SetFiles(base::File(), base::File());
+}
+
+// static
+const char* BatAdsDatabaseVfsDelegate::GetVfsName() {
+  return kVfsName;
+}
+
+// static
+base::FilePath BatAdsDatabaseVfsDelegate::GetDatabasePath() {
+  return base::FilePath(kDatabasePath);
+}
+
+void BatAdsDatabaseVfsDelegate::SetFiles(base::File database,
+                                         base::File journal) {
+  base::AutoLock auto_lock(lock_);
+  database_file_ = {std::move(database)};
+  journal_file_ = {std::move(journal)};
+}
+
+base::File BatAdsDatabaseVfsDelegate::OpenFile(
+    const base::FilePath& file_path,
+    int sqlite_requested_flags) {
+  base::AutoLock auto_lock(lock_);
+
+  VirtualFile* const virtual_file = GetFile(file_path);
+  if (!virtual_file || !virtual_file->file.IsValid()) {
+    return base::File();
+  }
+
+  if (virtual_file->is_deleted) {
+    if (!(sqlite_requested_flags & SQLITE_OPEN_CREATE)) {
+      return base::File();
+    }
+    virtual_file->is_deleted = false;
+  }
+
+  return virtual_file->file.Duplicate();
+}
+
+int BatAdsDatabaseVfsDelegate::DeleteFile(const base::FilePath& file_path,
+                                          bool /*sync_dir*/) {
+  base::AutoLock auto_lock(lock_);
+
+  VirtualFile* const virtual_file = GetFile(file_path);
+  if (!virtual_file || !virtual_file->file.IsValid() ||
+      virtual_file->is_deleted) {
+    return SQLITE_IOERR_DELETE_NOENT;
+  }
+
+  if (!virtual_file->file.SetLength(0)) {
+    return SQLITE_IOERR_DELETE;
+  }
+  virtual_file->is_deleted = true;
+
+  return SQLITE_OK;
+}
+
+absl::optional<sql::SandboxedVfs::PathAccessInfo>
+BatAdsDatabaseVfsDelegate::GetPathAccess(const base::FilePath& file_path) {
+  base::AutoLock auto_lock(lock_);
+
+  VirtualFile* const virtual_file = GetFile(file_path);
+  if (!virtual_file || !virtual_file->file.IsValid() ||
+      virtual_file->is_deleted) {
+    return absl::nullopt;
+  }
+
+  // An empty journal means there is no hot journal to roll back.
+  if (virtual_file == &journal_file_ &&
+      virtual_file->file.GetLength() <= 0) {
+    return absl::nullopt;
+  }
+
+  return sql::SandboxedVfs::PathAccessInfo{/*can_read=*/true,
+                                           /*can_write=*/true};
+}
+
+bool BatAdsDatabaseVfsDelegate::SetFileLength(
+    const base::FilePath& /*file_path*/,
+    base::File& file,
+    size_t size) {
+  return file.SetLength(static_cast<int64_t>(size));
+}
+
+BatAdsDatabaseVfsDelegate::VirtualFile* BatAdsDatabaseVfsDelegate::GetFile(
+    const base::FilePath& file_path) {
+  if (file_path == base::FilePath(kDatabasePath)) {
+    return &database_file_;
+  }
+
+  if (file_path == base::FilePath(kDatabaseJournalPath)) {
+    return &journal_file_;
+  }
+
+  return nullptr;
+}
+
+}  // namespace bat_ads
@@ -0,0 +1,87 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_SERVICES_BAT_ADS_BAT_ADS_DATABASE_VFS_DELEGATE_H_
+#define BRAVE_COMPONENTS_SERVICES_BAT_ADS_BAT_ADS_DATABASE_VFS_DELEGATE_H_
+
+#include <cstddef>
+
+#include "base/files/file.h"
+#include "base/files/file_path.h"
+#include "base/synchronization/lock.h"
+#include "base/thread_annotations.h"
+#include "brave/components/services/bat_ads/public/interfaces/bat_ads.mojom-forward.h"
+#include "sql/sandboxed_vfs.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
+
+namespace bat_ads {
+
+// The bat-ads service runs in a sandboxed utility process which cannot open
+// files, so SQLite file access for the ads database is served from file
+// handles opened by the browser process.
+class BatAdsDatabaseVfsDelegate final : public sql::SandboxedVfs::Delegate {
+ public:
+  BatAdsDatabaseVfsDelegate();
+
+  BatAdsDatabaseVfsDelegate(const BatAdsDatabaseVfsDelegate&) = delete;
+  BatAdsDatabaseVfsDelegate& operator=(const BatAdsDatabaseVfsDelegate&) =
+      delete;
+
+  BatAdsDatabaseVfsDelegate(BatAdsDatabaseVfsDelegate&&) noexcept = delete;
+  BatAdsDatabaseVfsDelegate& operator=(BatAdsDatabaseVfsDelegate&&) noexcept =
+      delete;
+
+  ~BatAdsDatabaseVfsDelegate() override;
+
+  // Registers the delegate as the SQLite VFS named |GetVfsName()|, if not
+  // already registered, and serves |database_files| for |GetDatabasePath()|.
+  // The VFS is not the process default, so it does not affect other databases
+  // when the service runs in the browser process.
+  static void SetDatabaseFiles(mojom::DatabaseFilesPtr database_files);
+
+  // Closes the file handles set by |SetDatabaseFiles| so that the browser
+  // process can delete the files. The database must be closed first.
+  static void CloseDatabaseFiles();
+
+  // Name of the VFS which the ads database must be opened with.
+  static const char* GetVfsName();
+
+  // Virtual path of the ads database. The browser process owns the real path.
+  static base::FilePath GetDatabasePath();
+
+  // Serves |database| and |journal| for the database and journal paths.
+  void SetFiles(base::File database, base::File journal);
+
+  // sql::SandboxedVfs::Delegate:
+  base::File OpenFile(const base::FilePath& file_path,
+                      int sqlite_requested_flags) override;
+  int DeleteFile(const base::FilePath& file_path, bool sync_dir) override;
+  absl::optional<sql::SandboxedVfs::PathAccessInfo> GetPathAccess(
+      const base::FilePath& file_path) override;
+  bool SetFileLength(const base::FilePath& file_path,
+                     base::File& file,
+                     size_t size) override;
+
+ private:
+  struct VirtualFile {
+    base::File file;
+    // The handles are shared with the browser process and cannot be unlinked
+    // from here, so deleted files are truncated and hidden until recreated.
+    bool is_deleted = false;
+  };
+
+  VirtualFile* GetFile(const base::FilePath& file_path)
+      EXCLUSIVE_LOCKS_REQUIRED(lock_);
+
+  // SQLite may call into the VFS from any sequence which owns a database
+  // connection.
+  base::Lock lock_;
+  VirtualFile database_file_ GUARDED_BY(lock_);
+  VirtualFile journal_file_ GUARDED_BY(lock_);
+};
+
+}  // namespace bat_ads
+
+#endif  // BRAVE_COMPONENTS_SERVICES_BAT_ADS_BAT_ADS_DATABASE_VFS_DELEGATE_H_
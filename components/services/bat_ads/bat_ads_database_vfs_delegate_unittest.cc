@@ -0,0 +1,148 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/services/bat_ads/bat_ads_database_vfs_delegate.h"
+
+#include <utility>
+
+#include "base/files/file.h"
+#include "base/files/file_path.h"
+#include "base/files/scoped_temp_dir.h"
+#include "brave/components/services/bat_ads/public/interfaces/bat_ads.mojom.h"
+#include "sql/database.h"
+#include "sql/statement.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/sqlite/sqlite3.h"
+
+// npm run test -- brave_unit_tests --filter=BatAdsDatabaseVfsDelegateTest*
+
+namespace bat_ads {
+
+namespace {
+
+constexpr base::FilePath::CharType kJournalPath[] =
+    FILE_PATH_LITERAL("/bat_ads/database.sqlite-journal");
+
+constexpr int kOpenFlags = SQLITE_OPEN_READWRITE | SQLITE_OPEN_MAIN_DB;
+
+}  // namespace
+
+class BatAdsDatabaseVfsDelegateTest : public testing::Test {
+ protected:
+  void SetUp() override { ASSERT_TRUE(temp_dir_.CreateUniqueTempDir()); }
+
+  base::File OpenTempFile(const base::FilePath::CharType* name) const {
+    return base::File(temp_dir_.GetPath().Append(name),
+                      base::File::FLAG_OPEN_ALWAYS | base::File::FLAG_READ |
+                          base::File::FLAG_WRITE);
+  }
+
+  mojom::DatabaseFilesPtr OpenDatabaseFiles() const {
+    return mojom::DatabaseFiles::New(
+        OpenTempFile(FILE_PATH_LITERAL("database.sqlite")),
+        OpenTempFile(FILE_PATH_LITERAL("database.sqlite-journal")));
+  }
+
+  base::ScopedTempDir temp_dir_;
+};
+
+TEST_F(BatAdsDatabaseVfsDelegateTest, OpenFile) {
+  BatAdsDatabaseVfsDelegate delegate;
+  EXPECT_FALSE(delegate
+                   .OpenFile(BatAdsDatabaseVfsDelegate::GetDatabasePath(),
+                             kOpenFlags)
+                   .IsValid());
+
+  delegate.SetFiles(OpenTempFile(FILE_PATH_LITERAL("database.sqlite")),
+                    OpenTempFile(FILE_PATH_LITERAL("database.sqlite-journal")));
+  EXPECT_TRUE(delegate
+                  .OpenFile(BatAdsDatabaseVfsDelegate::GetDatabasePath(),
+                            kOpenFlags)
+                  .IsValid());
+  EXPECT_TRUE(
+      delegate.OpenFile(base::FilePath(kJournalPath), kOpenFlags).IsValid());
+  EXPECT_FALSE(delegate
+                   .OpenFile(base::FilePath(FILE_PATH_LITERAL("/other.db")),
+                             kOpenFlags | SQLITE_OPEN_CREATE)
+                   .IsValid());
+}
+
+TEST_F(BatAdsDatabaseVfsDelegateTest, DeleteFile) {
+  BatAdsDatabaseVfsDelegate delegate;
+  delegate.SetFiles(OpenTempFile(FILE_PATH_LITERAL("database.sqlite")),
+                    OpenTempFile(FILE_PATH_LITERAL("database.sqlite-journal")));
+  const base::FilePath database_path =
+      BatAdsDatabaseVfsDelegate::GetDatabasePath();
+
+  base::File file = delegate.OpenFile(database_path, kOpenFlags);
+  ASSERT_TRUE(file.IsValid());
+  ASSERT_EQ(4, file.Write(0, "data", 4));
+
+  EXPECT_EQ(SQLITE_OK, delegate.DeleteFile(database_path, /*sync_dir=*/false));
+  EXPECT_EQ(0, file.GetLength());
+  EXPECT_FALSE(delegate.GetPathAccess(database_path));
+  EXPECT_EQ(SQLITE_IOERR_DELETE_NOENT,
+            delegate.DeleteFile(database_path, /*sync_dir=*/false));
+
+  // Deleted files can only be reopened by recreating them.
+  EXPECT_FALSE(delegate.OpenFile(database_path, kOpenFlags).IsValid());
+  EXPECT_TRUE(
+      delegate.OpenFile(database_path, kOpenFlags | SQLITE_OPEN_CREATE)
+          .IsValid());
+  EXPECT_TRUE(delegate.GetPathAccess(database_path));
+
+  EXPECT_EQ(SQLITE_IOERR_DELETE_NOENT,
+            delegate.DeleteFile(base::FilePath(FILE_PATH_LITERAL("/other.db")),
+                                /*sync_dir=*/false));
+}
+
+TEST_F(BatAdsDatabaseVfsDelegateTest, GetPathAccess) {
+  BatAdsDatabaseVfsDelegate delegate;
+  const base::FilePath database_path =
+      BatAdsDatabaseVfsDelegate::GetDatabasePath();
+  EXPECT_FALSE(delegate.GetPathAccess(database_path));
+
+  delegate.SetFiles(OpenTempFile(FILE_PATH_LITERAL("database.sqlite")),
+                    OpenTempFile(FILE_PATH_LITERAL("database.sqlite-journal")));
+  const auto access = delegate.GetPathAccess(database_path);
+  ASSERT_TRUE(access);
+  EXPECT_TRUE(access->can_read);
+  EXPECT_TRUE(access->can_write);
+
+  // An empty journal is not a hot journal.
+  const base::FilePath journal_path(kJournalPath);
+  EXPECT_FALSE(delegate.GetPathAccess(journal_path));
+  base::File journal = delegate.OpenFile(journal_path, kOpenFlags);
+  ASSERT_EQ(4, journal.Write(0, "data", 4));
+  EXPECT_TRUE(delegate.GetPathAccess(journal_path));
+
+  EXPECT_FALSE(
+      delegate.GetPathAccess(base::FilePath(FILE_PATH_LITERAL("/other.db"))));
+}
+
+TEST_F(BatAdsDatabaseVfsDelegateTest, OpenDatabaseWithoutReplacingDefaultVfs) {
+  BatAdsDatabaseVfsDelegate::SetDatabaseFiles(OpenDatabaseFiles());
+
+  sql::DatabaseOptions options;
+  options.vfs_name_discouraged = BatAdsDatabaseVfsDelegate::GetVfsName();
+  sql::Database ads_database(options);
+  ASSERT_TRUE(
+      ads_database.Open(BatAdsDatabaseVfsDelegate::GetDatabasePath()));
+  ASSERT_TRUE(ads_database.Execute("CREATE TABLE ads (id INTEGER)"));
+  ASSERT_TRUE(ads_database.Execute("INSERT INTO ads VALUES (1)"));
+
+  // Other databases in the process still use the default VFS.
+  sql::Database other_database;
+  ASSERT_TRUE(other_database.Open(
+      temp_dir_.GetPath().Append(FILE_PATH_LITERAL("other.sqlite"))));
+  ASSERT_TRUE(other_database.Execute("CREATE TABLE other (id INTEGER)"));
+
+  sql::Statement statement(
+      ads_database.GetUniqueStatement("SELECT COUNT(*) FROM ads"));
+  ASSERT_TRUE(statement.Step());
+  EXPECT_EQ(1, statement.ColumnInt(0));
+}
+
+}  // namespace bat_ads
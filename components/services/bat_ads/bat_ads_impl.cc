@@ -8,6 +8,7 @@
 #include <utility>
 
 #include "base/check.h"
+#include "base/functional/bind.h"
 #include "brave/components/brave_ads/common/interfaces/brave_ads.mojom.h"  // IWYU pragma: keep
 #include "brave/components/brave_ads/core/ad_content_info.h"
 #include "brave/components/brave_ads/core/ad_content_value_util.h"
@@ -48,6 +49,10 @@ class BatAdsImpl::AdsInstance final {
 
   brave_ads::Ads* GetAds() { return ads_.get(); }
 
+  BatAdsClientMojoBridge* GetAdsClient() {
+    return bat_ads_client_mojo_proxy_.get();
+  }
+
  private:
   std::unique_ptr<BatAdsClientMojoBridge> bat_ads_client_mojo_proxy_;
   std::unique_ptr<brave_ads::Ads> ads_;
@@ -77,12 +82,17 @@ void BatAdsImpl::SetFlags(brave_ads::mojom::FlagsPtr flags) {
 }
 
 void BatAdsImpl::Initialize(brave_ads::mojom::WalletInfoPtr wallet,
+                            mojom::DatabaseFilesPtr database_files,
                             InitializeCallback callback) {
+  GetAdsClient()->InitializeDatabase(std::move(database_files));
+
   GetAds()->Initialize(std::move(wallet), std::move(callback));
 }
 
 void BatAdsImpl::Shutdown(ShutdownCallback callback) {
-  GetAds()->Shutdown(std::move(callback));
+  GetAds()->Shutdown(base::BindOnce(&BatAdsImpl::ShutdownAdsCallback,
+                                    weak_factory_.GetWeakPtr(),
+                                    std::move(callback)));
 }
 
 void BatAdsImpl::MaybeGetNotificationAd(
@@ -272,4 +282,18 @@ brave_ads::Ads* BatAdsImpl::GetAds() {
   return ads_instance_->GetAds();
 }
 
+BatAdsClientMojoBridge* BatAdsImpl::GetAdsClient() {
+  DCHECK(ads_instance_);
+  DCHECK(ads_instance_->GetAdsClient());
+  return ads_instance_->GetAdsClient();
+}
+
+void BatAdsImpl::ShutdownAdsCallback(ShutdownCallback callback,
+                                     const bool success) {
+  // The database is opened before ads are initialized, so close it even if
+  // ads failed to shut down. The browser process may delete it once we reply.
+  GetAdsClient()->ShutdownDatabase(
+      base::BindOnce(std::move(callback), success));
+}
+
 }  // namespace bat_ads
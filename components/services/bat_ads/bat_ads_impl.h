@@ -11,6 +11,7 @@
 #include <string>
 #include <vector>
 
+#include "base/memory/weak_ptr.h"
 #include "base/task/sequenced_task_runner.h"
 #include "base/values.h"
 #include "brave/components/brave_ads/common/interfaces/brave_ads.mojom-forward.h"
@@ -47,6 +48,7 @@ class BatAdsImpl : public mojom::BatAds {
   void SetFlags(brave_ads::mojom::FlagsPtr flags) override;
 
   void Initialize(brave_ads::mojom::WalletInfoPtr wallet,
+                  mojom::DatabaseFilesPtr database_files,
                   InitializeCallback callback) override;
   void Shutdown(ShutdownCallback callback) override;
 
@@ -115,9 +117,14 @@ class BatAdsImpl : public mojom::BatAds {
 
  private:
   brave_ads::Ads* GetAds();
+  BatAdsClientMojoBridge* GetAdsClient();
+
+  void ShutdownAdsCallback(ShutdownCallback callback, bool success);
 
   class AdsInstance;
   std::unique_ptr<AdsInstance, base::OnTaskRunnerDeleter> ads_instance_;
+
+  base::WeakPtrFactory<BatAdsImpl> weak_factory_{this};
 };
 
 }  // namespace bat_ads
@@ -0,0 +1,30 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_SQL_UTILS_DATABASE_ERROR_CALLBACK_H_
+#define BRAVE_COMPONENTS_SQL_UTILS_DATABASE_ERROR_CALLBACK_H_
+
+namespace base {
+class FilePath;
+}  // namespace base
+
+namespace sql {
+class Database;
+class Statement;
+}  // namespace sql
+
+namespace sql_utils {
+
+// Error callback for databases stored at |db_file_path| which recovers |db|
+// from corruption and asserts on unexpected errors in debug builds. Bind it
+// with |sql::Database::set_error_callback| before opening |db|.
+void DatabaseErrorCallback(sql::Database* db,
+                           const base::FilePath& db_file_path,
+                           int extended_error,
+                           sql::Statement* stmt);
+
+}  // namespace sql_utils
+
+#endif  // BRAVE_COMPONENTS_SQL_UTILS_DATABASE_ERROR_CALLBACK_H_
@@ -6,11 +6,12 @@
 #ifndef BRAVE_COMPONENTS_TIME_PERIOD_STORAGE_TIME_PERIOD_STORAGE_H_
 #define BRAVE_COMPONENTS_TIME_PERIOD_STORAGE_TIME_PERIOD_STORAGE_H_
 
-#include <list>
 #include <memory>
 
+#include "base/containers/circular_deque.h"
 #include "base/memory/raw_ptr.h"
 #include "base/time/time.h"
+#include "base/timer/timer.h"
 
 namespace base {
 class Clock;
@@ -21,6 +22,8 @@ class PrefService;
 // Mostly used by various P3A recorders - allows to track a sum of some
 // values added from time to time via |AddDelta| over the last predefined time
 // period. Requires |pref_name| to be already registered.
+// Changes are written to prefs after a short delay, so that frequent updates
+// only write once, and on destruction.
 class TimePeriodStorage {
  public:
   TimePeriodStorage(PrefService* prefs,
@@ -47,6 +50,9 @@ class TimePeriodStorage {
   uint64_t GetHighestValueInPeriod() const;
   bool IsOnePeriodPassed() const;
 
+  // Writes pending changes to prefs right away.
+  void Flush();
+
  protected:
   std::unique_ptr<base::Clock> clock_;
 
@@ -57,13 +63,17 @@ class TimePeriodStorage {
   };
   void FilterToPeriod();
   void Load();
+  // Schedules a write of |daily_values_| to prefs.
   void Save();
+  void WriteToPrefs();
 
   const raw_ptr<PrefService> prefs_;
   const char* pref_name_ = nullptr;
   size_t period_days_;
 
-  std::list<DailyValue> daily_values_;
+  // At most |period_days_| days, most recent first.
+  base::circular_deque<DailyValue> daily_values_;
+  base::OneShotTimer save_timer_;
 };
 
 #endif  // BRAVE_COMPONENTS_TIME_PERIOD_STORAGE_TIME_PERIOD_STORAGE_H_
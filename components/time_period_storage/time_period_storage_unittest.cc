@@ -10,6 +10,7 @@
 
 #include "base/memory/raw_ptr.h"
 #include "base/test/simple_test_clock.h"
+#include "base/test/task_environment.h"
 #include "base/time/time.h"
 #include "components/prefs/pref_registry_simple.h"
 #include "components/prefs/testing_pref_service.h"
@@ -31,6 +32,8 @@ class TimePeriodStorageTest : public ::testing::Test {
   }
 
  protected:
+  base::test::TaskEnvironment task_environment_{
+      base::test::TaskEnvironment::TimeSource::MOCK_TIME};
   raw_ptr<base::SimpleTestClock> clock_ = nullptr;
   TestingPrefServiceSimple pref_service_;
   std::unique_ptr<TimePeriodStorage> state_;
@@ -286,3 +289,48 @@ TEST_F(TimePeriodStorageTest, ReplaceIfGreaterForDate) {
   state_->ReplaceIfGreaterForDate(clock_->Now() - base::Days(31), 10);
   EXPECT_EQ(state_->GetPeriodSum(), 11U);
 }
+
+TEST_F(TimePeriodStorageTest, CoalescesPrefWrites) {
+  InitStorage(7);
+  state_->AddDelta(1);
+  state_->AddDelta(2);
+  state_->AddDelta(3);
+  EXPECT_EQ(state_->GetPeriodSum(), 6U);
+  EXPECT_TRUE(pref_service_.GetList(kPrefName).empty());
+
+  task_environment_.FastForwardBy(base::Seconds(10));
+  const base::Value::List& list = pref_service_.GetList(kPrefName);
+  ASSERT_EQ(list.size(), 1U);
+  EXPECT_EQ(list[0].GetDict().FindDouble("value"), 6);
+
+  state_->AddDelta(4);
+  state_->Flush();
+  EXPECT_EQ(pref_service_.GetList(kPrefName)[0].GetDict().FindDouble("value"),
+            10);
+
+  // Pending changes are written on destruction.
+  state_->AddDelta(5);
+  clock_ = nullptr;
+  state_.reset();
+  EXPECT_EQ(pref_service_.GetList(kPrefName)[0].GetDict().FindDouble("value"),
+            15);
+}
+
+TEST_F(TimePeriodStorageTest, IncrementsAcrossHours) {
+  constexpr int kIncrements = 100;
+  InitStorage(30);
+
+  for (int i = 0; i < kIncrements; ++i) {
+    state_->AddDelta(1);
+    if (i % 10 == 0) {
+      clock_->Advance(base::Hours(1));
+    }
+  }
+
+  EXPECT_EQ(state_->GetPeriodSum(), static_cast<uint64_t>(kIncrements));
+  EXPECT_TRUE(pref_service_.GetList(kPrefName).empty());
+
+  task_environment_.FastForwardBy(base::Seconds(10));
+  EXPECT_FALSE(pref_service_.GetList(kPrefName).empty());
+  EXPECT_EQ(state_->GetPeriodSum(), static_cast<uint64_t>(kIncrements));
+}
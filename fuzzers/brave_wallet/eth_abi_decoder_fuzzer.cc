@@ -0,0 +1,51 @@
+/* Copyright (c) 2023 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include <fuzzer/FuzzedDataProvider.h>
+
+#include <string>
+#include <vector>
+
+#include "base/logging.h"
+#include "brave/components/brave_wallet/browser/eth_abi_decoder.h"
+#include "brave/components/brave_wallet/browser/eth_data_parser.h"
+#include "brave/components/brave_wallet/browser/solana_instruction_data_decoder.h"
+#include "brave/components/brave_wallet/common/brave_wallet.mojom.h"
+
+struct Environment {
+  Environment() { logging::SetMinLogLevel(logging::LOG_FATAL); }
+};
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+  static Environment env;
+
+  static const char* const kTypes[] = {"address", "uint8",   "uint256",
+                                       "bool",    "bytes",   "address[]",
+                                       "uint160", "uint48"};
+
+  FuzzedDataProvider data_provider(data, size);
+
+  std::vector<std::string> types(
+      data_provider.ConsumeIntegralInRange<size_t>(0, 16));
+  for (auto& type : types) {
+    type = data_provider.PickValueInArray(kTypes);
+  }
+  const std::vector<uint8_t> input =
+      data_provider.ConsumeRemainingBytes<uint8_t>();
+
+  if (auto values = brave_wallet::ABIDecodeValues(types, input)) {
+    for (const auto& value : *values) {
+      value.ToString();
+    }
+  }
+  brave_wallet::ABIDecode(types, input);
+  brave_wallet::GetTransactionInfoFromData(input);
+
+  brave_wallet::solana_ins_data_decoder::Decode(
+      input, brave_wallet::mojom::kSolanaSystemProgramId);
+  brave_wallet::solana_ins_data_decoder::Decode(
+      input, brave_wallet::mojom::kSolanaTokenProgramId);
+  return 0;
+}
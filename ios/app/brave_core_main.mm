@@ -469,10 +469,12 @@ static bool CustomLogHandler(int severity,
 - (void)initializeP3AServiceForChannel:(NSString*)channel
                          weekOfInstall:(NSString*)weekOfInstall {
 #if BUILDFLAG(BRAVE_P3A_ENABLED)
+  base::FilePath user_data_dir;
+  base::PathService::Get(ios::DIR_USER_DATA, &user_data_dir);
   _p3a_service = base::MakeRefCounted<p3a::P3AService>(
       *GetApplicationContext()->GetLocalState(),
       base::SysNSStringToUTF8(channel), base::SysNSStringToUTF8(weekOfInstall),
-      p3a::P3AConfig::LoadFromCommandLine());
+      p3a::P3AConfig::LoadFromCommandLine(), user_data_dir);
   _p3a_service->InitCallbacks();
   _p3a_service->Init(GetApplicationContext()->GetSharedURLLoaderFactory());
   _histogram_braveizer = p3a::HistogramsBraveizer::Create();
@@ -79,7 +79,8 @@ std::unique_ptr<KeyedService> TxServiceFactory::BuildServiceInstanceFor(
   // TODO(apaymyshev): support bitcoin for ios.
   std::unique_ptr<TxService> tx_service(
       new TxService(json_rpc_service, /*bitcoin_wallet_service=*/nullptr,
-                    keyring_service, browser_state->GetPrefs()));
+                    keyring_service, browser_state->GetPrefs(),
+                    browser_state->GetStatePath()));
   return tx_service;
 }
 